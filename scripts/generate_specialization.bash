@@ -32,10 +32,18 @@ ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash abs KokkosBl
 ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash axpby KokkosBlas1_axpby KokkosBlas1_axpby_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
 ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash axpby KokkosBlas1_axpby_mv KokkosBlas1_axpby_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
 
+#copy
+${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash copy KokkosBlas1_copy KokkosBlas1_copy_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
+${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash copy KokkosBlas1_copy_mv KokkosBlas1_copy_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
+
 #dot
 ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash dot KokkosBlas1_dot KokkosBlas1_dot_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
 ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash dot KokkosBlas1_dot_mv KokkosBlas1_dot_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
 
+#iamax
+${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash iamax KokkosBlas1_iamax KokkosBlas1_iamax_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
+${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash iamax KokkosBlas1_iamax_mv KokkosBlas1_iamax_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
+
 #mult
 ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash mult KokkosBlas1_mult KokkosBlas1_mult_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
 ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash mult KokkosBlas1_mult_mv KokkosBlas1_mult_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
@@ -60,6 +68,10 @@ ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash nrminf Kokko
 ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash reciprocal KokkosBlas1_reciprocal KokkosBlas1_reciprocal_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
 ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash reciprocal KokkosBlas1_reciprocal_mv KokkosBlas1_reciprocal_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
 
+#rot
+${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash rot KokkosBlas1_rot KokkosBlas1_rot_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
+${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash rot KokkosBlas1_rot_mv KokkosBlas1_rot_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
+
 #scal
 ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash scal KokkosBlas1_scal KokkosBlas1_scal_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
 ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash scal KokkosBlas1_scal_mv KokkosBlas1_scal_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
@@ -68,6 +80,10 @@ ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash scal KokkosB
 ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash sum KokkosBlas1_sum KokkosBlas1_sum_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
 ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash sum KokkosBlas1_sum_mv KokkosBlas1_sum_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
 
+#swap
+${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash swap KokkosBlas1_swap KokkosBlas1_swap_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
+${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash swap KokkosBlas1_swap_mv KokkosBlas1_swap_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
+
 #update
 ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash update KokkosBlas1_update KokkosBlas1_update_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
 ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash update KokkosBlas1_update_mv KokkosBlas1_update_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
@@ -75,5 +91,26 @@ ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash update Kokko
 #gemv
 ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash gemv KokkosBlas2_gemv KokkosBlas2_gemv_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
 
+#ger
+${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash ger KokkosBlas2_ger KokkosBlas2_ger_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
+
+#symv
+${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash symv KokkosBlas2_symv KokkosBlas2_symv_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
+
+#syr
+${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash syr KokkosBlas2_syr KokkosBlas2_syr_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
+
+#trmv
+${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash trmv KokkosBlas2_trmv KokkosBlas2_trmv_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
+
 #gemm
 ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash gemm KokkosBlas3_gemm KokkosBlas3_gemm_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
+
+#syrk
+${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash syrk KokkosBlas3_syrk KokkosBlas3_syrk_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
+
+#trsm
+${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash trsm KokkosBlas3_trsm KokkosBlas3_trsm_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
+
+#trmm
+${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash trmm KokkosBlas3_trmm KokkosBlas3_trmm_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
@@ -0,0 +1,51 @@
+#ifndef __KOKKOSBATCHED_APPLY_Q_DECL_HPP__
+#define __KOKKOSBATCHED_APPLY_Q_DECL_HPP__
+
+
+#include "KokkosBatched_Vector.hpp"
+
+namespace KokkosBatched {
+  namespace Experimental {
+
+    ///
+    /// Apply Q from QR to B (ormqr/unmqr)
+    ///
+    /// A and t are the output of SerialQR/TeamQR. Implemented:
+    /// Left/NoTranspose  B := Q B
+    /// Left/Transpose    B := Q^H B (Q^T for real value types)
+    ///
+      
+    template<typename ArgSide,
+             typename ArgTrans,
+             typename ArgAlgo>
+    struct SerialApplyQ {
+      template<typename AViewType,
+               typename tViewType,
+               typename BViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const AViewType &A,
+             const tViewType &t,
+             const BViewType &B);
+    };       
+
+    template<typename MemberType,
+             typename ArgSide,
+             typename ArgTrans,
+             typename ArgAlgo>
+    struct TeamApplyQ {
+      template<typename AViewType,
+               typename tViewType,
+               typename BViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member, 
+             const AViewType &A,
+             const tViewType &t,
+             const BViewType &B);
+    };       
+      
+  }
+}
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef __KOKKOSBATCHED_APPLY_Q_SERIAL_IMPL_HPP__
+#define __KOKKOSBATCHED_APPLY_Q_SERIAL_IMPL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_ApplyQ_Serial_Internal.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+    ///
+    /// Serial Impl
+    /// ===========
+
+    ///
+    /// L/NT
+    ///
+
+    template<>
+    template<typename AViewType,
+             typename tViewType,
+             typename BViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialApplyQ<Side::Left,Trans::NoTranspose,Algo::ApplyQ::Unblocked>::
+    invoke(const AViewType &A,
+           const tViewType &t,
+           const BViewType &B) {
+      return SerialApplyQ_LeftBackwardInternal::invoke(B.extent(0), B.extent(1), t.extent(0),
+                                                       A.data(), A.stride_0(), A.stride_1(),
+                                                       t.data(), t.stride_0(),
+                                                       B.data(), B.stride_0(), B.stride_1());
+    }
+
+    ///
+    /// L/T
+    ///
+
+    template<>
+    template<typename AViewType,
+             typename tViewType,
+             typename BViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialApplyQ<Side::Left,Trans::Transpose,Algo::ApplyQ::Unblocked>::
+    invoke(const AViewType &A,
+           const tViewType &t,
+           const BViewType &B) {
+      return SerialApplyQ_LeftForwardInternal::invoke(B.extent(0), B.extent(1), t.extent(0),
+                                                      A.data(), A.stride_0(), A.stride_1(),
+                                                      t.data(), t.stride_0(),
+                                                      B.data(), B.stride_0(), B.stride_1());
+    }
+
+  }
+}
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef __KOKKOSBATCHED_APPLY_Q_SERIAL_INTERNAL_HPP__
+#define __KOKKOSBATCHED_APPLY_Q_SERIAL_INTERNAL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+#include "KokkosBatched_Householder_Serial_Internal.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+  
+    ///
+    /// Serial Internal Impl
+    /// ====================
+
+    ///
+    /// B := Q^H B = H(k-1)^H ... H(0)^H B
+    ///
+    struct SerialApplyQ_LeftForwardInternal {
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static int 
+      invoke(const int m, const int n, const int k,
+             const ValueType *__restrict__ A, const int as0, const int as1,
+             const ValueType *__restrict__ t, const int ts0,
+             /**/  ValueType *__restrict__ B, const int bs0, const int bs1) {
+        typedef Kokkos::Details::ArithTraits<ValueType> ats;
+
+        for (int p=0;p<k;++p) {
+          const int m_B2 = m-p-1;
+          SerialApplyLeftHouseholderInternal::invoke(m_B2, n, ats::conj(t[p*ts0]),
+                                                     A+(p+1)*as0+p*as1, as0,
+                                                     B+p*bs0, bs1,
+                                                     B+(p+1)*bs0, bs0, bs1);
+        }
+        return 0;
+      }
+    };
+
+    ///
+    /// B := Q B = H(0) ... H(k-1) B
+    ///
+    struct SerialApplyQ_LeftBackwardInternal {
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static int 
+      invoke(const int m, const int n, const int k,
+             const ValueType *__restrict__ A, const int as0, const int as1,
+             const ValueType *__restrict__ t, const int ts0,
+             /**/  ValueType *__restrict__ B, const int bs0, const int bs1) {
+        for (int p=(k-1);p>=0;--p) {
+          const int m_B2 = m-p-1;
+          SerialApplyLeftHouseholderInternal::invoke(m_B2, n, t[p*ts0],
+                                                     A+(p+1)*as0+p*as1, as0,
+                                                     B+p*bs0, bs1,
+                                                     B+(p+1)*bs0, bs0, bs1);
+        }
+        return 0;
+      }
+    };
+
+  }
+}
+
+#endif
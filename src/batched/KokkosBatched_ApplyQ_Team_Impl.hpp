@@ -0,0 +1,58 @@
+#ifndef __KOKKOSBATCHED_APPLY_Q_TEAM_IMPL_HPP__
+#define __KOKKOSBATCHED_APPLY_Q_TEAM_IMPL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_ApplyQ_Team_Internal.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+    ///
+    /// Team Impl
+    /// =========
+
+    ///
+    /// L/NT
+    ///
+    
+    template<typename MemberType>
+    struct TeamApplyQ<MemberType,Side::Left,Trans::NoTranspose,Algo::ApplyQ::Unblocked> {
+      template<typename AViewType,
+               typename tViewType,
+               typename BViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member, const AViewType &A, const tViewType &t, const BViewType &B) {
+        return TeamApplyQ_LeftBackwardInternal::invoke(member,
+                                                       B.extent(0), B.extent(1), t.extent(0),
+                                                       A.data(), A.stride_0(), A.stride_1(),
+                                                       t.data(), t.stride_0(),
+                                                       B.data(), B.stride_0(), B.stride_1());
+      }
+    };
+
+    ///
+    /// L/T
+    ///
+    
+    template<typename MemberType>
+    struct TeamApplyQ<MemberType,Side::Left,Trans::Transpose,Algo::ApplyQ::Unblocked> {
+      template<typename AViewType,
+               typename tViewType,
+               typename BViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member, const AViewType &A, const tViewType &t, const BViewType &B) {
+        return TeamApplyQ_LeftForwardInternal::invoke(member,
+                                                      B.extent(0), B.extent(1), t.extent(0),
+                                                      A.data(), A.stride_0(), A.stride_1(),
+                                                      t.data(), t.stride_0(),
+                                                      B.data(), B.stride_0(), B.stride_1());
+      }
+    };
+
+  }
+}
+
+#endif
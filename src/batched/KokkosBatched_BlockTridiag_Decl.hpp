@@ -0,0 +1,174 @@
+#ifndef __KOKKOSBATCHED_BLOCKTRIDIAG_DECL_HPP__
+#define __KOKKOSBATCHED_BLOCKTRIDIAG_DECL_HPP__
+
+
+#include "KokkosBatched_Vector.hpp"
+
+namespace KokkosBatched {
+  namespace Experimental {
+
+    ///
+    /// Block tridiagonal matrix
+    /// ========================
+    ///
+    /// A block tridiagonal matrix with m block rows of size bs x bs is stored
+    /// in three rank-3 views,
+    ///
+    ///   A(k,:,:), k = 0..m-1 : diagonal blocks
+    ///   B(k,:,:), k = 0..m-2 : super diagonal blocks, row k and column k+1
+    ///   C(k,:,:), k = 0..m-2 : sub diagonal blocks, row k+1 and column k
+    ///
+    /// With Vector<SIMD<T>,l> values, l independent block tridiagonal
+    /// matrices are interleaved in the compact layout, one per lane.
+    ///
+
+    ///
+    /// Factorization (block Thomas algorithm without pivoting across blocks)
+    ///
+    /// On return A(k) holds L_k U_k of the k-th Schur complement, B(k) holds
+    /// L_k^{-1} B(k) and C(k) holds C(k) U_k^{-1}. Before A(k), k = 0..m-2, is
+    /// factored, its diagonal is shifted away from zero by |tiny| (see
+    /// AddRadial) to guard against breakdown; the last block is not shifted.
+    ///
+
+    template<typename ArgAlgo>
+    struct SerialBlockTridiagFactorize {
+      template<typename AViewType,
+               typename BViewType,
+               typename CViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const AViewType &A,
+             const BViewType &B,
+             const CViewType &C,
+             const typename MagnitudeScalarType<typename AViewType::non_const_value_type>::type tiny = 0);
+    };
+
+    template<typename MemberType,
+             typename ArgAlgo>
+    struct TeamBlockTridiagFactorize {
+      template<typename AViewType,
+               typename BViewType,
+               typename CViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const AViewType &A,
+             const BViewType &B,
+             const CViewType &C,
+             const typename MagnitudeScalarType<typename AViewType::non_const_value_type>::type tiny = 0);
+    };
+
+    ///
+    /// Solve with the factors from BlockTridiagFactorize
+    ///
+    /// X(k,:,:) is the k-th block row (bs x nrhs) of the right hand sides and
+    /// is overwritten by the solution.
+    ///
+
+    template<typename ArgAlgo>
+    struct SerialBlockTridiagSolve {
+      template<typename AViewType,
+               typename BViewType,
+               typename CViewType,
+               typename XViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const AViewType &A,
+             const BViewType &B,
+             const CViewType &C,
+             const XViewType &X);
+    };
+
+    template<typename MemberType,
+             typename ArgAlgo>
+    struct TeamBlockTridiagSolve {
+      template<typename AViewType,
+               typename BViewType,
+               typename CViewType,
+               typename XViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const AViewType &A,
+             const BViewType &B,
+             const CViewType &C,
+             const XViewType &X);
+    };
+
+    ///
+    /// Extraction from a block CRS matrix
+    ///
+    /// line(k), k = 0..m-1, lists the block rows of one line partition in
+    /// the order they appear along the line. The nonzero blocks coupling
+    /// line(k) with line(k-1), line(k) and line(k+1) are copied into C(k-1),
+    /// A(k) and B(k); couplings that are not stored are set to zero and
+    /// blocks coupling to rows outside of the line are dropped. For the
+    /// compact SIMD layout, the line is written into lane v of A, B and C.
+    ///
+    /// The matrix is given as rowptr/colidx with rank-3 values, where
+    /// values(c,:,:) is the c-th stored block. SerialExtractBlockTridiag also
+    /// takes a KokkosSparse::Experimental::BlockCrsMatrix, whose block size
+    /// must match A.extent(1).
+    ///
+
+    struct SerialExtractBlockTridiag {
+      template<typename RowPtrViewType,
+               typename ColIdxViewType,
+               typename ValuesViewType,
+               typename LineViewType,
+               typename AViewType,
+               typename BViewType,
+               typename CViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const RowPtrViewType &rowptr,
+             const ColIdxViewType &colidx,
+             const ValuesViewType &values,
+             const LineViewType &line,
+             const int v,
+             const AViewType &A,
+             const BViewType &B,
+             const CViewType &C);
+
+      template<typename BlockCrsMatrixType,
+               typename LineViewType,
+               typename AViewType,
+               typename BViewType,
+               typename CViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const BlockCrsMatrixType &T,
+             const LineViewType &line,
+             const int v,
+             const AViewType &A,
+             const BViewType &B,
+             const CViewType &C);
+    };
+
+    template<typename MemberType>
+    struct TeamExtractBlockTridiag {
+      template<typename RowPtrViewType,
+               typename ColIdxViewType,
+               typename ValuesViewType,
+               typename LineViewType,
+               typename AViewType,
+               typename BViewType,
+               typename CViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const RowPtrViewType &rowptr,
+             const ColIdxViewType &colidx,
+             const ValuesViewType &values,
+             const LineViewType &line,
+             const int v,
+             const AViewType &A,
+             const BViewType &B,
+             const CViewType &C);
+    };
+
+  }
+}
+
+#endif
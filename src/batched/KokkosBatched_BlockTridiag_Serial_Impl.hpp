@@ -0,0 +1,358 @@
+#ifndef __KOKKOSBATCHED_BLOCKTRIDIAG_SERIAL_IMPL_HPP__
+#define __KOKKOSBATCHED_BLOCKTRIDIAG_SERIAL_IMPL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_AddRadial_Decl.hpp"
+#include "KokkosBatched_AddRadial_Impl.hpp"
+#include "KokkosBatched_LU_Decl.hpp"
+#include "KokkosBatched_LU_Serial_Impl.hpp"
+#include "KokkosBatched_Trsm_Decl.hpp"
+#include "KokkosBatched_Trsm_Serial_Impl.hpp"
+#include "KokkosBatched_Gemm_Decl.hpp"
+#include "KokkosBatched_Gemm_Serial_Impl.hpp"
+
+namespace KokkosBatched {
+  namespace Experimental {
+    ///
+    /// Serial Impl
+    /// ===========
+
+    template<typename ArgAlgoLU,
+             typename ArgAlgoTrsm,
+             typename ArgAlgoGemm>
+    struct SerialBlockTridiagFactorizeImpl {
+      template<typename AViewType,
+               typename BViewType,
+               typename CViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const AViewType &A,
+             const BViewType &B,
+             const CViewType &C,
+             const typename MagnitudeScalarType<typename AViewType::non_const_value_type>::type tiny) {
+        static_assert(AViewType::rank == 3, "A should have three dimensions");
+        static_assert(BViewType::rank == 3, "B should have three dimensions");
+        static_assert(CViewType::rank == 3, "C should have three dimensions");
+
+        typedef typename MagnitudeScalarType<typename AViewType::non_const_value_type>::type mag_type;
+        const mag_type one(1.0), minus_one(-1.0);
+
+        const int m = A.extent(0);
+        if (m <= 0) return 0;
+
+        int r_val = 0;
+        const int kend = m - 1;
+        for (int k=0;k<kend;++k) {
+          auto AA = Kokkos::subview(A, k,   Kokkos::ALL(), Kokkos::ALL());
+          auto BB = Kokkos::subview(B, k,   Kokkos::ALL(), Kokkos::ALL());
+          auto CC = Kokkos::subview(C, k,   Kokkos::ALL(), Kokkos::ALL());
+          auto DD = Kokkos::subview(A, k+1, Kokkos::ALL(), Kokkos::ALL());
+
+          // A_k = L_k U_k, B_k := L_k^{-1} B_k, C_k := C_k U_k^{-1}
+          SerialAddRadial::invoke(tiny, AA);
+          r_val |= SerialLU<ArgAlgoLU>::invoke(AA);
+          SerialTrsm<Side::Left,Uplo::Lower,Trans::NoTranspose,Diag::Unit,ArgAlgoTrsm>
+            ::invoke(one, AA, BB);
+          SerialTrsm<Side::Right,Uplo::Upper,Trans::NoTranspose,Diag::NonUnit,ArgAlgoTrsm>
+            ::invoke(one, AA, CC);
+
+          // Schur complement A_{k+1} := A_{k+1} - C_k B_k
+          SerialGemm<Trans::NoTranspose,Trans::NoTranspose,ArgAlgoGemm>
+            ::invoke(minus_one, CC, BB, one, DD);
+        }
+        {
+          auto AA = Kokkos::subview(A, kend, Kokkos::ALL(), Kokkos::ALL());
+          r_val |= SerialLU<ArgAlgoLU>::invoke(AA);
+        }
+        return r_val;
+      }
+    };
+
+    template<typename ArgAlgoTrsm,
+             typename ArgAlgoGemm>
+    struct SerialBlockTridiagSolveImpl {
+      template<typename AViewType,
+               typename BViewType,
+               typename CViewType,
+               typename XViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const AViewType &A,
+             const BViewType &B,
+             const CViewType &C,
+             const XViewType &X) {
+        static_assert(AViewType::rank == 3, "A should have three dimensions");
+        static_assert(BViewType::rank == 3, "B should have three dimensions");
+        static_assert(CViewType::rank == 3, "C should have three dimensions");
+        static_assert(XViewType::rank == 3, "X should have three dimensions");
+        assert(A.extent(0) == X.extent(0));
+
+        typedef typename MagnitudeScalarType<typename AViewType::non_const_value_type>::type mag_type;
+        const mag_type one(1.0), minus_one(-1.0);
+
+        const int m = A.extent(0);
+        if (m <= 0) return 0;
+
+        ///
+        /// forward substitution
+        ///
+        for (int k=0;k<m;++k) {
+          auto LT = Kokkos::subview(A, k, Kokkos::ALL(), Kokkos::ALL());
+          auto xt = Kokkos::subview(X, k, Kokkos::ALL(), Kokkos::ALL());
+
+          SerialTrsm<Side::Left,Uplo::Lower,Trans::NoTranspose,Diag::Unit,ArgAlgoTrsm>
+            ::invoke(one, LT, xt);
+          if (k+1 < m) {
+            auto LB = Kokkos::subview(C, k,   Kokkos::ALL(), Kokkos::ALL());
+            auto xb = Kokkos::subview(X, k+1, Kokkos::ALL(), Kokkos::ALL());
+            SerialGemm<Trans::NoTranspose,Trans::NoTranspose,ArgAlgoGemm>
+              ::invoke(minus_one, LB, xt, one, xb);
+          }
+        }
+
+        ///
+        /// backward substitution
+        ///
+        for (int k=m-1;k>=0;--k) {
+          auto UB = Kokkos::subview(A, k, Kokkos::ALL(), Kokkos::ALL());
+          auto xb = Kokkos::subview(X, k, Kokkos::ALL(), Kokkos::ALL());
+
+          SerialTrsm<Side::Left,Uplo::Upper,Trans::NoTranspose,Diag::NonUnit,ArgAlgoTrsm>
+            ::invoke(one, UB, xb);
+          if (k > 0) {
+            auto UT = Kokkos::subview(B, k-1, Kokkos::ALL(), Kokkos::ALL());
+            auto xt = Kokkos::subview(X, k-1, Kokkos::ALL(), Kokkos::ALL());
+            SerialGemm<Trans::NoTranspose,Trans::NoTranspose,ArgAlgoGemm>
+              ::invoke(minus_one, UT, xb, one, xt);
+          }
+        }
+        return 0;
+      }
+    };
+
+    template<>
+    template<typename AViewType,
+             typename BViewType,
+             typename CViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialBlockTridiagFactorize<Algo::BlockTridiag::Unblocked>::
+    invoke(const AViewType &A,
+           const BViewType &B,
+           const CViewType &C,
+           const typename MagnitudeScalarType<typename AViewType::non_const_value_type>::type tiny) {
+      return SerialBlockTridiagFactorizeImpl
+        <Algo::LU::Unblocked,Algo::Trsm::Unblocked,Algo::Gemm::Unblocked>::invoke(A, B, C, tiny);
+    }
+
+    template<>
+    template<typename AViewType,
+             typename BViewType,
+             typename CViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialBlockTridiagFactorize<Algo::BlockTridiag::Blocked>::
+    invoke(const AViewType &A,
+           const BViewType &B,
+           const CViewType &C,
+           const typename MagnitudeScalarType<typename AViewType::non_const_value_type>::type tiny) {
+      return SerialBlockTridiagFactorizeImpl
+        <Algo::LU::Blocked,Algo::Trsm::Blocked,Algo::Gemm::Blocked>::invoke(A, B, C, tiny);
+    }
+
+    template<>
+    template<typename AViewType,
+             typename BViewType,
+             typename CViewType,
+             typename XViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialBlockTridiagSolve<Algo::BlockTridiag::Unblocked>::
+    invoke(const AViewType &A,
+           const BViewType &B,
+           const CViewType &C,
+           const XViewType &X) {
+      return SerialBlockTridiagSolveImpl
+        <Algo::Trsm::Unblocked,Algo::Gemm::Unblocked>::invoke(A, B, C, X);
+    }
+
+    template<>
+    template<typename AViewType,
+             typename BViewType,
+             typename CViewType,
+             typename XViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialBlockTridiagSolve<Algo::BlockTridiag::Blocked>::
+    invoke(const AViewType &A,
+           const BViewType &B,
+           const CViewType &C,
+           const XViewType &X) {
+      return SerialBlockTridiagSolveImpl
+        <Algo::Trsm::Blocked,Algo::Gemm::Blocked>::invoke(A, B, C, X);
+    }
+
+    ///
+    /// Extraction
+    ///
+
+    /// Stored block c of a block row as a bs x bs array; the rank-3 values
+    /// are indexed by c alone
+    template<typename ValuesViewType>
+    struct ExtractBlockTridiagValues {
+      ValuesViewType _values;
+
+      KOKKOS_INLINE_FUNCTION
+      ExtractBlockTridiagValues(const ValuesViewType &values)
+        : _values(values) {}
+
+      KOKKOS_INLINE_FUNCTION
+      typename ValuesViewType::const_value_type&
+      operator()(const int /* row */, const int c, const int i, const int j) const {
+        return _values(c,i,j);
+      }
+    };
+
+    /// BlockCrsMatrix keeps the values of a block row with point rows
+    /// outermost: row i of every block of the block row, then row i+1
+    template<typename RowPtrViewType,
+             typename ValuesViewType>
+    struct ExtractBlockTridiagBlockCrsValues {
+      typedef typename RowPtrViewType::non_const_value_type size_type;
+
+      RowPtrViewType _rowptr;
+      ValuesViewType _values;
+      int _bs;
+
+      KOKKOS_INLINE_FUNCTION
+      ExtractBlockTridiagBlockCrsValues(const RowPtrViewType &rowptr,
+                                        const ValuesViewType &values,
+                                        const int bs)
+        : _rowptr(rowptr), _values(values), _bs(bs) {}
+
+      KOKKOS_INLINE_FUNCTION
+      typename ValuesViewType::const_value_type&
+      operator()(const int row, const int c, const int i, const int j) const {
+        const size_type start = _rowptr(row), length = _rowptr(row+1) - start;
+        return _values((start*_bs + i*length + (c - start))*_bs + j);
+      }
+    };
+
+    struct SerialExtractBlockTridiagInternal {
+      // copy the couplings of block row line(k) into lane v of A(k), B(k) and C(k-1)
+      template<typename RowPtrViewType,
+               typename ColIdxViewType,
+               typename BlockValuesType,
+               typename LineViewType,
+               typename AViewType,
+               typename BViewType,
+               typename CViewType>
+      KOKKOS_INLINE_FUNCTION
+      static void
+      invoke(const int k,
+             const RowPtrViewType &rowptr,
+             const ColIdxViewType &colidx,
+             const BlockValuesType &values,
+             const LineViewType &line,
+             const int v,
+             const AViewType &A,
+             const BViewType &B,
+             const CViewType &C) {
+        typedef PivotTraits<typename AViewType::non_const_value_type> traits;
+        typedef typename traits::value_type value_type;
+
+        const int m = line.extent(0), bs = A.extent(1);
+        const int row = line(k);
+        const int prev = (k > 0   ? int(line(k-1)) : -1);
+        const int next = (k+1 < m ? int(line(k+1)) : -1);
+
+        for (int ii=0;ii<bs;++ii)
+          for (int jj=0;jj<bs;++jj) {
+            traits::value(A(k,ii,jj),v) = value_type(0);
+            if (next >= 0) traits::value(B(k,  ii,jj),v) = value_type(0);
+            if (prev >= 0) traits::value(C(k-1,ii,jj),v) = value_type(0);
+          }
+
+        const int cbeg = rowptr(row), cend = rowptr(row+1);
+        for (int c=cbeg;c<cend;++c) {
+          const int col = colidx(c);
+          if (col == row) {
+            for (int ii=0;ii<bs;++ii)
+              for (int jj=0;jj<bs;++jj)
+                traits::value(A(k,ii,jj),v) = values(row,c,ii,jj);
+          } else if (col == next) {
+            for (int ii=0;ii<bs;++ii)
+              for (int jj=0;jj<bs;++jj)
+                traits::value(B(k,ii,jj),v) = values(row,c,ii,jj);
+          } else if (col == prev) {
+            for (int ii=0;ii<bs;++ii)
+              for (int jj=0;jj<bs;++jj)
+                traits::value(C(k-1,ii,jj),v) = values(row,c,ii,jj);
+          }
+        }
+      }
+    };
+
+    template<typename RowPtrViewType,
+             typename ColIdxViewType,
+             typename ValuesViewType,
+             typename LineViewType,
+             typename AViewType,
+             typename BViewType,
+             typename CViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialExtractBlockTridiag::
+    invoke(const RowPtrViewType &rowptr,
+           const ColIdxViewType &colidx,
+           const ValuesViewType &values,
+           const LineViewType &line,
+           const int v,
+           const AViewType &A,
+           const BViewType &B,
+           const CViewType &C) {
+      static_assert(ValuesViewType::rank == 3, "values should have three dimensions");
+      static_assert(LineViewType::rank == 1, "line should have one dimension");
+      assert(line.extent(0) == A.extent(0));
+
+      const ExtractBlockTridiagValues<ValuesViewType> blocks(values);
+
+      const int m = line.extent(0);
+      for (int k=0;k<m;++k)
+        SerialExtractBlockTridiagInternal::invoke(k, rowptr, colidx, blocks, line, v, A, B, C);
+      return 0;
+    }
+
+    template<typename BlockCrsMatrixType,
+             typename LineViewType,
+             typename AViewType,
+             typename BViewType,
+             typename CViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialExtractBlockTridiag::
+    invoke(const BlockCrsMatrixType &T,
+           const LineViewType &line,
+           const int v,
+           const AViewType &A,
+           const BViewType &B,
+           const CViewType &C) {
+      static_assert(LineViewType::rank == 1, "line should have one dimension");
+      assert(line.extent(0) == A.extent(0));
+      assert(int(T.blockDim()) == int(A.extent(1)));
+
+      const ExtractBlockTridiagBlockCrsValues
+        <typename BlockCrsMatrixType::row_map_type,
+         typename BlockCrsMatrixType::values_type> blocks(T.graph.row_map, T.values, T.blockDim());
+
+      const int m = line.extent(0);
+      for (int k=0;k<m;++k)
+        SerialExtractBlockTridiagInternal::invoke(k, T.graph.row_map, T.graph.entries, blocks, line, v, A, B, C);
+      return 0;
+    }
+
+  }
+}
+
+#endif
@@ -0,0 +1,257 @@
+#ifndef __KOKKOSBATCHED_BLOCKTRIDIAG_TEAM_IMPL_HPP__
+#define __KOKKOSBATCHED_BLOCKTRIDIAG_TEAM_IMPL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_BlockTridiag_Serial_Impl.hpp"
+#include "KokkosBatched_AddRadial_Decl.hpp"
+#include "KokkosBatched_AddRadial_Impl.hpp"
+#include "KokkosBatched_LU_Decl.hpp"
+#include "KokkosBatched_LU_Team_Impl.hpp"
+#include "KokkosBatched_Trsm_Decl.hpp"
+#include "KokkosBatched_Trsm_Team_Impl.hpp"
+#include "KokkosBatched_Gemm_Decl.hpp"
+#include "KokkosBatched_Gemm_Team_Impl.hpp"
+
+namespace KokkosBatched {
+  namespace Experimental {
+    ///
+    /// Team Impl
+    /// =========
+
+    template<typename MemberType,
+             typename ArgAlgoLU,
+             typename ArgAlgoTrsm,
+             typename ArgAlgoGemm>
+    struct TeamBlockTridiagFactorizeImpl {
+      template<typename AViewType,
+               typename BViewType,
+               typename CViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const AViewType &A,
+             const BViewType &B,
+             const CViewType &C,
+             const typename MagnitudeScalarType<typename AViewType::non_const_value_type>::type tiny) {
+        static_assert(AViewType::rank == 3, "A should have three dimensions");
+        static_assert(BViewType::rank == 3, "B should have three dimensions");
+        static_assert(CViewType::rank == 3, "C should have three dimensions");
+
+        typedef typename MagnitudeScalarType<typename AViewType::non_const_value_type>::type mag_type;
+        const mag_type one(1.0), minus_one(-1.0);
+
+        const int m = A.extent(0);
+        if (m <= 0) return 0;
+
+        int r_val = 0;
+        const int kend = m - 1;
+        for (int k=0;k<kend;++k) {
+          auto AA = Kokkos::subview(A, k,   Kokkos::ALL(), Kokkos::ALL());
+          auto BB = Kokkos::subview(B, k,   Kokkos::ALL(), Kokkos::ALL());
+          auto CC = Kokkos::subview(C, k,   Kokkos::ALL(), Kokkos::ALL());
+          auto DD = Kokkos::subview(A, k+1, Kokkos::ALL(), Kokkos::ALL());
+
+          // A_k = L_k U_k, B_k := L_k^{-1} B_k, C_k := C_k U_k^{-1}
+          TeamAddRadial<MemberType>::invoke(member, tiny, AA);
+          member.team_barrier();
+          r_val |= TeamLU<MemberType,ArgAlgoLU>::invoke(member, AA);
+          member.team_barrier();
+          TeamTrsm<MemberType,Side::Left,Uplo::Lower,Trans::NoTranspose,Diag::Unit,ArgAlgoTrsm>
+            ::invoke(member, one, AA, BB);
+          TeamTrsm<MemberType,Side::Right,Uplo::Upper,Trans::NoTranspose,Diag::NonUnit,ArgAlgoTrsm>
+            ::invoke(member, one, AA, CC);
+          member.team_barrier();
+
+          // Schur complement A_{k+1} := A_{k+1} - C_k B_k
+          TeamGemm<MemberType,Trans::NoTranspose,Trans::NoTranspose,ArgAlgoGemm>
+            ::invoke(member, minus_one, CC, BB, one, DD);
+          member.team_barrier();
+        }
+        {
+          auto AA = Kokkos::subview(A, kend, Kokkos::ALL(), Kokkos::ALL());
+          r_val |= TeamLU<MemberType,ArgAlgoLU>::invoke(member, AA);
+        }
+        return r_val;
+      }
+    };
+
+    template<typename MemberType,
+             typename ArgAlgoTrsm,
+             typename ArgAlgoGemm>
+    struct TeamBlockTridiagSolveImpl {
+      template<typename AViewType,
+               typename BViewType,
+               typename CViewType,
+               typename XViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const AViewType &A,
+             const BViewType &B,
+             const CViewType &C,
+             const XViewType &X) {
+        static_assert(AViewType::rank == 3, "A should have three dimensions");
+        static_assert(BViewType::rank == 3, "B should have three dimensions");
+        static_assert(CViewType::rank == 3, "C should have three dimensions");
+        static_assert(XViewType::rank == 3, "X should have three dimensions");
+        assert(A.extent(0) == X.extent(0));
+
+        typedef typename MagnitudeScalarType<typename AViewType::non_const_value_type>::type mag_type;
+        const mag_type one(1.0), minus_one(-1.0);
+
+        const int m = A.extent(0);
+        if (m <= 0) return 0;
+
+        ///
+        /// forward substitution
+        ///
+        for (int k=0;k<m;++k) {
+          auto LT = Kokkos::subview(A, k, Kokkos::ALL(), Kokkos::ALL());
+          auto xt = Kokkos::subview(X, k, Kokkos::ALL(), Kokkos::ALL());
+
+          TeamTrsm<MemberType,Side::Left,Uplo::Lower,Trans::NoTranspose,Diag::Unit,ArgAlgoTrsm>
+            ::invoke(member, one, LT, xt);
+          member.team_barrier();
+          if (k+1 < m) {
+            auto LB = Kokkos::subview(C, k,   Kokkos::ALL(), Kokkos::ALL());
+            auto xb = Kokkos::subview(X, k+1, Kokkos::ALL(), Kokkos::ALL());
+            TeamGemm<MemberType,Trans::NoTranspose,Trans::NoTranspose,ArgAlgoGemm>
+              ::invoke(member, minus_one, LB, xt, one, xb);
+            member.team_barrier();
+          }
+        }
+
+        ///
+        /// backward substitution
+        ///
+        for (int k=m-1;k>=0;--k) {
+          auto UB = Kokkos::subview(A, k, Kokkos::ALL(), Kokkos::ALL());
+          auto xb = Kokkos::subview(X, k, Kokkos::ALL(), Kokkos::ALL());
+
+          TeamTrsm<MemberType,Side::Left,Uplo::Upper,Trans::NoTranspose,Diag::NonUnit,ArgAlgoTrsm>
+            ::invoke(member, one, UB, xb);
+          member.team_barrier();
+          if (k > 0) {
+            auto UT = Kokkos::subview(B, k-1, Kokkos::ALL(), Kokkos::ALL());
+            auto xt = Kokkos::subview(X, k-1, Kokkos::ALL(), Kokkos::ALL());
+            TeamGemm<MemberType,Trans::NoTranspose,Trans::NoTranspose,ArgAlgoGemm>
+              ::invoke(member, minus_one, UT, xb, one, xt);
+            member.team_barrier();
+          }
+        }
+        return 0;
+      }
+    };
+
+    template<typename MemberType>
+    struct TeamBlockTridiagFactorize<MemberType,Algo::BlockTridiag::Unblocked> {
+      template<typename AViewType,
+               typename BViewType,
+               typename CViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const AViewType &A,
+             const BViewType &B,
+             const CViewType &C,
+             const typename MagnitudeScalarType<typename AViewType::non_const_value_type>::type tiny = 0) {
+        return TeamBlockTridiagFactorizeImpl
+          <MemberType,Algo::LU::Unblocked,Algo::Trsm::Unblocked,Algo::Gemm::Unblocked>::invoke(member, A, B, C, tiny);
+      }
+    };
+
+    template<typename MemberType>
+    struct TeamBlockTridiagFactorize<MemberType,Algo::BlockTridiag::Blocked> {
+      template<typename AViewType,
+               typename BViewType,
+               typename CViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const AViewType &A,
+             const BViewType &B,
+             const CViewType &C,
+             const typename MagnitudeScalarType<typename AViewType::non_const_value_type>::type tiny = 0) {
+        return TeamBlockTridiagFactorizeImpl
+          <MemberType,Algo::LU::Blocked,Algo::Trsm::Blocked,Algo::Gemm::Blocked>::invoke(member, A, B, C, tiny);
+      }
+    };
+
+    template<typename MemberType>
+    struct TeamBlockTridiagSolve<MemberType,Algo::BlockTridiag::Unblocked> {
+      template<typename AViewType,
+               typename BViewType,
+               typename CViewType,
+               typename XViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const AViewType &A,
+             const BViewType &B,
+             const CViewType &C,
+             const XViewType &X) {
+        return TeamBlockTridiagSolveImpl
+          <MemberType,Algo::Trsm::Unblocked,Algo::Gemm::Unblocked>::invoke(member, A, B, C, X);
+      }
+    };
+
+    template<typename MemberType>
+    struct TeamBlockTridiagSolve<MemberType,Algo::BlockTridiag::Blocked> {
+      template<typename AViewType,
+               typename BViewType,
+               typename CViewType,
+               typename XViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const AViewType &A,
+             const BViewType &B,
+             const CViewType &C,
+             const XViewType &X) {
+        return TeamBlockTridiagSolveImpl
+          <MemberType,Algo::Trsm::Blocked,Algo::Gemm::Blocked>::invoke(member, A, B, C, X);
+      }
+    };
+
+    ///
+    /// Extraction; block rows along the line are distributed over the team
+    ///
+
+    template<typename MemberType>
+    template<typename RowPtrViewType,
+             typename ColIdxViewType,
+             typename ValuesViewType,
+             typename LineViewType,
+             typename AViewType,
+             typename BViewType,
+             typename CViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    TeamExtractBlockTridiag<MemberType>::
+    invoke(const MemberType &member,
+           const RowPtrViewType &rowptr,
+           const ColIdxViewType &colidx,
+           const ValuesViewType &values,
+           const LineViewType &line,
+           const int v,
+           const AViewType &A,
+           const BViewType &B,
+           const CViewType &C) {
+      static_assert(ValuesViewType::rank == 3, "values should have three dimensions");
+      static_assert(LineViewType::rank == 1, "line should have one dimension");
+      assert(line.extent(0) == A.extent(0));
+
+      const ExtractBlockTridiagValues<ValuesViewType> blocks(values);
+
+      Kokkos::parallel_for
+        (Kokkos::TeamThreadRange(member,0,line.extent(0)),[&](const int &k) {
+          SerialExtractBlockTridiagInternal::invoke(k, rowptr, colidx, blocks, line, v, A, B, C);
+        });
+      return 0;
+    }
+
+  }
+}
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef __KOKKOSBATCHED_CHOLESKY_DECL_HPP__
+#define __KOKKOSBATCHED_CHOLESKY_DECL_HPP__
+
+
+#include "KokkosBatched_Vector.hpp"
+
+namespace KokkosBatched {
+  namespace Experimental {
+
+    ///
+    /// Cholesky factorization A = L L^H (potrf, lower)
+    ///
+    /// Only the lower triangle of A is referenced and overwritten by L. A
+    /// nonzero return value k indicates that the leading minor of order k is
+    /// not positive definite (in at least one lane for SIMD vectors).
+    ///
+      
+    template<typename ArgAlgo>
+    struct SerialCholesky {
+      template<typename AViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const AViewType &A);
+    };       
+
+    template<typename MemberType,
+             typename ArgAlgo>
+    struct TeamCholesky {
+      template<typename AViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member, 
+             const AViewType &A);
+    };       
+
+    ///
+    /// Solve L L^H x = b with the factor from Cholesky (potrs); b is
+    /// overwritten by x
+    ///
+
+    template<typename ArgAlgo>
+    struct SerialCholeskySolve {
+      template<typename AViewType,
+               typename bViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const AViewType &A,
+             const bViewType &b);
+    };       
+
+    template<typename MemberType,
+             typename ArgAlgo>
+    struct TeamCholeskySolve {
+      template<typename AViewType,
+               typename bViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member, 
+             const AViewType &A,
+             const bViewType &b);
+    };       
+      
+  }
+}
+
+#endif
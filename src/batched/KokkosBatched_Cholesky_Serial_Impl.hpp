@@ -0,0 +1,43 @@
+#ifndef __KOKKOSBATCHED_CHOLESKY_SERIAL_IMPL_HPP__
+#define __KOKKOSBATCHED_CHOLESKY_SERIAL_IMPL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Cholesky_Serial_Internal.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+    ///
+    /// Serial Impl
+    /// ===========
+
+    template<>
+    template<typename AViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialCholesky<Algo::Cholesky::Unblocked>::
+    invoke(const AViewType &A) {
+      assert(A.extent(0)==A.extent(1));
+      return SerialCholeskyInternal<Algo::Cholesky::Unblocked>::invoke(A.extent(0),
+                                                                      A.data(), A.stride_0(), A.stride_1());
+    }
+
+    template<>
+    template<typename AViewType,
+             typename bViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialCholeskySolve<Algo::Cholesky::Unblocked>::
+    invoke(const AViewType &A,
+           const bViewType &b) {
+      static_assert(bViewType::rank == 1, "b should have one dimension");
+      return SerialCholeskySolveInternal::invoke(A.extent(0),
+                                                 A.data(), A.stride_0(), A.stride_1(),
+                                                 b.data(), b.stride_0());
+    }
+
+  }
+}
+
+#endif
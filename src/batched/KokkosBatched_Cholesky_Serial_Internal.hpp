@@ -0,0 +1,125 @@
+#ifndef __KOKKOSBATCHED_CHOLESKY_SERIAL_INTERNAL_HPP__
+#define __KOKKOSBATCHED_CHOLESKY_SERIAL_INTERNAL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+#include "KokkosBatched_Pivot_Internal.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+  
+    ///
+    /// Serial Internal Impl
+    /// ====================
+
+    struct SerialCholeskyCheckInternal {
+      // returns 1 if the real part of the diagonal is not positive in any lane
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static int 
+      invoke(const ValueType &alpha11) {
+        typedef PivotTraits<ValueType> traits;
+        typedef Kokkos::Details::ArithTraits<typename traits::value_type> ats;
+        
+        int r_val = 0;
+        for (int v=0;v<traits::vector_length;++v)
+          r_val |= !(ats::real(traits::value(alpha11, v)) > 0);
+        return r_val;
+      }
+    };
+
+    template<typename AlgoType>
+    struct SerialCholeskyInternal {
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static int 
+      invoke(const int m,
+             ValueType *__restrict__ A, const int as0, const int as1);
+    };
+
+    template<>
+    template<typename ValueType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialCholeskyInternal<Algo::Cholesky::Unblocked>::
+    invoke(const int m,
+           ValueType *__restrict__ A, const int as0, const int as1) {
+      typedef Kokkos::Details::ArithTraits<ValueType> ats;
+
+      int r_val = 0;
+      for (int p=0;p<m;++p) {
+        const int iend = m-p-1;
+
+        ValueType
+          *__restrict__ a21  = A+(p+1)*as0+(p  )*as1,
+          *__restrict__ A22  = A+(p+1)*as0+(p+1)*as1;
+
+        ValueType &alpha11_reference = A[p*as0+p*as1];
+        if (r_val == 0 && SerialCholeskyCheckInternal::invoke(alpha11_reference)) r_val = p+1;
+        alpha11_reference = ats::sqrt(alpha11_reference);
+
+        const ValueType
+          alpha11 = alpha11_reference;
+
+        for (int i=0;i<iend;++i)
+          a21[i*as0] /= alpha11;
+
+        // lower triangle of A22 -= a21 a21^H
+        for (int i=0;i<iend;++i) {
+          const ValueType alpha21 = a21[i*as0];
+          for (int j=0;j<=i;++j)
+            A22[i*as0+j*as1] -= alpha21 * ats::conj(a21[j*as0]);
+        }
+      }
+      return r_val;
+    }
+
+    struct SerialCholeskySolveInternal {
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static int 
+      invoke(const int m,
+             const ValueType *__restrict__ A, const int as0, const int as1,
+             /**/  ValueType *__restrict__ b, const int bs0) {
+        typedef Kokkos::Details::ArithTraits<ValueType> ats;
+
+        // b := L^{-1} b
+        for (int p=0;p<m;++p) {
+          const int iend = m-p-1;
+
+          const ValueType
+            *__restrict__ a21   = A+(p+1)*as0+p*as1;
+
+          ValueType
+            *__restrict__ beta1 = b+p*bs0,
+            *__restrict__ b2    = beta1+bs0;
+
+          *beta1 = *beta1 / A[p*as0+p*as1];
+          
+          for (int i=0;i<iend;++i)
+            b2[i*bs0] -= a21[i*as0] * (*beta1);
+        }
+
+        // b := L^{-H} b
+        for (int p=(m-1);p>=0;--p) {
+          const ValueType
+            *__restrict__ a10t  = A+p*as0;
+
+          ValueType
+            *__restrict__ beta1 = b+p*bs0;
+
+          *beta1 = *beta1 / ats::conj(A[p*as0+p*as1]);
+
+          for (int i=0;i<p;++i)
+            b[i*bs0] -= ats::conj(a10t[i*as1]) * (*beta1);
+        }
+        return 0;
+      }
+    };
+
+  }
+}
+
+#endif
@@ -0,0 +1,46 @@
+#ifndef __KOKKOSBATCHED_CHOLESKY_TEAM_IMPL_HPP__
+#define __KOKKOSBATCHED_CHOLESKY_TEAM_IMPL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Cholesky_Team_Internal.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+    ///
+    /// Team Impl
+    /// =========
+    
+    template<typename MemberType>
+    struct TeamCholesky<MemberType,Algo::Cholesky::Unblocked> {
+      template<typename AViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member, const AViewType &A) {
+        assert(A.extent(0)==A.extent(1));
+        return TeamCholeskyInternal<Algo::Cholesky::Unblocked>::invoke(member,
+                                                                      A.extent(0),
+                                                                      A.data(), A.stride_0(), A.stride_1());
+      }
+    };
+
+    template<typename MemberType>
+    struct TeamCholeskySolve<MemberType,Algo::Cholesky::Unblocked> {
+      template<typename AViewType,
+               typename bViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member, const AViewType &A, const bViewType &b) {
+        static_assert(bViewType::rank == 1, "b should have one dimension");
+        return TeamCholeskySolveInternal::invoke(member,
+                                                 A.extent(0),
+                                                 A.data(), A.stride_0(), A.stride_1(),
+                                                 b.data(), b.stride_0());
+      }
+    };
+
+  }
+}
+
+#endif
@@ -0,0 +1,125 @@
+#ifndef __KOKKOSBATCHED_CHOLESKY_TEAM_INTERNAL_HPP__
+#define __KOKKOSBATCHED_CHOLESKY_TEAM_INTERNAL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+#include "KokkosBatched_Cholesky_Serial_Internal.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+  
+    ///
+    /// Team Internal Impl
+    /// ==================
+
+    template<typename AlgoType>
+    struct TeamCholeskyInternal {
+      template<typename MemberType, typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static int 
+      invoke(const MemberType &member,
+             const int m,
+             ValueType *__restrict__ A, const int as0, const int as1);
+    };
+
+    template<>
+    template<typename MemberType, typename ValueType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    TeamCholeskyInternal<Algo::Cholesky::Unblocked>::
+    invoke(const MemberType &member,
+           const int m,
+           ValueType *__restrict__ A, const int as0, const int as1) {
+      typedef Kokkos::Details::ArithTraits<ValueType> ats;
+
+      int r_val = 0;
+      for (int p=0;p<m;++p) {
+        const int iend = m-p-1;
+
+        ValueType
+          *__restrict__ a21  = A+(p+1)*as0+(p  )*as1,
+          *__restrict__ A22  = A+(p+1)*as0+(p+1)*as1;
+
+        // every thread checks the diagonal so that the return value agrees
+        if (r_val == 0 && SerialCholeskyCheckInternal::invoke(A[p*as0+p*as1])) r_val = p+1;
+        member.team_barrier();
+        if (member.team_rank() == 0) {
+          ValueType &alpha11_reference = A[p*as0+p*as1];
+          alpha11_reference = ats::sqrt(alpha11_reference);
+        }
+        member.team_barrier();
+
+        const ValueType
+          alpha11 = A[p*as0+p*as1];
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(member,0,iend),[&](const int &i) {
+            a21[i*as0] /= alpha11;
+          });
+        member.team_barrier();
+
+        // lower triangle of A22 -= a21 a21^H
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(member,0,iend),[&](const int &i) {
+            const ValueType alpha21 = a21[i*as0];
+            for (int j=0;j<=i;++j)
+              A22[i*as0+j*as1] -= alpha21 * ats::conj(a21[j*as0]);
+          });
+        member.team_barrier();
+      }
+      return r_val;
+    }
+
+    struct TeamCholeskySolveInternal {
+      template<typename MemberType, typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static int 
+      invoke(const MemberType &member,
+             const int m,
+             const ValueType *__restrict__ A, const int as0, const int as1,
+             /**/  ValueType *__restrict__ b, const int bs0) {
+        typedef Kokkos::Details::ArithTraits<ValueType> ats;
+
+        // b := L^{-1} b
+        for (int p=0;p<m;++p) {
+          const int iend = m-p-1;
+
+          const ValueType
+            *__restrict__ a21   = A+(p+1)*as0+p*as1;
+
+          ValueType
+            *__restrict__ beta1 = b+p*bs0,
+            *__restrict__ b2    = beta1+bs0;
+
+          if (member.team_rank() == 0)
+            *beta1 = *beta1 / A[p*as0+p*as1];
+          member.team_barrier();
+          Kokkos::parallel_for(Kokkos::TeamThreadRange(member,0,iend),[&](const int &i) {
+              b2[i*bs0] -= a21[i*as0] * (*beta1);
+            });
+          member.team_barrier();
+        }
+
+        // b := L^{-H} b
+        for (int p=(m-1);p>=0;--p) {
+          const ValueType
+            *__restrict__ a10t  = A+p*as0;
+
+          ValueType
+            *__restrict__ beta1 = b+p*bs0;
+
+          if (member.team_rank() == 0)
+            *beta1 = *beta1 / ats::conj(A[p*as0+p*as1]);
+          member.team_barrier();
+          Kokkos::parallel_for(Kokkos::TeamThreadRange(member,0,p),[&](const int &i) {
+              b[i*bs0] -= ats::conj(a10t[i*as1]) * (*beta1);
+            });
+          member.team_barrier();
+        }
+        return 0;
+      }
+    };
+
+  }
+}
+
+#endif
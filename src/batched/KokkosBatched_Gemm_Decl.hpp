@@ -54,6 +54,31 @@ namespace KokkosBatched {
     // specialized for different m and n
     // C(mxn) += alpha * A(mxk) B(kxn)
 
+    ///
+    /// Serial Gemm (compile-time dimensions)
+    ///
+    /// C(MxN) = beta C + alpha op(A) op(B), op(A) is MxK. Intended for the
+    /// tiny blocks (2..8) of element kernels; loops are fully unrolled and
+    /// the view extents are not checked against M, N and K.
+    ///
+
+    template<typename ArgTransA,
+             typename ArgTransB,
+             int M, int N, int K>
+    struct SerialGemmFixed {
+      template<typename ScalarType,
+               typename AViewType,
+               typename BViewType,
+               typename CViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const ScalarType alpha,
+             const AViewType &A,
+             const BViewType &B,
+             const ScalarType beta,
+             const CViewType &C);
+    };
+
   }
 }
 
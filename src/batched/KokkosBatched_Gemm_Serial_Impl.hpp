@@ -458,7 +458,99 @@ namespace KokkosBatched {
                beta,
                C.data(), C.stride_0(), C.stride_1());
     }
-        
+
+    ///
+    /// Serial Impl (compile-time dimensions)
+    /// =====================================
+
+    template<int M, int N, int K>
+    struct SerialGemmFixed<Trans::NoTranspose,Trans::NoTranspose,M,N,K> {
+      template<typename ScalarType,
+               typename AViewType,
+               typename BViewType,
+               typename CViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const ScalarType alpha,
+             const AViewType &A,
+             const BViewType &B,
+             const ScalarType beta,
+             const CViewType &C) {
+        return SerialGemmFixedInternal<M,N,K>::
+          invoke(alpha, 
+                 A.data(), A.stride_0(), A.stride_1(),
+                 B.data(), B.stride_0(), B.stride_1(),
+                 beta,
+                 C.data(), C.stride_0(), C.stride_1());
+      }
+    };
+
+    template<int M, int N, int K>
+    struct SerialGemmFixed<Trans::Transpose,Trans::NoTranspose,M,N,K> {
+      template<typename ScalarType,
+               typename AViewType,
+               typename BViewType,
+               typename CViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const ScalarType alpha,
+             const AViewType &A,
+             const BViewType &B,
+             const ScalarType beta,
+             const CViewType &C) {
+        return SerialGemmFixedInternal<M,N,K>::
+          invoke(alpha, 
+                 A.data(), A.stride_1(), A.stride_0(),
+                 B.data(), B.stride_0(), B.stride_1(),
+                 beta,
+                 C.data(), C.stride_0(), C.stride_1());
+      }
+    };
+
+    template<int M, int N, int K>
+    struct SerialGemmFixed<Trans::NoTranspose,Trans::Transpose,M,N,K> {
+      template<typename ScalarType,
+               typename AViewType,
+               typename BViewType,
+               typename CViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const ScalarType alpha,
+             const AViewType &A,
+             const BViewType &B,
+             const ScalarType beta,
+             const CViewType &C) {
+        return SerialGemmFixedInternal<M,N,K>::
+          invoke(alpha, 
+                 A.data(), A.stride_0(), A.stride_1(),
+                 B.data(), B.stride_1(), B.stride_0(),
+                 beta,
+                 C.data(), C.stride_0(), C.stride_1());
+      }
+    };
+
+    template<int M, int N, int K>
+    struct SerialGemmFixed<Trans::Transpose,Trans::Transpose,M,N,K> {
+      template<typename ScalarType,
+               typename AViewType,
+               typename BViewType,
+               typename CViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const ScalarType alpha,
+             const AViewType &A,
+             const BViewType &B,
+             const ScalarType beta,
+             const CViewType &C) {
+        return SerialGemmFixedInternal<M,N,K>::
+          invoke(alpha, 
+                 A.data(), A.stride_1(), A.stride_0(),
+                 B.data(), B.stride_1(), B.stride_0(),
+                 beta,
+                 C.data(), C.stride_0(), C.stride_1());
+      }
+    };
+
   }
 }
 
@@ -151,6 +151,82 @@ namespace KokkosBatched {
       return 0;
     }
     
+    ///
+    /// Serial Internal Impl (compile-time dimensions)
+    /// ==============================================
+
+    template<int M, int N, int K>
+    struct SerialGemmFixedInternal {
+      static_assert(M > 0 && N > 0 && K > 0, "M, N and K should be positive");
+
+      template<typename ScalarType,
+               typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const ScalarType alpha, 
+             const ValueType *__restrict__ A, const int as0, const int as1,
+             const ValueType *__restrict__ B, const int bs0, const int bs1,
+             const ScalarType beta,
+             /**/  ValueType *__restrict__ C, const int cs0, const int cs1) {
+        // C = beta C + alpha A B
+        // C (M x N), A(M x K), B(K x N)
+
+        const ScalarType one(1.0), zero(0.0);
+
+        // the whole C is accumulated in registers; all trip counts are
+        // compile-time constants so the loops below unroll completely
+        ValueType c[M][N];
+        for (int i=0;i<M;++i)
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+          for (int j=0;j<N;++j)
+            c[i][j] = 0;
+
+        if (alpha != zero) {
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+          for (int p=0;p<K;++p) {
+            ValueType a_ip[M], b_pj[N];
+            for (int i=0;i<M;++i) a_ip[i] = A[i*as0+p*as1];
+            for (int j=0;j<N;++j) b_pj[j] = B[p*bs0+j*bs1];
+            
+            for (int i=0;i<M;++i)
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+              for (int j=0;j<N;++j)
+                c[i][j] += a_ip[i]*b_pj[j];
+          }
+        }
+
+        if (beta == zero) {
+          for (int i=0;i<M;++i)
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+            for (int j=0;j<N;++j)
+              C[i*cs0+j*cs1] = alpha*c[i][j];
+        } else if (beta == one) {
+          for (int i=0;i<M;++i)
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+            for (int j=0;j<N;++j)
+              C[i*cs0+j*cs1] += alpha*c[i][j];
+        } else {
+          for (int i=0;i<M;++i)
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+            for (int j=0;j<N;++j)
+              C[i*cs0+j*cs1] = beta*C[i*cs0+j*cs1] + alpha*c[i][j];
+        }
+        return 0;
+      }
+    };
+    
   }
 }
 
@@ -0,0 +1,92 @@
+#ifndef __KOKKOSBATCHED_GESV_DECL_HPP__
+#define __KOKKOSBATCHED_GESV_DECL_HPP__
+
+
+#include "KokkosBatched_Vector.hpp"
+
+namespace KokkosBatched {
+  namespace Experimental {
+
+    ///
+    /// Solve A x = b with partial pivoting
+    ///
+    /// On return A holds the LU factors (SerialLUPiv), ipiv the row
+    /// interchanges and b the solution x. The return value is that of the
+    /// factorization; a nonzero value means U is exactly singular.
+    ///
+      
+    template<typename ArgAlgo>
+    struct SerialGesv {
+      template<typename AViewType,
+               typename PivViewType,
+               typename bViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const AViewType &A,
+             const PivViewType &ipiv,
+             const bViewType &b);
+    };       
+
+    template<typename MemberType,
+             typename ArgAlgo>
+    struct TeamGesv {
+      template<typename AViewType,
+               typename PivViewType,
+               typename bViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member, 
+             const AViewType &A,
+             const PivViewType &ipiv,
+             const bViewType &b);
+    };
+
+    ///
+    /// Solve A x = b in mixed precision
+    ///
+    /// A is rounded into F, which has a lower precision value type with the
+    /// same number of lanes (e.g. Vector<SIMD<double>,8> and
+    /// Vector<SIMD<float>,8>), and factored there without pivoting
+    /// (SerialLU). x is then refined with residuals r = b - A x computed in
+    /// the precision of A (SerialGemv) until, in every lane,
+    ///   ||r||_inf <= sqrt(m) eps ||A||_inf ||x||_inf
+    /// or max_iter refinement steps are taken; eps is that of A. d is a low
+    /// precision workspace of length m. A and b are not modified.
+    ///
+    /// Since F has as many lanes as A, the low precision factorization and
+    /// solves run at the SIMD width of A; what is saved is the memory and
+    /// bandwidth of F and d, not arithmetic throughput.
+    ///
+    /// info(v) is the number of refinement steps lane v took after the
+    /// initial solve, or -1 if it did not converge; such a lane should be
+    /// solved again in high precision (SerialGesv). As in dsgesv, a lane
+    /// with ||A||_inf above the overflow threshold of the low precision is
+    /// not factored at all and returns info(v) = -1 with x = 0. The return
+    /// value is 0 if all lanes converged.
+    ///
+
+    template<typename ArgAlgo>
+    struct SerialGesvMixed {
+      template<typename AViewType,
+               typename FViewType,
+               typename bViewType,
+               typename xViewType,
+               typename rViewType,
+               typename dViewType,
+               typename InfoViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const AViewType &A,
+             const FViewType &F,
+             const bViewType &b,
+             const xViewType &x,
+             const rViewType &r,
+             const dViewType &d,
+             const InfoViewType &info,
+             const int max_iter = 30);
+    };
+
+  }
+}
+
+#endif
@@ -0,0 +1,268 @@
+#ifndef __KOKKOSBATCHED_GESV_SERIAL_IMPL_HPP__
+#define __KOKKOSBATCHED_GESV_SERIAL_IMPL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Pivot_Internal.hpp"
+#include "KokkosBatched_LU_Decl.hpp"
+#include "KokkosBatched_LU_Serial_Impl.hpp"
+#include "KokkosBatched_Trsv_Decl.hpp"
+#include "KokkosBatched_Trsv_Serial_Impl.hpp"
+#include "KokkosBatched_Gemv_Decl.hpp"
+#include "KokkosBatched_Gemv_Serial_Impl.hpp"
+
+namespace KokkosBatched {
+  namespace Experimental {
+    ///
+    /// Serial Impl
+    /// ===========
+
+    template<typename ArgAlgo,
+             typename ArgAlgoTrsv>
+    struct SerialGesvImpl {
+      template<typename AViewType,
+               typename PivViewType,
+               typename bViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const AViewType &A,
+             const PivViewType &ipiv,
+             const bViewType &b) {
+        static_assert(AViewType::rank == 2, "A should have two dimensions");
+        static_assert(PivViewType::rank == 1, "ipiv should have one dimension");
+        static_assert(bViewType::rank == 1, "b should have one dimension");
+        assert(A.extent(0)==A.extent(1));
+
+        typedef typename MagnitudeScalarType<typename AViewType::non_const_value_type>::type mag_type;
+        const mag_type one(1.0);
+
+        const int r_val = SerialLUPiv<ArgAlgo>::invoke(A, ipiv);
+
+        // b := P^T b
+        SerialApplyPivotInternal::invoke(A.extent(0), ipiv.data(), ipiv.stride_0(),
+                                         1, b.data(), b.stride_0(), 0);
+
+        // b := U^{-1} L^{-1} b
+        SerialTrsv<Uplo::Lower,Trans::NoTranspose,Diag::Unit,   ArgAlgoTrsv>::invoke(one, A, b);
+        SerialTrsv<Uplo::Upper,Trans::NoTranspose,Diag::NonUnit,ArgAlgoTrsv>::invoke(one, A, b);
+
+        return r_val;
+      }
+    };
+
+    template<>
+    template<typename AViewType,
+             typename PivViewType,
+             typename bViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialGesv<Algo::Gesv::Unblocked>::
+    invoke(const AViewType &A,
+           const PivViewType &ipiv,
+           const bViewType &b) {
+      return SerialGesvImpl<Algo::LU::Unblocked,Algo::Trsv::Unblocked>::invoke(A, ipiv, b);
+    }
+
+    template<>
+    template<typename AViewType,
+             typename PivViewType,
+             typename bViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialGesv<Algo::Gesv::Blocked>::
+    invoke(const AViewType &A,
+           const PivViewType &ipiv,
+           const bViewType &b) {
+      return SerialGesvImpl<Algo::LU::Blocked,Algo::Trsv::Blocked>::invoke(A, ipiv, b);
+    }
+
+    ///
+    /// Serial Impl (mixed precision)
+    /// =============================
+
+    template<typename ArgAlgoLU,
+             typename ArgAlgoTrsv,
+             typename ArgAlgoGemv>
+    struct SerialGesvMixedImpl {
+      template<typename AViewType,
+               typename FViewType,
+               typename bViewType,
+               typename xViewType,
+               typename rViewType,
+               typename dViewType,
+               typename InfoViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const AViewType &A,
+             const FViewType &F,
+             const bViewType &b,
+             const xViewType &x,
+             const rViewType &r,
+             const dViewType &d,
+             const InfoViewType &info,
+             const int max_iter) {
+        static_assert(AViewType::rank == 2, "A should have two dimensions");
+        static_assert(FViewType::rank == 2, "F should have two dimensions");
+        static_assert(bViewType::rank == 1, "b should have one dimension");
+        static_assert(xViewType::rank == 1, "x should have one dimension");
+        static_assert(rViewType::rank == 1, "r should have one dimension");
+        static_assert(dViewType::rank == 1, "d should have one dimension");
+        static_assert(InfoViewType::rank == 1, "info should have one dimension");
+        assert(A.extent(0)==A.extent(1));
+
+        typedef typename AViewType::non_const_value_type value_type;
+        typedef typename FViewType::non_const_value_type low_value_type;
+        typedef PivotTraits<value_type> traits;
+        typedef PivotTraits<low_value_type> low_traits;
+        static_assert(int(traits::vector_length) == int(low_traits::vector_length),
+                      "A and F should have the same number of lanes");
+
+        typedef typename traits::value_type scalar_type;
+        typedef typename low_traits::value_type low_scalar_type;
+        typedef Kokkos::Details::ArithTraits<scalar_type> ats;
+        typedef typename ats::mag_type mag_type;
+        typedef Kokkos::Details::ArithTraits<mag_type> mag_ats;
+        typedef typename Kokkos::Details::ArithTraits<low_scalar_type>::mag_type low_mag_type;
+        enum : int { vl = traits::vector_length };
+
+        const int m = A.extent(0);
+        const mag_type one(1.0);
+        const typename MagnitudeScalarType<low_value_type>::type low_one(1.0);
+
+        // ||A||_inf of each lane; as in dsgesv, a lane whose norm overflows
+        // the low precision fails at once and is left to the caller
+        const mag_type low_max = Kokkos::Details::ArithTraits<low_mag_type>::max();
+        mag_type anorm[vl];
+        bool active[vl];
+        int nactive = 0;
+        for (int v=0;v<vl;++v) {
+          anorm[v] = 0;
+          for (int i=0;i<m;++i) {
+            mag_type row(0);
+            for (int j=0;j<m;++j)
+              row += ats::abs(traits::value(A(i,j), v));
+            anorm[v] = row > anorm[v] ? row : anorm[v];
+          }
+          active[v] = !(anorm[v] > low_max);
+          nactive += active[v];
+          info(v) = -1;
+        }
+
+        // x := 0, r := b
+        const value_type zero(0);
+        for (int i=0;i<m;++i) {
+          x(i) = zero;
+          r(i) = b(i);
+        }
+
+        if (nactive == 0) return 1;
+
+        // F := A rounded to low precision; a failed lane factors the identity
+        // so that the other lanes of the pack are not disturbed
+        for (int v=0;v<vl;++v)
+          for (int i=0;i<m;++i)
+            for (int j=0;j<m;++j)
+              low_traits::value(F(i,j), v) =
+                active[v] ? static_cast<low_scalar_type>(traits::value(A(i,j), v)) : low_scalar_type(i == j);
+
+        SerialLU<ArgAlgoLU>::invoke(F);
+
+        const mag_type tol = mag_ats::sqrt(mag_type(m))*ats::epsilon();
+
+        for (int iter=0;iter<=max_iter && nactive > 0;++iter) {
+          // d := U^{-1} L^{-1} r in low precision
+          for (int i=0;i<m;++i)
+            for (int v=0;v<vl;++v)
+              low_traits::value(d(i), v) =
+                active[v] ? static_cast<low_scalar_type>(traits::value(r(i), v)) : low_scalar_type(0);
+
+          SerialTrsv<Uplo::Lower,Trans::NoTranspose,Diag::Unit,   ArgAlgoTrsv>::invoke(low_one, F, d);
+          SerialTrsv<Uplo::Upper,Trans::NoTranspose,Diag::NonUnit,ArgAlgoTrsv>::invoke(low_one, F, d);
+
+          // x := x + d for the lanes not yet converged
+          for (int i=0;i<m;++i)
+            for (int v=0;v<vl;++v)
+              if (active[v])
+                traits::value(x(i), v) += static_cast<scalar_type>(low_traits::value(d(i), v));
+
+          // r := b - A x in high precision
+          for (int i=0;i<m;++i)
+            r(i) = b(i);
+          SerialGemv<Trans::NoTranspose,ArgAlgoGemv>::invoke(-one, A, x, one, r);
+
+          for (int v=0;v<vl;++v)
+            if (active[v]) {
+              mag_type rnorm(0), xnorm(0);
+              for (int i=0;i<m;++i) {
+                const mag_type
+                  ri = ats::abs(traits::value(r(i), v)),
+                  xi = ats::abs(traits::value(x(i), v));
+                rnorm = ri > rnorm ? ri : rnorm;
+                xnorm = xi > xnorm ? xi : xnorm;
+              }
+              if (rnorm <= tol*anorm[v]*xnorm) {
+                info(v) = iter;
+                active[v] = false;
+                --nactive;
+              }
+            }
+        }
+
+        int r_val = 0;
+        for (int v=0;v<vl;++v)
+          r_val |= (info(v) < 0);
+
+        return r_val;
+      }
+    };
+
+    template<>
+    template<typename AViewType,
+             typename FViewType,
+             typename bViewType,
+             typename xViewType,
+             typename rViewType,
+             typename dViewType,
+             typename InfoViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialGesvMixed<Algo::Gesv::Unblocked>::
+    invoke(const AViewType &A,
+           const FViewType &F,
+           const bViewType &b,
+           const xViewType &x,
+           const rViewType &r,
+           const dViewType &d,
+           const InfoViewType &info,
+           const int max_iter) {
+      return SerialGesvMixedImpl<Algo::LU::Unblocked,Algo::Trsv::Unblocked,Algo::Gemv::Unblocked>::
+        invoke(A, F, b, x, r, d, info, max_iter);
+    }
+
+    template<>
+    template<typename AViewType,
+             typename FViewType,
+             typename bViewType,
+             typename xViewType,
+             typename rViewType,
+             typename dViewType,
+             typename InfoViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialGesvMixed<Algo::Gesv::Blocked>::
+    invoke(const AViewType &A,
+           const FViewType &F,
+           const bViewType &b,
+           const xViewType &x,
+           const rViewType &r,
+           const dViewType &d,
+           const InfoViewType &info,
+           const int max_iter) {
+      return SerialGesvMixedImpl<Algo::LU::Blocked,Algo::Trsv::Blocked,Algo::Gemv::Blocked>::
+        invoke(A, F, b, x, r, d, info, max_iter);
+    }
+
+  }
+}
+
+#endif
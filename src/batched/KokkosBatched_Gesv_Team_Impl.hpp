@@ -0,0 +1,84 @@
+#ifndef __KOKKOSBATCHED_GESV_TEAM_IMPL_HPP__
+#define __KOKKOSBATCHED_GESV_TEAM_IMPL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Pivot_Internal.hpp"
+#include "KokkosBatched_LU_Decl.hpp"
+#include "KokkosBatched_LU_Team_Impl.hpp"
+#include "KokkosBatched_Trsv_Decl.hpp"
+#include "KokkosBatched_Trsv_Team_Impl.hpp"
+
+namespace KokkosBatched {
+  namespace Experimental {
+    ///
+    /// Team Impl
+    /// =========
+
+    template<typename MemberType,
+             typename ArgAlgo,
+             typename ArgAlgoTrsv>
+    struct TeamGesvImpl {
+      template<typename AViewType,
+               typename PivViewType,
+               typename bViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const AViewType &A,
+             const PivViewType &ipiv,
+             const bViewType &b) {
+        static_assert(AViewType::rank == 2, "A should have two dimensions");
+        static_assert(PivViewType::rank == 1, "ipiv should have one dimension");
+        static_assert(bViewType::rank == 1, "b should have one dimension");
+        assert(A.extent(0)==A.extent(1));
+
+        typedef typename MagnitudeScalarType<typename AViewType::non_const_value_type>::type mag_type;
+        const mag_type one(1.0);
+
+        const int r_val = TeamLUPiv<MemberType,ArgAlgo>::invoke(member, A, ipiv);
+        member.team_barrier();
+
+        // b := P^T b
+        TeamApplyPivotInternal::invoke(member,
+                                       A.extent(0), ipiv.data(), ipiv.stride_0(),
+                                       1, b.data(), b.stride_0(), 0);
+        member.team_barrier();
+
+        // b := U^{-1} L^{-1} b
+        TeamTrsv<MemberType,Uplo::Lower,Trans::NoTranspose,Diag::Unit,   ArgAlgoTrsv>::invoke(member, one, A, b);
+        member.team_barrier();
+        TeamTrsv<MemberType,Uplo::Upper,Trans::NoTranspose,Diag::NonUnit,ArgAlgoTrsv>::invoke(member, one, A, b);
+
+        return r_val;
+      }
+    };
+
+    template<typename MemberType>
+    struct TeamGesv<MemberType,Algo::Gesv::Unblocked> {
+      template<typename AViewType,
+               typename PivViewType,
+               typename bViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member, const AViewType &A, const PivViewType &ipiv, const bViewType &b) {
+        return TeamGesvImpl<MemberType,Algo::LU::Unblocked,Algo::Trsv::Unblocked>::invoke(member, A, ipiv, b);
+      }
+    };
+
+    template<typename MemberType>
+    struct TeamGesv<MemberType,Algo::Gesv::Blocked> {
+      template<typename AViewType,
+               typename PivViewType,
+               typename bViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member, const AViewType &A, const PivViewType &ipiv, const bViewType &b) {
+        return TeamGesvImpl<MemberType,Algo::LU::Blocked,Algo::Trsv::Blocked>::invoke(member, A, ipiv, b);
+      }
+    };
+
+  }
+}
+
+#endif
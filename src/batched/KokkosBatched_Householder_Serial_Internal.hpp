@@ -0,0 +1,113 @@
+#ifndef __KOKKOSBATCHED_HOUSEHOLDER_SERIAL_INTERNAL_HPP__
+#define __KOKKOSBATCHED_HOUSEHOLDER_SERIAL_INTERNAL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+#include "KokkosBatched_Pivot_Internal.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+
+    ///
+    /// Serial Internal Impl
+    /// ====================
+    ///
+    /// Householder reflector H = I - tau [1; u2] [1; u2]^H such that
+    /// H^H [chi1; x2] = [beta; 0] (larfg). For SIMD vectors the norm and
+    /// scaling are vector operations; only the sign choice and the
+    /// zero-norm guard are evaluated lane by lane.
+
+    struct SerialLeftHouseholderInternal {
+      // compute tau, beta and the scaling u2 = scale x2 without touching the input
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      parameters(const int m_x2,
+                 const ValueType chi1,
+                 const ValueType *__restrict__ x2, const int x2s,
+                 /* */ ValueType &tau,
+                 /* */ ValueType &beta,
+                 /* */ ValueType &scale) {
+        typedef PivotTraits<ValueType> traits;
+        typedef typename traits::value_type value_type;
+        typedef Kokkos::Details::ArithTraits<ValueType> ats;
+        typedef Kokkos::Details::ArithTraits<value_type> ats_value;
+        typedef typename ats_value::mag_type mag_type;
+        typedef Kokkos::Details::ArithTraits<mag_type> ats_mag;
+
+        ValueType norm_x2_square(0);
+        for (int i=0;i<m_x2;++i) 
+          norm_x2_square += ats::conj(x2[i*x2s]) * x2[i*x2s];
+
+        for (int v=0;v<traits::vector_length;++v) {
+          const value_type alpha = traits::value(chi1, v);
+          const mag_type   xnorm = ats_value::real(traits::value(norm_x2_square, v));
+          
+          if (xnorm == mag_type(0) && ats_value::imag(alpha) == mag_type(0)) {
+            // H = I
+            traits::value(tau,   v) = value_type(0);
+            traits::value(beta,  v) = alpha;
+            traits::value(scale, v) = value_type(1);
+          } else {
+            const mag_type 
+              alpha_abs = ats_value::abs(alpha),
+              beta_abs  = ats_mag::sqrt(alpha_abs*alpha_abs + xnorm),
+              beta_val  = ats_value::real(alpha) < mag_type(0) ? beta_abs : -beta_abs;
+            traits::value(tau,   v) = (value_type(beta_val) - alpha)/value_type(beta_val);
+            traits::value(beta,  v) = value_type(beta_val);
+            traits::value(scale, v) = value_type(1)/(alpha - value_type(beta_val));
+          }
+        }
+        return 0;
+      }
+
+      // overwrite chi1 by beta and x2 by u2
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const int m_x2,
+             /* */ ValueType *__restrict__ chi1,
+             /* */ ValueType *__restrict__ x2, const int x2s,
+             /* */ ValueType *__restrict__ tau) {
+        ValueType beta, scale;
+        parameters(m_x2, *chi1, x2, x2s, *tau, beta, scale);
+
+        *chi1 = beta;
+        for (int i=0;i<m_x2;++i)
+          x2[i*x2s] *= scale;
+        return 0;
+      }
+    };
+
+    struct SerialApplyLeftHouseholderInternal {
+      // [a1t; A2] := (I - tau [1; u2] [1; u2]^H) [a1t; A2]
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const int m, const int n,
+             const ValueType tau,
+             const ValueType *__restrict__ u2, const int u2s,
+             /* */ ValueType *__restrict__ a1t, const int a1ts,
+             /* */ ValueType *__restrict__ A2, const int as0, const int as1) {
+        typedef Kokkos::Details::ArithTraits<ValueType> ats;
+
+        for (int j=0;j<n;++j) {
+          ValueType w1 = a1t[j*a1ts];
+          for (int i=0;i<m;++i)
+            w1 += ats::conj(u2[i*u2s]) * A2[i*as0+j*as1];
+          w1 *= tau;
+
+          a1t[j*a1ts] -= w1;
+          for (int i=0;i<m;++i)
+            A2[i*as0+j*as1] -= u2[i*u2s] * w1;
+        }
+        return 0;
+      }
+    };
+
+  }
+}
+
+#endif
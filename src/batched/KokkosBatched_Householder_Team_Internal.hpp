@@ -0,0 +1,42 @@
+#ifndef __KOKKOSBATCHED_HOUSEHOLDER_TEAM_INTERNAL_HPP__
+#define __KOKKOSBATCHED_HOUSEHOLDER_TEAM_INTERNAL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Householder_Serial_Internal.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+
+    ///
+    /// Team Internal Impl
+    /// ==================
+
+    struct TeamApplyLeftHouseholderInternal {
+      // columns are independent; distribute them over the team
+      template<typename MemberType,
+               typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const int m, const int n,
+             const ValueType tau,
+             const ValueType *__restrict__ u2, const int u2s,
+             /* */ ValueType *__restrict__ a1t, const int a1ts,
+             /* */ ValueType *__restrict__ A2, const int as0, const int as1) {
+        Kokkos::parallel_for
+          (Kokkos::TeamThreadRange(member,0,n),[&](const int &j) {
+            SerialApplyLeftHouseholderInternal::invoke(m, 1, tau, u2, u2s,
+                                                       a1t+j*a1ts, a1ts,
+                                                       A2+j*as1, as0, as1);
+          });
+        //member.team_barrier();
+        return 0;
+      }
+    };
+
+  }
+}
+
+#endif
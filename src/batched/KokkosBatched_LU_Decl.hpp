@@ -30,6 +30,53 @@ namespace KokkosBatched {
              const AViewType &A,
              const typename MagnitudeScalarType<typename AViewType::non_const_value_type>::type tiny = 0);
     };       
+
+    ///
+    /// no piv version with compile-time dimension
+    ///
+    /// A is MxM; the factorization is fully unrolled in registers. The view
+    /// extents are not checked against M.
+    ///
+
+    template<int M>
+    struct SerialLUFixed {
+      template<typename AViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const AViewType &A,
+             const typename MagnitudeScalarType<typename AViewType::non_const_value_type>::type tiny = 0);
+    };
+
+    ///
+    /// partial pivoting version
+    ///
+    /// A = P L U; ipiv(p) is the (0-based) row interchanged with row p at step p.
+    /// For Vector<SIMD<T>,l> values, every lane selects its own pivot and ipiv
+    /// holds Vector<SIMD<int>,l> (see PivotTraits). A nonzero return value k
+    /// indicates U(k-1,k-1) is exactly zero (in at least one lane).
+    ///
+
+    template<typename ArgAlgo>
+    struct SerialLUPiv {
+      template<typename AViewType,
+               typename PivViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const AViewType &A,
+             const PivViewType &ipiv);
+    };       
+
+    template<typename MemberType,
+             typename ArgAlgo>
+    struct TeamLUPiv {
+      template<typename AViewType,
+               typename PivViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member, 
+             const AViewType &A,
+             const PivViewType &ipiv);
+    };       
       
   }
 }
@@ -83,6 +83,51 @@ namespace KokkosBatched {
                                                           tiny);
     }
 
+    ///
+    /// SerialLU no piv with compile-time dimension
+    ///
+
+    template<int M>
+    template<typename AViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialLUFixed<M>::
+    invoke(const AViewType &A,
+           const typename MagnitudeScalarType<typename AViewType::non_const_value_type>::type tiny) {
+      return SerialLUFixed_Internal<M>::invoke(A.data(), A.stride_0(), A.stride_1(),
+                                               tiny);
+    }
+
+    ///
+    /// SerialLU partial pivoting
+    ///
+
+    template<>
+    template<typename AViewType,
+             typename PivViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialLUPiv<Algo::LU::Unblocked>::
+    invoke(const AViewType &A,
+           const PivViewType &ipiv) {
+      return SerialLUPiv_Internal<Algo::LU::Unblocked>::invoke(A.extent(0), A.extent(1),
+                                                               A.data(), A.stride_0(), A.stride_1(),
+                                                               ipiv.data(), ipiv.stride_0());
+    }
+    
+    template<>
+    template<typename AViewType,
+             typename PivViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialLUPiv<Algo::LU::Blocked>::
+    invoke(const AViewType &A,
+           const PivViewType &ipiv) {
+      return SerialLUPiv_Internal<Algo::LU::Blocked>::invoke(A.extent(0), A.extent(1),
+                                                             A.data(), A.stride_0(), A.stride_1(),
+                                                             ipiv.data(), ipiv.stride_0());
+    }
+
   }
 }
 
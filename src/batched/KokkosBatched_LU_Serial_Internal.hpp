@@ -9,6 +9,7 @@
 #include "KokkosBatched_InnerLU_Serial_Impl.hpp"
 #include "KokkosBatched_InnerTrsm_Serial_Impl.hpp"
 #include "KokkosBatched_Gemm_Serial_Internal.hpp"
+#include "KokkosBatched_Pivot_Internal.hpp"
 
 
 namespace KokkosBatched {
@@ -140,6 +141,139 @@ namespace KokkosBatched {
       return 0;
     }
 
+    ///
+    /// Serial Internal Impl (compile-time dimension)
+    /// =============================================
+
+    template<int M>
+    struct SerialLUFixed_Internal {
+      static_assert(M > 0, "M should be positive");
+
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static int 
+      invoke(ValueType *__restrict__ A, const int as0, const int as1,
+             const typename MagnitudeScalarType<ValueType>::type tiny) {
+        const auto       abs_tiny =  tiny > 0 ? tiny : -tiny;
+        const auto minus_abs_tiny = -abs_tiny;
+
+        // load the whole matrix; with constant trip counts the factorization
+        // below is straight line code on registers as in InnerLU
+        ValueType a[M][M];
+        for (int i=0;i<M;++i)
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+          for (int j=0;j<M;++j)
+            a[i][j] = A[i*as0+j*as1];
+
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+        for (int p=0;p<M;++p) {
+          if (tiny != 0) {
+            const auto alpha11_real = Kokkos::Details::ArithTraits<ValueType>::real(a[p][p]);
+            a[p][p] += minus_abs_tiny*ValueType(alpha11_real <  0);
+            a[p][p] +=       abs_tiny*ValueType(alpha11_real >= 0);
+          }
+
+          const ValueType alpha11 = a[p][p];
+          for (int i=p+1;i<M;++i) {
+            a[i][p] /= alpha11;
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+            for (int j=p+1;j<M;++j)
+              a[i][j] -= a[i][p]*a[p][j];
+          }
+        }
+
+        for (int i=0;i<M;++i)
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+          for (int j=0;j<M;++j)
+            A[i*as0+j*as1] = a[i][j];
+
+        return 0;
+      }
+    };
+
+    ///
+    /// Serial Internal Impl (partial pivoting)
+    /// =======================================
+
+    template<typename AlgoType>
+    struct SerialLUPiv_Internal {
+      template<typename ValueType,
+               typename PivotType>
+      KOKKOS_INLINE_FUNCTION
+      static int 
+      invoke(const int m, const int n,
+             ValueType *__restrict__ A, const int as0, const int as1,
+             PivotType *__restrict__ ipiv, const int ips0);
+    };
+
+    template<>
+    template<typename ValueType,
+             typename PivotType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialLUPiv_Internal<Algo::LU::Unblocked>::
+    invoke(const int m, const int n,
+           ValueType *__restrict__ A, const int as0, const int as1,
+           PivotType *__restrict__ ipiv, const int ips0) {
+      const int k = (m < n ? m : n);
+      if (k <= 0) return 0;
+
+      int r_val = 0;
+      for (int p=0;p<k;++p) {
+        const int iend = m-p-1, jend = n-p-1;
+
+        // pivot search and row interchange are lane-wise; the update below
+        // is the same vector arithmetic as the no piv version
+        PivotType &piv = ipiv[p*ips0];
+        const int is_zero = SerialFindPivotInternal::invoke(m-p, A+p*as0+p*as1, as0, p, piv);
+        SerialApplyPivotInternal::invoke(n, p, piv, A, as0, as1);
+        if (is_zero && r_val == 0) r_val = p+1;
+
+        const ValueType
+          *__restrict__ a12t = A+(p  )*as0+(p+1)*as1;
+        
+        ValueType
+          *__restrict__ a21  = A+(p+1)*as0+(p  )*as1,
+          *__restrict__ A22  = A+(p+1)*as0+(p+1)*as1;
+
+        const ValueType
+          alpha11 = A[p*as0+p*as1];
+        
+        for (int i=0;i<iend;++i) {
+          a21[i*as0] /= alpha11;
+              
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+          for (int j=0;j<jend;++j)
+            A22[i*as0+j*as1] -= a21[i*as0] * a12t[j*as1];
+        }
+      }
+      return r_val;
+    }
+
+    template<>
+    template<typename ValueType,
+             typename PivotType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialLUPiv_Internal<Algo::LU::Blocked>::
+    invoke(const int m, const int n,
+           ValueType *__restrict__ A, const int as0, const int as1,
+           PivotType *__restrict__ ipiv, const int ips0) {
+      // the pivot search needs the whole updated column, so the register
+      // blocked inner kernels do not apply; use the unblocked version
+      return SerialLUPiv_Internal<Algo::LU::Unblocked>::invoke(m, n, A, as0, as1, ipiv, ips0);
+    }
+
   }
 }
 
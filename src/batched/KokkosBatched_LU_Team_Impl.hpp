@@ -46,6 +46,38 @@ namespace KokkosBatched {
       }
     };
 
+    ///
+    /// LU partial pivoting
+    ///
+    
+    template<typename MemberType>
+    struct TeamLUPiv<MemberType,Algo::LU::Unblocked> {
+      template<typename AViewType,
+               typename PivViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member, const AViewType &A, const PivViewType &ipiv) {
+        return TeamLUPiv_Internal<Algo::LU::Unblocked>::invoke(member,
+                                                               A.extent(0), A.extent(1),
+                                                               A.data(), A.stride_0(), A.stride_1(),
+                                                               ipiv.data(), ipiv.stride_0());
+      }
+    };
+    
+    template<typename MemberType>
+    struct TeamLUPiv<MemberType,Algo::LU::Blocked> {
+      template<typename AViewType,
+               typename PivViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member, const AViewType &A, const PivViewType &ipiv) {
+        return TeamLUPiv_Internal<Algo::LU::Blocked>::invoke(member,
+                                                             A.extent(0), A.extent(1),
+                                                             A.data(), A.stride_0(), A.stride_1(),
+                                                             ipiv.data(), ipiv.stride_0());
+      }
+    };
+
   }
 }
 
@@ -11,6 +11,7 @@
 
 #include "KokkosBatched_Trsm_Team_Internal.hpp"
 #include "KokkosBatched_Gemm_Team_Internal.hpp"
+#include "KokkosBatched_Pivot_Internal.hpp"
 
 
 namespace KokkosBatched {
@@ -170,6 +171,94 @@ namespace KokkosBatched {
 
       return 0;
     }
+    ///
+    /// Team Internal Impl (partial pivoting)
+    /// =====================================
+
+    template<typename AlgoType>
+    struct TeamLUPiv_Internal {
+      template<typename MemberType,
+               typename ValueType,
+               typename PivotType>
+      KOKKOS_INLINE_FUNCTION
+      static int 
+      invoke(const MemberType &member,
+             const int m, const int n,
+             ValueType *__restrict__ A, const int as0, const int as1,
+             PivotType *__restrict__ ipiv, const int ips0);
+    };
+
+    template<>
+    template<typename MemberType,
+             typename ValueType,
+             typename PivotType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    TeamLUPiv_Internal<Algo::LU::Unblocked>::
+    invoke(const MemberType &member, 
+           const int m, const int n,
+           ValueType *__restrict__ A, const int as0, const int as1,
+           PivotType *__restrict__ ipiv, const int ips0) {
+
+      const int k = (m < n ? m : n);
+      if (k <= 0) return 0;
+
+      int r_val = 0;
+      for (int p=0;p<k;++p) {
+        const int iend = m-p-1, jend = n-p-1;
+
+        // every thread scans the pivot column (read only) so that the
+        // selected pivot does not need to be broadcast
+        PivotType piv;
+        const int is_zero = SerialFindPivotInternal::invoke(m-p, A+p*as0+p*as1, as0, p, piv);
+        if (is_zero && r_val == 0) r_val = p+1;
+
+        member.team_barrier();
+        if (member.team_rank() == 0) 
+          ipiv[p*ips0] = piv;
+        TeamApplyPivotInternal::invoke(member, n, p, piv, A, as0, as1);
+        member.team_barrier();
+
+        const ValueType 
+          *__restrict__ a12t = A+(p  )*as0+(p+1)*as1;
+
+        ValueType
+          *__restrict__ a21  = A+(p+1)*as0+(p  )*as1,
+          *__restrict__ A22  = A+(p+1)*as0+(p+1)*as1;
+
+        const ValueType
+          alpha11 = A[p*as0+p*as1];
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(member,0,iend),[&](const int &i) {
+            a21[i*as0] /= alpha11;
+          });
+            
+        member.team_barrier();
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(member,0,iend*jend),[&](const int &ij) {
+            // assume layout right for batched computation
+            const int i = ij/jend, j = ij%jend;
+            A22[i*as0+j*as1] -= a21[i*as0] * a12t[j*as1];
+          });
+        member.team_barrier();
+      }
+      return r_val;
+    }
+
+    template<>
+    template<typename MemberType,
+             typename ValueType,
+             typename PivotType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    TeamLUPiv_Internal<Algo::LU::Blocked>::
+    invoke(const MemberType &member, 
+           const int m, const int n,
+           ValueType *__restrict__ A, const int as0, const int as1,
+           PivotType *__restrict__ ipiv, const int ips0) {
+      // the pivot search needs the whole updated column, so the register
+      // blocked inner kernels do not apply; use the unblocked version
+      return TeamLUPiv_Internal<Algo::LU::Unblocked>::invoke(member, m, n, A, as0, as1, ipiv, ips0);
+    }
+
   }
 }
 
@@ -0,0 +1,104 @@
+#ifndef __KOKKOSBATCHED_PACK_DECL_HPP__
+#define __KOKKOSBATCHED_PACK_DECL_HPP__
+
+
+#include "KokkosBatched_Vector.hpp"
+
+namespace KokkosBatched {
+  namespace Experimental {
+
+    ///
+    /// Layout conversion between standard and compact batched matrices
+    /// ===============================================================
+    ///
+    /// A standard batch stores nbatch scalar matrices in a rank-3 view
+    /// A(p,:,:), p = 0..nbatch-1. The compact layout interleaves l of them
+    /// in Vector<SIMD<T>,l> values; pack k is a rank-2 view Ac(:,:) whose
+    /// lane v holds matrix p = k*l + v.
+    ///
+    /// PackTraits picks the vector length from DefaultVectorLength so that
+    /// the compact view can be allocated as
+    ///
+    ///   typedef PackTraits<T,memory_space> pack_traits;
+    ///   Kokkos::View<typename pack_traits::vector_type***> Ac("Ac", pack_traits::npacks(nbatch), m, n);
+    ///
+
+    template<typename ValueType,
+             typename SpaceType>
+    struct PackTraits {
+      enum : int { vector_length = DefaultVectorLength<ValueType,SpaceType>::value };
+      typedef Vector<SIMD<ValueType>,vector_length> vector_type;
+
+      KOKKOS_INLINE_FUNCTION
+      static int npacks(const int nbatch) {
+        return (nbatch + vector_length - 1)/vector_length;
+      }
+    };
+
+    ///
+    /// Pack: B(i,j)[v] = A(k*l+v,i,j), or B(j,i)[v] with Trans::Transpose
+    ///
+    /// When the last pack is partially filled (nbatch not a multiple of l),
+    /// the trailing lanes replicate the last matrix so that factorizations
+    /// stay well defined in every lane.
+    ///
+
+    template<typename ArgTrans>
+    struct SerialPack {
+      template<typename AViewType,
+               typename BViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const AViewType &A,
+             const int k,
+             const BViewType &B);
+    };
+
+    template<typename MemberType,
+             typename ArgTrans>
+    struct TeamPack {
+      template<typename AViewType,
+               typename BViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const AViewType &A,
+             const int k,
+             const BViewType &B);
+    };
+
+    ///
+    /// Unpack: B(k*l+v,i,j) = A(i,j)[v], or A(j,i)[v] with Trans::Transpose
+    ///
+    /// This is the inverse of Pack with the same ArgTrans; lanes beyond
+    /// the batch are not written.
+    ///
+
+    template<typename ArgTrans>
+    struct SerialUnpack {
+      template<typename AViewType,
+               typename BViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const AViewType &A,
+             const int k,
+             const BViewType &B);
+    };
+
+    template<typename MemberType,
+             typename ArgTrans>
+    struct TeamUnpack {
+      template<typename AViewType,
+               typename BViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const AViewType &A,
+             const int k,
+             const BViewType &B);
+    };
+
+  }
+}
+
+#endif
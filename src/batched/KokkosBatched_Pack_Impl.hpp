@@ -0,0 +1,195 @@
+#ifndef __KOKKOSBATCHED_PACK_IMPL_HPP__
+#define __KOKKOSBATCHED_PACK_IMPL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Pack_Internal.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+    ///
+    /// Serial Impl
+    /// ===========
+
+    template<>
+    template<typename AViewType,
+             typename BViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialPack<Trans::NoTranspose>::
+    invoke(const AViewType &A,
+           const int k,
+           const BViewType &B) {
+      static_assert(AViewType::rank == 3, "A should have three dimensions");
+      static_assert(BViewType::rank == 2, "B should have two dimensions");
+      enum : int { l = BViewType::non_const_value_type::vector_length };
+      const int nbatch = A.extent(0), offset = k*l, nv = (nbatch - offset < l ? nbatch - offset : l);
+      return SerialPackInternal::
+        invoke(nv,
+               B.extent(0), B.extent(1),
+               A.data()+offset*A.stride_0(), A.stride_0(), A.stride_1(), A.stride_2(),
+               B.data(), B.stride_0(), B.stride_1());
+    }
+
+    template<>
+    template<typename AViewType,
+             typename BViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialPack<Trans::Transpose>::
+    invoke(const AViewType &A,
+           const int k,
+           const BViewType &B) {
+      static_assert(AViewType::rank == 3, "A should have three dimensions");
+      static_assert(BViewType::rank == 2, "B should have two dimensions");
+      enum : int { l = BViewType::non_const_value_type::vector_length };
+      const int nbatch = A.extent(0), offset = k*l, nv = (nbatch - offset < l ? nbatch - offset : l);
+      return SerialPackInternal::
+        invoke(nv,
+               B.extent(0), B.extent(1),
+               A.data()+offset*A.stride_0(), A.stride_0(), A.stride_2(), A.stride_1(),
+               B.data(), B.stride_0(), B.stride_1());
+    }
+
+    template<>
+    template<typename AViewType,
+             typename BViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialUnpack<Trans::NoTranspose>::
+    invoke(const AViewType &A,
+           const int k,
+           const BViewType &B) {
+      static_assert(AViewType::rank == 2, "A should have two dimensions");
+      static_assert(BViewType::rank == 3, "B should have three dimensions");
+      enum : int { l = AViewType::non_const_value_type::vector_length };
+      const int nbatch = B.extent(0), offset = k*l, nv = (nbatch - offset < l ? nbatch - offset : l);
+      return SerialUnpackInternal::
+        invoke(nv,
+               A.extent(0), A.extent(1),
+               A.data(), A.stride_0(), A.stride_1(),
+               B.data()+offset*B.stride_0(), B.stride_0(), B.stride_1(), B.stride_2());
+    }
+
+    template<>
+    template<typename AViewType,
+             typename BViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialUnpack<Trans::Transpose>::
+    invoke(const AViewType &A,
+           const int k,
+           const BViewType &B) {
+      static_assert(AViewType::rank == 2, "A should have two dimensions");
+      static_assert(BViewType::rank == 3, "B should have three dimensions");
+      enum : int { l = AViewType::non_const_value_type::vector_length };
+      const int nbatch = B.extent(0), offset = k*l, nv = (nbatch - offset < l ? nbatch - offset : l);
+      return SerialUnpackInternal::
+        invoke(nv,
+               A.extent(0), A.extent(1),
+               A.data(), A.stride_0(), A.stride_1(),
+               B.data()+offset*B.stride_0(), B.stride_0(), B.stride_2(), B.stride_1());
+    }
+
+    ///
+    /// Team Impl
+    /// =========
+
+    template<typename MemberType>
+    struct TeamPack<MemberType,Trans::NoTranspose> {
+      template<typename AViewType,
+               typename BViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const AViewType &A,
+             const int k,
+             const BViewType &B) {
+        static_assert(AViewType::rank == 3, "A should have three dimensions");
+        static_assert(BViewType::rank == 2, "B should have two dimensions");
+        enum : int { l = BViewType::non_const_value_type::vector_length };
+        const int nbatch = A.extent(0), offset = k*l, nv = (nbatch - offset < l ? nbatch - offset : l);
+        return TeamPackInternal::
+          invoke(member,
+                 nv,
+                 B.extent(0), B.extent(1),
+                 A.data()+offset*A.stride_0(), A.stride_0(), A.stride_1(), A.stride_2(),
+                 B.data(), B.stride_0(), B.stride_1());
+      }
+    };
+
+    template<typename MemberType>
+    struct TeamPack<MemberType,Trans::Transpose> {
+      template<typename AViewType,
+               typename BViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const AViewType &A,
+             const int k,
+             const BViewType &B) {
+        static_assert(AViewType::rank == 3, "A should have three dimensions");
+        static_assert(BViewType::rank == 2, "B should have two dimensions");
+        enum : int { l = BViewType::non_const_value_type::vector_length };
+        const int nbatch = A.extent(0), offset = k*l, nv = (nbatch - offset < l ? nbatch - offset : l);
+        return TeamPackInternal::
+          invoke(member,
+                 nv,
+                 B.extent(0), B.extent(1),
+                 A.data()+offset*A.stride_0(), A.stride_0(), A.stride_2(), A.stride_1(),
+                 B.data(), B.stride_0(), B.stride_1());
+      }
+    };
+
+    template<typename MemberType>
+    struct TeamUnpack<MemberType,Trans::NoTranspose> {
+      template<typename AViewType,
+               typename BViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const AViewType &A,
+             const int k,
+             const BViewType &B) {
+        static_assert(AViewType::rank == 2, "A should have two dimensions");
+        static_assert(BViewType::rank == 3, "B should have three dimensions");
+        enum : int { l = AViewType::non_const_value_type::vector_length };
+        const int nbatch = B.extent(0), offset = k*l, nv = (nbatch - offset < l ? nbatch - offset : l);
+        return TeamUnpackInternal::
+          invoke(member,
+                 nv,
+                 A.extent(0), A.extent(1),
+                 A.data(), A.stride_0(), A.stride_1(),
+                 B.data()+offset*B.stride_0(), B.stride_0(), B.stride_1(), B.stride_2());
+      }
+    };
+
+    template<typename MemberType>
+    struct TeamUnpack<MemberType,Trans::Transpose> {
+      template<typename AViewType,
+               typename BViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const AViewType &A,
+             const int k,
+             const BViewType &B) {
+        static_assert(AViewType::rank == 2, "A should have two dimensions");
+        static_assert(BViewType::rank == 3, "B should have three dimensions");
+        enum : int { l = AViewType::non_const_value_type::vector_length };
+        const int nbatch = B.extent(0), offset = k*l, nv = (nbatch - offset < l ? nbatch - offset : l);
+        return TeamUnpackInternal::
+          invoke(member,
+                 nv,
+                 A.extent(0), A.extent(1),
+                 A.data(), A.stride_0(), A.stride_1(),
+                 B.data()+offset*B.stride_0(), B.stride_0(), B.stride_2(), B.stride_1());
+      }
+    };
+
+  } // end namespace Experimental
+} //end namespace KokkosBatched
+
+
+#endif
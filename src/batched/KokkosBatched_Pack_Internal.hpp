@@ -0,0 +1,257 @@
+#ifndef __KOKKOSBATCHED_PACK_INTERNAL_HPP__
+#define __KOKKOSBATCHED_PACK_INTERNAL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+    ///
+    /// Serial Internal Impl
+    /// ====================
+
+    struct SerialPackInternal {
+      // b[v] = a[v*as] for v < nv; lanes v >= nv replicate lane nv-1
+      template<typename ValueType, int l>
+      KOKKOS_FORCEINLINE_FUNCTION
+      static void
+      gather(const int nv,
+             const ValueType *__restrict__ a, const int as,
+             /* */ Vector<SIMD<ValueType>,l> &b) {
+        if (nv == l && as == 1) {
+          b.loadUnaligned(a);
+        } else {
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+          for (int v=0;v<l;++v)
+            b[v] = a[(v < nv ? v : nv-1)*as];
+        }
+      }
+
+#if defined(__KOKKOSBATCHED_ENABLE_AVX__)
+#if defined(__AVX512F__)
+      KOKKOS_FORCEINLINE_FUNCTION
+      static void
+      gather(const int nv,
+             const double *__restrict__ a, const int as,
+             /* */ Vector<SIMD<double>,8> &b) {
+        if (nv == 8 && as != 1)
+          b = _mm512_i32gather_pd(_mm256_mullo_epi32(_mm256_set1_epi32(as),
+                                                     _mm256_setr_epi32(0,1,2,3,4,5,6,7)), a, 8);
+        else
+          gather<double,8>(nv, a, as, b);
+      }
+
+      KOKKOS_FORCEINLINE_FUNCTION
+      static void
+      gather(const int nv,
+             const float *__restrict__ a, const int as,
+             /* */ Vector<SIMD<float>,16> &b) {
+        if (nv == 16 && as != 1)
+          b = _mm512_i32gather_ps(_mm512_mullo_epi32(_mm512_set1_epi32(as),
+                                                     _mm512_setr_epi32(0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15)), a, 4);
+        else
+          gather<float,16>(nv, a, as, b);
+      }
+#endif
+#if defined(__AVX2__)
+      KOKKOS_FORCEINLINE_FUNCTION
+      static void
+      gather(const int nv,
+             const double *__restrict__ a, const int as,
+             /* */ Vector<SIMD<double>,4> &b) {
+        if (nv == 4 && as != 1)
+          b = _mm256_i32gather_pd(a, _mm_mullo_epi32(_mm_set1_epi32(as),
+                                                     _mm_setr_epi32(0,1,2,3)), 8);
+        else
+          gather<double,4>(nv, a, as, b);
+      }
+
+      KOKKOS_FORCEINLINE_FUNCTION
+      static void
+      gather(const int nv,
+             const float *__restrict__ a, const int as,
+             /* */ Vector<SIMD<float>,8> &b) {
+        if (nv == 8 && as != 1)
+          b = _mm256_i32gather_ps(a, _mm256_mullo_epi32(_mm256_set1_epi32(as),
+                                                        _mm256_setr_epi32(0,1,2,3,4,5,6,7)), 4);
+        else
+          gather<float,8>(nv, a, as, b);
+      }
+#endif
+#endif
+
+      template<typename ValueType, int l>
+      KOKKOS_FORCEINLINE_FUNCTION
+      static int
+      invoke(const int nv,
+             const int m,
+             const ValueType *__restrict__ A, const int as, const int as0,
+             /* */ Vector<SIMD<ValueType>,l> *__restrict__ B, const int bs0) {
+        for (int i=0;i<m;++i)
+          gather(nv, A+i*as0, as, B[i*bs0]);
+        return 0;
+      }
+
+      template<typename ValueType, int l>
+      KOKKOS_FORCEINLINE_FUNCTION
+      static int
+      invoke(const int nv,
+             const int m, const int n,
+             const ValueType *__restrict__ A, const int as, const int as0, const int as1,
+             /* */ Vector<SIMD<ValueType>,l> *__restrict__ B, const int bs0, const int bs1) {
+        if (nv <= 0) return 0;
+        // sweep each lane's matrix along its contiguous direction
+        if (as1 < as0)
+          for (int i=0;i<m;++i)
+            invoke(nv, n, A+i*as0, as, as1, B+i*bs0, bs1);
+        else
+          for (int j=0;j<n;++j)
+            invoke(nv, m, A+j*as1, as, as0, B+j*bs1, bs0);
+        return 0;
+      }
+    };
+
+    struct SerialUnpackInternal {
+      // b[v*bs] = a[v] for v < nv
+      template<typename ValueType, int l>
+      KOKKOS_FORCEINLINE_FUNCTION
+      static void
+      scatter(const int nv,
+              const Vector<SIMD<ValueType>,l> &a,
+              /* */ ValueType *__restrict__ b, const int bs) {
+        if (nv == l && bs == 1) {
+          a.storeUnaligned(b);
+        } else {
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+          for (int v=0;v<l;++v)
+            if (v < nv) b[v*bs] = a[v];
+        }
+      }
+
+#if defined(__KOKKOSBATCHED_ENABLE_AVX__)
+#if defined(__AVX512F__)
+      KOKKOS_FORCEINLINE_FUNCTION
+      static void
+      scatter(const int nv,
+              const Vector<SIMD<double>,8> &a,
+              /* */ double *__restrict__ b, const int bs) {
+        if (nv == 8 && bs != 1)
+          _mm512_i32scatter_pd(b, _mm256_mullo_epi32(_mm256_set1_epi32(bs),
+                                                     _mm256_setr_epi32(0,1,2,3,4,5,6,7)), a, 8);
+        else
+          scatter<double,8>(nv, a, b, bs);
+      }
+
+      KOKKOS_FORCEINLINE_FUNCTION
+      static void
+      scatter(const int nv,
+              const Vector<SIMD<float>,16> &a,
+              /* */ float *__restrict__ b, const int bs) {
+        if (nv == 16 && bs != 1)
+          _mm512_i32scatter_ps(b, _mm512_mullo_epi32(_mm512_set1_epi32(bs),
+                                                     _mm512_setr_epi32(0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15)), a, 4);
+        else
+          scatter<float,16>(nv, a, b, bs);
+      }
+#endif
+#endif
+
+      template<typename ValueType, int l>
+      KOKKOS_FORCEINLINE_FUNCTION
+      static int
+      invoke(const int nv,
+             const int m,
+             const Vector<SIMD<ValueType>,l> *__restrict__ A, const int as0,
+             /* */ ValueType *__restrict__ B, const int bs, const int bs0) {
+        for (int i=0;i<m;++i)
+          scatter(nv, A[i*as0], B+i*bs0, bs);
+        return 0;
+      }
+
+      template<typename ValueType, int l>
+      KOKKOS_FORCEINLINE_FUNCTION
+      static int
+      invoke(const int nv,
+             const int m, const int n,
+             const Vector<SIMD<ValueType>,l> *__restrict__ A, const int as0, const int as1,
+             /* */ ValueType *__restrict__ B, const int bs, const int bs0, const int bs1) {
+        if (nv <= 0) return 0;
+        if (bs1 < bs0)
+          for (int i=0;i<m;++i)
+            invoke(nv, n, A+i*as0, as1, B+i*bs0, bs, bs1);
+        else
+          for (int j=0;j<n;++j)
+            invoke(nv, m, A+j*as1, as0, B+j*bs1, bs, bs0);
+        return 0;
+      }
+    };
+
+    ///
+    /// Team Internal Impl
+    /// ==================
+
+    struct TeamPackInternal {
+      template<typename MemberType,
+               typename ValueType, int l>
+      KOKKOS_FORCEINLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const int nv,
+             const int m, const int n,
+             const ValueType *__restrict__ A, const int as, const int as0, const int as1,
+             /* */ Vector<SIMD<ValueType>,l> *__restrict__ B, const int bs0, const int bs1) {
+        if (nv <= 0) return 0;
+        if (m > n) {
+          Kokkos::parallel_for
+            (Kokkos::TeamThreadRange(member,0,m),[&](const int &i) {
+              SerialPackInternal::invoke(nv, n, A+i*as0, as, as1, B+i*bs0, bs1);
+            });
+        } else {
+          Kokkos::parallel_for
+            (Kokkos::TeamThreadRange(member,0,n),[&](const int &j) {
+              SerialPackInternal::invoke(nv, m, A+j*as1, as, as0, B+j*bs1, bs0);
+            });
+        }
+        //member.team_barrier();
+        return 0;
+      }
+    };
+
+    struct TeamUnpackInternal {
+      template<typename MemberType,
+               typename ValueType, int l>
+      KOKKOS_FORCEINLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const int nv,
+             const int m, const int n,
+             const Vector<SIMD<ValueType>,l> *__restrict__ A, const int as0, const int as1,
+             /* */ ValueType *__restrict__ B, const int bs, const int bs0, const int bs1) {
+        if (nv <= 0) return 0;
+        if (m > n) {
+          Kokkos::parallel_for
+            (Kokkos::TeamThreadRange(member,0,m),[&](const int &i) {
+              SerialUnpackInternal::invoke(nv, n, A+i*as0, as1, B+i*bs0, bs, bs1);
+            });
+        } else {
+          Kokkos::parallel_for
+            (Kokkos::TeamThreadRange(member,0,n),[&](const int &j) {
+              SerialUnpackInternal::invoke(nv, m, A+j*as1, as0, B+j*bs1, bs, bs0);
+            });
+        }
+        //member.team_barrier();
+        return 0;
+      }
+    };
+
+  }//  end namespace Experimental
+} // end namespace KokkosBatched
+
+
+#endif
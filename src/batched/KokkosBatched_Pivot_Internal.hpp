@@ -0,0 +1,175 @@
+#ifndef __KOKKOSBATCHED_PIVOT_INTERNAL_HPP__
+#define __KOKKOSBATCHED_PIVOT_INTERNAL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+
+    ///
+    /// Pivot type
+    /// ==========
+    ///
+    /// A scalar matrix stores one pivot index per row (int). A compact
+    /// Vector<SIMD<T>,l> matrix packs l independent problems, one per lane,
+    /// so each lane selects its own pivot row and the pivot is stored as
+    /// Vector<SIMD<int>,l>.
+
+    template<typename ValueType>
+    struct PivotTraits {
+      typedef ValueType value_type;
+      typedef int pivot_type;
+      enum : int { vector_length = 1 };
+
+      KOKKOS_FORCEINLINE_FUNCTION
+      static /* */ value_type& value(/* */ ValueType &a, const int &) { return a; }
+      KOKKOS_FORCEINLINE_FUNCTION
+      static const value_type& value(const ValueType &a, const int &) { return a; }
+      KOKKOS_FORCEINLINE_FUNCTION
+      static /* */ int& index(/* */ pivot_type &p, const int &) { return p; }
+      KOKKOS_FORCEINLINE_FUNCTION
+      static const int& index(const pivot_type &p, const int &) { return p; }
+    };
+
+    template<typename T, int l>
+    struct PivotTraits<Vector<SIMD<T>,l> > {
+      typedef T value_type;
+      typedef Vector<SIMD<int>,l> pivot_type;
+      enum : int { vector_length = l };
+
+      KOKKOS_FORCEINLINE_FUNCTION
+      static value_type& value(const Vector<SIMD<T>,l> &a, const int &v) { return a[v]; }
+      KOKKOS_FORCEINLINE_FUNCTION
+      static int& index(const pivot_type &p, const int &v) { return p[v]; }
+    };
+
+    ///
+    /// Serial Internal Impl
+    /// ====================
+
+    struct SerialFindPivotInternal {
+      // piv = offset + argmax_i |a(i)|, selected independently for each lane;
+      // returns 1 if the maximum is zero in any lane
+      template<typename ValueType,
+               typename PivotType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const int m,
+             const ValueType *__restrict__ a, const int as0,
+             const int offset,
+             /* */ PivotType &piv) {
+        typedef PivotTraits<ValueType> traits;
+        typedef typename traits::value_type value_type;
+        typedef Kokkos::Details::ArithTraits<value_type> ats;
+        typedef typename ats::mag_type mag_type;
+
+        int r_val = 0;
+        for (int v=0;v<traits::vector_length;++v) {
+          int idx = 0;
+          mag_type amax(-1);
+          for (int i=0;i<m;++i) {
+            const mag_type aval = ats::abs(traits::value(a[i*as0], v));
+            if (aval > amax) { amax = aval; idx = i; }
+          }
+          traits::index(piv, v) = offset + idx;
+          r_val |= (amax == mag_type(0));
+        }
+        return r_val;
+      }
+    };
+
+    struct SerialApplyPivotInternal {
+      // swap row p with row piv (per lane) across n columns
+      template<typename ValueType,
+               typename PivotType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const int n,
+             const int p,
+             const PivotType &piv,
+             /* */ ValueType *__restrict__ A, const int as0, const int as1) {
+        typedef PivotTraits<ValueType> traits;
+        typedef typename traits::value_type value_type;
+
+        for (int v=0;v<traits::vector_length;++v) {
+          const int q = traits::index(piv, v);
+          if (q != p) {
+            for (int j=0;j<n;++j) {
+              value_type
+                &ap = traits::value(A[p*as0+j*as1], v),
+                &aq = traits::value(A[q*as0+j*as1], v);
+              const value_type tmp = ap; ap = aq; aq = tmp;
+            }
+          }
+        }
+        return 0;
+      }
+
+      // apply the row interchanges ipiv(0:k) in order (forward)
+      template<typename ValueType,
+               typename PivotType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const int k,
+             const PivotType *__restrict__ ipiv, const int ips0,
+             const int n,
+             /* */ ValueType *__restrict__ A, const int as0, const int as1) {
+        for (int p=0;p<k;++p)
+          invoke(n, p, ipiv[p*ips0], A, as0, as1);
+        return 0;
+      }
+    };
+
+    ///
+    /// Team Internal Impl
+    /// ==================
+
+    struct TeamApplyPivotInternal {
+      // swap row p with row piv (per lane) across n columns; columns are
+      // distributed over the team
+      template<typename MemberType,
+               typename ValueType,
+               typename PivotType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const int n,
+             const int p,
+             const PivotType &piv,
+             /* */ ValueType *__restrict__ A, const int as0, const int as1) {
+        Kokkos::parallel_for
+          (Kokkos::TeamThreadRange(member,0,n),[&](const int &j) {
+            SerialApplyPivotInternal::invoke(1, p, piv, A+j*as1, as0, 0);
+          });
+        //member.team_barrier();
+        return 0;
+      }
+
+      template<typename MemberType,
+               typename ValueType,
+               typename PivotType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const int k,
+             const PivotType *__restrict__ ipiv, const int ips0,
+             const int n,
+             /* */ ValueType *__restrict__ A, const int as0, const int as1) {
+        // interchanges are sequential in p but independent across columns
+        Kokkos::parallel_for
+          (Kokkos::TeamThreadRange(member,0,n),[&](const int &j) {
+            SerialApplyPivotInternal::invoke(k, ipiv, ips0, 1, A+j*as1, as0, 0);
+          });
+        //member.team_barrier();
+        return 0;
+      }
+    };
+
+  }//  end namespace Experimental
+} // end namespace KokkosBatched
+
+
+#endif
@@ -0,0 +1,45 @@
+#ifndef __KOKKOSBATCHED_QR_DECL_HPP__
+#define __KOKKOSBATCHED_QR_DECL_HPP__
+
+
+#include "KokkosBatched_Vector.hpp"
+
+namespace KokkosBatched {
+  namespace Experimental {
+
+    ///
+    /// Householder QR A = Q R (geqr2)
+    ///
+    /// On return the upper triangle of A holds R and the entries below the
+    /// diagonal hold the Householder vectors (unit leading entry implied);
+    /// t(p), p < min(m,n), holds the reflector coefficients so that
+    /// Q = H(0) H(1) ... H(k-1) with H(p) = I - t(p) u u^H. Use ApplyQ to
+    /// form Q B or Q^H B.
+    ///
+      
+    template<typename ArgAlgo>
+    struct SerialQR {
+      template<typename AViewType,
+               typename tViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const AViewType &A,
+             const tViewType &t);
+    };       
+
+    template<typename MemberType,
+             typename ArgAlgo>
+    struct TeamQR {
+      template<typename AViewType,
+               typename tViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member, 
+             const AViewType &A,
+             const tViewType &t);
+    };       
+      
+  }
+}
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef __KOKKOSBATCHED_QR_SERIAL_IMPL_HPP__
+#define __KOKKOSBATCHED_QR_SERIAL_IMPL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_QR_Serial_Internal.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+    ///
+    /// Serial Impl
+    /// ===========
+
+    template<>
+    template<typename AViewType,
+             typename tViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialQR<Algo::QR::Unblocked>::
+    invoke(const AViewType &A,
+           const tViewType &t) {
+      static_assert(tViewType::rank == 1, "t should have one dimension");
+      return SerialQR_Internal<Algo::QR::Unblocked>::invoke(A.extent(0), A.extent(1),
+                                                            A.data(), A.stride_0(), A.stride_1(),
+                                                            t.data(), t.stride_0());
+    }
+
+  }
+}
+
+#endif
@@ -0,0 +1,33 @@
+#ifndef __KOKKOSBATCHED_QR_TEAM_IMPL_HPP__
+#define __KOKKOSBATCHED_QR_TEAM_IMPL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_QR_Team_Internal.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+    ///
+    /// Team Impl
+    /// =========
+    
+    template<typename MemberType>
+    struct TeamQR<MemberType,Algo::QR::Unblocked> {
+      template<typename AViewType,
+               typename tViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member, const AViewType &A, const tViewType &t) {
+        static_assert(tViewType::rank == 1, "t should have one dimension");
+        return TeamQR_Internal<Algo::QR::Unblocked>::invoke(member,
+                                                            A.extent(0), A.extent(1),
+                                                            A.data(), A.stride_0(), A.stride_1(),
+                                                            t.data(), t.stride_0());
+      }
+    };
+
+  }
+}
+
+#endif
@@ -0,0 +1,81 @@
+#ifndef __KOKKOSBATCHED_QR_TEAM_INTERNAL_HPP__
+#define __KOKKOSBATCHED_QR_TEAM_INTERNAL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+#include "KokkosBatched_Householder_Serial_Internal.hpp"
+#include "KokkosBatched_Householder_Team_Internal.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+  
+    ///
+    /// Team Internal Impl
+    /// ==================
+
+    template<typename AlgoType>
+    struct TeamQR_Internal {
+      template<typename MemberType, typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static int 
+      invoke(const MemberType &member,
+             const int m, const int n,
+             ValueType *__restrict__ A, const int as0, const int as1,
+             ValueType *__restrict__ t, const int ts0);
+    };
+
+    template<>
+    template<typename MemberType, typename ValueType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    TeamQR_Internal<Algo::QR::Unblocked>::
+    invoke(const MemberType &member,
+           const int m, const int n,
+           ValueType *__restrict__ A, const int as0, const int as1,
+           ValueType *__restrict__ t, const int ts0) {
+      typedef Kokkos::Details::ArithTraits<ValueType> ats;
+
+      const int k = (m < n ? m : n);
+      if (k <= 0) return 0;
+
+      for (int p=0;p<k;++p) {
+        const int m_A22 = m-p-1, n_A22 = n-p-1;
+
+        ValueType
+          *__restrict__ alpha11 = A+(p  )*as0+(p  )*as1,
+          *__restrict__ a21     = A+(p+1)*as0+(p  )*as1,
+          *__restrict__ a12t    = A+(p  )*as0+(p+1)*as1,
+          *__restrict__ A22     = A+(p+1)*as0+(p+1)*as1;
+
+        // every thread evaluates the reflector (read only) so that tau does
+        // not need to be broadcast
+        ValueType tau, beta, scale;
+        SerialLeftHouseholderInternal::parameters(m_A22, *alpha11, a21, as0, tau, beta, scale);
+        member.team_barrier();
+
+        if (member.team_rank() == 0) {
+          *alpha11 = beta;
+          t[p*ts0] = tau;
+        }
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(member,0,m_A22),[&](const int &i) {
+            a21[i*as0] *= scale;
+          });
+        member.team_barrier();
+
+        // [a12t; A22] := H^H [a12t; A22]
+        TeamApplyLeftHouseholderInternal::invoke(member,
+                                                 m_A22, n_A22, ats::conj(tau), 
+                                                 a21, as0, 
+                                                 a12t, as1, 
+                                                 A22, as0, as1);
+        member.team_barrier();
+      }
+      return 0;
+    }
+
+  }
+}
+
+#endif
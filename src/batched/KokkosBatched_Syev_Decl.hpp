@@ -0,0 +1,55 @@
+#ifndef __KOKKOSBATCHED_SYEV_DECL_HPP__
+#define __KOKKOSBATCHED_SYEV_DECL_HPP__
+
+
+#include "KokkosBatched_Vector.hpp"
+
+namespace KokkosBatched {
+  namespace Experimental {
+
+    ///
+    /// Eigendecomposition of a real symmetric matrix A = V diag(w) V^T (syev)
+    ///
+    /// A (m x m) is used as workspace, w (m) returns the eigenvalues in ascending
+    /// order and the columns of V (m x m) are the orthonormal eigenvectors.
+    /// For Vector<SIMD<T>,l> values each lane is an independent problem.
+    ///
+    /// Algo::Syev::Jacobi     - cyclic Jacobi rotations; the rotations are
+    ///                          applied to all lanes at once
+    /// Algo::Syev::ClosedForm - trigonometric eigenvalues and cross product
+    ///                          eigenvectors for m = 3; other sizes use Jacobi
+    ///
+    /// A nonzero return value indicates Jacobi did not converge (in at least
+    /// one lane) within the maximum number of sweeps.
+    ///
+      
+    template<typename ArgAlgo>
+    struct SerialSyev {
+      template<typename AViewType,
+               typename wViewType,
+               typename VViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const AViewType &A,
+             const wViewType &w,
+             const VViewType &V);
+    };       
+
+    template<typename MemberType,
+             typename ArgAlgo>
+    struct TeamSyev {
+      template<typename AViewType,
+               typename wViewType,
+               typename VViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member, 
+             const AViewType &A,
+             const wViewType &w,
+             const VViewType &V);
+    };       
+      
+  }
+}
+
+#endif
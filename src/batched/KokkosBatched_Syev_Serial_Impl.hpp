@@ -0,0 +1,54 @@
+#ifndef __KOKKOSBATCHED_SYEV_SERIAL_IMPL_HPP__
+#define __KOKKOSBATCHED_SYEV_SERIAL_IMPL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Syev_Serial_Internal.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+    ///
+    /// Serial Impl
+    /// ===========
+
+    template<>
+    template<typename AViewType,
+             typename wViewType,
+             typename VViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialSyev<Algo::Syev::Jacobi>::
+    invoke(const AViewType &A,
+           const wViewType &w,
+           const VViewType &V) {
+      static_assert(wViewType::rank == 1, "w should have one dimension");
+      assert(A.extent(0)==A.extent(1));
+      return SerialSyevInternal<Algo::Syev::Jacobi>::invoke(A.extent(0),
+                                                         A.data(), A.stride_0(), A.stride_1(),
+                                                         w.data(), w.stride_0(),
+                                                         V.data(), V.stride_0(), V.stride_1());
+    }
+
+    template<>
+    template<typename AViewType,
+             typename wViewType,
+             typename VViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialSyev<Algo::Syev::ClosedForm>::
+    invoke(const AViewType &A,
+           const wViewType &w,
+           const VViewType &V) {
+      static_assert(wViewType::rank == 1, "w should have one dimension");
+      assert(A.extent(0)==A.extent(1));
+      return SerialSyevInternal<Algo::Syev::ClosedForm>::invoke(A.extent(0),
+                                                         A.data(), A.stride_0(), A.stride_1(),
+                                                         w.data(), w.stride_0(),
+                                                         V.data(), V.stride_0(), V.stride_1());
+    }
+
+  }
+}
+
+#endif
@@ -0,0 +1,421 @@
+#ifndef __KOKKOSBATCHED_SYEV_SERIAL_INTERNAL_HPP__
+#define __KOKKOSBATCHED_SYEV_SERIAL_INTERNAL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+#include "KokkosBatched_Pivot_Internal.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+
+    ///
+    /// Serial Internal Impl
+    /// ====================
+
+    struct SerialJacobiRotationInternal {
+      // c, s, t = s/c of the rotation annihilating apq, computed per lane
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static void
+      invoke(const ValueType &app, const ValueType &aqq, const ValueType &apq,
+             /* */ ValueType &c, ValueType &s, ValueType &t) {
+        typedef PivotTraits<ValueType> traits;
+        typedef typename traits::value_type value_type;
+        typedef Kokkos::Details::ArithTraits<value_type> ats;
+
+        const value_type zero(0), one(1), two(2);
+        for (int v=0;v<traits::vector_length;++v) {
+          const value_type
+            d    = traits::value(aqq, v) - traits::value(app, v),
+            apq2 = two*traits::value(apq, v),
+            den  = ats::abs(d) + ats::sqrt(d*d + apq2*apq2),
+            tv   = den == zero ? zero : (d < zero ? -apq2 : apq2)/den,
+            cv   = one/ats::sqrt(one + tv*tv);
+          traits::value(c, v) = cv;
+          traits::value(s, v) = tv*cv;
+          traits::value(t, v) = tv;
+        }
+      }
+    };
+
+    struct SerialSyevConvergedInternal {
+      // off <= tol in every lane
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static bool
+      invoke(const ValueType &off, const ValueType &tol) {
+        typedef PivotTraits<ValueType> traits;
+
+        bool r_val = true;
+        for (int v=0;v<traits::vector_length;++v)
+          r_val &= (traits::value(off, v) <= traits::value(tol, v));
+        return r_val;
+      }
+    };
+
+    struct SerialSyevSortInternal {
+      // sort w ascending and permute the columns of V accordingly, per lane
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const int m,
+             /* */ ValueType *__restrict__ w, const int ws0,
+             /* */ ValueType *__restrict__ V, const int vs0, const int vs1) {
+        typedef PivotTraits<ValueType> traits;
+        typedef typename traits::value_type value_type;
+
+        for (int v=0;v<traits::vector_length;++v) {
+          for (int i=0;i<(m-1);++i) {
+            int k = i;
+            for (int j=i+1;j<m;++j)
+              if (traits::value(w[j*ws0], v) < traits::value(w[k*ws0], v)) k = j;
+            if (k != i) {
+              value_type &wi = traits::value(w[i*ws0], v), &wk = traits::value(w[k*ws0], v);
+              const value_type tmp = wi; wi = wk; wk = tmp;
+              for (int r=0;r<m;++r) {
+                value_type
+                  &vi = traits::value(V[r*vs0+i*vs1], v),
+                  &vk = traits::value(V[r*vs0+k*vs1], v);
+                const value_type tmp = vi; vi = vk; vk = tmp;
+              }
+            }
+          }
+        }
+        return 0;
+      }
+    };
+
+    struct SerialSyev3x3Internal {
+      // Eberly, A robust eigensolver for 3x3 symmetric matrices (2014);
+      // scalar kernel, eigenvalues ascending and eigenvectors in columns of e
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static void
+      cross(const ValueType *__restrict__ u, const ValueType *__restrict__ v,
+            /* */ ValueType *__restrict__ r) {
+        r[0] = u[1]*v[2] - u[2]*v[1];
+        r[1] = u[2]*v[0] - u[0]*v[2];
+        r[2] = u[0]*v[1] - u[1]*v[0];
+      }
+
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static ValueType
+      dot(const ValueType *__restrict__ u, const ValueType *__restrict__ v) {
+        return u[0]*v[0] + u[1]*v[1] + u[2]*v[2];
+      }
+
+      // eigenvector of a simple eigenvalue; rows of A - lambda I span a plane
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static void
+      eigenvector0(const ValueType a[3][3], const ValueType lambda,
+                   /* */ ValueType *__restrict__ e) {
+        typedef Kokkos::Details::ArithTraits<ValueType> ats;
+
+        const ValueType
+          r0[3] = { a[0][0] - lambda, a[0][1], a[0][2] },
+          r1[3] = { a[0][1], a[1][1] - lambda, a[1][2] },
+          r2[3] = { a[0][2], a[1][2], a[2][2] - lambda };
+        ValueType c[3][3];
+        cross(r0, r1, c[0]);
+        cross(r0, r2, c[1]);
+        cross(r1, r2, c[2]);
+
+        const ValueType d[3] = { dot(c[0], c[0]), dot(c[1], c[1]), dot(c[2], c[2]) };
+        int imax = 0;
+        if (d[1] > d[imax]) imax = 1;
+        if (d[2] > d[imax]) imax = 2;
+
+        const ValueType inv = ValueType(1)/ats::sqrt(d[imax]);
+        for (int i=0;i<3;++i) e[i] = c[imax][i]*inv;
+      }
+
+      // eigenvector of lambda orthogonal to e0; solves the 2x2 problem on
+      // the orthogonal complement of e0
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static void
+      eigenvector1(const ValueType a[3][3], const ValueType *__restrict__ e0, const ValueType lambda,
+                   /* */ ValueType *__restrict__ e) {
+        typedef Kokkos::Details::ArithTraits<ValueType> ats;
+
+        const ValueType zero(0), one(1);
+        ValueType u[3], v[3];
+        if (ats::abs(e0[0]) > ats::abs(e0[1])) {
+          const ValueType inv = one/ats::sqrt(e0[0]*e0[0] + e0[2]*e0[2]);
+          u[0] = -e0[2]*inv; u[1] = zero; u[2] = e0[0]*inv;
+        } else {
+          const ValueType inv = one/ats::sqrt(e0[1]*e0[1] + e0[2]*e0[2]);
+          u[0] = zero; u[1] = e0[2]*inv; u[2] = -e0[1]*inv;
+        }
+        cross(e0, u, v);
+
+        ValueType au[3], av[3];
+        for (int i=0;i<3;++i) {
+          au[i] = a[i][0]*u[0] + a[i][1]*u[1] + a[i][2]*u[2];
+          av[i] = a[i][0]*v[0] + a[i][1]*v[1] + a[i][2]*v[2];
+        }
+
+        ValueType
+          m00 = dot(u, au) - lambda,
+          m01 = dot(u, av),
+          m11 = dot(v, av) - lambda;
+
+        const ValueType
+          abs_m00 = ats::abs(m00),
+          abs_m01 = ats::abs(m01),
+          abs_m11 = ats::abs(m11);
+
+        if (abs_m00 >= abs_m11) {
+          if ((abs_m00 > abs_m01 ? abs_m00 : abs_m01) > zero) {
+            if (abs_m00 >= abs_m01) {
+              m01 /= m00; m00 = one/ats::sqrt(one + m01*m01); m01 *= m00;
+            } else {
+              m00 /= m01; m01 = one/ats::sqrt(one + m00*m00); m00 *= m01;
+            }
+            for (int i=0;i<3;++i) e[i] = m01*u[i] - m00*v[i];
+          } else {
+            for (int i=0;i<3;++i) e[i] = u[i];
+          }
+        } else {
+          if ((abs_m11 > abs_m01 ? abs_m11 : abs_m01) > zero) {
+            if (abs_m11 >= abs_m01) {
+              m01 /= m11; m11 = one/ats::sqrt(one + m01*m01); m01 *= m11;
+            } else {
+              m11 /= m01; m01 = one/ats::sqrt(one + m11*m11); m11 *= m01;
+            }
+            for (int i=0;i<3;++i) e[i] = m11*u[i] - m01*v[i];
+          } else {
+            for (int i=0;i<3;++i) e[i] = u[i];
+          }
+        }
+      }
+
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static void
+      invoke(/* */ ValueType a[3][3],
+             /* */ ValueType *__restrict__ w,
+             /* */ ValueType e[3][3]) {
+        typedef Kokkos::Details::ArithTraits<ValueType> ats;
+
+        const ValueType zero(0), one(1), two(2), three(3), six(6);
+
+        // scale by the largest entry to avoid overflow
+        ValueType amax(0);
+        for (int i=0;i<3;++i)
+          for (int j=i;j<3;++j) {
+            const ValueType aij = ats::abs(a[i][j]);
+            amax = aij > amax ? aij : amax;
+          }
+
+        for (int i=0;i<3;++i)
+          for (int j=0;j<3;++j)
+            e[i][j] = (i == j ? one : zero);
+
+        if (amax == zero) {
+          w[0] = zero; w[1] = zero; w[2] = zero;
+          return;
+        }
+
+        const ValueType inv_amax = one/amax;
+        for (int i=0;i<3;++i)
+          for (int j=0;j<3;++j)
+            a[i][j] = a[i][j]*inv_amax;
+
+        const ValueType norm = a[0][1]*a[0][1] + a[0][2]*a[0][2] + a[1][2]*a[1][2];
+        if (norm > zero) {
+          const ValueType
+            q = (a[0][0] + a[1][1] + a[2][2])/three,
+            b00 = a[0][0] - q, b11 = a[1][1] - q, b22 = a[2][2] - q,
+            p = ats::sqrt((b00*b00 + b11*b11 + b22*b22 + two*norm)/six),
+            c00 = b11*b22 - a[1][2]*a[1][2],
+            c01 = a[0][1]*b22 - a[1][2]*a[0][2],
+            c02 = a[0][1]*a[1][2] - b11*a[0][2],
+            det = (b00*c00 - a[0][1]*c01 + a[0][2]*c02)/(p*p*p);
+
+          ValueType half_det = det/two;
+          half_det = half_det < -one ? -one : half_det;
+          half_det = half_det >  one ?  one : half_det;
+
+          const ValueType
+            two_thirds_pi = 2.09439510239319549,
+            angle = ats::acos(half_det)/three,
+            beta2 = two*ats::cos(angle),
+            beta0 = two*ats::cos(angle + two_thirds_pi),
+            beta1 = -(beta0 + beta2);
+
+          w[0] = q + p*beta0;
+          w[1] = q + p*beta1;
+          w[2] = q + p*beta2;
+
+          ValueType e0[3], e1[3], e2[3];
+          if (half_det >= zero) {
+            eigenvector0(a, w[2], e2);
+            eigenvector1(a, e2, w[1], e1);
+            cross(e1, e2, e0);
+          } else {
+            eigenvector0(a, w[0], e0);
+            eigenvector1(a, e0, w[1], e1);
+            cross(e0, e1, e2);
+          }
+          for (int i=0;i<3;++i) {
+            e[i][0] = e0[i]; e[i][1] = e1[i]; e[i][2] = e2[i];
+          }
+
+          // acos near a repeated root only resolves sqrt(eps); the Rayleigh
+          // quotients of the orthonormal eigenvectors are accurate to eps
+          for (int j=0;j<3;++j) {
+            ValueType ae[3];
+            for (int i=0;i<3;++i)
+              ae[i] = a[i][0]*e[0][j] + a[i][1]*e[1][j] + a[i][2]*e[2][j];
+            w[j] = ae[0]*e[0][j] + ae[1]*e[1][j] + ae[2]*e[2][j];
+          }
+        } else {
+          // diagonal matrix
+          for (int i=0;i<3;++i) w[i] = a[i][i];
+        }
+
+        for (int i=0;i<2;++i) {
+          int k = i;
+          for (int j=i+1;j<3;++j)
+            if (w[j] < w[k]) k = j;
+          if (k != i) {
+            const ValueType tmp = w[i]; w[i] = w[k]; w[k] = tmp;
+            for (int r=0;r<3;++r) {
+              const ValueType tmp = e[r][i]; e[r][i] = e[r][k]; e[r][k] = tmp;
+            }
+          }
+        }
+
+        for (int i=0;i<3;++i)
+          w[i] *= amax;
+      }
+    };
+
+    template<typename AlgoType>
+    struct SerialSyevInternal {
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const int m,
+             /* */ ValueType *__restrict__ A, const int as0, const int as1,
+             /* */ ValueType *__restrict__ w, const int ws0,
+             /* */ ValueType *__restrict__ V, const int vs0, const int vs1);
+    };
+
+    template<>
+    template<typename ValueType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialSyevInternal<Algo::Syev::Jacobi>::
+    invoke(const int m,
+           /* */ ValueType *__restrict__ A, const int as0, const int as1,
+           /* */ ValueType *__restrict__ w, const int ws0,
+           /* */ ValueType *__restrict__ V, const int vs0, const int vs1) {
+      typedef typename PivotTraits<ValueType>::value_type value_type;
+      typedef Kokkos::Details::ArithTraits<value_type> ats;
+      enum : int { max_sweeps = 30 };
+
+      const ValueType zero(0), one(1);
+
+      for (int i=0;i<m;++i)
+        for (int j=0;j<m;++j)
+          V[i*vs0+j*vs1] = (i == j ? one : zero);
+      if (m <= 0) return 0;
+
+      // converged when the off diagonal part is below eps ||A||_F
+      ValueType tol(0);
+      for (int i=0;i<m;++i)
+        for (int j=0;j<m;++j)
+          tol += A[i*as0+j*as1]*A[i*as0+j*as1];
+      tol *= (ats::epsilon()*ats::epsilon());
+
+      int r_val = 1;
+      for (int sweep=0;sweep<=max_sweeps;++sweep) {
+        ValueType off(0);
+        for (int p=0;p<m;++p)
+          for (int q=p+1;q<m;++q)
+            off += A[p*as0+q*as1]*A[p*as0+q*as1];
+        if (SerialSyevConvergedInternal::invoke(off, tol)) {
+          r_val = 0;
+          break;
+        }
+        if (sweep == max_sweeps) break;
+
+        // cyclic-by-row sweep
+        for (int p=0;p<m;++p)
+          for (int q=p+1;q<m;++q) {
+            ValueType
+              &app = A[p*as0+p*as1],
+              &aqq = A[q*as0+q*as1],
+              &apq = A[p*as0+q*as1];
+
+            ValueType c, s, t;
+            SerialJacobiRotationInternal::invoke(app, aqq, apq, c, s, t);
+
+            const ValueType tapq = t*apq;
+            app -= tapq;
+            aqq += tapq;
+            apq = zero;
+            A[q*as0+p*as1] = zero;
+
+            for (int k=0;k<m;++k) {
+              if (k != p && k != q) {
+                const ValueType akp = A[k*as0+p*as1], akq = A[k*as0+q*as1];
+                A[k*as0+p*as1] = A[p*as0+k*as1] = c*akp - s*akq;
+                A[k*as0+q*as1] = A[q*as0+k*as1] = s*akp + c*akq;
+              }
+              const ValueType vkp = V[k*vs0+p*vs1], vkq = V[k*vs0+q*vs1];
+              V[k*vs0+p*vs1] = c*vkp - s*vkq;
+              V[k*vs0+q*vs1] = s*vkp + c*vkq;
+            }
+          }
+      }
+
+      for (int i=0;i<m;++i)
+        w[i*ws0] = A[i*as0+i*as1];
+      SerialSyevSortInternal::invoke(m, w, ws0, V, vs0, vs1);
+
+      return r_val;
+    }
+
+    template<>
+    template<typename ValueType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialSyevInternal<Algo::Syev::ClosedForm>::
+    invoke(const int m,
+           /* */ ValueType *__restrict__ A, const int as0, const int as1,
+           /* */ ValueType *__restrict__ w, const int ws0,
+           /* */ ValueType *__restrict__ V, const int vs0, const int vs1) {
+      typedef PivotTraits<ValueType> traits;
+      typedef typename traits::value_type value_type;
+
+      if (m != 3)
+        return SerialSyevInternal<Algo::Syev::Jacobi>::invoke(m, A, as0, as1, w, ws0, V, vs0, vs1);
+
+      for (int v=0;v<traits::vector_length;++v) {
+        value_type a[3][3], wv[3], e[3][3];
+        for (int i=0;i<3;++i)
+          for (int j=0;j<3;++j)
+            a[i][j] = traits::value(A[i*as0+j*as1], v);
+
+        SerialSyev3x3Internal::invoke(a, wv, e);
+
+        for (int i=0;i<3;++i) {
+          traits::value(w[i*ws0], v) = wv[i];
+          for (int j=0;j<3;++j)
+            traits::value(V[i*vs0+j*vs1], v) = e[i][j];
+        }
+      }
+      return 0;
+    }
+
+  }
+}
+
+#endif
@@ -0,0 +1,60 @@
+#ifndef __KOKKOSBATCHED_SYEV_TEAM_IMPL_HPP__
+#define __KOKKOSBATCHED_SYEV_TEAM_IMPL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Syev_Team_Internal.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+    ///
+    /// Team Impl
+    /// =========
+
+    template<typename MemberType>
+    struct TeamSyev<MemberType,Algo::Syev::Jacobi> {
+      template<typename AViewType,
+               typename wViewType,
+               typename VViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const AViewType &A,
+             const wViewType &w,
+             const VViewType &V) {
+        static_assert(wViewType::rank == 1, "w should have one dimension");
+        assert(A.extent(0)==A.extent(1));
+        return TeamSyevInternal<Algo::Syev::Jacobi>::invoke(member,
+                                                         A.extent(0),
+                                                         A.data(), A.stride_0(), A.stride_1(),
+                                                         w.data(), w.stride_0(),
+                                                         V.data(), V.stride_0(), V.stride_1());
+      }
+    };
+
+    template<typename MemberType>
+    struct TeamSyev<MemberType,Algo::Syev::ClosedForm> {
+      template<typename AViewType,
+               typename wViewType,
+               typename VViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const AViewType &A,
+             const wViewType &w,
+             const VViewType &V) {
+        static_assert(wViewType::rank == 1, "w should have one dimension");
+        assert(A.extent(0)==A.extent(1));
+        return TeamSyevInternal<Algo::Syev::ClosedForm>::invoke(member,
+                                                         A.extent(0),
+                                                         A.data(), A.stride_0(), A.stride_1(),
+                                                         w.data(), w.stride_0(),
+                                                         V.data(), V.stride_0(), V.stride_1());
+      }
+    };
+
+  }
+}
+
+#endif
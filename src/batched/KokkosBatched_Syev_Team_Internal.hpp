@@ -0,0 +1,137 @@
+#ifndef __KOKKOSBATCHED_SYEV_TEAM_INTERNAL_HPP__
+#define __KOKKOSBATCHED_SYEV_TEAM_INTERNAL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+#include "KokkosBatched_Syev_Serial_Internal.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+
+    ///
+    /// Team Internal Impl
+    /// ==================
+
+    template<typename AlgoType>
+    struct TeamSyevInternal {
+      template<typename MemberType, typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const int m,
+             /* */ ValueType *__restrict__ A, const int as0, const int as1,
+             /* */ ValueType *__restrict__ w, const int ws0,
+             /* */ ValueType *__restrict__ V, const int vs0, const int vs1);
+    };
+
+    template<>
+    template<typename MemberType, typename ValueType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    TeamSyevInternal<Algo::Syev::Jacobi>::
+    invoke(const MemberType &member,
+           const int m,
+           /* */ ValueType *__restrict__ A, const int as0, const int as1,
+           /* */ ValueType *__restrict__ w, const int ws0,
+           /* */ ValueType *__restrict__ V, const int vs0, const int vs1) {
+      typedef typename PivotTraits<ValueType>::value_type value_type;
+      typedef Kokkos::Details::ArithTraits<value_type> ats;
+      enum : int { max_sweeps = 30 };
+
+      const ValueType zero(0), one(1);
+
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(member,0,m),[&](const int &i) {
+          for (int j=0;j<m;++j)
+            V[i*vs0+j*vs1] = (i == j ? one : zero);
+        });
+      if (m <= 0) return 0;
+
+      // the norms are evaluated redundantly by every thread so that all
+      // threads agree on convergence
+      ValueType tol(0);
+      for (int i=0;i<m;++i)
+        for (int j=0;j<m;++j)
+          tol += A[i*as0+j*as1]*A[i*as0+j*as1];
+      tol *= (ats::epsilon()*ats::epsilon());
+      member.team_barrier();
+
+      int r_val = 1;
+      for (int sweep=0;sweep<=max_sweeps;++sweep) {
+        ValueType off(0);
+        for (int p=0;p<m;++p)
+          for (int q=p+1;q<m;++q)
+            off += A[p*as0+q*as1]*A[p*as0+q*as1];
+        if (SerialSyevConvergedInternal::invoke(off, tol)) {
+          r_val = 0;
+          break;
+        }
+        if (sweep == max_sweeps) break;
+
+        for (int p=0;p<m;++p)
+          for (int q=p+1;q<m;++q) {
+            const ValueType apq = A[p*as0+q*as1];
+
+            ValueType c, s, t;
+            SerialJacobiRotationInternal::invoke(A[p*as0+p*as1], A[q*as0+q*as1], apq, c, s, t);
+            member.team_barrier();
+
+            // thread k owns row k and column k outside the (p,q) block
+            Kokkos::parallel_for(Kokkos::TeamThreadRange(member,0,m),[&](const int &k) {
+                if (k != p && k != q) {
+                  const ValueType akp = A[k*as0+p*as1], akq = A[k*as0+q*as1];
+                  A[k*as0+p*as1] = A[p*as0+k*as1] = c*akp - s*akq;
+                  A[k*as0+q*as1] = A[q*as0+k*as1] = s*akp + c*akq;
+                }
+                const ValueType vkp = V[k*vs0+p*vs1], vkq = V[k*vs0+q*vs1];
+                V[k*vs0+p*vs1] = c*vkp - s*vkq;
+                V[k*vs0+q*vs1] = s*vkp + c*vkq;
+              });
+            if (member.team_rank() == 0) {
+              const ValueType tapq = t*apq;
+              A[p*as0+p*as1] -= tapq;
+              A[q*as0+q*as1] += tapq;
+              A[p*as0+q*as1] = zero;
+              A[q*as0+p*as1] = zero;
+            }
+            member.team_barrier();
+          }
+      }
+
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(member,0,m),[&](const int &i) {
+          w[i*ws0] = A[i*as0+i*as1];
+        });
+      member.team_barrier();
+      if (member.team_rank() == 0)
+        SerialSyevSortInternal::invoke(m, w, ws0, V, vs0, vs1);
+      member.team_barrier();
+
+      return r_val;
+    }
+
+    template<>
+    template<typename MemberType, typename ValueType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    TeamSyevInternal<Algo::Syev::ClosedForm>::
+    invoke(const MemberType &member,
+           const int m,
+           /* */ ValueType *__restrict__ A, const int as0, const int as1,
+           /* */ ValueType *__restrict__ w, const int ws0,
+           /* */ ValueType *__restrict__ V, const int vs0, const int vs1) {
+      if (m != 3)
+        return TeamSyevInternal<Algo::Syev::Jacobi>::invoke(member, m, A, as0, as1, w, ws0, V, vs0, vs1);
+
+      // a 3x3 problem has no team parallelism to exploit
+      if (member.team_rank() == 0)
+        SerialSyevInternal<Algo::Syev::ClosedForm>::invoke(m, A, as0, as1, w, ws0, V, vs0, vs1);
+      member.team_barrier();
+
+      return 0;
+    }
+
+  }
+}
+
+#endif
@@ -274,6 +274,11 @@ namespace KokkosBatched {
       using Trsm = Level3;
       using LU   = Level3;
       using InverseLU   = Level3;
+      using Gesv = Level3;
+      using Cholesky = Level3;
+      using QR = Level3;
+      using ApplyQ = Level3;
+      using BlockTridiag = Level3;
 
       struct Level2 {
 	struct Unblocked {};
@@ -300,6 +305,15 @@ namespace KokkosBatched {
       using Gemv = Level2;
       using Trsv = Level2;
 
+      struct Syev {
+	struct Jacobi {
+	  static const char* name() { return "Jacobi"; }
+	};
+	struct ClosedForm {
+	  static const char* name() { return "ClosedForm"; }
+	};
+      };
+
       //         struct Level1 {
       //           struct Unblocked {};
       //           struct Blocked {
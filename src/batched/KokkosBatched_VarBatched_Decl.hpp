@@ -0,0 +1,65 @@
+#ifndef __KOKKOSBATCHED_VAR_BATCHED_DECL_HPP__
+#define __KOKKOSBATCHED_VAR_BATCHED_DECL_HPP__
+
+
+#include "KokkosBatched_Vector.hpp"
+
+namespace KokkosBatched {
+  namespace Experimental {
+
+    ///
+    /// Variable size batched Gemm and LU
+    /// =================================
+    ///
+    /// Entry p of the batch is a column major matrix stored contiguously in
+    /// a flat rank-1 view starting at offset(p); its leading dimension is its
+    /// number of rows. The sizes and offsets are rank-1 int views of length
+    /// nbatch in the memory space of the values.
+    ///
+    /// Unlike the Serial/Team kernels these are host drivers. The entries
+    /// are sorted by decreasing work with identical sizes adjacent, then
+    ///  - entries with all dimensions <= max_serial_size run one per thread
+    ///    in a single dynamically scheduled launch; square 2..8 entries use
+    ///    the fixed-size kernels (SerialGemmFixed, SerialLUFixed),
+    ///  - larger entries run one per team in a second launch.
+    /// Largest-first ordering with dynamic scheduling balances the load
+    /// across size groups without padding to the largest size.
+    ///
+
+    struct VarBatchedTraits {
+      enum : int { max_serial_size = 8 };
+    };
+
+    template<typename ArgTransA,
+             typename ArgTransB>
+    struct VarBatchedGemm {
+      // C(p) = beta C(p) + alpha op(A(p)) op(B(p)), op is NoTranspose or Transpose
+      // C(p) is m(p) x n(p) and op(A(p)) is m(p) x k(p)
+      template<typename ScalarType,
+               typename SizeViewType,
+               typename AViewType,
+               typename BViewType,
+               typename CViewType>
+      static int
+      invoke(const ScalarType alpha,
+             const SizeViewType &m, const SizeViewType &n, const SizeViewType &k,
+             const AViewType &A, const SizeViewType &a_offset,
+             const BViewType &B, const SizeViewType &b_offset,
+             const ScalarType beta,
+             const CViewType &C, const SizeViewType &c_offset);
+    };
+
+    struct VarBatchedLU {
+      // no piv LU of the n(p) x n(p) matrices A(p)
+      template<typename SizeViewType,
+               typename AViewType>
+      static int
+      invoke(const SizeViewType &n,
+             const AViewType &A, const SizeViewType &a_offset,
+             const typename MagnitudeScalarType<typename AViewType::non_const_value_type>::type tiny = 0);
+    };
+
+  }
+}
+
+#endif
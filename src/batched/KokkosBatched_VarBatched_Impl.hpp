@@ -0,0 +1,307 @@
+#ifndef __KOKKOSBATCHED_VAR_BATCHED_IMPL_HPP__
+#define __KOKKOSBATCHED_VAR_BATCHED_IMPL_HPP__
+
+
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_VarBatched_Decl.hpp"
+
+#include "KokkosBatched_Gemm_Serial_Internal.hpp"
+#include "KokkosBatched_Gemm_Team_Internal.hpp"
+#include "KokkosBatched_LU_Serial_Internal.hpp"
+#include "KokkosBatched_LU_Team_Internal.hpp"
+
+namespace KokkosBatched {
+  namespace Experimental {
+
+    ///
+    /// Host scheduling
+    /// ===============
+
+    struct VarBatchedSerialTag {};
+    struct VarBatchedTeamTag {};
+
+    struct VarBatchedScheduleInternal {
+      // fill perm with the serial entries followed by the team entries, both
+      // in decreasing order of work with identical sizes adjacent; returns
+      // the number of serial entries
+      template<typename HostSizeViewType,
+               typename HostPermViewType>
+      inline
+      static int
+      invoke(const int nbatch,
+             const HostSizeViewType &m, const HostSizeViewType &n, const HostSizeViewType &k,
+             const HostPermViewType &perm) {
+        std::vector<int> serial, team;
+        serial.reserve(nbatch);
+        for (int p=0;p<nbatch;++p) {
+          const int s = std::max(m(p), std::max(n(p), k(p)));
+          if (s <= VarBatchedTraits::max_serial_size) serial.push_back(p);
+          else                                        team.push_back(p);
+        }
+
+        const auto larger = [&](const int p, const int q) {
+          const long wp = long(m(p))*n(p)*k(p), wq = long(m(q))*n(q)*k(q);
+          if (wp != wq)     return wp > wq;
+          if (m(p) != m(q)) return m(p) > m(q);
+          if (n(p) != n(q)) return n(p) > n(q);
+          return k(p) > k(q);
+        };
+        std::stable_sort(serial.begin(), serial.end(), larger);
+        std::stable_sort(team.begin(),   team.end(),   larger);
+
+        const int nserial = serial.size(), nteam = team.size();
+        for (int p=0;p<nserial;++p) perm(p)         = serial[p];
+        for (int p=0;p<nteam;++p)   perm(nserial+p) = team[p];
+
+        return nserial;
+      }
+    };
+
+    ///
+    /// Gemm
+    /// ====
+
+    template<typename ArgTransA,
+             typename ArgTransB>
+    struct VarBatchedGemmStrides {
+      static_assert(std::is_same<ArgTransA,Trans::NoTranspose>::value ||
+                    std::is_same<ArgTransA,Trans::Transpose>::value,
+                    "ArgTransA must be Trans::NoTranspose or Trans::Transpose");
+      static_assert(std::is_same<ArgTransB,Trans::NoTranspose>::value ||
+                    std::is_same<ArgTransB,Trans::Transpose>::value,
+                    "ArgTransB must be Trans::NoTranspose or Trans::Transpose");
+
+      enum : bool { is_trans_a = std::is_same<ArgTransA,Trans::Transpose>::value,
+                    is_trans_b = std::is_same<ArgTransB,Trans::Transpose>::value };
+
+      // op(A) is m x k and op(B) is k x n; the stored matrices are column major
+      KOKKOS_INLINE_FUNCTION
+      static void
+      get(const int m, const int n, const int k,
+          int &as0, int &as1, int &bs0, int &bs1, int &cs0, int &cs1) {
+        as0 = is_trans_a ? k : 1; as1 = is_trans_a ? 1 : m;
+        bs0 = is_trans_b ? n : 1; bs1 = is_trans_b ? 1 : k;
+        cs0 = 1; cs1 = m;
+      }
+    };
+
+    template<typename ArgTransA,
+             typename ArgTransB,
+             typename ScalarType,
+             typename SizeViewType,
+             typename PermViewType,
+             typename AViewType,
+             typename BViewType,
+             typename CViewType>
+    struct Functor_VarBatchedGemm {
+      typedef typename CViewType::non_const_value_type value_type;
+      typedef VarBatchedGemmStrides<ArgTransA,ArgTransB> strides;
+
+      ScalarType _alpha, _beta;
+      SizeViewType _m, _n, _k, _a_offset, _b_offset, _c_offset;
+      PermViewType _perm;
+      AViewType _A;
+      BViewType _B;
+      CViewType _C;
+      int _team_begin;
+
+      KOKKOS_INLINE_FUNCTION
+      Functor_VarBatchedGemm(const ScalarType alpha,
+                             const SizeViewType &m, const SizeViewType &n, const SizeViewType &k,
+                             const AViewType &A, const SizeViewType &a_offset,
+                             const BViewType &B, const SizeViewType &b_offset,
+                             const ScalarType beta,
+                             const CViewType &C, const SizeViewType &c_offset,
+                             const PermViewType &perm, const int team_begin)
+        : _alpha(alpha), _beta(beta),
+          _m(m), _n(n), _k(k), _a_offset(a_offset), _b_offset(b_offset), _c_offset(c_offset),
+          _perm(perm), _A(A), _B(B), _C(C), _team_begin(team_begin) {}
+
+      // one entry per thread; entries of equal square size up to 8 are
+      // dispatched to the fixed-size kernel
+      KOKKOS_INLINE_FUNCTION
+      void operator()(const VarBatchedSerialTag &, const int i) const {
+        const int p = _perm(i), mm = _m(p), nn = _n(p), kk = _k(p);
+        int as0, as1, bs0, bs1, cs0, cs1;
+        strides::get(mm, nn, kk, as0, as1, bs0, bs1, cs0, cs1);
+
+        const value_type *__restrict__ A = _A.data() + _a_offset(p);
+        const value_type *__restrict__ B = _B.data() + _b_offset(p);
+        /**/  value_type *__restrict__ C = _C.data() + _c_offset(p);
+
+        const int s = (mm == nn && nn == kk) ? mm : 0;
+        switch (s) {
+        case 2: SerialGemmFixedInternal<2,2,2>::invoke(_alpha, A, as0, as1, B, bs0, bs1, _beta, C, cs0, cs1); break;
+        case 3: SerialGemmFixedInternal<3,3,3>::invoke(_alpha, A, as0, as1, B, bs0, bs1, _beta, C, cs0, cs1); break;
+        case 4: SerialGemmFixedInternal<4,4,4>::invoke(_alpha, A, as0, as1, B, bs0, bs1, _beta, C, cs0, cs1); break;
+        case 5: SerialGemmFixedInternal<5,5,5>::invoke(_alpha, A, as0, as1, B, bs0, bs1, _beta, C, cs0, cs1); break;
+        case 6: SerialGemmFixedInternal<6,6,6>::invoke(_alpha, A, as0, as1, B, bs0, bs1, _beta, C, cs0, cs1); break;
+        case 7: SerialGemmFixedInternal<7,7,7>::invoke(_alpha, A, as0, as1, B, bs0, bs1, _beta, C, cs0, cs1); break;
+        case 8: SerialGemmFixedInternal<8,8,8>::invoke(_alpha, A, as0, as1, B, bs0, bs1, _beta, C, cs0, cs1); break;
+        default:
+          SerialGemmInternal<Algo::Gemm::Blocked>::
+            invoke(mm, nn, kk, _alpha, A, as0, as1, B, bs0, bs1, _beta, C, cs0, cs1);
+        }
+      }
+
+      // one entry per team
+      template<typename MemberType>
+      KOKKOS_INLINE_FUNCTION
+      void operator()(const VarBatchedTeamTag &, const MemberType &member) const {
+        const int p = _perm(_team_begin + member.league_rank()), mm = _m(p), nn = _n(p), kk = _k(p);
+        int as0, as1, bs0, bs1, cs0, cs1;
+        strides::get(mm, nn, kk, as0, as1, bs0, bs1, cs0, cs1);
+
+        TeamGemmInternal<Algo::Gemm::Blocked>::
+          invoke(member,
+                 mm, nn, kk,
+                 _alpha,
+                 _A.data() + _a_offset(p), as0, as1,
+                 _B.data() + _b_offset(p), bs0, bs1,
+                 _beta,
+                 _C.data() + _c_offset(p), cs0, cs1);
+      }
+    };
+
+    template<typename ArgTransA,
+             typename ArgTransB>
+    template<typename ScalarType,
+             typename SizeViewType,
+             typename AViewType,
+             typename BViewType,
+             typename CViewType>
+    int
+    VarBatchedGemm<ArgTransA,ArgTransB>::
+    invoke(const ScalarType alpha,
+           const SizeViewType &m, const SizeViewType &n, const SizeViewType &k,
+           const AViewType &A, const SizeViewType &a_offset,
+           const BViewType &B, const SizeViewType &b_offset,
+           const ScalarType beta,
+           const CViewType &C, const SizeViewType &c_offset) {
+      typedef typename CViewType::execution_space exec_space;
+      typedef Kokkos::View<int*,typename CViewType::memory_space> perm_view_type;
+
+      const int nbatch = m.extent(0);
+      if (nbatch <= 0) return 0;
+
+      auto m_host = Kokkos::create_mirror_view(m); Kokkos::deep_copy(m_host, m);
+      auto n_host = Kokkos::create_mirror_view(n); Kokkos::deep_copy(n_host, n);
+      auto k_host = Kokkos::create_mirror_view(k); Kokkos::deep_copy(k_host, k);
+
+      perm_view_type perm("VarBatchedGemm::perm", nbatch);
+      auto perm_host = Kokkos::create_mirror_view(perm);
+      const int nserial = VarBatchedScheduleInternal::invoke(nbatch, m_host, n_host, k_host, perm_host);
+      const int nteam = nbatch - nserial;
+      Kokkos::deep_copy(perm, perm_host);
+
+      Functor_VarBatchedGemm<ArgTransA,ArgTransB,ScalarType,SizeViewType,perm_view_type,AViewType,BViewType,CViewType>
+        functor(alpha, m, n, k, A, a_offset, B, b_offset, beta, C, c_offset, perm, nserial);
+
+      if (nteam > 0) {
+        Kokkos::TeamPolicy<exec_space,VarBatchedTeamTag,Kokkos::Schedule<Kokkos::Dynamic> > policy(nteam, Kokkos::AUTO);
+        Kokkos::parallel_for(policy, functor);
+      }
+      if (nserial > 0) {
+        Kokkos::RangePolicy<exec_space,VarBatchedSerialTag,Kokkos::Schedule<Kokkos::Dynamic> > policy(0, nserial);
+        Kokkos::parallel_for(policy, functor);
+      }
+
+      return 0;
+    }
+
+    ///
+    /// LU
+    /// ==
+
+    template<typename SizeViewType,
+             typename PermViewType,
+             typename AViewType>
+    struct Functor_VarBatchedLU {
+      typedef typename AViewType::non_const_value_type value_type;
+      typedef typename MagnitudeScalarType<value_type>::type mag_type;
+
+      SizeViewType _n, _a_offset;
+      PermViewType _perm;
+      AViewType _A;
+      mag_type _tiny;
+      int _team_begin;
+
+      KOKKOS_INLINE_FUNCTION
+      Functor_VarBatchedLU(const SizeViewType &n,
+                           const AViewType &A, const SizeViewType &a_offset,
+                           const mag_type tiny,
+                           const PermViewType &perm, const int team_begin)
+        : _n(n), _a_offset(a_offset), _perm(perm), _A(A), _tiny(tiny), _team_begin(team_begin) {}
+
+      // one entry per thread; sizes up to 8 are dispatched to the fixed-size kernel
+      KOKKOS_INLINE_FUNCTION
+      void operator()(const VarBatchedSerialTag &, const int i) const {
+        const int p = _perm(i), nn = _n(p);
+        value_type *__restrict__ A = _A.data() + _a_offset(p);
+
+        switch (nn) {
+        case 2: SerialLUFixed_Internal<2>::invoke(A, 1, nn, _tiny); break;
+        case 3: SerialLUFixed_Internal<3>::invoke(A, 1, nn, _tiny); break;
+        case 4: SerialLUFixed_Internal<4>::invoke(A, 1, nn, _tiny); break;
+        case 5: SerialLUFixed_Internal<5>::invoke(A, 1, nn, _tiny); break;
+        case 6: SerialLUFixed_Internal<6>::invoke(A, 1, nn, _tiny); break;
+        case 7: SerialLUFixed_Internal<7>::invoke(A, 1, nn, _tiny); break;
+        case 8: SerialLUFixed_Internal<8>::invoke(A, 1, nn, _tiny); break;
+        default:
+          SerialLU_Internal<Algo::LU::Blocked>::invoke(nn, nn, A, 1, nn, _tiny);
+        }
+      }
+
+      // one entry per team
+      template<typename MemberType>
+      KOKKOS_INLINE_FUNCTION
+      void operator()(const VarBatchedTeamTag &, const MemberType &member) const {
+        const int p = _perm(_team_begin + member.league_rank()), nn = _n(p);
+        TeamLU_Internal<Algo::LU::Blocked>::invoke(member, nn, nn, _A.data() + _a_offset(p), 1, nn, _tiny);
+      }
+    };
+
+    template<typename SizeViewType,
+             typename AViewType>
+    int
+    VarBatchedLU::
+    invoke(const SizeViewType &n,
+           const AViewType &A, const SizeViewType &a_offset,
+           const typename MagnitudeScalarType<typename AViewType::non_const_value_type>::type tiny) {
+      typedef typename AViewType::execution_space exec_space;
+      typedef Kokkos::View<int*,typename AViewType::memory_space> perm_view_type;
+
+      const int nbatch = n.extent(0);
+      if (nbatch <= 0) return 0;
+
+      auto n_host = Kokkos::create_mirror_view(n); Kokkos::deep_copy(n_host, n);
+
+      perm_view_type perm("VarBatchedLU::perm", nbatch);
+      auto perm_host = Kokkos::create_mirror_view(perm);
+      const int nserial = VarBatchedScheduleInternal::invoke(nbatch, n_host, n_host, n_host, perm_host);
+      const int nteam = nbatch - nserial;
+      Kokkos::deep_copy(perm, perm_host);
+
+      Functor_VarBatchedLU<SizeViewType,perm_view_type,AViewType>
+        functor(n, A, a_offset, tiny, perm, nserial);
+
+      if (nteam > 0) {
+        Kokkos::TeamPolicy<exec_space,VarBatchedTeamTag,Kokkos::Schedule<Kokkos::Dynamic> > policy(nteam, Kokkos::AUTO);
+        Kokkos::parallel_for(policy, functor);
+      }
+      if (nserial > 0) {
+        Kokkos::RangePolicy<exec_space,VarBatchedSerialTag,Kokkos::Schedule<Kokkos::Dynamic> > policy(0, nserial);
+        Kokkos::parallel_for(policy, functor);
+      }
+
+      return 0;
+    }
+
+  }
+}
+
+#endif
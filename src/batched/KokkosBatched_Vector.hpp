@@ -132,6 +132,19 @@ namespace Kokkos {
       static KOKKOS_FORCEINLINE_FUNCTION mag_type real (const val_type &val) {
         return val;
       }
+      static KOKKOS_FORCEINLINE_FUNCTION val_type conj (const val_type &val) {
+        return val;
+      }
+      static KOKKOS_FORCEINLINE_FUNCTION mag_type abs (const val_type &val) {
+        mag_type r_val;
+        for (int i=0;i<l;++i) { r_val[i] = ArithTraits<T>::abs(val[i]); }
+        return r_val;
+      }
+      static KOKKOS_FORCEINLINE_FUNCTION val_type sqrt (const val_type &val) {
+        val_type r_val;
+        for (int i=0;i<l;++i) { r_val[i] = ArithTraits<T>::sqrt(val[i]); }
+        return r_val;
+      }
  
       static const bool is_specialized = ArithTraits<T>::is_specialized;
       static const bool is_signed = ArithTraits<T>::is_signed;
@@ -160,6 +173,21 @@ namespace Kokkos {
         for (int i=0;i<l;++i) { r_val[i] = val[i].imag(); }
         return r_val;
       }
+      static KOKKOS_FORCEINLINE_FUNCTION val_type conj (const val_type &val) {
+        val_type r_val;
+        for (int i=0;i<l;++i) { r_val[i] = ArithTraits<Kokkos::complex<T> >::conj(val[i]); }
+        return r_val;
+      }
+      static KOKKOS_FORCEINLINE_FUNCTION mag_type abs (const val_type &val) {
+        mag_type r_val;
+        for (int i=0;i<l;++i) { r_val[i] = ArithTraits<Kokkos::complex<T> >::abs(val[i]); }
+        return r_val;
+      }
+      static KOKKOS_FORCEINLINE_FUNCTION val_type sqrt (const val_type &val) {
+        val_type r_val;
+        for (int i=0;i<l;++i) { r_val[i] = ArithTraits<Kokkos::complex<T> >::sqrt(val[i]); }
+        return r_val;
+      }
     };
 
   }
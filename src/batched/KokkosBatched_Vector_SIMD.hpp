@@ -315,6 +315,193 @@ namespace KokkosBatched {
         return reinterpret_cast<value_type*>(&_data)[i];
       }
     };
+
+    template<>
+    class Vector<SIMD<float>,8> {
+    public:
+      using type = Vector<SIMD<float>,8>;
+      using value_type = float;
+      using mag_type = float;
+
+      enum : int { vector_length = 8 };
+      typedef __m256 data_type __attribute__ ((aligned(32)));
+
+      KOKKOS_INLINE_FUNCTION
+      static const char* label() { return "AVX256"; }
+
+      template<typename,int>
+      friend class Vector;
+
+    private:
+      mutable data_type _data;
+
+    public:
+      KOKKOS_INLINE_FUNCTION Vector() { _data = _mm256_setzero_ps(); }
+      KOKKOS_INLINE_FUNCTION Vector(const value_type &val) { _data = _mm256_set1_ps(val); }
+      KOKKOS_INLINE_FUNCTION Vector(const type &b) { _data = b._data; }
+      KOKKOS_INLINE_FUNCTION Vector(const __m256 &val) { _data = val; }
+
+      template<typename ArgValueType>
+      KOKKOS_INLINE_FUNCTION Vector(const ArgValueType &val) {
+        auto d = reinterpret_cast<value_type*>(&_data);
+#if defined( KOKKOS_ENABLE_PRAGMA_IVDEP )
+#pragma ivdep
+#endif
+#if defined( KOKKOS_ENABLE_PRAGMA_VECTOR )
+#pragma vector always
+#endif
+        for (int i=0;i<vector_length;++i)
+          d[i] = val;
+      }
+
+      template<typename ArgValueType>
+      KOKKOS_INLINE_FUNCTION Vector(const Vector<SIMD<ArgValueType>,vector_length> &b) {
+	auto dd = reinterpret_cast<value_type*>(&_data);
+	auto bb = reinterpret_cast<ArgValueType*>(&b._data);
+#if defined( KOKKOS_ENABLE_PRAGMA_IVDEP )
+#pragma ivdep
+#endif
+#if defined( KOKKOS_ENABLE_PRAGMA_VECTOR )
+#pragma vector always
+#endif
+	for (int i=0;i<vector_length;++i)
+	  dd[i] = bb[i];
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      type& operator=(const __m256 &val) {
+        _data = val;
+        return *this;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      operator __m256() const {
+        return _data;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      type& loadAligned(const value_type *p) {
+        _data = _mm256_load_ps(p);
+        return *this;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      type& loadUnaligned(const value_type *p) {
+        _data = _mm256_loadu_ps(p);
+        return *this;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      void storeAligned(value_type *p) const {
+        _mm256_store_ps(p, _data);
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      void storeUnaligned(value_type *p) const {
+        _mm256_storeu_ps(p, _data);
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      value_type& operator[](const int &i) const {
+        return reinterpret_cast<value_type*>(&_data)[i];
+      }
+    };
+
+    template<>
+    class Vector<SIMD<Kokkos::complex<float> >,4> {
+    public:
+      using type = Vector<SIMD<Kokkos::complex<float> >,4>;
+      using value_type = Kokkos::complex<float>;
+      using mag_type = float;
+
+      enum : int { vector_length = 4 };
+      typedef __m256 data_type __attribute__ ((aligned(32)));
+
+      KOKKOS_INLINE_FUNCTION
+      static const char* label() { return "AVX256"; }
+
+      template<typename,int>
+      friend class Vector;
+
+    private:
+      mutable data_type _data;
+
+    public:
+      KOKKOS_INLINE_FUNCTION Vector() { _data = _mm256_setzero_ps(); }
+      KOKKOS_INLINE_FUNCTION Vector(const value_type &val) {
+        _data = _mm256_setr_ps(val.real(), val.imag(), val.real(), val.imag(),
+                               val.real(), val.imag(), val.real(), val.imag());
+      }
+      KOKKOS_INLINE_FUNCTION Vector(const mag_type &val) {
+        _data = _mm256_setr_ps(val, 0, val, 0, val, 0, val, 0);
+      }
+      KOKKOS_INLINE_FUNCTION Vector(const type &b) { _data = b._data; }
+      KOKKOS_INLINE_FUNCTION Vector(const __m256 &val) { _data = val; }
+
+      template<typename ArgValueType>
+      KOKKOS_INLINE_FUNCTION Vector(const ArgValueType &val) {
+        auto d = reinterpret_cast<value_type*>(&_data);
+#if defined( KOKKOS_ENABLE_PRAGMA_IVDEP )
+#pragma ivdep
+#endif
+#if defined( KOKKOS_ENABLE_PRAGMA_VECTOR )
+#pragma vector always
+#endif
+        for (int i=0;i<vector_length;++i)
+          d[i] = val;
+      }
+      template<typename ArgValueType>
+      KOKKOS_INLINE_FUNCTION Vector(const Vector<SIMD<ArgValueType>,vector_length> &b) {
+	auto dd = reinterpret_cast<value_type*>(&_data);
+	auto bb = reinterpret_cast<ArgValueType*>(&b._data);
+#if defined( KOKKOS_ENABLE_PRAGMA_IVDEP )
+#pragma ivdep
+#endif
+#if defined( KOKKOS_ENABLE_PRAGMA_VECTOR )
+#pragma vector always
+#endif
+	for (int i=0;i<vector_length;++i)
+	  dd[i] = bb[i];
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      type& operator=(const __m256 &val) {
+        _data = val;
+        return *this;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      operator __m256() const {
+        return _data;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      type& loadAligned(const value_type *p) {
+        _data = _mm256_load_ps((mag_type*)p);
+        return *this;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      type& loadUnaligned(const value_type *p) {
+        _data = _mm256_loadu_ps((mag_type*)p);
+        return *this;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      void storeAligned(value_type *p) const {
+        _mm256_store_ps((mag_type*)p, _data);
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      void storeUnaligned(value_type *p) const {
+        _mm256_storeu_ps((mag_type*)p, _data);
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      value_type& operator[](const int &i) const {
+        return reinterpret_cast<value_type*>(&_data)[i];
+      }
+    };
 }}
 #endif /* #if defined(__AVX__) || defined(__AVX2__) */
 
@@ -505,6 +692,192 @@ namespace KokkosBatched {
         return reinterpret_cast<value_type*>(&_data)[i];
       }
     };
+
+    template<>
+    class Vector<SIMD<float>,16> {
+    public:
+      using type = Vector<SIMD<float>,16>;
+      using value_type = float;
+      using mag_type = float;
+
+      enum : int { vector_length = 16 };
+      typedef __m512 data_type __attribute__ ((aligned(64)));
+
+      KOKKOS_INLINE_FUNCTION
+      static const char* label() { return "AVX512"; }
+
+      template<typename,int>
+      friend class Vector;
+
+    private:
+      mutable data_type _data;
+
+    public:
+      KOKKOS_INLINE_FUNCTION Vector() { _data = _mm512_setzero_ps(); }
+      KOKKOS_INLINE_FUNCTION Vector(const value_type &val) { _data = _mm512_set1_ps(val); }
+      KOKKOS_INLINE_FUNCTION Vector(const type &b) { _data = b._data; }
+      KOKKOS_INLINE_FUNCTION Vector(const __m512 &val) { _data = val; }
+
+      template<typename ArgValueType>
+      KOKKOS_INLINE_FUNCTION Vector(const ArgValueType &val) {
+        auto d = reinterpret_cast<value_type*>(&_data);
+#if defined( KOKKOS_ENABLE_PRAGMA_IVDEP )
+#pragma ivdep
+#endif
+#if defined( KOKKOS_ENABLE_PRAGMA_VECTOR )
+#pragma vector always
+#endif
+        for (int i=0;i<vector_length;++i)
+          d[i] = val;
+      }
+
+      template<typename ArgValueType>
+      KOKKOS_INLINE_FUNCTION Vector(const Vector<SIMD<ArgValueType>,vector_length> &b) {
+	auto dd = reinterpret_cast<value_type*>(&_data);
+	auto bb = reinterpret_cast<ArgValueType*>(&b._data);
+#if defined( KOKKOS_ENABLE_PRAGMA_IVDEP )
+#pragma ivdep
+#endif
+#if defined( KOKKOS_ENABLE_PRAGMA_VECTOR )
+#pragma vector always
+#endif
+	for (int i=0;i<vector_length;++i)
+	  dd[i] = bb[i];
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      type& operator=(const __m512 &val) {
+        _data = val;
+        return *this;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      operator __m512() const {
+        return _data;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      type& loadAligned(const value_type *p) {
+        _data = _mm512_load_ps(p);
+        return *this;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      type& loadUnaligned(const value_type *p) {
+        _data = _mm512_loadu_ps(p);
+        return *this;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      void storeAligned(value_type *p) const {
+        _mm512_store_ps(p, _data);
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      void storeUnaligned(value_type *p) const {
+        _mm512_storeu_ps(p, _data);
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      value_type& operator[](const int &i) const {
+        return reinterpret_cast<value_type*>(&_data)[i];
+      }
+    };
+
+    template<>
+    class Vector<SIMD<Kokkos::complex<float> >,8> {
+    public:
+      using type = Vector<SIMD<Kokkos::complex<float> >,8>;
+      using value_type = Kokkos::complex<float>;
+      using mag_type = float;
+
+      enum : int { vector_length = 8 };
+      typedef __m512 data_type __attribute__ ((aligned(64)));
+
+      KOKKOS_INLINE_FUNCTION
+      static const char* label() { return "AVX512"; }
+
+      template<typename,int>
+      friend class Vector;
+
+    private:
+      mutable data_type _data;
+
+    public:
+      KOKKOS_INLINE_FUNCTION Vector() { _data = _mm512_setzero_ps(); }
+      KOKKOS_INLINE_FUNCTION Vector(const value_type &val) {
+        _data = _mm512_mask_blend_ps(0xAAAA, _mm512_set1_ps(val.real()), _mm512_set1_ps(val.imag()));
+      }
+      KOKKOS_INLINE_FUNCTION Vector(const mag_type &val) {
+        _data = _mm512_mask_blend_ps(0xAAAA, _mm512_set1_ps(val), _mm512_setzero_ps());
+      }
+      KOKKOS_INLINE_FUNCTION Vector(const type &b) { _data = b._data; }
+      KOKKOS_INLINE_FUNCTION Vector(const __m512 &val) { _data = val; }
+
+      template<typename ArgValueType>
+      KOKKOS_INLINE_FUNCTION Vector(const ArgValueType &val) {
+        auto d = reinterpret_cast<value_type*>(&_data);
+#if defined( KOKKOS_ENABLE_PRAGMA_IVDEP )
+#pragma ivdep
+#endif
+#if defined( KOKKOS_ENABLE_PRAGMA_VECTOR )
+#pragma vector always
+#endif
+        for (int i=0;i<vector_length;++i)
+          d[i] = val;
+      }
+      template<typename ArgValueType>
+      KOKKOS_INLINE_FUNCTION Vector(const Vector<SIMD<ArgValueType>,vector_length> &b) {
+	auto dd = reinterpret_cast<value_type*>(&_data);
+	auto bb = reinterpret_cast<ArgValueType*>(&b._data);
+#if defined( KOKKOS_ENABLE_PRAGMA_IVDEP )
+#pragma ivdep
+#endif
+#if defined( KOKKOS_ENABLE_PRAGMA_VECTOR )
+#pragma vector always
+#endif
+	for (int i=0;i<vector_length;++i)
+	  dd[i] = bb[i];
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      type& operator=(const __m512 &val) {
+        _data = val;
+        return *this;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      operator __m512() const {
+        return _data;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      type& loadAligned(const value_type *p) {
+        _data = _mm512_load_ps((mag_type*)p);
+        return *this;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      type& loadUnaligned(const value_type *p) {
+        _data = _mm512_loadu_ps((mag_type*)p);
+        return *this;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      void storeAligned(value_type *p) const {
+        _mm512_store_ps((mag_type*)p, _data);
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      void storeUnaligned(value_type *p) const {
+        _mm512_storeu_ps((mag_type*)p, _data);
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      value_type& operator[](const int &i) const {
+        return reinterpret_cast<value_type*>(&_data)[i];
+      }
+    };
 }}
 #endif /* #if defined(__AVX512F__) */
 #endif /* #if defined(__KOKKOSBATCHED_ENABLE_AVX__) */
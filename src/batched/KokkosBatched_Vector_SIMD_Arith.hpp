@@ -22,6 +22,13 @@ namespace KokkosBatched {
       return _mm512_add_pd(a, b);
     }
 
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float,16)
+    operator + (const Vector<SIMD<float>,16> &a, const Vector<SIMD<float>,16> &b) {
+      return _mm512_add_ps(a, b);
+    }
+
 #if !defined(KOKKOS_COMPILER_GNU)
     KOKKOS_FORCEINLINE_FUNCTION
     static
@@ -29,6 +36,13 @@ namespace KokkosBatched {
     operator + (const Vector<SIMD<Kokkos::complex<double> >,4> &a, const Vector<SIMD<Kokkos::complex<double> >,4> &b) {
       return _mm512_add_pd(a, b);
     }
+
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>,8)
+    operator + (const Vector<SIMD<Kokkos::complex<float> >,8> &a, const Vector<SIMD<Kokkos::complex<float> >,8> &b) {
+      return _mm512_add_ps(a, b);
+    }
 #endif
 
 #endif
@@ -40,6 +54,13 @@ namespace KokkosBatched {
       return _mm256_add_pd(a, b);
     }
 
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float,8)
+    operator + (const Vector<SIMD<float>,8> &a, const Vector<SIMD<float>,8> &b) {
+      return _mm256_add_ps(a, b);
+    }
+
 #if !defined(KOKKOS_COMPILER_GNU)
     KOKKOS_FORCEINLINE_FUNCTION
     static 
@@ -47,6 +68,13 @@ namespace KokkosBatched {
     operator + (const Vector<SIMD<Kokkos::complex<double> >,2> & a, const Vector<SIMD<Kokkos::complex<double> >,2> & b) {
       return _mm256_add_pd(a, b);
     }
+
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>,4)
+    operator + (const Vector<SIMD<Kokkos::complex<float> >,4> &a, const Vector<SIMD<Kokkos::complex<float> >,4> &b) {
+      return _mm256_add_ps(a, b);
+    }
 #endif
 
 #endif
@@ -191,6 +219,13 @@ namespace KokkosBatched {
       return _mm512_sub_pd(a, b);
     }
 
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float,16)
+    operator - (const Vector<SIMD<float>,16> &a, const Vector<SIMD<float>,16> &b) {
+      return _mm512_sub_ps(a, b);
+    }
+
 #if !defined(KOKKOS_COMPILER_GNU)
     KOKKOS_FORCEINLINE_FUNCTION
     static 
@@ -198,6 +233,13 @@ namespace KokkosBatched {
     operator - (const Vector<SIMD<Kokkos::complex<double> >,4> &a, const Vector<SIMD<Kokkos::complex<double> >,4> &b) {
       return _mm512_sub_pd(a, b);
     }
+
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>,8)
+    operator - (const Vector<SIMD<Kokkos::complex<float> >,8> &a, const Vector<SIMD<Kokkos::complex<float> >,8> &b) {
+      return _mm512_sub_ps(a, b);
+    }
 #endif
 
 #endif
@@ -209,6 +251,13 @@ namespace KokkosBatched {
       return _mm256_sub_pd(a, b);
     }
 
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float,8)
+    operator - (const Vector<SIMD<float>,8> &a, const Vector<SIMD<float>,8> &b) {
+      return _mm256_sub_ps(a, b);
+    }
+
 #if !defined(KOKKOS_COMPILER_GNU)
     KOKKOS_FORCEINLINE_FUNCTION
     static
@@ -216,6 +265,13 @@ namespace KokkosBatched {
     operator - (const Vector<SIMD<Kokkos::complex<double> >,2> & a, const Vector<SIMD<Kokkos::complex<double> >,2> & b) {
       return _mm256_sub_pd(a, b);
     }
+
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>,4)
+    operator - (const Vector<SIMD<Kokkos::complex<float> >,4> &a, const Vector<SIMD<Kokkos::complex<float> >,4> &b) {
+      return _mm256_sub_ps(a, b);
+    }
 #endif
 
 #endif
@@ -378,6 +434,13 @@ namespace KokkosBatched {
       return _mm512_mul_pd(a, b);
     }
 
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float,16)
+    operator * (const Vector<SIMD<float>,16> &a, const Vector<SIMD<float>,16> &b) {
+      return _mm512_mul_ps(a, b);
+    }
+
 #if !defined(KOKKOS_COMPILER_GNU)
     KOKKOS_FORCEINLINE_FUNCTION
     static
@@ -400,6 +463,18 @@ namespace KokkosBatched {
       // return _mm512_mask_sub_pd(_mm512_mask_add_pd(_mm512_mul_pd(a, br), 0x55, cc), 0xaa, cc);
 #endif
     }
+
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>,8)
+    operator * (const Vector<SIMD<Kokkos::complex<float> >,8> &a, const Vector<SIMD<Kokkos::complex<float> >,8> &b) {
+      const __m512
+        as = _mm512_permute_ps(a, 0xb1),
+        br = _mm512_moveldup_ps(b),
+        bi = _mm512_movehdup_ps(b);
+
+      return _mm512_fmaddsub_ps(a, br, _mm512_mul_ps(as, bi));
+    }
 #endif
 
 #endif
@@ -411,6 +486,13 @@ namespace KokkosBatched {
       return _mm256_mul_pd(a, b);
     }
 
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float,8)
+    operator * (const Vector<SIMD<float>,8> &a, const Vector<SIMD<float>,8> &b) {
+      return _mm256_mul_ps(a, b);
+    }
+
 #if !defined(KOKKOS_COMPILER_GNU)
     KOKKOS_FORCEINLINE_FUNCTION
     static Vector<SIMD<Kokkos::complex<double> >,2>
@@ -426,6 +508,22 @@ namespace KokkosBatched {
       return _mm256_add_pd(_mm256_mul_pd(a, br),
                            _mm256_xor_pd(_mm256_mul_pd(as, bi),
                                          _mm256_set_pd( 0.0, -0.0, 0.0, -0.0)));
+#endif
+    }
+
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>,4)
+    operator * (const Vector<SIMD<Kokkos::complex<float> >,4> &a, const Vector<SIMD<Kokkos::complex<float> >,4> &b) {
+      const __m256
+        as = _mm256_permute_ps(a, 0xb1),
+        br = _mm256_moveldup_ps(b),
+        bi = _mm256_movehdup_ps(b);
+
+#if defined(__FMA__)
+      return _mm256_fmaddsub_ps(a, br, _mm256_mul_ps(as, bi));
+#else
+      return _mm256_addsub_ps(_mm256_mul_ps(a, br), _mm256_mul_ps(as, bi));
 #endif
     }
 #endif
@@ -498,6 +596,13 @@ namespace KokkosBatched {
     operator * (const Vector<SIMD<Kokkos::complex<double> >,4> &a, const double b) {
       return _mm512_mul_pd(a, _mm512_set1_pd(b));
     }
+
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>,8)
+    operator * (const Vector<SIMD<Kokkos::complex<float> >,8> &a, const float b) {
+      return _mm512_mul_ps(a, _mm512_set1_ps(b));
+    }
 #endif
 
 #endif
@@ -510,6 +615,13 @@ namespace KokkosBatched {
     operator * (const Vector<SIMD<Kokkos::complex<double> >,2> & a, const double b) {
       return _mm256_mul_pd(a, _mm256_set1_pd(b));
     }
+
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>,4)
+    operator * (const Vector<SIMD<Kokkos::complex<float> >,4> &a, const float b) {
+      return _mm256_mul_ps(a, _mm256_set1_ps(b));
+    }
 #endif
 
 #endif
@@ -532,6 +644,13 @@ namespace KokkosBatched {
     operator * (const double a, const Vector<SIMD<Kokkos::complex<double> >,4> &b) {
       return _mm512_mul_pd(_mm512_set1_pd(a), b);
     }
+
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>,8)
+    operator * (const float a, const Vector<SIMD<Kokkos::complex<float> >,8> &b) {
+      return _mm512_mul_ps(_mm512_set1_ps(a), b);
+    }
 #endif
 
 #endif
@@ -544,6 +663,13 @@ namespace KokkosBatched {
     operator * (const double a, const Vector<SIMD<Kokkos::complex<double> >,2> & b) {
       return _mm256_mul_pd(_mm256_set1_pd(a), b);
     }
+
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>,4)
+    operator * (const float a, const Vector<SIMD<Kokkos::complex<float> >,4> &b) {
+      return _mm256_mul_ps(_mm256_set1_ps(a), b);
+    }
 #endif
 
 #endif
@@ -607,6 +733,13 @@ namespace KokkosBatched {
       return _mm512_div_pd(a, b);
     }
 
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float,16)
+    operator / (const Vector<SIMD<float>,16> &a, const Vector<SIMD<float>,16> &b) {
+      return _mm512_div_ps(a, b);
+    }
+
 #if !defined(KOKKOS_COMPILER_GNU)
     KOKKOS_FORCEINLINE_FUNCTION
     static 
@@ -634,6 +767,19 @@ namespace KokkosBatched {
       //                      _mm512_add_pd(_mm512_mul_pd(br, br), _mm512_mul_pd(bi, bi)));
 #endif
     }
+
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>,8)
+    operator / (const Vector<SIMD<Kokkos::complex<float> >,8> &a, const Vector<SIMD<Kokkos::complex<float> >,8> &b) {
+      const __m512
+        as = _mm512_permute_ps(a, 0xb1),
+        br = _mm512_moveldup_ps(b),
+        bi = _mm512_movehdup_ps(b);
+
+      return _mm512_div_ps(_mm512_fmsubadd_ps(a,  br, _mm512_mul_ps(as, bi)),
+                           _mm512_fmadd_ps   (br, br, _mm512_mul_ps(bi, bi)));
+    }
 #endif
 
 #endif
@@ -646,6 +792,13 @@ namespace KokkosBatched {
       return _mm256_div_pd(a, b);
     }
 
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float,8)
+    operator / (const Vector<SIMD<float>,8> &a, const Vector<SIMD<float>,8> &b) {
+      return _mm256_div_ps(a, b);
+    }
+
 #if !defined(KOKKOS_COMPILER_GNU)
     KOKKOS_FORCEINLINE_FUNCTION
     static 
@@ -665,6 +818,25 @@ namespace KokkosBatched {
                                          _mm256_xor_pd(_mm256_mul_pd(as, bi),
                                                        _mm256_set_pd( 0.0, -0.0, 0.0, -0.0))),
                            _mm256_add_pd(_mm256_mul_pd(br, br), _mm256_mul_pd(bi, bi)));
+#endif
+    }
+
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>,4)
+    operator / (const Vector<SIMD<Kokkos::complex<float> >,4> &a, const Vector<SIMD<Kokkos::complex<float> >,4> &b) {
+      const __m256
+        as = _mm256_permute_ps(a, 0xb1),
+        br = _mm256_moveldup_ps(b),
+        bi = _mm256_movehdup_ps(b);
+
+#if defined(__FMA__)
+      return _mm256_div_ps(_mm256_fmsubadd_ps(a,  br, _mm256_mul_ps(as, bi)),
+                           _mm256_fmadd_ps   (br, br, _mm256_mul_ps(bi, bi)));
+#else
+      return _mm256_div_ps(_mm256_addsub_ps(_mm256_mul_ps(a, br),
+                                            _mm256_sub_ps(_mm256_setzero_ps(), _mm256_mul_ps(as, bi))),
+                           _mm256_add_ps(_mm256_mul_ps(br, br), _mm256_mul_ps(bi, bi)));
 #endif
     }
 #endif
@@ -710,6 +882,13 @@ namespace KokkosBatched {
     operator / (const Vector<SIMD<Kokkos::complex<double> >,4> &a, const double b) {
       return _mm512_div_pd(a, _mm512_set1_pd(b));
     }
+
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>,8)
+    operator / (const Vector<SIMD<Kokkos::complex<float> >,8> &a, const float b) {
+      return _mm512_div_ps(a, _mm512_set1_ps(b));
+    }
 #endif
 
 #endif
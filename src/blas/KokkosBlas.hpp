@@ -46,8 +46,12 @@
 
 #include<KokkosBlas1_abs.hpp>
 #include<KokkosBlas1_axpby.hpp>
+#include<KokkosBlas1_compensated.hpp>
+#include<KokkosBlas1_copy.hpp>
 #include<KokkosBlas1_dot.hpp>
 #include<KokkosBlas1_fill.hpp>
+#include<KokkosBlas1_fused_update.hpp>
+#include<KokkosBlas1_iamax.hpp>
 #include<KokkosBlas1_mult.hpp>
 #include<KokkosBlas1_nrm1.hpp>
 #include<KokkosBlas1_nrm2.hpp>
@@ -56,13 +60,25 @@
 #include<KokkosBlas1_nrm2w_squared.hpp>
 #include<KokkosBlas1_nrminf.hpp>
 #include<KokkosBlas1_reciprocal.hpp>
+#include<KokkosBlas1_reduction_mode.hpp>
+#include<KokkosBlas1_reproducible.hpp>
+#include<KokkosBlas1_rot.hpp>
 #include<KokkosBlas1_scal.hpp>
 #include<KokkosBlas1_sum.hpp>
+#include<KokkosBlas1_swap.hpp>
 #include<KokkosBlas1_update.hpp>
 
 
 #include<KokkosBlas2_gemv.hpp>
+#include<KokkosBlas2_ger.hpp>
+#include<KokkosBlas2_symv.hpp>
+#include<KokkosBlas2_syr.hpp>
+#include<KokkosBlas2_trmv.hpp>
 
 
 #include<KokkosBlas3_gemm.hpp>
+#include<KokkosBlas3_syrk.hpp>
+#include<KokkosBlas3_trmm.hpp>
+#include<KokkosBlas3_trsm.hpp>
+#include<KokkosBlas3_tsqr.hpp>
 #endif
@@ -0,0 +1,180 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#ifndef KOKKOSBLAS1_COMPENSATED_HPP_
+#define KOKKOSBLAS1_COMPENSATED_HPP_
+
+/// \file KokkosBlas1_compensated.hpp
+///
+/// High-accuracy variants of dot, sum and nrm2 based on compensated
+/// summation: Kahan-Babuska for sum and Dot2 (Ogita, Rump and Oishi) for
+/// dot and nrm2.  The result is about as accurate as if it had been
+/// accumulated in twice the working precision, at the memory bandwidth
+/// bound cost of the plain reductions, see
+/// KokkosBlas1_compensated_impl.hpp.  Results still depend on the
+/// number of threads in the last bit; use KokkosBlas1_reproducible.hpp
+/// for bitwise reproducibility.
+///
+/// Call these directly to select the algorithm per call, or use
+/// Experimental::set_reduction_mode(REDUCTION_COMPENSATED) to make
+/// KokkosBlas::dot, sum and nrm2 use them.
+
+#include <KokkosKernels_Macros.hpp>
+#include <KokkosBlas1_reduction_mode.hpp>
+#include <KokkosBlas1_reproducible.hpp>
+#include <KokkosBlas1_compensated_impl.hpp>
+#include <type_traits>
+
+namespace KokkosBlas {
+namespace Experimental {
+
+/// \brief Compensated dot product of the two vectors x and y.
+template<class XVector, class YVector>
+typename Kokkos::Details::InnerProductSpaceTraits<typename XVector::non_const_value_type>::dot_type
+compensated_dot (const XVector& x, const YVector& y)
+{
+  static_assert (Kokkos::Impl::is_view<XVector>::value && Kokkos::Impl::is_view<YVector>::value,
+                 "KokkosBlas::compensated_dot: x and y must be Kokkos::Views.");
+  static_assert (XVector::rank == 1 && YVector::rank == 1,
+                 "KokkosBlas::compensated_dot: x and y must have rank 1.");
+  Impl::reduction_check_dims ("compensated_dot", x, y);
+
+  typedef KokkosBlas::Impl::CompensatedDotOp<XVector, YVector> op_type;
+  typename op_type::result_type result;
+  Kokkos::View<typename op_type::result_type, Kokkos::HostSpace,
+               Kokkos::MemoryTraits<Kokkos::Unmanaged> > R (&result);
+  KokkosBlas::Impl::compensated_reduce<op_type> ("KokkosBlas::compensated_dot", R, x, y);
+  return result;
+}
+
+/// \brief Compensated column-wise dot products, with the same
+///   combinations of ranks as KokkosBlas::dot(R,X,Y).
+template<class RV, class XMV, class YMV>
+void
+compensated_dot (const RV& R, const XMV& X, const YMV& Y,
+                 typename std::enable_if<Kokkos::Impl::is_view<RV>::value, int>::type = 0)
+{
+  static_assert (Kokkos::Impl::is_view<XMV>::value && Kokkos::Impl::is_view<YMV>::value,
+                 "KokkosBlas::compensated_dot: X and Y must be Kokkos::Views.");
+  static_assert ((RV::rank == 0 && XMV::rank == 1 && YMV::rank == 1) ||
+                 (RV::rank == 1 && (XMV::rank == 2 || YMV::rank == 2)),
+                 "KokkosBlas::compensated_dot: R must be 0-D for vectors, "
+                 "1-D if X or Y is a multivector.");
+  Impl::reduction_check_dims ("compensated_dot", X, Y);
+  Impl::reduction_check_result ("compensated_dot", R, X.extent(1) > Y.extent(1) ? X.extent(1) : Y.extent(1));
+
+  KokkosBlas::Impl::compensated_reduce<KokkosBlas::Impl::CompensatedDotOp<XMV, YMV> >
+    ("KokkosBlas::compensated_dot", R, X, Y);
+}
+
+/// \brief Compensated sum of the entries of the vector x.
+template<class XVector>
+typename XVector::non_const_value_type
+compensated_sum (const XVector& x)
+{
+  static_assert (Kokkos::Impl::is_view<XVector>::value,
+                 "KokkosBlas::compensated_sum: x must be a Kokkos::View.");
+  static_assert (XVector::rank == 1,
+                 "KokkosBlas::compensated_sum: x must have rank 1.");
+
+  typedef KokkosBlas::Impl::CompensatedSumOp<XVector> op_type;
+  typename op_type::result_type result;
+  Kokkos::View<typename op_type::result_type, Kokkos::HostSpace,
+               Kokkos::MemoryTraits<Kokkos::Unmanaged> > R (&result);
+  KokkosBlas::Impl::compensated_reduce<op_type> ("KokkosBlas::compensated_sum", R, x, x);
+  return result;
+}
+
+/// \brief Compensated R(j) = sum(X(:,j)); R is 0-D for a vector X.
+template<class RV, class XMV>
+void
+compensated_sum (const RV& R, const XMV& X,
+                 typename std::enable_if<Kokkos::Impl::is_view<RV>::value, int>::type = 0)
+{
+  static_assert (Kokkos::Impl::is_view<XMV>::value,
+                 "KokkosBlas::compensated_sum: X must be a Kokkos::View.");
+  static_assert (RV::rank + 1 == XMV::rank,
+                 "KokkosBlas::compensated_sum: R must have rank one less than X.");
+  Impl::reduction_check_result ("compensated_sum", R, X.extent(1));
+
+  KokkosBlas::Impl::compensated_reduce<KokkosBlas::Impl::CompensatedSumOp<XMV> >
+    ("KokkosBlas::compensated_sum", R, X, X);
+}
+
+/// \brief Compensated 2-norm of the vector x.
+template<class XVector>
+typename Kokkos::Details::InnerProductSpaceTraits<typename XVector::non_const_value_type>::mag_type
+compensated_nrm2 (const XVector& x)
+{
+  static_assert (Kokkos::Impl::is_view<XVector>::value,
+                 "KokkosBlas::compensated_nrm2: x must be a Kokkos::View.");
+  static_assert (XVector::rank == 1,
+                 "KokkosBlas::compensated_nrm2: x must have rank 1.");
+
+  typedef KokkosBlas::Impl::CompensatedNrm2Op<XVector> op_type;
+  typename op_type::result_type result;
+  Kokkos::View<typename op_type::result_type, Kokkos::HostSpace,
+               Kokkos::MemoryTraits<Kokkos::Unmanaged> > R (&result);
+  KokkosBlas::Impl::compensated_reduce<op_type> ("KokkosBlas::compensated_nrm2", R, x, x);
+  return result;
+}
+
+/// \brief Compensated R(j) = nrm2(X(:,j)); R is 0-D for a vector X.
+template<class RV, class XMV>
+void
+compensated_nrm2 (const RV& R, const XMV& X,
+                  typename std::enable_if<Kokkos::Impl::is_view<RV>::value, int>::type = 0)
+{
+  static_assert (Kokkos::Impl::is_view<XMV>::value,
+                 "KokkosBlas::compensated_nrm2: X must be a Kokkos::View.");
+  static_assert (RV::rank + 1 == XMV::rank,
+                 "KokkosBlas::compensated_nrm2: R must have rank one less than X.");
+  Impl::reduction_check_result ("compensated_nrm2", R, X.extent(1));
+
+  KokkosBlas::Impl::compensated_reduce<KokkosBlas::Impl::CompensatedNrm2Op<XMV> >
+    ("KokkosBlas::compensated_nrm2", R, X, X);
+}
+
+} // namespace Experimental
+} // namespace KokkosBlas
+
+#endif // KOKKOSBLAS1_COMPENSATED_HPP_
@@ -46,6 +46,8 @@
 
 #include<KokkosBlas1_dot_spec.hpp>
 #include<KokkosKernels_helpers.hpp>
+#include<KokkosBlas1_reproducible.hpp>
+#include<KokkosBlas1_compensated.hpp>
 
 namespace KokkosBlas {
 
@@ -80,6 +82,13 @@ dot (const XVector& x, const YVector& y)
     Kokkos::Impl::throw_runtime_exception (os.str ());
   }
 
+  if (Experimental::get_reduction_mode () == Experimental::REDUCTION_REPRODUCIBLE) {
+    return Experimental::reproducible_dot (x, y);
+  }
+  if (Experimental::get_reduction_mode () == Experimental::REDUCTION_COMPENSATED) {
+    return Experimental::compensated_dot (x, y);
+  }
+
 
   typedef Kokkos::View<typename XVector::const_value_type*,
     typename KokkosKernels::Impl::GetUnifiedLayout<XVector>::array_layout,
@@ -191,6 +200,15 @@ dot (const RV& R, const XMV& X, const YMV& Y,
     Kokkos::Impl::throw_runtime_exception (os.str ());
   }
 
+  if (Experimental::get_reduction_mode () == Experimental::REDUCTION_REPRODUCIBLE) {
+    Experimental::reproducible_dot (R, X, Y);
+    return;
+  }
+  if (Experimental::get_reduction_mode () == Experimental::REDUCTION_COMPENSATED) {
+    Experimental::compensated_dot (R, X, Y);
+    return;
+  }
+
   // Create unmanaged versions of the input Views.
 
   typedef Kokkos::View<
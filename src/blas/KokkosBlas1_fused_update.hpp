@@ -0,0 +1,215 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#ifndef KOKKOSBLAS1_FUSED_UPDATE_HPP_
+#define KOKKOSBLAS1_FUSED_UPDATE_HPP_
+
+/// \file KokkosBlas1_fused_update.hpp
+///
+/// Fused vector update + reduction kernels for Krylov solvers.  Each
+/// routine makes one pass over its vectors where the equivalent sequence
+/// of axpby / update / dot / nrm2 calls would make one pass per call.
+
+#include <KokkosKernels_Macros.hpp>
+#include <KokkosBlas1_fused_update_impl.hpp>
+#include <climits>
+#include <sstream>
+
+namespace KokkosBlas {
+namespace Experimental {
+
+/// \brief Compute Y := a*X + b*Y and return the 2-norm of the new Y.
+///
+/// Equivalent to axpby(a, X, b, Y) followed by nrm2(Y).  If b is zero,
+/// Y is not read (BLAS semantics).
+///
+/// \tparam XV 1-D Kokkos::View
+/// \tparam YV 1-D nonconst Kokkos::View
+template<class XV, class YV>
+typename Kokkos::Details::InnerProductSpaceTraits<typename YV::non_const_value_type>::mag_type
+axpby_nrm2 (const typename XV::non_const_value_type& a, const XV& X,
+            const typename YV::non_const_value_type& b, const YV& Y)
+{
+  static_assert (Kokkos::Impl::is_view<XV>::value, "KokkosBlas::axpby_nrm2: "
+                 "X is not a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_view<YV>::value, "KokkosBlas::axpby_nrm2: "
+                 "Y is not a Kokkos::View.");
+  static_assert (int(XV::rank) == 1 && int(YV::rank) == 1, "KokkosBlas::axpby_nrm2: "
+                 "X and Y must have rank 1.");
+
+  if (X.extent(0) != Y.extent(0)) {
+    std::ostringstream os;
+    os << "KokkosBlas::axpby_nrm2: Dimensions of X and Y do not match: "
+       << "X: " << X.extent(0) << ", Y: " << Y.extent(0);
+    Kokkos::Impl::throw_runtime_exception (os.str ());
+  }
+
+  typedef typename Kokkos::Details::InnerProductSpaceTraits<
+    typename YV::non_const_value_type>::mag_type mag_type;
+  typedef Kokkos::Details::ArithTraits<mag_type> AT;
+  typedef typename YV::size_type size_type;
+
+  Kokkos::Profiling::pushRegion("KokkosBlas::axpby_nrm2");
+  const size_type numRows = Y.extent(0);
+  mag_type result;
+  if (numRows < static_cast<size_type> (INT_MAX)) {
+    result = KokkosBlas::Impl::V_Axpby_Nrm2_Invoke<XV, YV, int> (a, X, b, Y);
+  }
+  else {
+    result = KokkosBlas::Impl::V_Axpby_Nrm2_Invoke<XV, YV, std::int64_t> (a, X, b, Y);
+  }
+  Kokkos::Profiling::popRegion();
+  return AT::sqrt (result);
+}
+
+/// \brief Compute Z := a*X + b*Y + c*Z and return dot(Z, W) of the new Z.
+///
+/// Equivalent to update(a, X, b, Y, c, Z) followed by dot(Z, W).  If c
+/// is zero, Z is not read (BLAS semantics).  W may be the same View as
+/// X or Y, but not Z.
+///
+/// \tparam XV 1-D Kokkos::View
+/// \tparam YV 1-D Kokkos::View
+/// \tparam ZV 1-D nonconst Kokkos::View
+/// \tparam WV 1-D Kokkos::View
+template<class XV, class YV, class ZV, class WV>
+typename Kokkos::Details::InnerProductSpaceTraits<typename ZV::non_const_value_type>::dot_type
+update_dot (const typename XV::non_const_value_type& a, const XV& X,
+            const typename YV::non_const_value_type& b, const YV& Y,
+            const typename ZV::non_const_value_type& c, const ZV& Z,
+            const WV& W)
+{
+  static_assert (Kokkos::Impl::is_view<XV>::value && Kokkos::Impl::is_view<YV>::value &&
+                 Kokkos::Impl::is_view<ZV>::value && Kokkos::Impl::is_view<WV>::value,
+                 "KokkosBlas::update_dot: X, Y, Z and W must be Kokkos::Views.");
+  static_assert (int(XV::rank) == 1 && int(YV::rank) == 1 &&
+                 int(ZV::rank) == 1 && int(WV::rank) == 1,
+                 "KokkosBlas::update_dot: X, Y, Z and W must have rank 1.");
+
+  if (X.extent(0) != Z.extent(0) || Y.extent(0) != Z.extent(0) ||
+      W.extent(0) != Z.extent(0)) {
+    std::ostringstream os;
+    os << "KokkosBlas::update_dot: Dimensions of X, Y, Z and W do not match: "
+       << "X: " << X.extent(0) << ", Y: " << Y.extent(0)
+       << ", Z: " << Z.extent(0) << ", W: " << W.extent(0);
+    Kokkos::Impl::throw_runtime_exception (os.str ());
+  }
+
+  typedef typename ZV::size_type size_type;
+  typename Kokkos::Details::InnerProductSpaceTraits<typename ZV::non_const_value_type>::dot_type result;
+
+  Kokkos::Profiling::pushRegion("KokkosBlas::update_dot");
+  const size_type numRows = Z.extent(0);
+  if (numRows < static_cast<size_type> (INT_MAX)) {
+    result = KokkosBlas::Impl::V_Update_Dot_Invoke<XV, YV, ZV, WV, int> (a, X, b, Y, c, Z, W);
+  }
+  else {
+    result = KokkosBlas::Impl::V_Update_Dot_Invoke<XV, YV, ZV, WV, std::int64_t> (a, X, b, Y, c, Z, W);
+  }
+  Kokkos::Profiling::popRegion();
+  return result;
+}
+
+/// \brief All vector updates and inner products of one iteration of
+///   pipelined preconditioned CG (Ghysels and Vanroose, 2014), fused
+///   into a single kernel.
+///
+/// Given n = A*m and m = M^{-1}*w from the overlapped preconditioner
+/// application and SpMV, compute
+///
+///   z = n + beta*z;   q = m + beta*q;   s = w + beta*s;   p = u + beta*p;
+///   x = x + alpha*p;  r = r - alpha*s;  u = u - alpha*q;  w = w - alpha*z;
+///
+/// and return gamma = (r,u), delta = (w,u) and rr = (r,r) for the new
+/// vectors.  The unfused sequence is eight axpby and three dot calls.
+/// In the first iteration pass beta = 0 (z, q, s and p are then
+/// overwritten; they must still be allocated and finite).
+///
+/// \param alpha [in] Step length.
+/// \param beta [in] Search direction update coefficient.
+/// \param n [in] A*m.
+/// \param m [in] Preconditioned w.
+template<class NV, class MV, class VV>
+typename KokkosBlas::Impl::V_PipelinedCG_Functor<NV, MV, VV>::value_type
+pipelined_cg_update (const typename VV::non_const_value_type& alpha,
+                     const typename VV::non_const_value_type& beta,
+                     const NV& n, const MV& m,
+                     const VV& z, const VV& q, const VV& s, const VV& p,
+                     const VV& x, const VV& r, const VV& u, const VV& w)
+{
+  static_assert (Kokkos::Impl::is_view<NV>::value && Kokkos::Impl::is_view<MV>::value &&
+                 Kokkos::Impl::is_view<VV>::value,
+                 "KokkosBlas::pipelined_cg_update: arguments must be Kokkos::Views.");
+  static_assert (int(NV::rank) == 1 && int(MV::rank) == 1 && int(VV::rank) == 1,
+                 "KokkosBlas::pipelined_cg_update: arguments must have rank 1.");
+
+  const size_t numRows = x.extent(0);
+  if (n.extent(0) != numRows || m.extent(0) != numRows ||
+      z.extent(0) != numRows || q.extent(0) != numRows ||
+      s.extent(0) != numRows || p.extent(0) != numRows ||
+      r.extent(0) != numRows || u.extent(0) != numRows ||
+      w.extent(0) != numRows) {
+    std::ostringstream os;
+    os << "KokkosBlas::pipelined_cg_update: all vectors must have length "
+       << numRows << " (the length of x)";
+    Kokkos::Impl::throw_runtime_exception (os.str ());
+  }
+
+  typename KokkosBlas::Impl::V_PipelinedCG_Functor<NV, MV, VV>::value_type result;
+
+  Kokkos::Profiling::pushRegion("KokkosBlas::pipelined_cg_update");
+  if (numRows < static_cast<size_t> (INT_MAX)) {
+    result = KokkosBlas::Impl::V_PipelinedCG_Invoke<NV, MV, VV, int>
+      (alpha, beta, n, m, z, q, s, p, x, r, u, w);
+  }
+  else {
+    result = KokkosBlas::Impl::V_PipelinedCG_Invoke<NV, MV, VV, std::int64_t>
+      (alpha, beta, n, m, z, q, s, p, x, r, u, w);
+  }
+  Kokkos::Profiling::popRegion();
+  return result;
+}
+
+} // namespace Experimental
+} // namespace KokkosBlas
+
+#endif // KOKKOSBLAS1_FUSED_UPDATE_HPP_
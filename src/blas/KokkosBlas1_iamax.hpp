@@ -0,0 +1,212 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#ifndef KOKKOSBLAS1_IAMAX_HPP_
+#define KOKKOSBLAS1_IAMAX_HPP_
+
+#include<KokkosBlas1_iamax_spec.hpp>
+#include<KokkosKernels_helpers.hpp>
+
+namespace KokkosBlas {
+
+namespace Impl {
+
+// Shared implementation of the single-vector iamax and iamin.
+template<class XVector, bool find_max>
+typename XVector::size_type
+iamax_vector (const XVector& x)
+{
+  static_assert (Kokkos::Impl::is_view<XVector>::value,
+                 "KokkosBlas::iamax: XVector must be a Kokkos::View.");
+  static_assert (XVector::rank == 1, "KokkosBlas::iamax: "
+                 "Both Vector inputs must have rank 1.");
+  typedef typename XVector::size_type index_type;
+
+  typedef Kokkos::View<typename XVector::const_value_type*,
+    typename KokkosKernels::Impl::GetUnifiedLayout<XVector>::array_layout,
+    typename XVector::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > XVector_Internal;
+
+  typedef Kokkos::View<index_type,
+    Kokkos::LayoutLeft,
+    Kokkos::HostSpace,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > RVector_Internal;
+
+  index_type result;
+  RVector_Internal R = RVector_Internal(&result);
+  XVector_Internal X = x;
+
+  if (find_max) {
+    Iamax<RVector_Internal,XVector_Internal>::iamax (R,X);
+  }
+  else {
+    Iamax<RVector_Internal,XVector_Internal>::iamin (R,X);
+  }
+  Kokkos::fence();
+  return result;
+}
+
+// Shared implementation of the multivector iamax and iamin.
+template<class RV, class XMV, bool find_max>
+void
+iamax_multivector (const RV& R, const XMV& X)
+{
+  static_assert (Kokkos::Impl::is_view<RV>::value, "KokkosBlas::iamax: "
+                 "R is not a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_view<XMV>::value, "KokkosBlas::iamax: "
+                 "X is not a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_same<typename RV::value_type,
+                 typename RV::non_const_value_type>::value,
+                 "KokkosBlas::iamax: R is const.  "
+                 "It must be nonconst, because it is an output argument "
+                 "(we have to be able to write to its entries).");
+  static_assert (((RV::rank == 0) && (XMV::rank == 1)) ||
+                 ((RV::rank == 1) && (XMV::rank == 2)), "KokkosBlas::iamax: "
+                 "RV and XMV must either have rank 0 and 1 or rank 1 and 2.");
+  static_assert (Kokkos::Impl::is_same<typename RV::value_type,
+                 typename XMV::size_type>::value,
+                 "KokkosBlas::iamax: R must have the size_type of X "
+                 "as its value_type.");
+
+  // Check compatibility of dimensions at run time.
+  if (X.extent(1) != R.extent(0)) {
+    std::ostringstream os;
+    os << "KokkosBlas::iamax (MV): Dimensions of R and X do not match: "
+       << "R: " << R.extent(0)
+       << ", X: " << X.extent(0) << " x " << X.extent(1);
+    Kokkos::Impl::throw_runtime_exception (os.str ());
+  }
+
+  // Create unmanaged versions of the input Views.  RV and XMV may be
+  // rank 1 or rank 2.
+  typedef Kokkos::View<
+    typename Kokkos::Impl::if_c<
+      RV::rank == 0,
+      typename RV::non_const_value_type,
+      typename RV::non_const_value_type* >::type,
+    typename KokkosKernels::Impl::GetUnifiedLayout<RV>::array_layout,
+    typename RV::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > RV_Internal;
+  typedef Kokkos::View<
+    typename Kokkos::Impl::if_c<
+      XMV::rank == 1,
+      typename XMV::const_value_type*,
+      typename XMV::const_value_type** >::type,
+    typename KokkosKernels::Impl::GetUnifiedLayout<XMV>::array_layout,
+    typename XMV::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > XMV_Internal;
+
+  RV_Internal R_internal = R;
+  XMV_Internal X_internal = X;
+
+  if (find_max) {
+    Iamax<RV_Internal, XMV_Internal>::iamax (R_internal, X_internal);
+  }
+  else {
+    Iamax<RV_Internal, XMV_Internal>::iamin (R_internal, X_internal);
+  }
+}
+
+} // namespace Impl
+
+/// \brief Return the index of the entry of x with the largest
+///   magnitude.
+///
+/// As in reference BLAS, the magnitude of an entry is |Re(x_i)| +
+/// |Im(x_i)|, the index is 1-based, the first index is returned if
+/// several entries share the largest magnitude, and 0 is returned for
+/// an empty vector.
+///
+/// \tparam XVector Type of the vector x; a 1-D Kokkos::View.
+///
+/// \param x [in] Input 1-D View.
+///
+/// \return The (1-based) index of the largest entry; a single value.
+template<class XVector>
+typename XVector::size_type
+iamax (const XVector& x)
+{
+  return Impl::iamax_vector<XVector, true> (x);
+}
+
+/// \brief R(j) = iamax(X(:,j))
+///
+/// Store in R the (1-based) index of the entry with the largest
+/// magnitude of each column of X, with the same conventions as the
+/// single-vector iamax.
+///
+/// \tparam RV 0-D or 1-D output View; its value_type must be
+///   XMV::size_type.
+/// \tparam XMV 1-D or 2-D input View.
+template<class RV, class XMV>
+void
+iamax (const RV& R, const XMV& X,
+       typename std::enable_if<Kokkos::Impl::is_view<RV>::value, int>::type = 0)
+{
+  Impl::iamax_multivector<RV, XMV, true> (R, X);
+}
+
+/// \brief Return the index of the entry of x with the smallest
+///   magnitude.
+///
+/// This is not part of reference BLAS, but is provided by several
+/// vendor libraries.  It follows the same conventions as iamax: 1-based
+/// index, first index on ties, and 0 for an empty vector.
+template<class XVector>
+typename XVector::size_type
+iamin (const XVector& x)
+{
+  return Impl::iamax_vector<XVector, false> (x);
+}
+
+/// \brief R(j) = iamin(X(:,j))
+template<class RV, class XMV>
+void
+iamin (const RV& R, const XMV& X,
+       typename std::enable_if<Kokkos::Impl::is_view<RV>::value, int>::type = 0)
+{
+  Impl::iamax_multivector<RV, XMV, false> (R, X);
+}
+
+}
+
+#endif // KOKKOSBLAS1_IAMAX_HPP_
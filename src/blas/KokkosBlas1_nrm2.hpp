@@ -46,6 +46,8 @@
 
 #include<KokkosBlas1_nrm2_spec.hpp>
 #include<KokkosKernels_helpers.hpp>
+#include<KokkosBlas1_reproducible.hpp>
+#include<KokkosBlas1_compensated.hpp>
 
 namespace KokkosBlas {
 
@@ -66,6 +68,13 @@ nrm2 (const XVector& x)
                  "Both Vector inputs must have rank 1.");
   typedef typename Kokkos::Details::InnerProductSpaceTraits<typename XVector::non_const_value_type>::mag_type mag_type;
 
+  if (Experimental::get_reduction_mode () == Experimental::REDUCTION_REPRODUCIBLE) {
+    return Experimental::reproducible_nrm2 (x);
+  }
+  if (Experimental::get_reduction_mode () == Experimental::REDUCTION_COMPENSATED) {
+    return Experimental::compensated_nrm2 (x);
+  }
+
   typedef Kokkos::View<typename XVector::const_value_type*,
     typename KokkosKernels::Impl::GetUnifiedLayout<XVector>::array_layout,
     typename XVector::device_type,
@@ -128,6 +137,15 @@ nrm2 (const RV& R, const XMV& X,
     Kokkos::Impl::throw_runtime_exception (os.str ());
   }
 
+  if (Experimental::get_reduction_mode () == Experimental::REDUCTION_REPRODUCIBLE) {
+    Experimental::reproducible_nrm2 (R, X);
+    return;
+  }
+  if (Experimental::get_reduction_mode () == Experimental::REDUCTION_COMPENSATED) {
+    Experimental::compensated_nrm2 (R, X);
+    return;
+  }
+
   // Create unmanaged versions of the input Views.  RV and XMV may be
   // rank 1 or rank 2.
   typedef Kokkos::View<
@@ -0,0 +1,89 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#ifndef KOKKOSBLAS1_REDUCTION_MODE_HPP_
+#define KOKKOSBLAS1_REDUCTION_MODE_HPP_
+
+/// \file KokkosBlas1_reduction_mode.hpp
+///
+/// Process-wide selection of the algorithm used by the BLAS 1
+/// reductions KokkosBlas::dot, sum and nrm2.
+
+namespace KokkosBlas {
+namespace Experimental {
+
+enum ReductionMode {
+  /// Kokkos::parallel_reduce (or the TPL); fastest, but the rounding of
+  /// the result depends on the number of threads.
+  REDUCTION_DEFAULT,
+  /// Fixed-order blocked reduction; bitwise identical results for any
+  /// number of threads.  See KokkosBlas1_reproducible.hpp.
+  REDUCTION_REPRODUCIBLE,
+  /// Compensated summation (Kahan-Babuska for sum, Dot2 for dot and
+  /// nrm2); about as accurate as accumulating in twice the working
+  /// precision.  See KokkosBlas1_compensated.hpp.
+  REDUCTION_COMPENSATED
+};
+
+namespace Impl {
+inline ReductionMode& reduction_mode_storage () {
+  static ReductionMode mode = REDUCTION_DEFAULT;
+  return mode;
+}
+}
+
+/// \brief Set the algorithm used by all subsequent calls of
+///   KokkosBlas::dot, sum and nrm2.  Not thread safe; set it once at
+///   startup.
+inline void set_reduction_mode (const ReductionMode mode) {
+  Impl::reduction_mode_storage () = mode;
+}
+
+/// \brief The algorithm currently used by KokkosBlas::dot, sum and nrm2.
+inline ReductionMode get_reduction_mode () {
+  return Impl::reduction_mode_storage ();
+}
+
+} // namespace Experimental
+} // namespace KokkosBlas
+
+#endif // KOKKOSBLAS1_REDUCTION_MODE_HPP_
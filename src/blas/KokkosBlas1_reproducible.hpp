@@ -0,0 +1,201 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#ifndef KOKKOSBLAS1_REPRODUCIBLE_HPP_
+#define KOKKOSBLAS1_REPRODUCIBLE_HPP_
+
+/// \file KokkosBlas1_reproducible.hpp
+///
+/// Reproducible variants of dot, sum and nrm2: for a given vector length
+/// and type of execution space the result is bitwise identical for any
+/// number of threads.  The vector is reduced in fixed-size blocks whose
+/// partial results are combined by a fixed pairwise tree, see
+/// KokkosBlas1_reproducible_impl.hpp.
+///
+/// Call these directly to select the algorithm per call, or use
+/// Experimental::set_reduction_mode(REDUCTION_REPRODUCIBLE) to make
+/// KokkosBlas::dot, sum and nrm2 use them.
+
+#include <KokkosKernels_Macros.hpp>
+#include <KokkosBlas1_reduction_mode.hpp>
+#include <KokkosBlas1_reproducible_impl.hpp>
+#include <sstream>
+#include <type_traits>
+
+namespace KokkosBlas {
+namespace Experimental {
+
+namespace Impl {
+template<class XMV, class YMV>
+void reduction_check_dims (const char name[], const XMV& X, const YMV& Y) {
+  if (X.extent(0) != Y.extent(0) ||
+      (X.extent(1) != Y.extent(1) && X.extent(1) != 1 && Y.extent(1) != 1)) {
+    std::ostringstream os;
+    os << "KokkosBlas::" << name << ": Dimensions of X and Y do not match: "
+       << "X: " << X.extent(0) << " x " << X.extent(1)
+       << ", Y: " << Y.extent(0) << " x " << Y.extent(1);
+    Kokkos::Impl::throw_runtime_exception (os.str ());
+  }
+}
+
+template<class RV>
+void reduction_check_result (const char name[], const RV& R, const size_t numCols) {
+  if (RV::rank == 1 && R.extent(0) != numCols) {
+    std::ostringstream os;
+    os << "KokkosBlas::" << name << ": R has " << R.extent(0)
+       << " entries, but the input has " << numCols << " columns";
+    Kokkos::Impl::throw_runtime_exception (os.str ());
+  }
+}
+}
+
+/// \brief Reproducible dot product of the two vectors x and y.
+template<class XVector, class YVector>
+typename Kokkos::Details::InnerProductSpaceTraits<typename XVector::non_const_value_type>::dot_type
+reproducible_dot (const XVector& x, const YVector& y)
+{
+  static_assert (Kokkos::Impl::is_view<XVector>::value && Kokkos::Impl::is_view<YVector>::value,
+                 "KokkosBlas::reproducible_dot: x and y must be Kokkos::Views.");
+  static_assert (XVector::rank == 1 && YVector::rank == 1,
+                 "KokkosBlas::reproducible_dot: x and y must have rank 1.");
+  Impl::reduction_check_dims ("reproducible_dot", x, y);
+
+  typedef KokkosBlas::Impl::ReproducibleDotOp<XVector, YVector> op_type;
+  typename op_type::value_type result;
+  Kokkos::View<typename op_type::value_type, Kokkos::HostSpace,
+               Kokkos::MemoryTraits<Kokkos::Unmanaged> > R (&result);
+  KokkosBlas::Impl::reproducible_reduce<op_type> ("KokkosBlas::reproducible_dot", R, x, y);
+  return result;
+}
+
+/// \brief Reproducible column-wise dot products, with the same
+///   combinations of ranks as KokkosBlas::dot(R,X,Y).
+template<class RV, class XMV, class YMV>
+void
+reproducible_dot (const RV& R, const XMV& X, const YMV& Y,
+                  typename std::enable_if<Kokkos::Impl::is_view<RV>::value, int>::type = 0)
+{
+  static_assert (Kokkos::Impl::is_view<XMV>::value && Kokkos::Impl::is_view<YMV>::value,
+                 "KokkosBlas::reproducible_dot: X and Y must be Kokkos::Views.");
+  static_assert ((RV::rank == 0 && XMV::rank == 1 && YMV::rank == 1) ||
+                 (RV::rank == 1 && (XMV::rank == 2 || YMV::rank == 2)),
+                 "KokkosBlas::reproducible_dot: R must be 0-D for vectors, "
+                 "1-D if X or Y is a multivector.");
+  Impl::reduction_check_dims ("reproducible_dot", X, Y);
+  Impl::reduction_check_result ("reproducible_dot", R, X.extent(1) > Y.extent(1) ? X.extent(1) : Y.extent(1));
+
+  KokkosBlas::Impl::reproducible_reduce<KokkosBlas::Impl::ReproducibleDotOp<XMV, YMV> >
+    ("KokkosBlas::reproducible_dot", R, X, Y);
+}
+
+/// \brief Reproducible sum of the entries of the vector x.
+template<class XVector>
+typename XVector::non_const_value_type
+reproducible_sum (const XVector& x)
+{
+  static_assert (Kokkos::Impl::is_view<XVector>::value,
+                 "KokkosBlas::reproducible_sum: x must be a Kokkos::View.");
+  static_assert (XVector::rank == 1,
+                 "KokkosBlas::reproducible_sum: x must have rank 1.");
+
+  typedef KokkosBlas::Impl::ReproducibleSumOp<XVector> op_type;
+  typename op_type::value_type result;
+  Kokkos::View<typename op_type::value_type, Kokkos::HostSpace,
+               Kokkos::MemoryTraits<Kokkos::Unmanaged> > R (&result);
+  KokkosBlas::Impl::reproducible_reduce<op_type> ("KokkosBlas::reproducible_sum", R, x, x);
+  return result;
+}
+
+/// \brief Reproducible R(j) = sum(X(:,j)); R is 0-D for a vector X.
+template<class RV, class XMV>
+void
+reproducible_sum (const RV& R, const XMV& X,
+                  typename std::enable_if<Kokkos::Impl::is_view<RV>::value, int>::type = 0)
+{
+  static_assert (Kokkos::Impl::is_view<XMV>::value,
+                 "KokkosBlas::reproducible_sum: X must be a Kokkos::View.");
+  static_assert (RV::rank + 1 == XMV::rank,
+                 "KokkosBlas::reproducible_sum: R must have rank one less than X.");
+  Impl::reduction_check_result ("reproducible_sum", R, X.extent(1));
+
+  KokkosBlas::Impl::reproducible_reduce<KokkosBlas::Impl::ReproducibleSumOp<XMV> >
+    ("KokkosBlas::reproducible_sum", R, X, X);
+}
+
+/// \brief Reproducible 2-norm of the vector x.
+template<class XVector>
+typename Kokkos::Details::InnerProductSpaceTraits<typename XVector::non_const_value_type>::mag_type
+reproducible_nrm2 (const XVector& x)
+{
+  static_assert (Kokkos::Impl::is_view<XVector>::value,
+                 "KokkosBlas::reproducible_nrm2: x must be a Kokkos::View.");
+  static_assert (XVector::rank == 1,
+                 "KokkosBlas::reproducible_nrm2: x must have rank 1.");
+
+  typedef KokkosBlas::Impl::ReproducibleNrm2Op<XVector> op_type;
+  typename op_type::value_type result;
+  Kokkos::View<typename op_type::value_type, Kokkos::HostSpace,
+               Kokkos::MemoryTraits<Kokkos::Unmanaged> > R (&result);
+  KokkosBlas::Impl::reproducible_reduce<op_type> ("KokkosBlas::reproducible_nrm2", R, x, x);
+  return result;
+}
+
+/// \brief Reproducible R(j) = nrm2(X(:,j)); R is 0-D for a vector X.
+template<class RV, class XMV>
+void
+reproducible_nrm2 (const RV& R, const XMV& X,
+                   typename std::enable_if<Kokkos::Impl::is_view<RV>::value, int>::type = 0)
+{
+  static_assert (Kokkos::Impl::is_view<XMV>::value,
+                 "KokkosBlas::reproducible_nrm2: X must be a Kokkos::View.");
+  static_assert (RV::rank + 1 == XMV::rank,
+                 "KokkosBlas::reproducible_nrm2: R must have rank one less than X.");
+  Impl::reduction_check_result ("reproducible_nrm2", R, X.extent(1));
+
+  KokkosBlas::Impl::reproducible_reduce<KokkosBlas::Impl::ReproducibleNrm2Op<XMV> >
+    ("KokkosBlas::reproducible_nrm2", R, X, X);
+}
+
+} // namespace Experimental
+} // namespace KokkosBlas
+
+#endif // KOKKOSBLAS1_REPRODUCIBLE_HPP_
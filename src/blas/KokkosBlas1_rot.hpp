@@ -0,0 +1,148 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#ifndef KOKKOSBLAS1_ROT_HPP_
+#define KOKKOSBLAS1_ROT_HPP_
+
+#include<KokkosBlas1_rot_spec.hpp>
+#include<KokkosKernels_helpers.hpp>
+#include<KokkosBlas1_rotg_impl.hpp>
+
+namespace KokkosBlas {
+
+/// \brief Apply a plane rotation to the pairs (X(i,j), Y(i,j)):
+///
+///   X(i,j) =         c  * X(i,j) + s * Y(i,j)
+///   Y(i,j) = -conj(s) * X(i,j) + c * Y(i,j)
+///
+/// This is BLAS ?rot (and LAPACK zrot for complex entries).  Use rotg
+/// to compute c and s.
+///
+/// \tparam XMV 1-D or 2-D Kokkos::View specialization.
+/// \tparam YMV 1-D or 2-D Kokkos::View specialization.  It must have
+///   the same rank and the same entry type as XMV.
+///
+/// \param c [in] Cosine of the rotation; a real number.
+/// \param s [in] Sine of the rotation; of the entry type of X.
+template<class XMV, class YMV>
+void
+rot (const XMV& X, const YMV& Y,
+     const typename Kokkos::Details::ArithTraits<typename XMV::non_const_value_type>::mag_type& c,
+     const typename XMV::non_const_value_type& s)
+{
+  static_assert (Kokkos::Impl::is_view<XMV>::value, "KokkosBlas::rot: "
+                 "X is not a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_view<YMV>::value, "KokkosBlas::rot: "
+                 "Y is not a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_same<typename XMV::value_type,
+                 typename XMV::non_const_value_type>::value,
+                 "KokkosBlas::rot: X is const.  "
+                 "It must be nonconst, because it is an output argument "
+                 "(we have to be able to write to its entries).");
+  static_assert (Kokkos::Impl::is_same<typename YMV::value_type,
+                 typename YMV::non_const_value_type>::value,
+                 "KokkosBlas::rot: Y is const.  "
+                 "It must be nonconst, because it is an output argument "
+                 "(we have to be able to write to its entries).");
+  static_assert (int(XMV::rank) == int(YMV::rank), "KokkosBlas::rot: "
+                 "X and Y must have the same rank.");
+  static_assert (YMV::rank == 1 || YMV::rank == 2, "KokkosBlas::rot: "
+                 "XMV and YMV must either have rank 1 or rank 2.");
+
+  // Check compatibility of dimensions at run time.
+  if (X.extent(0) != Y.extent(0) ||
+      X.extent(1) != Y.extent(1)) {
+    std::ostringstream os;
+    os << "KokkosBlas::rot (MV): Dimensions of X and Y do not match: "
+       << "X: " << X.extent(0) << " x " << X.extent(1)
+       << ", Y: " << Y.extent(0) << " x " << Y.extent(1);
+    Kokkos::Impl::throw_runtime_exception (os.str ());
+  }
+
+  // Create unmanaged versions of the input Views.  XMV and YMV may be
+  // rank 1 or rank 2.
+  typedef Kokkos::View<
+    typename Kokkos::Impl::if_c<
+      XMV::rank == 1,
+      typename XMV::non_const_value_type*,
+      typename XMV::non_const_value_type** >::type,
+    typename KokkosKernels::Impl::GetUnifiedLayout<XMV>::array_layout,
+    typename XMV::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > XMV_Internal;
+  typedef Kokkos::View<
+    typename Kokkos::Impl::if_c<
+      YMV::rank == 1,
+      typename YMV::non_const_value_type*,
+      typename YMV::non_const_value_type** >::type,
+    typename KokkosKernels::Impl::GetUnifiedLayout<YMV>::array_layout,
+    typename YMV::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > YMV_Internal;
+
+  XMV_Internal X_internal = X;
+  YMV_Internal Y_internal = Y;
+
+  Impl::Rot<XMV_Internal, YMV_Internal>::rot (X_internal, Y_internal, c, s);
+}
+
+/// \brief Construct a plane (Givens) rotation, like BLAS ?rotg.
+///
+/// Compute c and s such that
+///
+///   [  c        s ] [ a ]   [ r ]
+///   [ -conj(s)  c ] [ b ] = [ 0 ],
+///
+/// and overwrite a with r.  For real Scalar, b is overwritten with the
+/// reconstruction parameter z of reference BLAS drotg; for complex
+/// Scalar, b is left unchanged (as in zrotg).  This is a scalar
+/// function; it may be called on the host or inside a kernel.
+template<class Scalar>
+KOKKOS_INLINE_FUNCTION void
+rotg (Scalar& a, Scalar& b,
+      typename Kokkos::Details::ArithTraits<Scalar>::mag_type& c,
+      Scalar& s)
+{
+  Impl::Rotg<Scalar>::rotg (a, b, c, s);
+}
+
+}
+
+#endif // KOKKOSBLAS1_ROT_HPP_
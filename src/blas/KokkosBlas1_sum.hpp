@@ -46,6 +46,8 @@
 
 #include<KokkosBlas1_sum_spec.hpp>
 #include<KokkosKernels_helpers.hpp>
+#include<KokkosBlas1_reproducible.hpp>
+#include<KokkosBlas1_compensated.hpp>
 
 namespace KokkosBlas {
 
@@ -65,6 +67,13 @@ sum (const XVector& x)
   static_assert (XVector::rank == 1, "KokkosBlas::sum: "
                  "Both Vector inputs must have rank 1.");
 
+  if (Experimental::get_reduction_mode () == Experimental::REDUCTION_REPRODUCIBLE) {
+    return Experimental::reproducible_sum (x);
+  }
+  if (Experimental::get_reduction_mode () == Experimental::REDUCTION_COMPENSATED) {
+    return Experimental::compensated_sum (x);
+  }
+
   typedef Kokkos::View<typename XVector::const_value_type*,
     typename KokkosKernels::Impl::GetUnifiedLayout<XVector>::array_layout,
     typename XVector::device_type,
@@ -121,6 +130,15 @@ sum (const RV& R, const XMV& X,
     Kokkos::Impl::throw_runtime_exception (os.str ());
   }
 
+  if (Experimental::get_reduction_mode () == Experimental::REDUCTION_REPRODUCIBLE) {
+    Experimental::reproducible_sum (R, X);
+    return;
+  }
+  if (Experimental::get_reduction_mode () == Experimental::REDUCTION_COMPENSATED) {
+    Experimental::compensated_sum (R, X);
+    return;
+  }
+
   // Create unmanaged versions of the input Views.  RV and XMV may be
   // rank 1 or rank 2.
   typedef Kokkos::View<
@@ -0,0 +1,138 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#ifndef KOKKOSBLAS2_GER_HPP_
+#define KOKKOSBLAS2_GER_HPP_
+
+/// \file KokkosBlas2_ger.hpp
+
+#include <KokkosBlas2_ger_spec.hpp>
+#include <KokkosKernels_helpers.hpp>
+#include <sstream>
+#include <type_traits>
+
+namespace KokkosBlas {
+
+/// \brief Rank-1 update of a general matrix: A = A + alpha*x*op(y).
+///
+/// \tparam XViewType Input vector, as a 1-D Kokkos::View
+/// \tparam YViewType Input vector, as a 1-D Kokkos::View
+/// \tparam AViewType Input/output matrix, as a nonconst 2-D Kokkos::View
+///
+/// \param trans [in] "T" for op(y) = y^T (BLAS ?ger / ?geru), "H" for
+///   op(y) = y^H (BLAS ?gerc).  Both are the same for real scalars.
+/// \param alpha [in] Input coefficient of x*op(y)
+/// \param x [in] Input vector, as a 1-D Kokkos::View
+/// \param y [in] Input vector, as a 1-D Kokkos::View
+/// \param A [in/out] Output matrix, as a nonconst 2-D Kokkos::View
+template<class XViewType,
+         class YViewType,
+         class AViewType>
+void
+ger (const char trans[],
+     typename AViewType::const_value_type& alpha,
+     const XViewType& x,
+     const YViewType& y,
+     const AViewType& A)
+{
+  static_assert (Kokkos::Impl::is_view<XViewType>::value,
+                 "XViewType must be a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_view<YViewType>::value,
+                 "YViewType must be a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_view<AViewType>::value,
+                 "AViewType must be a Kokkos::View.");
+  static_assert (static_cast<int> (XViewType::rank) == 1,
+                 "XViewType must have rank 1.");
+  static_assert (static_cast<int> (YViewType::rank) == 1,
+                 "YViewType must have rank 1.");
+  static_assert (static_cast<int> (AViewType::rank) == 2,
+                 "AViewType must have rank 2.");
+  static_assert (std::is_same<typename AViewType::value_type,
+                 typename AViewType::non_const_value_type>::value,
+                 "KokkosBlas::ger: A is const.  "
+                 "It must be nonconst, because it is an output argument "
+                 "(we have to be able to write to its entries).");
+
+  if (!(trans[0] == 'T' || trans[0] == 't' ||
+        trans[0] == 'H' || trans[0] == 'h' ||
+        trans[0] == 'C' || trans[0] == 'c')) {
+    std::ostringstream os;
+    os << "KokkosBlas::ger: trans[0] = '" << trans[0] << "'.  Valid values "
+      "include 'T' (transpose) and 'H' (conjugate transpose).";
+    Kokkos::Impl::throw_runtime_exception (os.str ());
+  }
+
+  // Check compatibility of dimensions at run time.
+  if (A.extent(0) != x.extent(0) || A.extent(1) != y.extent(0)) {
+    std::ostringstream os;
+    os << "KokkosBlas::ger: Dimensions of A, x, and y do not match: "
+       << "A: " << A.extent(0) << " x " << A.extent(1)
+       << ", x: " << x.extent(0) << ", y: " << y.extent(0);
+    Kokkos::Impl::throw_runtime_exception (os.str ());
+  }
+
+  // Return if degenerated matrices are provided
+  if (A.extent(0) == 0 || A.extent(1) == 0)
+    return;
+
+  // Minimize the number of Impl::GER instantiations, by
+  // standardizing on particular View specializations for its template
+  // parameters.
+  typedef Kokkos::View<typename XViewType::const_value_type*,
+    typename KokkosKernels::Impl::GetUnifiedLayout<XViewType>::array_layout,
+    typename XViewType::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > XVT;
+  typedef Kokkos::View<typename YViewType::const_value_type*,
+    typename KokkosKernels::Impl::GetUnifiedLayout<YViewType>::array_layout,
+    typename YViewType::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > YVT;
+  typedef Kokkos::View<typename AViewType::non_const_value_type**,
+    typename AViewType::array_layout,
+    typename AViewType::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > AVT;
+  typedef Impl::GER<XVT, YVT, AVT> impl_type;
+  impl_type::ger (trans, alpha, x, y, A);
+}
+
+} // namespace KokkosBlas
+
+#endif // KOKKOSBLAS2_GER_HPP_
@@ -0,0 +1,180 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#ifndef KOKKOSBLAS2_SYMV_HPP_
+#define KOKKOSBLAS2_SYMV_HPP_
+
+/// \file KokkosBlas2_symv.hpp
+
+#include <KokkosBlas2_symv_spec.hpp>
+#include <KokkosKernels_helpers.hpp>
+#include <sstream>
+#include <type_traits>
+
+namespace KokkosBlas {
+
+namespace Impl {
+
+template<class AViewType,
+         class XViewType,
+         class YViewType>
+void
+symv_check_and_call (const char caller[],
+                     const char uplo[],
+                     const bool hermitian,
+                     typename AViewType::const_value_type& alpha,
+                     const AViewType& A,
+                     const XViewType& x,
+                     typename YViewType::const_value_type& beta,
+                     const YViewType& y)
+{
+  static_assert (Kokkos::Impl::is_view<AViewType>::value,
+                 "AViewType must be a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_view<XViewType>::value,
+                 "XViewType must be a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_view<YViewType>::value,
+                 "YViewType must be a Kokkos::View.");
+  static_assert (static_cast<int> (AViewType::rank) == 2,
+                 "AViewType must have rank 2.");
+  static_assert (static_cast<int> (XViewType::rank) == 1,
+                 "XViewType must have rank 1.");
+  static_assert (static_cast<int> (YViewType::rank) == 1,
+                 "YViewType must have rank 1.");
+
+  if (!(uplo[0] == 'U' || uplo[0] == 'u' ||
+        uplo[0] == 'L' || uplo[0] == 'l')) {
+    std::ostringstream os;
+    os << "KokkosBlas::" << caller << ": uplo[0] = '" << uplo[0] << "'.  "
+       << "Valid values include 'U' (upper triangle) and 'L' (lower triangle).";
+    Kokkos::Impl::throw_runtime_exception (os.str ());
+  }
+
+  // Check compatibility of dimensions at run time.
+  if (A.extent(0) != A.extent(1) ||
+      A.extent(1) != x.extent(0) || A.extent(0) != y.extent(0)) {
+    std::ostringstream os;
+    os << "KokkosBlas::" << caller << ": Dimensions of A, x, and y do not match: "
+       << "A: " << A.extent(0) << " x " << A.extent(1)
+       << ", x: " << x.extent(0) << ", y: " << y.extent(0);
+    Kokkos::Impl::throw_runtime_exception (os.str ());
+  }
+
+  // Return if degenerated matrices are provided
+  if (A.extent(0) == 0)
+    return;
+
+  // Minimize the number of Impl::SYMV instantiations, by
+  // standardizing on particular View specializations for its template
+  // parameters.
+  typedef Kokkos::View<typename AViewType::const_value_type**,
+    typename AViewType::array_layout,
+    typename AViewType::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > AVT;
+  typedef Kokkos::View<typename XViewType::const_value_type*,
+    typename KokkosKernels::Impl::GetUnifiedLayout<XViewType>::array_layout,
+    typename XViewType::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > XVT;
+  typedef Kokkos::View<typename YViewType::non_const_value_type*,
+    typename KokkosKernels::Impl::GetUnifiedLayout<YViewType>::array_layout,
+    typename YViewType::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > YVT;
+  typedef Impl::SYMV<AVT, XVT, YVT> impl_type;
+  impl_type::symv (uplo, hermitian, alpha, A, x, beta, y);
+}
+
+} // namespace Impl
+
+/// \brief Symmetric matrix-vector multiply: y = beta*y + alpha*A*x.
+///
+/// Only the triangle of A selected by uplo is referenced, and each stored
+/// entry is read once: every tile of that triangle contributes to both the
+/// row and the column products. This halves the amount of matrix data
+/// compared to gemv.
+///
+/// \tparam AViewType Input symmetric matrix, as a 2-D Kokkos::View
+/// \tparam XViewType Input vector, as a 1-D Kokkos::View
+/// \tparam YViewType Output vector, as a nonconst 1-D Kokkos::View
+///
+/// \param uplo [in] "U" if the upper, "L" if the lower triangle of A
+///   is stored.
+/// \param alpha [in] Input coefficient of A*x
+/// \param A [in] Input matrix, as a 2-D Kokkos::View
+/// \param x [in] Input vector, as a 1-D Kokkos::View
+/// \param beta [in] Input coefficient of y
+/// \param y [in/out] Output vector, as a nonconst 1-D Kokkos::View
+template<class AViewType,
+         class XViewType,
+         class YViewType>
+void
+symv (const char uplo[],
+      typename AViewType::const_value_type& alpha,
+      const AViewType& A,
+      const XViewType& x,
+      typename YViewType::const_value_type& beta,
+      const YViewType& y)
+{
+  Impl::symv_check_and_call ("symv", uplo, false, alpha, A, x, beta, y);
+}
+
+/// \brief Hermitian matrix-vector multiply: y = beta*y + alpha*A*x.
+///
+/// Like symv, but the triangle of A which is not referenced is the
+/// conjugate transpose of the stored one, and the imaginary part of
+/// the diagonal of A is assumed to be zero.  For real matrices this is
+/// the same as symv.
+template<class AViewType,
+         class XViewType,
+         class YViewType>
+void
+hemv (const char uplo[],
+      typename AViewType::const_value_type& alpha,
+      const AViewType& A,
+      const XViewType& x,
+      typename YViewType::const_value_type& beta,
+      const YViewType& y)
+{
+  Impl::symv_check_and_call ("hemv", uplo, true, alpha, A, x, beta, y);
+}
+
+} // namespace KokkosBlas
+
+#endif // KOKKOSBLAS2_SYMV_HPP_
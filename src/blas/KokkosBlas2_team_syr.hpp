@@ -0,0 +1,88 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#ifndef KOKKOSBLAS2_TEAM_SYR_HPP_
+#define KOKKOSBLAS2_TEAM_SYR_HPP_
+
+#include<KokkosBlas2_team_syr_spec.hpp>
+
+namespace KokkosBlas {
+namespace Experimental {
+
+// A = A + alpha*x*op(x) on the uplo triangle of A; see KokkosBlas::syr.
+template<class TeamType, class XVector, class MatrixType>
+void KOKKOS_INLINE_FUNCTION syr (const TeamType& team,
+                 const char trans,
+                 const char uplo,
+                 const typename MatrixType::non_const_value_type& alpha,
+                 const XVector& x,
+                 const MatrixType& A)
+{
+  const bool lower = (uplo == 'L' || uplo == 'l');
+  if (trans == 'T' || trans == 't')
+    return Impl::TeamSYR<TeamType,XVector,XVector,MatrixType,false,false>::team_syr(team,lower,alpha,x,x,A);
+  if (trans == 'H' || trans == 'h' || trans == 'C' || trans == 'c')
+    return Impl::TeamSYR<TeamType,XVector,XVector,MatrixType,false,true>::team_syr(team,lower,alpha,x,x,A);
+}
+
+// A = A + alpha*x*op(y) + op(alpha)*y*op(x) on the uplo triangle of A;
+// see KokkosBlas::syr2.
+template<class TeamType, class XVector, class YVector, class MatrixType>
+void KOKKOS_INLINE_FUNCTION syr2 (const TeamType& team,
+                 const char trans,
+                 const char uplo,
+                 const typename MatrixType::non_const_value_type& alpha,
+                 const XVector& x,
+                 const YVector& y,
+                 const MatrixType& A)
+{
+  const bool lower = (uplo == 'L' || uplo == 'l');
+  if (trans == 'T' || trans == 't')
+    return Impl::TeamSYR<TeamType,XVector,YVector,MatrixType,true,false>::team_syr(team,lower,alpha,x,y,A);
+  if (trans == 'H' || trans == 'h' || trans == 'C' || trans == 'c')
+    return Impl::TeamSYR<TeamType,XVector,YVector,MatrixType,true,true>::team_syr(team,lower,alpha,x,y,A);
+}
+
+}
+}
+
+#endif
@@ -0,0 +1,137 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#ifndef KOKKOSBLAS2_TRMV_HPP_
+#define KOKKOSBLAS2_TRMV_HPP_
+
+/// \file KokkosBlas2_trmv.hpp
+
+#include <KokkosBlas2_trmv_spec.hpp>
+#include <KokkosKernels_helpers.hpp>
+#include <sstream>
+#include <type_traits>
+
+namespace KokkosBlas {
+
+/// \brief Triangular matrix-vector multiply: x = op(A)*x.
+///
+/// Only the triangle of A selected by uplo is referenced.
+///
+/// \tparam AViewType Input triangular matrix, as a 2-D Kokkos::View
+/// \tparam XViewType Input/output vector, as a nonconst 1-D Kokkos::View
+///
+/// \param uplo [in] "U" if A is upper, "L" if A is lower triangular.
+/// \param trans [in] "N" for op(A) = A, "T" for op(A) = A^T, "C" for
+///   op(A) = A^H.
+/// \param diag [in] "U" if the diagonal of A is assumed to be all
+///   ones (and is not referenced), "N" otherwise.
+/// \param A [in] Input matrix, as a 2-D Kokkos::View
+/// \param x [in/out] Input/output vector, as a nonconst 1-D Kokkos::View
+template<class AViewType,
+         class XViewType>
+void
+trmv (const char uplo[],
+      const char trans[],
+      const char diag[],
+      const AViewType& A,
+      const XViewType& x)
+{
+  static_assert (Kokkos::Impl::is_view<AViewType>::value,
+                 "AViewType must be a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_view<XViewType>::value,
+                 "XViewType must be a Kokkos::View.");
+  static_assert (static_cast<int> (AViewType::rank) == 2,
+                 "AViewType must have rank 2.");
+  static_assert (static_cast<int> (XViewType::rank) == 1,
+                 "XViewType must have rank 1.");
+  static_assert (std::is_same<typename XViewType::value_type,
+                 typename XViewType::non_const_value_type>::value,
+                 "KokkosBlas::trmv: x is const.  "
+                 "It must be nonconst, because it is an output argument "
+                 "(we have to be able to write to its entries).");
+
+  const bool valid_uplo = (uplo[0] == 'U' || uplo[0] == 'u' ||
+                           uplo[0] == 'L' || uplo[0] == 'l');
+  const bool valid_trans = (trans[0] == 'N' || trans[0] == 'n' ||
+                            trans[0] == 'T' || trans[0] == 't' ||
+                            trans[0] == 'C' || trans[0] == 'c');
+  const bool valid_diag = (diag[0] == 'U' || diag[0] == 'u' ||
+                           diag[0] == 'N' || diag[0] == 'n');
+  if (!valid_uplo || !valid_trans || !valid_diag) {
+    std::ostringstream os;
+    os << "KokkosBlas::trmv: uplo[0] = '" << uplo[0] << "', trans[0] = '"
+       << trans[0] << "', diag[0] = '" << diag[0] << "'.  Valid values for "
+       << "uplo are 'U' and 'L', for trans 'N', 'T' and 'C', for diag 'U' and 'N'.";
+    Kokkos::Impl::throw_runtime_exception (os.str ());
+  }
+
+  // Check compatibility of dimensions at run time.
+  if (A.extent(0) != A.extent(1) || A.extent(1) != x.extent(0)) {
+    std::ostringstream os;
+    os << "KokkosBlas::trmv: Dimensions of A and x do not match: "
+       << "A: " << A.extent(0) << " x " << A.extent(1)
+       << ", x: " << x.extent(0);
+    Kokkos::Impl::throw_runtime_exception (os.str ());
+  }
+
+  // Return if degenerated matrices are provided
+  if (A.extent(0) == 0)
+    return;
+
+  // Minimize the number of Impl::TRMV instantiations, by
+  // standardizing on particular View specializations for its template
+  // parameters.
+  typedef Kokkos::View<typename AViewType::const_value_type**,
+    typename AViewType::array_layout,
+    typename AViewType::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > AVT;
+  typedef Kokkos::View<typename XViewType::non_const_value_type*,
+    typename KokkosKernels::Impl::GetUnifiedLayout<XViewType>::array_layout,
+    typename XViewType::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > XVT;
+  typedef Impl::TRMV<AVT, XVT> impl_type;
+  impl_type::trmv (uplo, trans, diag, A, x);
+}
+
+} // namespace KokkosBlas
+
+#endif // KOKKOSBLAS2_TRMV_HPP_
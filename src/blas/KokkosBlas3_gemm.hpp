@@ -47,29 +47,13 @@
 
 #include <KokkosKernels_Macros.hpp>
 #include <KokkosBlas3_gemm_spec.hpp>
+#include <KokkosBlas3_gemm_batched_impl.hpp>
 #include <KokkosKernels_helpers.hpp>
 #include <sstream>
 #include <type_traits>
 
 namespace KokkosBlas {
 
-/// \brief Dense matrix-matrix multiply: C = beta*C + alpha*op(A)*op(B).
-///
-/// \tparam AViewType Input matrix, as a 2-D Kokkos::View
-/// \tparam BViewType Input matrix, as a 2-D Kokkos::View
-/// \tparam CViewType Output matrix, as a nonconst 2-D Kokkos::View
-///
-/// \param transA [in] "N" for non-transpose, "T" for transpose, "C"
-///   for conjugate transpose.  All characters after the first are
-///   ignored.  This works just like the BLAS routines.
-/// \param transB [in] "N" for non-transpose, "T" for transpose, "C"
-///   for conjugate transpose.  All characters after the first are
-///   ignored.  This works just like the BLAS routines.
-/// \param alpha [in] Input coefficient of A*x
-/// \param A [in] Input matrix, as a 2-D Kokkos::View
-/// \param B [in] Input matrix, as a 2-D Kokkos::View
-/// \param beta [in] Input coefficient of C
-/// \param C [in/out] Output vector, as a nonconst 2-D Kokkos::View
 template<class AViewType,
          class BViewType,
          class CViewType>
@@ -80,38 +64,25 @@ gemm (const char transA[],
       const AViewType& A,
       const BViewType& B,
       typename CViewType::const_value_type& beta,
-      const CViewType& C)
-{
+      const CViewType& C);
 
-  #if (KOKKOSKERNELS_DEBUG_LEVEL > 0)
-  static_assert (Kokkos::Impl::is_view<AViewType>::value,
-                 "AViewType must be a Kokkos::View.");
-  static_assert (Kokkos::Impl::is_view<BViewType>::value,
-                 "BViewType must be a Kokkos::View.");
-  static_assert (Kokkos::Impl::is_view<CViewType>::value,
-                 "CViewType must be a Kokkos::View.");
-  static_assert (static_cast<int> (AViewType::rank) == 2,
-                 "AViewType must have rank 2.");
-  static_assert (static_cast<int> (BViewType::rank) == 2,
-                 "BViewType must have rank 2.");
-  static_assert (static_cast<int> (CViewType::rank) == 2,
-                 "CViewType must have rank 2.");
-
-  // Check validity of transpose argument
-  bool valid_transA = (transA[0] == 'N') || (transA[0] == 'n') ||
-                      (transA[0] == 'T') || (transA[0] == 't') ||
-                      (transA[0] == 'C') || (transA[0] == 'c');
-  bool valid_transB = (transB[0] == 'N') || (transB[0] == 'n') ||
-                      (transB[0] == 'T') || (transB[0] == 't') ||
-                      (transB[0] == 'C') || (transB[0] == 'c');
-  if(!(valid_transA && valid_transB)) {
-    std::ostringstream os;
-    os << "KokkosBlas::gemm: transA[0] = '" << transA[0] << " transB[0] = '" << transB[0] << "'. " <<
-      "Valid values include 'N' or 'n' (No transpose), 'T' or 't' (Transpose), "
-      "and 'C' or 'c' (Conjugate transpose).";
-    Kokkos::Impl::throw_runtime_exception (os.str ());
-  }
+namespace Impl {
 
+// Rank-2: a single matrix-matrix multiply.
+template<class AViewType,
+         class BViewType,
+         class CViewType>
+void
+gemm_rank (const char transA[],
+           const char transB[],
+           typename AViewType::const_value_type& alpha,
+           const AViewType& A,
+           const BViewType& B,
+           typename CViewType::const_value_type& beta,
+           const CViewType& C,
+           std::integral_constant<int,2>)
+{
+  #if (KOKKOSKERNELS_DEBUG_LEVEL > 0)
   // Check compatibility of dimensions at run time.
   bool A_t = !(transA[0] == 'N' || transA[0] == 'n');
   bool B_t = !(transB[0] == 'N' || transB[0] == 'n');
@@ -158,6 +129,181 @@ gemm (const char transA[],
   impl_type::gemm (transA, transB, alpha, A, B, beta, C);
 }
 
+// Large LayoutRight batches: every slice is a LayoutRight matrix, so use
+// the (possibly TPL or ETI) rank-2 gemm on each of them.
+template<class AViewType,
+         class BViewType,
+         class CViewType>
+bool
+gemm_batched_blocked (const char transA[],
+                      const char transB[],
+                      typename AViewType::const_value_type& alpha,
+                      const AViewType& A,
+                      const BViewType& B,
+                      typename CViewType::const_value_type& beta,
+                      const CViewType& C,
+                      std::true_type)
+{
+  const int m = C.extent_int(1);
+  const int n = C.extent_int(2);
+  const int k = (transA[0]=='N' || transA[0]=='n') ? A.extent_int(2) : A.extent_int(1);
+  const int min_dim = m < n ? (m < k ? m : k) : (n < k ? n : k);
+  if(min_dim < impl_gemm_batched_size::blocked_min)
+    return false;
+
+  for(int l = 0; l < C.extent_int(0); ++l)
+    KokkosBlas::gemm(transA, transB, alpha,
+                     Kokkos::subview(A, l, Kokkos::ALL(), Kokkos::ALL()),
+                     Kokkos::subview(B, l, Kokkos::ALL(), Kokkos::ALL()),
+                     beta,
+                     Kokkos::subview(C, l, Kokkos::ALL(), Kokkos::ALL()));
+  return true;
+}
+
+template<class AViewType,
+         class BViewType,
+         class CViewType>
+bool
+gemm_batched_blocked (const char[],
+                      const char[],
+                      typename AViewType::const_value_type&,
+                      const AViewType&,
+                      const BViewType&,
+                      typename CViewType::const_value_type&,
+                      const CViewType&,
+                      std::false_type)
+{
+  return false;
+}
+
+// Rank-3: a batch of independent matrix-matrix multiplies.
+template<class AViewType,
+         class BViewType,
+         class CViewType>
+void
+gemm_rank (const char transA[],
+           const char transB[],
+           typename AViewType::const_value_type& alpha,
+           const AViewType& A,
+           const BViewType& B,
+           typename CViewType::const_value_type& beta,
+           const CViewType& C,
+           std::integral_constant<int,3>)
+{
+  #if (KOKKOSKERNELS_DEBUG_LEVEL > 0)
+  // Check compatibility of dimensions at run time.
+  bool A_t = !(transA[0] == 'N' || transA[0] == 'n');
+  bool B_t = !(transB[0] == 'N' || transB[0] == 'n');
+  int64_t A0 = A.extent(1);
+  int64_t A1 = A.extent(2);
+  int64_t B0 = B.extent(1);
+  int64_t B1 = B.extent(2);
+  int64_t C0 = C.extent(1);
+  int64_t C1 = C.extent(2);
+
+  if ( (A.extent(0) != C.extent(0)) ||
+       (B.extent(0) != C.extent(0)) ||
+       ((A_t?A1:A0) != C0) ||
+       ((B_t?B0:B1) != C1) ||
+       ((A_t?A0:A1) != (B_t?B1:B0)) ) {
+      std::ostringstream os;
+      os << "KokkosBlas::gemm: Dimensions of A, B, and C do not match: "
+         << "transA: " << transA[0] << " transB: " << transB[0]
+         << " A: " << A.extent(0) << " x " << A.extent(1) << " x " << A.extent(2)
+         << " B: " << B.extent(0) << " x " << B.extent(1) << " x " << B.extent(2)
+         << " C: " << C.extent(0) << " x " << C.extent(1) << " x " << C.extent(2);
+      Kokkos::Impl::throw_runtime_exception (os.str ());
+    }
+  #endif // KOKKOSKERNELS_DEBUG_LEVEL > 0
+
+  // Return if degenerated matrices are provided
+  if((C.extent(0) == 0) || (C.extent(1) == 0) || (C.extent(2) == 0))
+    return;
+
+  typedef std::integral_constant<bool,
+    std::is_same<typename AViewType::array_layout, Kokkos::LayoutRight>::value &&
+    std::is_same<typename BViewType::array_layout, Kokkos::LayoutRight>::value &&
+    std::is_same<typename CViewType::array_layout, Kokkos::LayoutRight>::value> slices_are_layout_right;
+
+  if(!gemm_batched_blocked(transA, transB, alpha, A, B, beta, C, slices_are_layout_right()))
+    GEMMBatched<AViewType, BViewType, CViewType>::gemm(transA, transB, alpha, A, B, beta, C);
+}
+
+} // namespace Impl
+
+/// \brief Dense matrix-matrix multiply: C = beta*C + alpha*op(A)*op(B).
+///
+/// If the views have rank 3, the first dimension is the batch index and
+/// each C(l,:,:) = beta*C(l,:,:) + alpha*op(A(l,:,:))*op(B(l,:,:)) is
+/// computed independently.  Small matrices are computed with the
+/// KokkosBatched Serial (one thread per matrix) or Team (one team per
+/// matrix) gemm; large LayoutRight matrices use the rank-2 gemm on each
+/// slice.  Conjugate transpose of complex rank-3 views is only supported
+/// on that last path.
+///
+/// \tparam AViewType Input matrix, as a 2-D or 3-D Kokkos::View
+/// \tparam BViewType Input matrix, as a 2-D or 3-D Kokkos::View
+/// \tparam CViewType Output matrix, as a nonconst 2-D or 3-D Kokkos::View
+///
+/// \param transA [in] "N" for non-transpose, "T" for transpose, "C"
+///   for conjugate transpose.  All characters after the first are
+///   ignored.  This works just like the BLAS routines.
+/// \param transB [in] "N" for non-transpose, "T" for transpose, "C"
+///   for conjugate transpose.  All characters after the first are
+///   ignored.  This works just like the BLAS routines.
+/// \param alpha [in] Input coefficient of A*x
+/// \param A [in] Input matrix, as a 2-D or 3-D Kokkos::View
+/// \param B [in] Input matrix, as a 2-D or 3-D Kokkos::View
+/// \param beta [in] Input coefficient of C
+/// \param C [in/out] Output vector, as a nonconst 2-D or 3-D Kokkos::View
+template<class AViewType,
+         class BViewType,
+         class CViewType>
+void
+gemm (const char transA[],
+      const char transB[],
+      typename AViewType::const_value_type& alpha,
+      const AViewType& A,
+      const BViewType& B,
+      typename CViewType::const_value_type& beta,
+      const CViewType& C)
+{
+
+  #if (KOKKOSKERNELS_DEBUG_LEVEL > 0)
+  static_assert (Kokkos::Impl::is_view<AViewType>::value,
+                 "AViewType must be a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_view<BViewType>::value,
+                 "BViewType must be a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_view<CViewType>::value,
+                 "CViewType must be a Kokkos::View.");
+  static_assert (static_cast<int> (CViewType::rank) == 2 ||
+                 static_cast<int> (CViewType::rank) == 3,
+                 "CViewType must have rank 2 or 3.");
+  static_assert (static_cast<int> (AViewType::rank) == static_cast<int> (CViewType::rank),
+                 "AViewType must have the same rank as CViewType.");
+  static_assert (static_cast<int> (BViewType::rank) == static_cast<int> (CViewType::rank),
+                 "BViewType must have the same rank as CViewType.");
+
+  // Check validity of transpose argument
+  bool valid_transA = (transA[0] == 'N') || (transA[0] == 'n') ||
+                      (transA[0] == 'T') || (transA[0] == 't') ||
+                      (transA[0] == 'C') || (transA[0] == 'c');
+  bool valid_transB = (transB[0] == 'N') || (transB[0] == 'n') ||
+                      (transB[0] == 'T') || (transB[0] == 't') ||
+                      (transB[0] == 'C') || (transB[0] == 'c');
+  if(!(valid_transA && valid_transB)) {
+    std::ostringstream os;
+    os << "KokkosBlas::gemm: transA[0] = '" << transA[0] << " transB[0] = '" << transB[0] << "'. " <<
+      "Valid values include 'N' or 'n' (No transpose), 'T' or 't' (Transpose), "
+      "and 'C' or 'c' (Conjugate transpose).";
+    Kokkos::Impl::throw_runtime_exception (os.str ());
+  }
+  #endif // KOKKOSKERNELS_DEBUG_LEVEL > 0
+
+  Impl::gemm_rank (transA, transB, alpha, A, B, beta, C,
+                   std::integral_constant<int, static_cast<int> (CViewType::rank)> ());
+}
+
 } // namespace KokkosBlas
 
 #endif // KOKKOS_BLAS3_MV_HPP_
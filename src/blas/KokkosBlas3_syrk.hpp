@@ -0,0 +1,182 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#ifndef KOKKOSBLAS3_SYRK_HPP_
+#define KOKKOSBLAS3_SYRK_HPP_
+
+/// \file KokkosBlas3_syrk.hpp
+
+#include <KokkosKernels_Macros.hpp>
+#include <KokkosBlas3_syrk_spec.hpp>
+#include <KokkosKernels_helpers.hpp>
+#include <Kokkos_ArithTraits.hpp>
+#include <sstream>
+#include <type_traits>
+
+namespace KokkosBlas {
+
+namespace Impl {
+
+template<class AViewType,
+         class CViewType>
+void
+syrk_check_and_call (const char caller[],
+                     const char uplo[],
+                     const char trans[],
+                     const bool hermitian,
+                     typename AViewType::const_value_type& alpha,
+                     const AViewType& A,
+                     typename CViewType::const_value_type& beta,
+                     const CViewType& C)
+{
+  static_assert (Kokkos::Impl::is_view<AViewType>::value,
+                 "AViewType must be a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_view<CViewType>::value,
+                 "CViewType must be a Kokkos::View.");
+  static_assert (static_cast<int> (AViewType::rank) == 2,
+                 "AViewType must have rank 2.");
+  static_assert (static_cast<int> (CViewType::rank) == 2,
+                 "CViewType must have rank 2.");
+
+  // syrk of a complex matrix is transposed with 'T', herk with 'C'. For
+  // real matrices both are the same.
+  const bool is_complex = Kokkos::Details::ArithTraits<typename CViewType::non_const_value_type>::is_complex;
+  const bool valid_uplo = (uplo[0] == 'U' || uplo[0] == 'u' ||
+                           uplo[0] == 'L' || uplo[0] == 'l');
+  const bool valid_trans = (trans[0] == 'N' || trans[0] == 'n') ||
+                           ((!hermitian || !is_complex) && (trans[0] == 'T' || trans[0] == 't')) ||
+                           (( hermitian || !is_complex) && (trans[0] == 'C' || trans[0] == 'c'));
+  if(!valid_uplo || !valid_trans) {
+    std::ostringstream os;
+    os << "KokkosBlas::" << caller << ": uplo[0] = '" << uplo[0] << "', trans[0] = '"
+       << trans[0] << "'.  Valid values for uplo are 'U' and 'L', for trans 'N' and '"
+       << (hermitian ? 'C' : 'T') << "'.";
+    Kokkos::Impl::throw_runtime_exception (os.str ());
+  }
+
+  // Check compatibility of dimensions at run time.
+  const bool A_t = !(trans[0] == 'N' || trans[0] == 'n');
+  if ( (C.extent(0) != C.extent(1)) ||
+       (A.extent(A_t?1:0) != C.extent(0)) ) {
+    std::ostringstream os;
+    os << "KokkosBlas::" << caller << ": Dimensions of A and C do not match: "
+       << "trans: " << trans[0]
+       << " A: " << A.extent(0) << " x " << A.extent(1)
+       << " C: " << C.extent(0) << " x " << C.extent(1);
+    Kokkos::Impl::throw_runtime_exception (os.str ());
+  }
+
+  // Return if degenerated matrices are provided
+  if(C.extent(0) == 0)
+    return;
+
+  // Minimize the number of Impl::SYRK instantiations, by
+  // standardizing on particular View specializations for its template
+  // parameters.
+  typedef Kokkos::View<typename AViewType::const_value_type**,
+    typename AViewType::array_layout,
+    typename AViewType::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > AVT;
+  typedef Kokkos::View<typename CViewType::non_const_value_type**,
+    typename CViewType::array_layout,
+    typename CViewType::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > CVT;
+  typedef Impl::SYRK<AVT, CVT> impl_type;
+  impl_type::syrk (uplo, trans, hermitian, alpha, A, beta, C);
+}
+
+} // namespace Impl
+
+/// \brief Symmetric rank-k update: C = beta*C + alpha*op(A)*op(A)^T.
+///
+/// Only the triangle of C selected by uplo is read and written, which
+/// takes half the flops of the equivalent gemm.
+///
+/// \tparam AViewType Input matrix, as a 2-D Kokkos::View
+/// \tparam CViewType Output symmetric matrix, as a nonconst 2-D Kokkos::View
+///
+/// \param uplo [in] "U" to update the upper, "L" to update the lower
+///   triangle of C.
+/// \param trans [in] "N" for C = beta*C + alpha*A*A^T, "T" for
+///   C = beta*C + alpha*A^T*A.
+/// \param alpha [in] Input coefficient of op(A)*op(A)^T
+/// \param A [in] Input matrix, as a 2-D Kokkos::View
+/// \param beta [in] Input coefficient of C
+/// \param C [in/out] Output matrix, as a nonconst 2-D Kokkos::View
+template<class AViewType,
+         class CViewType>
+void
+syrk (const char uplo[],
+      const char trans[],
+      typename AViewType::const_value_type& alpha,
+      const AViewType& A,
+      typename CViewType::const_value_type& beta,
+      const CViewType& C)
+{
+  Impl::syrk_check_and_call ("syrk", uplo, trans, false, alpha, A, beta, C);
+}
+
+/// \brief Hermitian rank-k update: C = beta*C + alpha*op(A)*op(A)^H.
+///
+/// Like syrk, but with the conjugate transpose. alpha and beta are real,
+/// and the imaginary part of the diagonal of C is set to zero.
+///
+/// \param trans [in] "N" for C = beta*C + alpha*A*A^H, "C" for
+///   C = beta*C + alpha*A^H*A.
+template<class AViewType,
+         class CViewType>
+void
+herk (const char uplo[],
+      const char trans[],
+      typename Kokkos::Details::ArithTraits<typename AViewType::non_const_value_type>::mag_type alpha,
+      const AViewType& A,
+      typename Kokkos::Details::ArithTraits<typename CViewType::non_const_value_type>::mag_type beta,
+      const CViewType& C)
+{
+  typedef typename AViewType::non_const_value_type ScalarA;
+  typedef typename CViewType::non_const_value_type ScalarC;
+  Impl::syrk_check_and_call ("herk", uplo, trans, true, ScalarA(alpha), A, ScalarC(beta), C);
+}
+
+} // namespace KokkosBlas
+
+#endif // KOKKOSBLAS3_SYRK_HPP_
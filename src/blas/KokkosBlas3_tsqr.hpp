@@ -0,0 +1,126 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#ifndef KOKKOSBLAS3_TSQR_HPP_
+#define KOKKOSBLAS3_TSQR_HPP_
+
+/// \file KokkosBlas3_tsqr.hpp
+
+#include <KokkosKernels_Macros.hpp>
+#include <KokkosBlas3_tsqr_impl.hpp>
+#include <sstream>
+#include <type_traits>
+
+namespace KokkosBlas {
+namespace Experimental {
+
+/// \brief Tall-skinny QR factorization A = Q*R of an m x k matrix with
+///   m >= k (communication-avoiding TSQR).
+///
+/// The rows of A are split into blocks which are factored independently,
+/// and the resulting R factors are combined in a binary reduction tree.
+/// A is read once and Q is written in a second pass, instead of the O(k)
+/// passes over the tall matrix needed by Gram-Schmidt with multivector
+/// dot and axpby.  R has a real, non-negative diagonal.
+///
+/// \tparam AViewType Input matrix, as a 2-D Kokkos::View
+/// \tparam QViewType Output matrix with orthonormal columns, as a
+///   nonconst 2-D Kokkos::View
+/// \tparam RViewType Output upper triangular matrix, as a nonconst 2-D
+///   Kokkos::View
+///
+/// \param A [in] m x k input matrix.
+/// \param Q [out] m x k matrix with orthonormal columns.  May not alias A.
+/// \param R [out] k x k upper triangular matrix; the strictly lower
+///   triangle is set to zero.
+template<class AViewType,
+         class QViewType,
+         class RViewType>
+void
+tsqr (const AViewType& A,
+      const QViewType& Q,
+      const RViewType& R)
+{
+  static_assert (Kokkos::Impl::is_view<AViewType>::value,
+                 "AViewType must be a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_view<QViewType>::value,
+                 "QViewType must be a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_view<RViewType>::value,
+                 "RViewType must be a Kokkos::View.");
+  static_assert (static_cast<int> (AViewType::rank) == 2,
+                 "AViewType must have rank 2.");
+  static_assert (static_cast<int> (QViewType::rank) == 2,
+                 "QViewType must have rank 2.");
+  static_assert (static_cast<int> (RViewType::rank) == 2,
+                 "RViewType must have rank 2.");
+  static_assert (std::is_same<typename QViewType::value_type,
+                              typename QViewType::non_const_value_type>::value,
+                 "QViewType must be nonconst.");
+  static_assert (std::is_same<typename RViewType::value_type,
+                              typename RViewType::non_const_value_type>::value,
+                 "RViewType must be nonconst.");
+
+  // Check compatibility of dimensions at run time.
+  if ( (Q.extent(0) != A.extent(0)) || (Q.extent(1) != A.extent(1)) ||
+       (R.extent(0) != A.extent(1)) || (R.extent(1) != A.extent(1)) ||
+       (A.extent(0) < A.extent(1)) ) {
+    std::ostringstream os;
+    os << "KokkosBlas::tsqr: A must be m x k with m >= k, Q m x k and R k x k: "
+       << "A: " << A.extent(0) << " x " << A.extent(1)
+       << " Q: " << Q.extent(0) << " x " << Q.extent(1)
+       << " R: " << R.extent(0) << " x " << R.extent(1);
+    Kokkos::Impl::throw_runtime_exception (os.str ());
+  }
+
+  // Return if degenerated matrices are provided
+  if(A.extent(1) == 0)
+    return;
+
+  Kokkos::Profiling::pushRegion("KokkosBlas::tsqr");
+  KokkosBlas::Impl::tsqr_impl (A, Q, R);
+  Kokkos::Profiling::popRegion();
+}
+
+} // namespace Experimental
+} // namespace KokkosBlas
+
+#endif // KOKKOSBLAS3_TSQR_HPP_
@@ -0,0 +1,289 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#ifndef KOKKOSBLAS1_COMPENSATED_IMPL_HPP_
+#define KOKKOSBLAS1_COMPENSATED_IMPL_HPP_
+
+#include <KokkosKernels_config.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_InnerProductSpaceTraits.hpp>
+#include <KokkosBlas1_reproducible_impl.hpp>
+#include <cmath>
+
+namespace KokkosBlas {
+namespace Impl {
+
+//
+// Compensated (high-accuracy) reductions.
+//
+// Every thread carries, per real component, a running sum s together with
+// the accumulated rounding error c of all its additions (and products),
+// and the result is s + c.  The error terms are computed exactly with the
+// error-free transformations
+//
+//   TwoSum(a,b):  s = a + b, e = (a - (s - z)) + (b - z) with z = s - a
+//   TwoProd(a,b): p = a * b, e = fma(a, b, -p)
+//
+// so that the result is as accurate as if it had been computed in twice
+// the working precision and then rounded: Kahan-Babuska summation for sum
+// and Dot2 of Ogita, Rump and Oishi (2005) for dot and nrm2.  All of it
+// is branch free, the additional flops are hidden behind the memory
+// traffic of the reduction.
+//
+
+template<class T>
+KOKKOS_FORCEINLINE_FUNCTION T compensated_fma (const T& a, const T& b, const T& c) {
+#ifdef __CUDA_ARCH__
+  return ::fma (a, b, c);
+#else
+  return std::fma (a, b, c);
+#endif
+}
+
+// (s, c) += x
+template<class T>
+KOKKOS_FORCEINLINE_FUNCTION void
+compensated_add (T& s, T& c, const T& x) {
+  const T t = s + x;
+  const T z = t - s;
+  c += (s - (t - z)) + (x - z);
+  s = t;
+}
+
+// (s, c) += a * b
+template<class T>
+KOKKOS_FORCEINLINE_FUNCTION void
+compensated_add_prod (T& s, T& c, const T& a, const T& b) {
+  const T p = a * b;
+  const T e = compensated_fma (a, b, -p);
+  compensated_add (s, c, p);
+  c += e;
+}
+
+// s + c of every real component
+template<class R, int num_components>
+struct CompensatedResult {
+  template<class M>
+  KOKKOS_INLINE_FUNCTION static R make (const M* acc) { return R (acc[0] + acc[1]); }
+};
+
+template<class R>
+struct CompensatedResult<R,2> {
+  template<class M>
+  KOKKOS_INLINE_FUNCTION static R make (const M* acc) { return R (acc[0] + acc[1], acc[2] + acc[3]); }
+};
+
+// Per-entry operations.  acc holds (s, c) for the real part and, for
+// complex results, (s, c) for the imaginary part.
+template<class XV, class YV>
+struct CompensatedDotOp {
+  typedef typename XV::non_const_value_type scalar_type;
+  typedef Kokkos::Details::InnerProductSpaceTraits<scalar_type> IPT;
+  typedef Kokkos::Details::ArithTraits<scalar_type> ATS;
+  typedef typename IPT::dot_type result_type;
+  typedef typename IPT::mag_type mag_type;
+  enum : int { num_components = ATS::is_complex ? 2 : 1 };
+
+  KOKKOS_INLINE_FUNCTION static void
+  accumulate (mag_type* acc, const XV& x, const YV& y, const int64_t i, const int64_t j) {
+    const scalar_type x_ij = ReproducibleAccess<XV>::get (x,i,j);
+    const typename YV::non_const_value_type y_ij = ReproducibleAccess<YV>::get (y,i,j);
+    // conj(x)*y = (xr*yr + xi*yi) + i*(xr*yi - xi*yr)
+    compensated_add_prod (acc[0], acc[1], ATS::real (x_ij), ATS::real (y_ij));
+    if (ATS::is_complex) {
+      compensated_add_prod (acc[0], acc[1], ATS::imag (x_ij), ATS::imag (y_ij));
+      compensated_add_prod (acc[2], acc[3], ATS::real (x_ij), ATS::imag (y_ij));
+      compensated_add_prod (acc[2], acc[3], -ATS::imag (x_ij), ATS::real (y_ij));
+    }
+  }
+  KOKKOS_INLINE_FUNCTION static result_type finalize (const mag_type* acc) {
+    return CompensatedResult<result_type, num_components>::make (acc);
+  }
+};
+
+template<class XV>
+struct CompensatedSumOp {
+  typedef typename XV::non_const_value_type scalar_type;
+  typedef Kokkos::Details::ArithTraits<scalar_type> ATS;
+  typedef scalar_type result_type;
+  typedef typename ATS::mag_type mag_type;
+  enum : int { num_components = ATS::is_complex ? 2 : 1 };
+
+  KOKKOS_INLINE_FUNCTION static void
+  accumulate (mag_type* acc, const XV& x, const XV& /* y */, const int64_t i, const int64_t j) {
+    const scalar_type x_ij = ReproducibleAccess<XV>::get (x,i,j);
+    compensated_add (acc[0], acc[1], ATS::real (x_ij));
+    if (ATS::is_complex)
+      compensated_add (acc[2], acc[3], ATS::imag (x_ij));
+  }
+  KOKKOS_INLINE_FUNCTION static result_type finalize (const mag_type* acc) {
+    return CompensatedResult<result_type, num_components>::make (acc);
+  }
+};
+
+template<class XV>
+struct CompensatedNrm2Op {
+  typedef typename XV::non_const_value_type scalar_type;
+  typedef Kokkos::Details::ArithTraits<scalar_type> ATS;
+  typedef typename ATS::mag_type result_type;
+  typedef typename ATS::mag_type mag_type;
+  enum : int { num_components = 1 };
+
+  KOKKOS_INLINE_FUNCTION static void
+  accumulate (mag_type* acc, const XV& x, const XV& /* y */, const int64_t i, const int64_t j) {
+    const scalar_type x_ij = ReproducibleAccess<XV>::get (x,i,j);
+    compensated_add_prod (acc[0], acc[1], ATS::real (x_ij), ATS::real (x_ij));
+    if (ATS::is_complex)
+      compensated_add_prod (acc[0], acc[1], ATS::imag (x_ij), ATS::imag (x_ij));
+  }
+  KOKKOS_INLINE_FUNCTION static result_type finalize (const mag_type* acc) {
+    return Kokkos::Details::ArithTraits<mag_type>::sqrt (acc[0] + acc[1]);
+  }
+};
+
+/// \brief Compensated reduction of the columns of X (and Y), one
+///   (s, c) pair per real component and column.
+template<class Op, class XV, class YV, class SizeType = int64_t>
+struct CompensatedFunctor
+{
+  typedef typename XV::execution_space execution_space;
+  typedef SizeType                     size_type;
+  typedef typename Op::mag_type        mag_type;
+  typedef Kokkos::Details::ArithTraits<mag_type> AT;
+  typedef mag_type                     value_type[];
+  enum : int { stride = 2 * Op::num_components };
+
+  size_type value_count;
+  size_type numCols;
+  XV x;
+  YV y;
+
+  CompensatedFunctor (const XV& x_, const YV& y_, const size_type numCols_) :
+    value_count (numCols_ * stride), numCols (numCols_), x (x_), y (y_) {}
+
+  KOKKOS_INLINE_FUNCTION void
+  operator() (const size_type i, value_type acc) const
+  {
+#ifdef KOKKOS_ENABLE_PRAGMA_IVDEP
+#pragma ivdep
+#endif
+    for (size_type j = 0; j < numCols; ++j) {
+      Op::accumulate (acc + j*stride, x, y, i, j);
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  init (value_type update) const
+  {
+    for (size_type k = 0; k < value_count; ++k) {
+      update[k] = AT::zero ();
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  join (volatile value_type update,
+        const volatile value_type source) const
+  {
+    for (size_type k = 0; k < value_count; k += 2) {
+      mag_type s = update[k], c = update[k+1];
+      compensated_add (s, c, mag_type (source[k]));
+      update[k] = s;
+      update[k+1] = c + source[k+1];
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  join (value_type update,
+        const value_type source) const
+  {
+    for (size_type k = 0; k < value_count; k += 2) {
+      compensated_add (update[k], update[k+1], source[k]);
+      update[k+1] += source[k+1];
+    }
+  }
+};
+
+template<class Op, class AV, class TV>
+struct CompensatedFinalizeFunctor {
+  AV acc;
+  TV result;
+
+  CompensatedFinalizeFunctor (const AV& acc_, const TV& result_) :
+    acc (acc_), result (result_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const int64_t& j) const {
+    result(j) = Op::finalize (&acc(j * 2 * Op::num_components));
+  }
+};
+
+/// \brief R(j) = compensated Op-reduction over i of (X(i,j), Y(i,j)).
+template<class Op, class RV, class XV, class YV>
+void compensated_reduce (const char label[], const RV& R, const XV& X, const YV& Y)
+{
+  typedef typename XV::execution_space execution_space;
+  typedef Kokkos::View<typename Op::mag_type*, typename XV::device_type> AV;
+  typedef Kokkos::View<typename RV::non_const_value_type*, Kokkos::LayoutLeft,
+                       typename XV::device_type> TV;
+
+  const int64_t numRows = X.extent(0);
+  const int64_t numCols = X.extent(1) > Y.extent(1) ? X.extent(1) : Y.extent(1);
+
+  Kokkos::Profiling::pushRegion (label);
+  AV acc ("KokkosBlas::compensated::acc", numCols * 2 * Op::num_components);
+  if (numRows > 0) {
+    Kokkos::parallel_reduce ("KokkosBlas::compensated",
+                             Kokkos::RangePolicy<execution_space, int64_t> (0, numRows),
+                             CompensatedFunctor<Op, XV, YV> (X, Y, numCols), acc);
+  }
+  TV result ("KokkosBlas::compensated::result", numCols);
+  Kokkos::parallel_for ("KokkosBlas::compensated::finalize",
+                        Kokkos::RangePolicy<execution_space, int64_t> (0, numCols),
+                        CompensatedFinalizeFunctor<Op, AV, TV> (acc, result));
+  ReproducibleCopyResult<RV, TV>::copy (R, result);
+  Kokkos::Profiling::popRegion ();
+}
+
+} // namespace Impl
+} // namespace KokkosBlas
+
+#endif // KOKKOSBLAS1_COMPENSATED_IMPL_HPP_
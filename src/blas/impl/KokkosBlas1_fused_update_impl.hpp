@@ -0,0 +1,363 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#ifndef KOKKOSBLAS1_FUSED_UPDATE_IMPL_HPP_
+#define KOKKOSBLAS1_FUSED_UPDATE_IMPL_HPP_
+
+#include <KokkosKernels_config.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_InnerProductSpaceTraits.hpp>
+
+namespace KokkosBlas {
+namespace Impl {
+
+//
+// Fused vector updates and reductions for Krylov solvers.  Each functor
+// does the work of an axpby / update followed by one or more dot / nrm2
+// calls in a single pass over the vectors, so every entry is loaded from
+// memory once instead of once per BLAS 1 call.
+//
+// As for Axpby_Functor and V_Update_Functor, the integer template
+// parameters encode the coefficients: 0 means a literal zero (the
+// corresponding vector is not read, BLAS semantics), 2 means use the
+// coefficient passed in.
+//
+
+/// \brief Y(i) = a*X(i) + b*Y(i), and accumulate |Y(i)|^2.
+template<class XV, class YV, int scalar_y,
+         class SizeType = typename YV::size_type>
+struct V_Axpby_Nrm2_Functor
+{
+  typedef typename YV::execution_space                          execution_space;
+  typedef SizeType                                              size_type;
+  typedef typename YV::non_const_value_type                     yvalue_type;
+  typedef Kokkos::Details::InnerProductSpaceTraits<yvalue_type> IPT;
+  typedef Kokkos::Details::ArithTraits<typename IPT::mag_type>  AT;
+  typedef typename IPT::mag_type                                value_type;
+
+  const typename XV::non_const_value_type a_;
+  typename XV::const_type X_;
+  const yvalue_type b_;
+  YV Y_;
+
+  V_Axpby_Nrm2_Functor (const typename XV::non_const_value_type& a, const XV& X,
+                        const yvalue_type& b, const YV& Y) :
+    a_ (a), X_ (X), b_ (b), Y_ (Y)
+  {
+    static_assert (Kokkos::Impl::is_view<XV>::value, "KokkosBlas::Impl::"
+                   "V_Axpby_Nrm2_Functor: X is not a Kokkos::View.");
+    static_assert (Kokkos::Impl::is_view<YV>::value, "KokkosBlas::Impl::"
+                   "V_Axpby_Nrm2_Functor: Y is not a Kokkos::View.");
+    static_assert (Kokkos::Impl::is_same<typename YV::value_type,
+                   typename YV::non_const_value_type>::value,
+                   "KokkosBlas::Impl::V_Axpby_Nrm2_Functor: Y is const.  "
+                   "It must be nonconst, because it is an output argument "
+                   "(we have to be able to write to its entries).");
+    static_assert (XV::rank == 1 && YV::rank == 1,
+                   "KokkosBlas::Impl::V_Axpby_Nrm2_Functor: "
+                   "XV and YV must have rank 1.");
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const size_type& i, value_type& sum) const
+  {
+    // scalar_y is a compile-time constant (since it is a template
+    // parameter), so the compiler should evaluate this branch at
+    // compile time.
+    const yvalue_type y_i = (scalar_y == 0) ? yvalue_type (a_ * X_(i)) :
+                                              yvalue_type (a_ * X_(i) + b_ * Y_(i));
+    Y_(i) = y_i;
+    const typename IPT::mag_type tmp = IPT::norm (y_i);
+    sum += tmp * tmp;
+  }
+
+  KOKKOS_INLINE_FUNCTION void init (value_type& update) const
+  {
+    update = AT::zero ();
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  join (value_type& update,
+        const value_type& source) const
+  {
+    update += source;
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  join (volatile value_type& update,
+        const volatile value_type& source) const
+  {
+    update += source;
+  }
+};
+
+/// \brief Z(i) = a*X(i) + b*Y(i) + c*Z(i), and accumulate dot(Z(i), W(i)).
+template<class XV, class YV, class ZV, class WV, int scalar_z,
+         class SizeType = typename ZV::size_type>
+struct V_Update_Dot_Functor
+{
+  typedef typename ZV::execution_space                          execution_space;
+  typedef SizeType                                              size_type;
+  typedef typename ZV::non_const_value_type                     zvalue_type;
+  typedef Kokkos::Details::InnerProductSpaceTraits<zvalue_type> IPT;
+  typedef typename IPT::dot_type                                value_type;
+
+  const typename XV::non_const_value_type a_;
+  typename XV::const_type X_;
+  const typename YV::non_const_value_type b_;
+  typename YV::const_type Y_;
+  const zvalue_type c_;
+  ZV Z_;
+  typename WV::const_type W_;
+
+  V_Update_Dot_Functor (const typename XV::non_const_value_type& a, const XV& X,
+                        const typename YV::non_const_value_type& b, const YV& Y,
+                        const zvalue_type& c, const ZV& Z, const WV& W) :
+    a_ (a), X_ (X), b_ (b), Y_ (Y), c_ (c), Z_ (Z), W_ (W)
+  {
+    static_assert (Kokkos::Impl::is_same<typename ZV::value_type,
+                   typename ZV::non_const_value_type>::value,
+                   "KokkosBlas::Impl::V_Update_Dot_Functor: Z is const.  "
+                   "It must be nonconst, because it is an output argument "
+                   "(we have to be able to write to its entries).");
+    static_assert (XV::rank == 1 && YV::rank == 1 && ZV::rank == 1 && WV::rank == 1,
+                   "KokkosBlas::Impl::V_Update_Dot_Functor: "
+                   "XV, YV, ZV and WV must have rank 1.");
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const size_type& i, value_type& sum) const
+  {
+    const zvalue_type z_i = (scalar_z == 0) ? zvalue_type (a_ * X_(i) + b_ * Y_(i)) :
+                                              zvalue_type (a_ * X_(i) + b_ * Y_(i) + c_ * Z_(i));
+    Z_(i) = z_i;
+    sum += IPT::dot (z_i, W_(i));
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  init (value_type& update) const
+  {
+    update = Kokkos::Details::ArithTraits<value_type>::zero ();
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  join (value_type& update,
+        const value_type& source) const
+  {
+    update += source;
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  join (volatile value_type& update,
+        const volatile value_type& source) const
+  {
+    update += source;
+  }
+};
+
+/// \brief Reduction result of one pipelined CG iteration.
+template<class DotType, class MagType>
+struct PipelinedCGDots {
+  /// (r, u)
+  DotType gamma;
+  /// (w, u)
+  DotType delta;
+  /// (r, r)
+  MagType rr;
+};
+
+/// \brief All vector updates and inner products of one iteration of
+///   pipelined (preconditioned) CG [Ghysels and Vanroose, 2014]:
+///
+///   z = n + beta*z;   q = m + beta*q;   s = w + beta*s;   p = u + beta*p;
+///   x = x + alpha*p;  r = r - alpha*s;  u = u - alpha*q;  w = w - alpha*z;
+///   gamma = (r,u);    delta = (w,u);    rr = (r,r).
+///
+/// Unfused this is eight axpby calls and three dot products, i.e. 11
+/// passes over the vectors.
+template<class NV, class MV, class VV, class SizeType = typename VV::size_type>
+struct V_PipelinedCG_Functor
+{
+  typedef typename VV::execution_space                          execution_space;
+  typedef SizeType                                              size_type;
+  typedef typename VV::non_const_value_type                     scalar_type;
+  typedef Kokkos::Details::InnerProductSpaceTraits<scalar_type> IPT;
+  typedef Kokkos::Details::ArithTraits<typename IPT::dot_type>  ATD;
+  typedef Kokkos::Details::ArithTraits<typename IPT::mag_type>  ATM;
+  typedef PipelinedCGDots<typename IPT::dot_type,
+                          typename IPT::mag_type>               value_type;
+
+  const scalar_type alpha_, beta_;
+  typename NV::const_type n_;
+  typename MV::const_type m_;
+  VV z_, q_, s_, p_, x_, r_, u_, w_;
+
+  V_PipelinedCG_Functor (const scalar_type& alpha, const scalar_type& beta,
+                         const NV& n, const MV& m,
+                         const VV& z, const VV& q, const VV& s, const VV& p,
+                         const VV& x, const VV& r, const VV& u, const VV& w) :
+    alpha_ (alpha), beta_ (beta), n_ (n), m_ (m),
+    z_ (z), q_ (q), s_ (s), p_ (p), x_ (x), r_ (r), u_ (u), w_ (w)
+  {
+    static_assert (NV::rank == 1 && MV::rank == 1 && VV::rank == 1,
+                   "KokkosBlas::Impl::V_PipelinedCG_Functor: "
+                   "NV, MV and VV must have rank 1.");
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const size_type& i, value_type& sum) const
+  {
+    const scalar_type z_i = n_(i) + beta_ * z_(i);
+    const scalar_type q_i = m_(i) + beta_ * q_(i);
+    const scalar_type s_i = w_(i) + beta_ * s_(i);
+    const scalar_type p_i = u_(i) + beta_ * p_(i);
+    const scalar_type r_i = r_(i) - alpha_ * s_i;
+    const scalar_type u_i = u_(i) - alpha_ * q_i;
+    const scalar_type w_i = w_(i) - alpha_ * z_i;
+    z_(i) = z_i;
+    q_(i) = q_i;
+    s_(i) = s_i;
+    p_(i) = p_i;
+    x_(i) += alpha_ * p_i;
+    r_(i) = r_i;
+    u_(i) = u_i;
+    w_(i) = w_i;
+
+    sum.gamma += IPT::dot (r_i, u_i);
+    sum.delta += IPT::dot (w_i, u_i);
+    const typename IPT::mag_type tmp = IPT::norm (r_i);
+    sum.rr += tmp * tmp;
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  init (value_type& update) const
+  {
+    update.gamma = ATD::zero ();
+    update.delta = ATD::zero ();
+    update.rr = ATM::zero ();
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  join (value_type& update,
+        const value_type& source) const
+  {
+    update.gamma += source.gamma;
+    update.delta += source.delta;
+    update.rr += source.rr;
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  join (volatile value_type& update,
+        const volatile value_type& source) const
+  {
+    update.gamma += source.gamma;
+    update.delta += source.delta;
+    update.rr += source.rr;
+  }
+};
+
+template<class XV, class YV, class SizeType>
+typename Kokkos::Details::InnerProductSpaceTraits<typename YV::non_const_value_type>::mag_type
+V_Axpby_Nrm2_Invoke (const typename XV::non_const_value_type& a, const XV& X,
+                     const typename YV::non_const_value_type& b, const YV& Y)
+{
+  typedef typename YV::execution_space execution_space;
+  typedef Kokkos::Details::ArithTraits<typename YV::non_const_value_type> ATS;
+  Kokkos::RangePolicy<execution_space, SizeType> policy (0, Y.extent(0));
+
+  typename Kokkos::Details::InnerProductSpaceTraits<typename YV::non_const_value_type>::mag_type result;
+  if (b == ATS::zero ()) {
+    V_Axpby_Nrm2_Functor<XV, YV, 0, SizeType> op (a, X, b, Y);
+    Kokkos::parallel_reduce ("KokkosBlas::axpby_nrm2<0>", policy, op, result);
+  }
+  else {
+    V_Axpby_Nrm2_Functor<XV, YV, 2, SizeType> op (a, X, b, Y);
+    Kokkos::parallel_reduce ("KokkosBlas::axpby_nrm2<2>", policy, op, result);
+  }
+  return result;
+}
+
+template<class XV, class YV, class ZV, class WV, class SizeType>
+typename Kokkos::Details::InnerProductSpaceTraits<typename ZV::non_const_value_type>::dot_type
+V_Update_Dot_Invoke (const typename XV::non_const_value_type& a, const XV& X,
+                     const typename YV::non_const_value_type& b, const YV& Y,
+                     const typename ZV::non_const_value_type& c, const ZV& Z,
+                     const WV& W)
+{
+  typedef typename ZV::execution_space execution_space;
+  typedef Kokkos::Details::ArithTraits<typename ZV::non_const_value_type> ATS;
+  Kokkos::RangePolicy<execution_space, SizeType> policy (0, Z.extent(0));
+
+  typename Kokkos::Details::InnerProductSpaceTraits<typename ZV::non_const_value_type>::dot_type result;
+  if (c == ATS::zero ()) {
+    V_Update_Dot_Functor<XV, YV, ZV, WV, 0, SizeType> op (a, X, b, Y, c, Z, W);
+    Kokkos::parallel_reduce ("KokkosBlas::update_dot<0>", policy, op, result);
+  }
+  else {
+    V_Update_Dot_Functor<XV, YV, ZV, WV, 2, SizeType> op (a, X, b, Y, c, Z, W);
+    Kokkos::parallel_reduce ("KokkosBlas::update_dot<2>", policy, op, result);
+  }
+  return result;
+}
+
+template<class NV, class MV, class VV, class SizeType>
+typename V_PipelinedCG_Functor<NV, MV, VV, SizeType>::value_type
+V_PipelinedCG_Invoke (const typename VV::non_const_value_type& alpha,
+                      const typename VV::non_const_value_type& beta,
+                      const NV& n, const MV& m,
+                      const VV& z, const VV& q, const VV& s, const VV& p,
+                      const VV& x, const VV& r, const VV& u, const VV& w)
+{
+  typedef V_PipelinedCG_Functor<NV, MV, VV, SizeType> functor_type;
+  typedef typename VV::execution_space execution_space;
+  Kokkos::RangePolicy<execution_space, SizeType> policy (0, x.extent(0));
+
+  typename functor_type::value_type result;
+  functor_type op (alpha, beta, n, m, z, q, s, p, x, r, u, w);
+  Kokkos::parallel_reduce ("KokkosBlas::pipelined_cg_update", policy, op, result);
+  return result;
+}
+
+} // namespace Impl
+} // namespace KokkosBlas
+
+#endif // KOKKOSBLAS1_FUSED_UPDATE_IMPL_HPP_
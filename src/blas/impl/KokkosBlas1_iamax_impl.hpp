@@ -0,0 +1,304 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#ifndef KOKKOSBLAS1_IAMAX_IMPL_HPP_
+#define KOKKOSBLAS1_IAMAX_IMPL_HPP_
+
+#include <KokkosKernels_config.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ArithTraits.hpp>
+#include <Kokkos_InnerProductSpaceTraits.hpp>
+
+namespace KokkosBlas {
+namespace Impl {
+
+/// \brief Magnitude used by iamax and iamin: |Re(x)| + |Im(x)|.
+///
+/// This is what reference BLAS (i?amax) uses, so that results agree
+/// with the TPL implementations also for complex vectors.  For real
+/// scalars it is just |x|.
+template<class Scalar>
+KOKKOS_INLINE_FUNCTION
+typename Kokkos::Details::InnerProductSpaceTraits<Scalar>::mag_type
+iamax_abs1 (const Scalar& x)
+{
+  typedef Kokkos::Details::ArithTraits<Scalar> ATS;
+  typedef typename Kokkos::Details::InnerProductSpaceTraits<Scalar>::mag_type mag_type;
+  typedef Kokkos::Details::ArithTraits<mag_type> ATM;
+  return ATM::abs (ATS::real (x)) + ATM::abs (ATS::imag (x));
+}
+
+// iamax wants the largest magnitude ...
+struct Iamax_FindMax {
+  template<class MagType>
+  KOKKOS_INLINE_FUNCTION static bool better (const MagType a, const MagType b) {
+    return a > b;
+  }
+};
+
+// ... and iamin the smallest.
+struct Iamax_FindMin {
+  template<class MagType>
+  KOKKOS_INLINE_FUNCTION static bool better (const MagType a, const MagType b) {
+    return a < b;
+  }
+};
+
+/// \brief Value type of the argmax / argmin reduction: the best
+///   magnitude seen so far and its (0-based) index.
+///
+/// An index equal to none() marks a value that has not seen any entry
+/// yet.  Ties are broken towards the smaller index, which makes the
+/// result independent of how the range is split across threads and
+/// matches the "first index" rule of reference BLAS.
+template<class MagType, class SizeType>
+struct Iamax_Value {
+  MagType  val;
+  SizeType idx;
+
+  KOKKOS_INLINE_FUNCTION static SizeType none () {
+    return Kokkos::Details::ArithTraits<SizeType>::max ();
+  }
+
+  template<class Compare>
+  KOKKOS_INLINE_FUNCTION static bool
+  replaces (const MagType val, const SizeType idx,
+            const MagType best_val, const SizeType best_idx)
+  {
+    if (idx == none ()) return false;
+    if (best_idx == none ()) return true;
+    return Compare::better (val, best_val) ||
+      (val == best_val && idx < best_idx);
+  }
+};
+
+/// \brief Argmax (or argmin) of the magnitudes of the entries of the
+///   single vector (1-D View) X.
+template<class XV, class SizeType, class Compare>
+struct V_Iamax_Functor
+{
+  typedef typename XV::execution_space              execution_space;
+  typedef SizeType                                  size_type;
+  typedef typename XV::non_const_value_type         xvalue_type;
+  typedef typename Kokkos::Details::InnerProductSpaceTraits<xvalue_type>::mag_type mag_type;
+  typedef Kokkos::Details::ArithTraits<mag_type>    ATM;
+  typedef Iamax_Value<mag_type, size_type>          value_type;
+
+  typename XV::const_type m_x;
+
+  V_Iamax_Functor (const XV& x) : m_x (x)
+  {
+    static_assert (Kokkos::Impl::is_view<XV>::value, "KokkosBlas::Impl::"
+                   "V_Iamax_Functor: XV is not a Kokkos::View.");
+    static_assert (XV::rank == 1, "KokkosBlas::Impl::V_Iamax_Functor: "
+                   "XV must have rank 1.");
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  operator() (const size_type& i, value_type& best) const
+  {
+    const mag_type val = iamax_abs1 (m_x(i));
+    if (value_type::template replaces<Compare> (val, i, best.val, best.idx)) {
+      best.val = val;
+      best.idx = i;
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void init (value_type& update) const
+  {
+    update.val = ATM::zero ();
+    update.idx = value_type::none ();
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  join (volatile value_type& update,
+        const volatile value_type& source) const
+  {
+    if (value_type::template replaces<Compare> (source.val, source.idx,
+                                                 update.val, update.idx)) {
+      update.val = source.val;
+      update.idx = source.idx;
+    }
+  }
+};
+
+/// \brief Column-wise argmax (or argmin) of the magnitudes of the
+///   entries of the multivector (2-D View) X.
+///
+/// This is an array reduction with one Iamax_Value per column.
+template<class XMV, class SizeType, class Compare>
+struct MV_Iamax_Functor
+{
+  typedef typename XMV::execution_space             execution_space;
+  typedef SizeType                                  size_type;
+  typedef typename XMV::non_const_value_type        xvalue_type;
+  typedef typename Kokkos::Details::InnerProductSpaceTraits<xvalue_type>::mag_type mag_type;
+  typedef Kokkos::Details::ArithTraits<mag_type>    ATM;
+  typedef Iamax_Value<mag_type, size_type>          entry_type;
+  typedef entry_type                                value_type[];
+
+  size_type value_count;
+  typename XMV::const_type m_x;
+
+  MV_Iamax_Functor (const XMV& x) :
+    value_count (x.extent(1)), m_x (x)
+  {
+    static_assert (Kokkos::Impl::is_view<XMV>::value, "KokkosBlas::Impl::"
+                   "MV_Iamax_Functor: XMV is not a Kokkos::View.");
+    static_assert (XMV::rank == 2, "KokkosBlas::Impl::MV_Iamax_Functor: "
+                   "XMV must have rank 2.");
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  operator() (const size_type& i, value_type best) const
+  {
+    const size_type numVecs = value_count;
+    for (size_type j = 0; j < numVecs; ++j) {
+      const mag_type val = iamax_abs1 (m_x(i,j));
+      if (entry_type::template replaces<Compare> (val, i, best[j].val, best[j].idx)) {
+        best[j].val = val;
+        best[j].idx = i;
+      }
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void init (value_type update) const
+  {
+    const size_type numVecs = value_count;
+    for (size_type j = 0; j < numVecs; ++j) {
+      update[j].val = ATM::zero ();
+      update[j].idx = entry_type::none ();
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  join (volatile value_type update,
+        const volatile value_type source) const
+  {
+    const size_type numVecs = value_count;
+    for (size_type j = 0; j < numVecs; ++j) {
+      if (entry_type::template replaces<Compare> (source[j].val, source[j].idx,
+                                                  update[j].val, update[j].idx)) {
+        update[j].val = source[j].val;
+        update[j].idx = source[j].idx;
+      }
+    }
+  }
+};
+
+/// \brief Store in the 0-D View r the 1-based index of the entry of
+///   the single vector X with the largest (Compare = Iamax_FindMax) or
+///   smallest (Iamax_FindMin) magnitude, or 0 if X is empty.
+template<class RV, class XV, class SizeType, class Compare>
+void
+V_Iamax_Invoke (const RV& r, const XV& X)
+{
+  typedef typename XV::execution_space execution_space;
+  typedef typename RV::non_const_value_type index_type;
+  typedef V_Iamax_Functor<XV, SizeType, Compare> functor_type;
+  typedef typename functor_type::value_type value_type;
+
+  const SizeType numRows = static_cast<SizeType> (X.extent(0));
+
+  // BLAS convention: the index of an empty vector is 0
+  if (numRows == 0) {
+    Kokkos::deep_copy (r, index_type (0));
+    return;
+  }
+
+  Kokkos::RangePolicy<execution_space, SizeType> policy (0, numRows);
+  value_type best;
+  Kokkos::parallel_reduce ("KokkosBlas::iamax<1-D>", policy, functor_type (X), best);
+  Kokkos::deep_copy (r, static_cast<index_type> (best.idx + 1));
+}
+
+/// \brief Column-wise version of V_Iamax_Invoke: store in the 1-D
+///   View r the 1-based index for each column of the multivector X.
+template<class RV, class XMV, class SizeType, class Compare>
+void
+MV_Iamax_Invoke (const RV& r, const XMV& X)
+{
+  typedef typename XMV::execution_space execution_space;
+  typedef typename RV::non_const_value_type index_type;
+  typedef MV_Iamax_Functor<XMV, SizeType, Compare> functor_type;
+  typedef typename functor_type::entry_type entry_type;
+
+  const SizeType numRows = static_cast<SizeType> (X.extent(0));
+  const SizeType numCols = static_cast<SizeType> (X.extent(1));
+
+  if (numRows == 0) {
+    Kokkos::deep_copy (r, index_type (0));
+    return;
+  }
+  if (numCols == 0) {
+    return;
+  }
+
+  // If the input multivector (2-D View) has only one column, invoke
+  // the single-vector version of the kernel.
+  if (numCols == 1) {
+    typedef Kokkos::View<index_type,
+                         typename RV::array_layout,
+                         typename RV::device_type,
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged> > RV0D;
+    RV0D r_0 (r, 0);
+    auto X_0 = Kokkos::subview (X, Kokkos::ALL (), 0);
+    typedef decltype (X_0) XV1D;
+    V_Iamax_Invoke<RV0D, XV1D, SizeType, Compare> (r_0, X_0);
+    return;
+  }
+
+  Kokkos::RangePolicy<execution_space, SizeType> policy (0, numRows);
+  Kokkos::View<entry_type*, Kokkos::HostSpace> best ("KokkosBlas::Iamax::best", numCols);
+  Kokkos::parallel_reduce ("KokkosBlas::iamax<2-D>", policy, functor_type (X), best);
+
+  typename RV::HostMirror h_r = Kokkos::create_mirror_view (r);
+  for (SizeType j = 0; j < numCols; ++j) {
+    h_r(j) = static_cast<index_type> (best(j).idx + 1);
+  }
+  Kokkos::deep_copy (r, h_r);
+}
+
+} // namespace Impl
+} // namespace KokkosBlas
+
+#endif // KOKKOSBLAS1_IAMAX_IMPL_HPP_
@@ -0,0 +1,298 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#ifndef KOKKOSBLAS1_REPRODUCIBLE_IMPL_HPP_
+#define KOKKOSBLAS1_REPRODUCIBLE_IMPL_HPP_
+
+#include <KokkosKernels_config.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_InnerProductSpaceTraits.hpp>
+
+namespace KokkosBlas {
+namespace Impl {
+
+//
+// Reproducible (bitwise deterministic) reductions.
+//
+// parallel_reduce combines per-thread partial results in an order that
+// depends on the number of threads, so the rounding of the result does
+// too.  Here the reduction order is fixed by the vector length alone:
+//
+// 1. The rows are split into fixed-size blocks and every block is
+//    reduced by one thread in a fixed order into a partial result.
+// 2. The partial results are combined by a fixed pairwise tree, one
+//    parallel_for per tree level.
+//
+// On host spaces a block is a contiguous range of rows, reduced with
+// four interleaved accumulators.  On GPUs, block b instead holds rows
+// b, b+P, b+2P, ... (P the number of blocks) so that neighbouring
+// threads read neighbouring entries.  Results are thus reproducible for
+// a given vector length and type of execution space, independent of the
+// number of threads and of how the launches are chunked.
+//
+// The block sizes below (1024 rows on host spaces, 128 on GPUs) fix the
+// reduction order and are therefore part of the reproducibility
+// contract: changing them changes the rounding of every result, so they
+// must not be tuned per architecture or made run-time parameters.
+//
+
+template<class ExecSpace>
+struct reproducible_reduce_strided {
+  enum : bool { value = false };
+  enum : int { block_size = 1024 };
+};
+
+#ifdef KOKKOS_ENABLE_CUDA
+template<>
+struct reproducible_reduce_strided<Kokkos::Cuda> {
+  enum : bool { value = true };
+  enum : int { block_size = 128 };
+};
+#endif
+#ifdef KOKKOS_ENABLE_ROCM
+template<>
+struct reproducible_reduce_strided<Kokkos::ROCm> {
+  enum : bool { value = true };
+  enum : int { block_size = 128 };
+};
+#endif
+
+// Entry (i,j) of a 1-D or 2-D View.  The column index is ignored for 1-D
+// Views and for 2-D Views with one column, so that a vector can be
+// combined with every column of a multivector, as in KokkosBlas::dot.
+template<class V, int rank = V::rank>
+struct ReproducibleAccess {
+  KOKKOS_INLINE_FUNCTION static typename V::const_value_type&
+  get (const V& v, const int64_t i, const int64_t j) {
+    return v(i, v.extent(1) == 1 ? int64_t (0) : j);
+  }
+};
+
+template<class V>
+struct ReproducibleAccess<V,1> {
+  KOKKOS_INLINE_FUNCTION static typename V::const_value_type&
+  get (const V& v, const int64_t i, const int64_t /* j */) { return v(i); }
+};
+
+// The per-entry operation and the final transformation of each reduction
+template<class XV, class YV>
+struct ReproducibleDotOp {
+  typedef Kokkos::Details::InnerProductSpaceTraits<typename XV::non_const_value_type> IPT;
+  typedef typename IPT::dot_type value_type;
+
+  KOKKOS_INLINE_FUNCTION static value_type
+  apply (const XV& x, const YV& y, const int64_t i, const int64_t j) {
+    return IPT::dot (ReproducibleAccess<XV>::get (x,i,j), ReproducibleAccess<YV>::get (y,i,j));
+  }
+  KOKKOS_INLINE_FUNCTION static value_type finalize (const value_type& v) { return v; }
+};
+
+template<class XV>
+struct ReproducibleSumOp {
+  typedef typename XV::non_const_value_type value_type;
+
+  KOKKOS_INLINE_FUNCTION static value_type
+  apply (const XV& x, const XV& /* y */, const int64_t i, const int64_t j) {
+    return ReproducibleAccess<XV>::get (x,i,j);
+  }
+  KOKKOS_INLINE_FUNCTION static value_type finalize (const value_type& v) { return v; }
+};
+
+template<class XV>
+struct ReproducibleNrm2Op {
+  typedef Kokkos::Details::InnerProductSpaceTraits<typename XV::non_const_value_type> IPT;
+  typedef typename IPT::mag_type value_type;
+
+  KOKKOS_INLINE_FUNCTION static value_type
+  apply (const XV& x, const XV& /* y */, const int64_t i, const int64_t j) {
+    const value_type tmp = IPT::norm (ReproducibleAccess<XV>::get (x,i,j));
+    return tmp * tmp;
+  }
+  KOKKOS_INLINE_FUNCTION static value_type finalize (const value_type& v) {
+    return Kokkos::Details::ArithTraits<value_type>::sqrt (v);
+  }
+};
+
+// Step 1: partial result of every (block, column)
+template<class Op, class XV, class YV, class PV, bool strided>
+struct ReproducibleBlockFunctor {
+  typedef typename Op::value_type value_type;
+  typedef Kokkos::Details::ArithTraits<value_type> AT;
+
+  XV x;
+  YV y;
+  PV partial;
+  int64_t numRows, numCols, numBlocks, blockSize;
+
+  ReproducibleBlockFunctor (const XV& x_, const YV& y_, const PV& partial_,
+                            const int64_t numRows_, const int64_t blockSize_) :
+    x (x_), y (y_), partial (partial_), numRows (numRows_),
+    numCols (partial_.extent(1)), numBlocks (partial_.extent(0)), blockSize (blockSize_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const int64_t& k) const {
+    const int64_t b = k / numCols;
+    const int64_t j = k % numCols;
+    if (strided) {
+      value_type sum = AT::zero ();
+      for (int64_t i = b; i < numRows; i += numBlocks)
+        sum += Op::apply (x, y, i, j);
+      partial(b,j) = sum;
+    }
+    else {
+      const int64_t begin = b*blockSize;
+      const int64_t end = (begin + blockSize < numRows) ? begin + blockSize : numRows;
+      value_type sum0 = AT::zero (), sum1 = AT::zero (), sum2 = AT::zero (), sum3 = AT::zero ();
+      int64_t i = begin;
+      for (; i + 3 < end; i += 4) {
+        sum0 += Op::apply (x, y, i  , j);
+        sum1 += Op::apply (x, y, i+1, j);
+        sum2 += Op::apply (x, y, i+2, j);
+        sum3 += Op::apply (x, y, i+3, j);
+      }
+      for (; i < end; ++i)
+        sum0 += Op::apply (x, y, i, j);
+      partial(b,j) = (sum0 + sum1) + (sum2 + sum3);
+    }
+  }
+};
+
+// Step 2: one level of the pairwise tree, partial(b) += partial(b+stride)
+// for all b that are multiples of 2*stride
+template<class PV>
+struct ReproducibleTreeFunctor {
+  PV partial;
+  int64_t numCols, numBlocks, stride;
+
+  ReproducibleTreeFunctor (const PV& partial_, const int64_t stride_) :
+    partial (partial_), numCols (partial_.extent(1)), numBlocks (partial_.extent(0)),
+    stride (stride_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const int64_t& k) const {
+    const int64_t b = (k / numCols) * 2 * stride;
+    const int64_t j = k % numCols;
+    if (b + stride < numBlocks)
+      partial(b,j) += partial(b+stride,j);
+  }
+};
+
+template<class Op, class PV, class RV>
+struct ReproducibleFinalizeFunctor {
+  PV partial;
+  RV result;
+
+  ReproducibleFinalizeFunctor (const PV& partial_, const RV& result_) :
+    partial (partial_), result (result_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const int64_t& j) const {
+    result(j) = Op::finalize (partial(0,j));
+  }
+};
+
+// Copy the results to R (0-D or 1-D, host or device).
+template<class RV, class TV, int rank = RV::rank>
+struct ReproducibleCopyResult {
+  static void copy (const RV& R, const TV& result) {
+    Kokkos::deep_copy (R, result);
+  }
+};
+
+template<class RV, class TV>
+struct ReproducibleCopyResult<RV,TV,0> {
+  static void copy (const RV& R, const TV& result) {
+    Kokkos::deep_copy (R, Kokkos::subview (result, 0));
+  }
+};
+
+/// \brief R(j) = Op-reduction over i of (X(i,j), Y(i,j)), in a fixed order.
+///
+/// chunkSize, if positive, is passed to every RangePolicy; it changes
+/// the scheduling only, never the result.
+template<class Op, class RV, class XV, class YV>
+void reproducible_reduce (const char label[], const RV& R, const XV& X, const YV& Y,
+                          const int chunkSize = 0)
+{
+  typedef typename XV::execution_space execution_space;
+  typedef typename Op::value_type value_type;
+  typedef Kokkos::View<value_type**, Kokkos::LayoutRight, typename XV::device_type> PV;
+  typedef Kokkos::View<typename RV::non_const_value_type*, Kokkos::LayoutLeft,
+                       typename XV::device_type> TV;
+  typedef reproducible_reduce_strided<execution_space> strided;
+  typedef Kokkos::RangePolicy<execution_space, int64_t> policy_type;
+
+  const int64_t numRows = X.extent(0);
+  const int64_t numCols = X.extent(1) > Y.extent(1) ? X.extent(1) : Y.extent(1);
+  // At least one block, so that empty vectors reduce to zero
+  const int64_t numBlocks = numRows > 0 ? (numRows + strided::block_size - 1) / strided::block_size : 1;
+
+  Kokkos::Profiling::pushRegion (label);
+  PV partial (Kokkos::ViewAllocateWithoutInitializing ("KokkosBlas::reproducible::partial"),
+              numBlocks, numCols);
+  const auto policy = [chunkSize] (const int64_t n) {
+    policy_type p (0, n);
+    if (chunkSize > 0) p.set_chunk_size (chunkSize);
+    return p;
+  };
+  Kokkos::parallel_for ("KokkosBlas::reproducible::block",
+                        policy (numBlocks*numCols),
+                        ReproducibleBlockFunctor<Op, XV, YV, PV, strided::value>
+                          (X, Y, partial, numRows, strided::block_size));
+  for (int64_t stride = 1; stride < numBlocks; stride *= 2) {
+    const int64_t numPairs = (numBlocks + 2*stride - 1) / (2*stride);
+    Kokkos::parallel_for ("KokkosBlas::reproducible::tree",
+                          policy (numPairs*numCols),
+                          ReproducibleTreeFunctor<PV> (partial, stride));
+  }
+  TV result ("KokkosBlas::reproducible::result", numCols);
+  Kokkos::parallel_for ("KokkosBlas::reproducible::finalize",
+                        policy (numCols),
+                        ReproducibleFinalizeFunctor<Op, PV, TV> (partial, result));
+  ReproducibleCopyResult<RV, TV>::copy (R, result);
+  Kokkos::Profiling::popRegion ();
+}
+
+} // namespace Impl
+} // namespace KokkosBlas
+
+#endif // KOKKOSBLAS1_REPRODUCIBLE_IMPL_HPP_
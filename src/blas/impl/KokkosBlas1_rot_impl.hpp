@@ -0,0 +1,197 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#ifndef KOKKOSBLAS1_ROT_IMPL_HPP_
+#define KOKKOSBLAS1_ROT_IMPL_HPP_
+
+#include <KokkosKernels_config.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ArithTraits.hpp>
+
+namespace KokkosBlas {
+namespace Impl {
+
+//
+// rot
+//
+
+// Apply the plane rotation [c s; -conj(s) c] to the rows of the
+// multivectors X and Y:
+//
+//   X(i,j) =         c  * X(i,j) + s * Y(i,j)
+//   Y(i,j) = -conj(s) * X(i,j) + c * Y(i,j)
+template<class XMV, class YMV, class SizeType = typename XMV::size_type>
+struct MV_Rot_Functor
+{
+  typedef typename XMV::execution_space execution_space;
+  typedef SizeType                            size_type;
+  typedef typename XMV::non_const_value_type  value_type;
+  typedef Kokkos::Details::ArithTraits<value_type> ATS;
+  typedef typename ATS::mag_type              mag_type;
+
+  const size_type numCols;
+  XMV X_;
+  YMV Y_;
+  const mag_type c_;
+  const value_type s_;
+
+  MV_Rot_Functor (const XMV& X, const YMV& Y,
+                  const mag_type& c, const value_type& s) :
+    numCols (X.extent(1)), X_ (X), Y_ (Y), c_ (c), s_ (s)
+  {
+    static_assert (Kokkos::Impl::is_view<XMV>::value, "KokkosBlas::Impl::"
+                   "MV_Rot_Functor: XMV is not a Kokkos::View.");
+    static_assert (Kokkos::Impl::is_view<YMV>::value, "KokkosBlas::Impl::"
+                   "MV_Rot_Functor: YMV is not a Kokkos::View.");
+    static_assert (XMV::rank == 2, "KokkosBlas::Impl::"
+                   "MV_Rot_Functor: XMV is not rank 2");
+    static_assert (YMV::rank == 2, "KokkosBlas::Impl::"
+                   "MV_Rot_Functor: YMV is not rank 2");
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const size_type& i) const
+  {
+    const value_type s_conj = ATS::conj (s_);
+#ifdef KOKKOS_ENABLE_PRAGMA_IVDEP
+#pragma ivdep
+#endif
+    for (size_type j = 0; j < numCols; ++j) {
+      const value_type x = X_(i,j);
+      const value_type y = Y_(i,j);
+      X_(i,j) = c_*x + s_*y;
+      Y_(i,j) = c_*y - s_conj*x;
+    }
+  }
+};
+
+// Single-vector version of MV_Rot_Functor.
+template<class XV, class YV, class SizeType = typename XV::size_type>
+struct V_Rot_Functor
+{
+  typedef typename XV::execution_space execution_space;
+  typedef SizeType                            size_type;
+  typedef typename XV::non_const_value_type   value_type;
+  typedef Kokkos::Details::ArithTraits<value_type> ATS;
+  typedef typename ATS::mag_type              mag_type;
+
+  XV X_;
+  YV Y_;
+  const mag_type c_;
+  const value_type s_;
+  const value_type s_conj_;
+
+  V_Rot_Functor (const XV& X, const YV& Y,
+                 const mag_type& c, const value_type& s) :
+    X_ (X), Y_ (Y), c_ (c), s_ (s), s_conj_ (ATS::conj (s))
+  {
+    static_assert (Kokkos::Impl::is_view<XV>::value, "KokkosBlas::Impl::"
+                   "V_Rot_Functor: XV is not a Kokkos::View.");
+    static_assert (Kokkos::Impl::is_view<YV>::value, "KokkosBlas::Impl::"
+                   "V_Rot_Functor: YV is not a Kokkos::View.");
+    static_assert (XV::rank == 1, "KokkosBlas::Impl::"
+                   "V_Rot_Functor: XV is not rank 1");
+    static_assert (YV::rank == 1, "KokkosBlas::Impl::"
+                   "V_Rot_Functor: YV is not rank 1");
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const size_type& i) const
+  {
+    const value_type x = X_(i);
+    const value_type y = Y_(i);
+    X_(i) = c_*x + s_*y;
+    Y_(i) = c_*y - s_conj_*x;
+  }
+};
+
+// Invoke the "generic" (not unrolled) multivector rotation functor.
+template<class XMV, class YMV, class SizeType>
+void
+MV_Rot_Generic (const XMV& X, const YMV& Y,
+                const typename Kokkos::Details::ArithTraits<typename XMV::non_const_value_type>::mag_type& c,
+                const typename XMV::non_const_value_type& s)
+{
+  static_assert (Kokkos::Impl::is_view<XMV>::value, "KokkosBlas::Impl::"
+                 "MV_Rot_Generic: XMV is not a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_view<YMV>::value, "KokkosBlas::Impl::"
+                 "MV_Rot_Generic: YMV is not a Kokkos::View.");
+  static_assert (XMV::rank == 2, "KokkosBlas::Impl::"
+                 "MV_Rot_Generic: XMV is not rank 2");
+  static_assert (YMV::rank == 2, "KokkosBlas::Impl::"
+                 "MV_Rot_Generic: YMV is not rank 2");
+
+  typedef typename XMV::execution_space execution_space;
+  const SizeType numRows = X.extent(0);
+  Kokkos::RangePolicy<execution_space, SizeType> policy (0, numRows);
+
+  MV_Rot_Functor<XMV, YMV, SizeType> op (X, Y, c, s);
+  Kokkos::parallel_for (policy, op);
+}
+
+// Variant of MV_Rot_Generic for single vectors (1-D Views) X and Y.
+template<class XV, class YV, class SizeType>
+void
+V_Rot_Generic (const XV& X, const YV& Y,
+               const typename Kokkos::Details::ArithTraits<typename XV::non_const_value_type>::mag_type& c,
+               const typename XV::non_const_value_type& s)
+{
+  static_assert (Kokkos::Impl::is_view<XV>::value, "KokkosBlas::Impl::"
+                 "V_Rot_Generic: XV is not a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_view<YV>::value, "KokkosBlas::Impl::"
+                 "V_Rot_Generic: YV is not a Kokkos::View.");
+  static_assert (XV::rank == 1, "KokkosBlas::Impl::"
+                 "V_Rot_Generic: XV is not rank 1");
+  static_assert (YV::rank == 1, "KokkosBlas::Impl::"
+                 "V_Rot_Generic: YV is not rank 1");
+
+  typedef typename XV::execution_space execution_space;
+  const SizeType numRows = X.extent(0);
+  Kokkos::RangePolicy<execution_space, SizeType> policy (0, numRows);
+
+  V_Rot_Functor<XV, YV, SizeType> op (X, Y, c, s);
+  Kokkos::parallel_for (policy, op);
+}
+
+}
+}
+#endif // KOKKOSBLAS1_ROT_IMPL_HPP_
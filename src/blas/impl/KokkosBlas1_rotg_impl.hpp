@@ -0,0 +1,138 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#ifndef KOKKOSBLAS1_ROTG_IMPL_HPP_
+#define KOKKOSBLAS1_ROTG_IMPL_HPP_
+
+#include <KokkosKernels_config.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ArithTraits.hpp>
+
+namespace KokkosBlas {
+namespace Impl {
+
+/// \brief Construct a plane (Givens) rotation, following reference
+///   BLAS ?rotg.
+///
+/// The real version overwrites a with r and b with the reconstruction
+/// parameter z; the complex version (zrotg) overwrites a with r and
+/// leaves b unchanged.  In both cases
+///
+///   [  c        s ] [ a ]   [ r ]
+///   [ -conj(s)  c ] [ b ] = [ 0 ].
+template<class Scalar,
+         bool is_complex = Kokkos::Details::ArithTraits<Scalar>::is_complex>
+struct Rotg;
+
+template<class Scalar>
+struct Rotg<Scalar, false> {
+  typedef Kokkos::Details::ArithTraits<Scalar> ATS;
+  typedef typename ATS::mag_type mag_type;
+
+  KOKKOS_INLINE_FUNCTION static void
+  rotg (Scalar& a, Scalar& b, mag_type& c, Scalar& s)
+  {
+    const Scalar zero = ATS::zero ();
+    const Scalar one = ATS::one ();
+    const Scalar abs_a = ATS::abs (a);
+    const Scalar abs_b = ATS::abs (b);
+    const Scalar roe = abs_a > abs_b ? a : b;
+    const Scalar scale = abs_a + abs_b;
+
+    if (scale == zero) {
+      c = one;
+      s = zero;
+      a = zero;
+      b = zero;
+      return;
+    }
+
+    const Scalar as = a / scale;
+    const Scalar bs = b / scale;
+    Scalar r = scale * ATS::sqrt (as*as + bs*bs);
+    if (roe < zero) r = -r;
+    c = a / r;
+    s = b / r;
+
+    Scalar z = one;
+    if (abs_a > abs_b) z = s;
+    if (abs_b >= abs_a && c != zero) z = one / c;
+
+    a = r;
+    b = z;
+  }
+};
+
+template<class Scalar>
+struct Rotg<Scalar, true> {
+  typedef Kokkos::Details::ArithTraits<Scalar> ATS;
+  typedef typename ATS::mag_type mag_type;
+  typedef Kokkos::Details::ArithTraits<mag_type> ATM;
+
+  KOKKOS_INLINE_FUNCTION static void
+  rotg (Scalar& a, Scalar& b, mag_type& c, Scalar& s)
+  {
+    const mag_type abs_a = ATS::abs (a);
+
+    if (abs_a == ATM::zero ()) {
+      c = ATM::zero ();
+      s = ATS::one ();
+      a = b;
+      return;
+    }
+
+    const mag_type abs_b = ATS::abs (b);
+    const mag_type scale = abs_a + abs_b;
+    const mag_type as = abs_a / scale;
+    const mag_type bs = abs_b / scale;
+    const mag_type norm = scale * ATM::sqrt (as*as + bs*bs);
+    const Scalar alpha = a / abs_a;
+
+    c = abs_a / norm;
+    s = alpha * ATS::conj (b) / norm;
+    a = alpha * norm;
+  }
+};
+
+}
+}
+#endif // KOKKOSBLAS1_ROTG_IMPL_HPP_
@@ -0,0 +1,123 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#ifndef KOKKOSBLAS1_TEAM_IAMAX_SPEC_HPP_
+#define KOKKOSBLAS1_TEAM_IAMAX_SPEC_HPP_
+
+#include <KokkosKernels_config.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ArithTraits.hpp>
+#include <Kokkos_InnerProductSpaceTraits.hpp>
+#include <KokkosBlas1_iamax_impl.hpp>
+
+namespace KokkosBlas {
+namespace Experimental {
+namespace Impl {
+
+template<class XV>
+struct team_iamax_tpl_spec_avail {
+  constexpr static bool value = false;
+};
+
+// Unification and Specialization layer
+template<class TeamType, class XV, bool tpl_spec_avail = team_iamax_tpl_spec_avail<XV>::value>
+struct TeamIamax {
+  typedef typename XV::size_type size_type;
+
+  static KOKKOS_INLINE_FUNCTION size_type team_iamax (const TeamType& team, const XV& X);
+  static KOKKOS_INLINE_FUNCTION size_type team_iamin (const TeamType& team, const XV& X);
+};
+
+// The argmax is computed in two passes: first the extreme magnitude,
+// then the smallest index at which it occurs.  This keeps the
+// "first index on ties" rule of reference BLAS with the built-in
+// reducers only.  NaN entries compare false and are skipped, except
+// that, as in reference BLAS, a NaN first entry is returned as is.
+template<class TeamType, class XV>
+struct TeamIamax<TeamType, XV, false> {
+  typedef typename XV::size_type size_type;
+  typedef typename Kokkos::Details::InnerProductSpaceTraits<typename XV::non_const_value_type>::mag_type mag_type;
+  typedef Kokkos::Details::ArithTraits<mag_type> ATM;
+
+  static KOKKOS_INLINE_FUNCTION size_type team_iamax (const TeamType& team, const XV& X) {
+    const int N = X.extent(0);
+    if (N == 0) return 0;
+    if (ATM::isNan(KokkosBlas::Impl::iamax_abs1(X(0)))) return 1;
+    mag_type best;
+    Kokkos::parallel_reduce(Kokkos::TeamThreadRange(team,N), [&] (const int& i, mag_type& val) {
+      const mag_type m = KokkosBlas::Impl::iamax_abs1(X(i));
+      if (m > val) val = m;
+    },Kokkos::Max<mag_type>(best));
+    return first_index(team,X,best);
+  }
+
+  static KOKKOS_INLINE_FUNCTION size_type team_iamin (const TeamType& team, const XV& X) {
+    const int N = X.extent(0);
+    if (N == 0) return 0;
+    if (ATM::isNan(KokkosBlas::Impl::iamax_abs1(X(0)))) return 1;
+    mag_type best;
+    Kokkos::parallel_reduce(Kokkos::TeamThreadRange(team,N), [&] (const int& i, mag_type& val) {
+      const mag_type m = KokkosBlas::Impl::iamax_abs1(X(i));
+      if (m < val) val = m;
+    },Kokkos::Min<mag_type>(best));
+    return first_index(team,X,best);
+  }
+
+private:
+  // 1-based index of the first entry of X with magnitude best, or 1 if
+  // there is none (all entries are NaN, so best is the reducer identity).
+  static KOKKOS_INLINE_FUNCTION size_type first_index (const TeamType& team, const XV& X, const mag_type best) {
+    const int N = X.extent(0);
+    int idx;
+    Kokkos::parallel_reduce(Kokkos::TeamThreadRange(team,N), [&] (const int& i, int& val) {
+      if (i < val && KokkosBlas::Impl::iamax_abs1(X(i)) == best) val = i;
+    },Kokkos::Min<int>(idx));
+    if (idx >= N) return 1;
+    return static_cast<size_type>(idx) + 1;
+  }
+};
+
+}
+}
+}
+
+#endif
@@ -479,6 +479,355 @@ singleLevelGemv (const char trans[],
   }
 }
 
+
+// Block and tile sizes of the two-level GEMV kernels below.
+struct impl_gemv_two_level_size {
+  enum : int {
+    // Entries of x processed per tile by the non-transpose kernel, so
+    // that the tile of x stays in cache while the rows of a team stream
+    // through it.
+    x_tile = 2048,
+    // Rows of A owned by one team in the non-transpose kernel
+    team_rows = 256,
+    // Columns of A (entries of y) owned by one team in the transpose
+    // kernel
+    team_cols = 64,
+    // The split kernel is used if y has at most this many entries ...
+    max_split_outputs = 256,
+    // ... and the other dimension of A has at least two blocks of this
+    // many entries.
+    min_split_block = 1024
+  };
+};
+
+// Two-level non-transpose GEMV.  Each team owns team_rows rows of A
+// and y, one row per thread, and sweeps over the columns in tiles of
+// x_tile entries, reduced over the vector lanes.  Only the first tile
+// reads y (and only if beta != 0).
+template<class AViewType,
+         class XViewType,
+         class YViewType,
+         class IndexType = typename AViewType::size_type>
+struct TwoLevelNontransposeGEMV {
+  typedef typename AViewType::execution_space execution_space;
+  typedef typename Kokkos::TeamPolicy<execution_space>::member_type member_type;
+  typedef typename AViewType::non_const_value_type AlphaCoeffType;
+  typedef typename YViewType::non_const_value_type BetaCoeffType;
+  typedef typename YViewType::non_const_value_type y_value_type;
+  typedef Kokkos::Details::ArithTraits<y_value_type> ATY;
+
+  TwoLevelNontransposeGEMV (const AlphaCoeffType& alpha,
+                            const AViewType& A,
+                            const XViewType& x,
+                            const BetaCoeffType& beta,
+                            const YViewType& y) :
+    alpha_ (alpha), A_ (A), x_ (x), beta_ (beta), y_ (y)
+  {
+    static_assert (std::is_integral<IndexType>::value,
+                   "IndexType must be an integer.");
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  operator () (const member_type& team) const
+  {
+    const IndexType numRows = A_.extent(0);
+    const IndexType numCols = A_.extent(1);
+    const IndexType i_begin = static_cast<IndexType> (team.league_rank ()) * impl_gemv_two_level_size::team_rows;
+    const IndexType i_end = (i_begin + impl_gemv_two_level_size::team_rows < numRows) ?
+                             i_begin + impl_gemv_two_level_size::team_rows : numRows;
+
+    for (IndexType j_begin = 0; j_begin < numCols; j_begin += impl_gemv_two_level_size::x_tile) {
+      const IndexType j_end = (j_begin + impl_gemv_two_level_size::x_tile < numCols) ?
+                               j_begin + impl_gemv_two_level_size::x_tile : numCols;
+      Kokkos::parallel_for (Kokkos::TeamThreadRange (team, i_begin, i_end), [&] (const IndexType& i) {
+        y_value_type Ax_i;
+        Kokkos::parallel_reduce (Kokkos::ThreadVectorRange (team, j_end - j_begin), [&] (const IndexType& jj, y_value_type& val) {
+          val += A_(i, j_begin+jj) * x_(j_begin+jj);
+        }, Ax_i);
+        Kokkos::single (Kokkos::PerThread (team), [&] () {
+          if (j_begin == 0)
+            y_(i) = (beta_ == ATY::zero () ? ATY::zero () : beta_ * y_(i)) + alpha_ * Ax_i;
+          else
+            y_(i) += alpha_ * Ax_i;
+        });
+      });
+      team.team_barrier ();
+    }
+  }
+
+private:
+  AlphaCoeffType alpha_;
+  typename AViewType::const_type A_;
+  typename XViewType::const_type x_;
+  BetaCoeffType beta_;
+  YViewType y_;
+};
+
+// Two-level (conjugate) transpose GEMV.  Each team owns team_cols
+// columns of A and entries of y, one column per thread, and reduces
+// over the rows on the vector lanes.  Unlike SingleLevelTransposeGEMV
+// the reduction result does not grow with the number of columns.
+template<class AViewType,
+         class XViewType,
+         class YViewType,
+         const bool conj,
+         class IndexType = typename AViewType::size_type>
+struct TwoLevelTransposeGEMV {
+  typedef typename AViewType::execution_space execution_space;
+  typedef typename Kokkos::TeamPolicy<execution_space>::member_type member_type;
+  typedef typename AViewType::non_const_value_type AlphaCoeffType;
+  typedef typename YViewType::non_const_value_type BetaCoeffType;
+  typedef typename YViewType::non_const_value_type y_value_type;
+  typedef Kokkos::Details::ArithTraits<typename AViewType::non_const_value_type> KAT;
+  typedef Kokkos::Details::ArithTraits<y_value_type> ATY;
+
+  TwoLevelTransposeGEMV (const AlphaCoeffType& alpha,
+                         const AViewType& A,
+                         const XViewType& x,
+                         const BetaCoeffType& beta,
+                         const YViewType& y) :
+    alpha_ (alpha), A_ (A), x_ (x), beta_ (beta), y_ (y)
+  {
+    static_assert (std::is_integral<IndexType>::value,
+                   "IndexType must be an integer.");
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  operator () (const member_type& team) const
+  {
+    const IndexType numRows = A_.extent(0);
+    const IndexType numCols = A_.extent(1);
+    const IndexType j_begin = static_cast<IndexType> (team.league_rank ()) * impl_gemv_two_level_size::team_cols;
+    const IndexType j_end = (j_begin + impl_gemv_two_level_size::team_cols < numCols) ?
+                             j_begin + impl_gemv_two_level_size::team_cols : numCols;
+
+    Kokkos::parallel_for (Kokkos::TeamThreadRange (team, j_begin, j_end), [&] (const IndexType& j) {
+      y_value_type Ax_j;
+      Kokkos::parallel_reduce (Kokkos::ThreadVectorRange (team, numRows), [&] (const IndexType& i, y_value_type& val) {
+        val += (conj ? KAT::conj (A_(i,j)) : A_(i,j)) * x_(i);
+      }, Ax_j);
+      Kokkos::single (Kokkos::PerThread (team), [&] () {
+        y_(j) = (beta_ == ATY::zero () ? ATY::zero () : beta_ * y_(j)) + alpha_ * Ax_j;
+      });
+    });
+  }
+
+private:
+  AlphaCoeffType alpha_;
+  typename AViewType::const_type A_;
+  typename XViewType::const_type x_;
+  BetaCoeffType beta_;
+  YViewType y_;
+};
+
+// Split GEMV for a short y and a long other dimension: op(A) is short
+// and wide, e.g. y = A^T*x with a tall and skinny A (the projection
+// step of Arnoldi or block orthogonalization).  The long dimension is
+// cut into blocks, one per team.  The team computes all entries of y
+// over its block, one team reduction per entry, so the block of x is
+// reused from cache, and writes them to the row of W for this block.
+// GEMVSplitFinal then sums the partial results in a fixed order.
+template<class AViewType,
+         class XViewType,
+         class WViewType,
+         const bool trans,
+         const bool conj,
+         class IndexType = typename AViewType::size_type>
+struct TwoLevelSplitGEMV {
+  typedef typename AViewType::execution_space execution_space;
+  typedef typename Kokkos::TeamPolicy<execution_space>::member_type member_type;
+  typedef typename WViewType::non_const_value_type w_value_type;
+  typedef Kokkos::Details::ArithTraits<typename AViewType::non_const_value_type> KAT;
+
+  TwoLevelSplitGEMV (const IndexType blockSize,
+                     const AViewType& A,
+                     const XViewType& x,
+                     const WViewType& W) :
+    blockSize_ (blockSize), A_ (A), x_ (x), W_ (W)
+  {
+    static_assert (std::is_integral<IndexType>::value,
+                   "IndexType must be an integer.");
+  }
+
+  // Entry (k,l) of op(A)
+  KOKKOS_INLINE_FUNCTION
+  typename AViewType::non_const_value_type
+  op_A (const IndexType k, const IndexType l) const {
+    if (!trans) return A_(k,l);
+    return conj ? KAT::conj (A_(l,k)) : A_(l,k);
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  operator () (const member_type& team) const
+  {
+    const IndexType numOut = trans ? A_.extent(1) : A_.extent(0);
+    const IndexType numIn  = trans ? A_.extent(0) : A_.extent(1);
+    const IndexType block = team.league_rank ();
+    const IndexType l_begin = block * blockSize_;
+    const IndexType l_end = (l_begin + blockSize_ < numIn) ? l_begin + blockSize_ : numIn;
+
+    for (IndexType k = 0; k < numOut; ++k) {
+      w_value_type Ax_k;
+      Kokkos::parallel_reduce (Kokkos::TeamThreadRange (team, l_begin, l_end), [&] (const IndexType& l, w_value_type& val) {
+        val += op_A (k,l) * x_(l);
+      }, Ax_k);
+      Kokkos::single (Kokkos::PerTeam (team), [&] () {
+        W_(block,k) = Ax_k;
+      });
+    }
+  }
+
+private:
+  IndexType blockSize_;
+  typename AViewType::const_type A_;
+  typename XViewType::const_type x_;
+  WViewType W_;
+};
+
+// y = beta*y + alpha*(sum of the rows of W)
+template<class WViewType,
+         class YViewType,
+         class IndexType = typename YViewType::size_type>
+struct GEMVSplitFinal {
+  typedef typename YViewType::non_const_value_type y_value_type;
+  typedef Kokkos::Details::ArithTraits<y_value_type> ATY;
+
+  typename YViewType::non_const_value_type alpha_;
+  typename YViewType::non_const_value_type beta_;
+  typename WViewType::const_type W_;
+  YViewType y_;
+
+  GEMVSplitFinal (const y_value_type& alpha, const WViewType& W,
+                  const y_value_type& beta, const YViewType& y) :
+    alpha_ (alpha), beta_ (beta), W_ (W), y_ (y) {}
+
+  KOKKOS_INLINE_FUNCTION void
+  operator () (const IndexType& k) const
+  {
+    y_value_type Ax_k = ATY::zero ();
+    for (IndexType block = 0; block < static_cast<IndexType> (W_.extent(0)); ++block)
+      Ax_k += W_(block,k);
+    y_(k) = (beta_ == ATY::zero () ? ATY::zero () : beta_ * y_(k)) + alpha_ * Ax_k;
+  }
+};
+
+// Whether twoLevelGemv should be used instead of singleLevelGemv.  The
+// single-level kernels parallelize over the rows of op(A) only.
+// This leaves cores idle when op(A) has few rows, and for long rows of
+// op(A) the transpose kernel carries a long reduction per thread while
+// the non-transpose kernel streams all of x once per row.  Trivial and
+// small cases are left to singleLevelGemv.
+template<class AViewType>
+bool
+useTwoLevelGemv (const char trans[],
+                 typename AViewType::const_value_type& alpha,
+                 const AViewType& A)
+{
+  typedef typename AViewType::non_const_value_type AlphaCoeffType;
+  const char tr = trans[0];
+  const bool tran = !(tr == 'N' || tr == 'n');
+  const int64_t numRows = A.extent(0);
+  const int64_t numCols = A.extent(1);
+  if (numRows == 0 || numCols == 0 ||
+      alpha == Kokkos::Details::ArithTraits<AlphaCoeffType>::zero ())
+    return false;
+
+  const int64_t numOut = tran ? numCols : numRows;
+  const int64_t numIn  = tran ? numRows : numCols;
+  if (numOut <= impl_gemv_two_level_size::max_split_outputs &&
+      numIn >= 2*impl_gemv_two_level_size::min_split_block)
+    return true;
+  // Otherwise only if x is longer than one tile, whatever trans is.
+  // Smaller problems do not pay for the team launch (nor, for a
+  // transpose of a LayoutRight A, for its strided column access).
+  return numIn > impl_gemv_two_level_size::x_tile;
+}
+
+// Two-level parallel version of GEMV: team-parallel over blocks of
+// rows or columns of A, vector- or team-parallel within them.  The
+// shape of A decides at run time between
+//
+//   - the split kernel for a short y (see TwoLevelSplitGEMV),
+//   - the tiled non-transpose kernel (see TwoLevelNontransposeGEMV),
+//   - the column-blocked transpose kernel (see TwoLevelTransposeGEMV).
+//
+// Requires useTwoLevelGemv (trans, alpha, A) to be true.
+template<class AViewType,
+         class XViewType,
+         class YViewType,
+         class IndexType = typename AViewType::size_type>
+void
+twoLevelGemv (const char trans[],
+              typename AViewType::const_value_type& alpha,
+              const AViewType& A,
+              const XViewType& x,
+              typename YViewType::const_value_type& beta,
+              const YViewType& y)
+{
+  static_assert (Kokkos::Impl::is_view<AViewType>::value,
+                 "AViewType must be a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_view<XViewType>::value,
+                 "XViewType must be a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_view<YViewType>::value,
+                 "YViewType must be a Kokkos::View.");
+  static_assert (std::is_integral<IndexType>::value,
+                 "IndexType must be an integer");
+
+  typedef typename YViewType::non_const_value_type y_value_type;
+  typedef typename AViewType::execution_space execution_space;
+  typedef Kokkos::TeamPolicy<execution_space> team_policy_type;
+  typedef Kokkos::RangePolicy<execution_space, IndexType> range_policy_type;
+
+  const char tr = trans[0];
+  const bool tran = !(tr == 'N' || tr == 'n');
+  const bool conj = (tr == 'C' || tr == 'c' || tr == 'H' || tr == 'h');
+  const IndexType numRows = A.extent(0);
+  const IndexType numCols = A.extent(1);
+  const IndexType numOut = tran ? numCols : numRows;
+  const IndexType numIn  = tran ? numRows : numCols;
+
+  if (numOut <= impl_gemv_two_level_size::max_split_outputs &&
+      numIn >= 2*impl_gemv_two_level_size::min_split_block) {
+    // A few blocks per thread for load balance, but no block shorter
+    // than min_split_block.
+    const int64_t concurrency = execution_space::concurrency ();
+    const int64_t maxBlocks = numIn / impl_gemv_two_level_size::min_split_block;
+    const int64_t numBlocks = (4*concurrency < maxBlocks) ? 4*concurrency : maxBlocks;
+    const IndexType blockSize = (numIn + numBlocks - 1) / numBlocks;
+    const IndexType numTeams = (numIn + blockSize - 1) / blockSize;
+
+    typedef Kokkos::View<y_value_type**, Kokkos::LayoutRight,
+                         typename YViewType::device_type> w_view_type;
+    w_view_type W (Kokkos::ViewAllocateWithoutInitializing ("KokkosBlas::gemv::W"),
+                   numTeams, numOut);
+    if (!tran)
+      Kokkos::parallel_for ("KokkosBlas::gemv[TwoLevelSplit]", team_policy_type (numTeams, Kokkos::AUTO),
+        TwoLevelSplitGEMV<AViewType, XViewType, w_view_type, false, false, IndexType> (blockSize, A, x, W));
+    else if (!conj)
+      Kokkos::parallel_for ("KokkosBlas::gemv[TwoLevelSplit]", team_policy_type (numTeams, Kokkos::AUTO),
+        TwoLevelSplitGEMV<AViewType, XViewType, w_view_type, true, false, IndexType> (blockSize, A, x, W));
+    else
+      Kokkos::parallel_for ("KokkosBlas::gemv[TwoLevelSplit]", team_policy_type (numTeams, Kokkos::AUTO),
+        TwoLevelSplitGEMV<AViewType, XViewType, w_view_type, true, true, IndexType> (blockSize, A, x, W));
+    Kokkos::parallel_for ("KokkosBlas::gemv[TwoLevelSplitFinal]", range_policy_type (0, numOut),
+      GEMVSplitFinal<w_view_type, YViewType, IndexType> (alpha, W, beta, y));
+  }
+  else if (!tran) {
+    const IndexType numTeams = (numRows + impl_gemv_two_level_size::team_rows - 1) / impl_gemv_two_level_size::team_rows;
+    Kokkos::parallel_for ("KokkosBlas::gemv[TwoLevel]", team_policy_type (numTeams, Kokkos::AUTO),
+      TwoLevelNontransposeGEMV<AViewType, XViewType, YViewType, IndexType> (alpha, A, x, beta, y));
+  }
+  else {
+    const IndexType numTeams = (numCols + impl_gemv_two_level_size::team_cols - 1) / impl_gemv_two_level_size::team_cols;
+    if (conj)
+      Kokkos::parallel_for ("KokkosBlas::gemv[TwoLevelTranspose]", team_policy_type (numTeams, Kokkos::AUTO),
+        TwoLevelTransposeGEMV<AViewType, XViewType, YViewType, true, IndexType> (alpha, A, x, beta, y));
+    else
+      Kokkos::parallel_for ("KokkosBlas::gemv[TwoLevelTranspose]", team_policy_type (numTeams, Kokkos::AUTO),
+        TwoLevelTransposeGEMV<AViewType, XViewType, YViewType, false, IndexType> (alpha, A, x, beta, y));
+  }
+}
+
 } // namespace Impl
 } // namespace KokkosBlas
 
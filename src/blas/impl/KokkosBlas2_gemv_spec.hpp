@@ -132,15 +132,27 @@ struct GEMV {
     const size_type numRows = A.extent(0);
     const size_type numCols = A.extent(1);
 
+    // Shapes for which a flat parallel loop over the rows exposes too
+    // little parallelism or reuse go to the two-level kernels.
+    const bool twoLevel = useTwoLevelGemv (trans, alpha, A);
+
     // Prefer int as the index type, but use a larger type if needed.
     if (numRows < static_cast<size_type> (INT_MAX) &&
         numCols < static_cast<size_type> (INT_MAX)) {
-      singleLevelGemv<AViewType, XViewType, YViewType,int>
-         (trans, alpha, A, x, beta, y);
+      if (twoLevel)
+        twoLevelGemv<AViewType, XViewType, YViewType, int>
+           (trans, alpha, A, x, beta, y);
+      else
+        singleLevelGemv<AViewType, XViewType, YViewType,int>
+           (trans, alpha, A, x, beta, y);
     }
     else {
-      singleLevelGemv<AViewType, XViewType, YViewType, int64_t>
-         (trans, alpha, A, x, beta, y);
+      if (twoLevel)
+        twoLevelGemv<AViewType, XViewType, YViewType, int64_t>
+           (trans, alpha, A, x, beta, y);
+      else
+        singleLevelGemv<AViewType, XViewType, YViewType, int64_t>
+           (trans, alpha, A, x, beta, y);
     }
   }
   #else
@@ -0,0 +1,108 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#ifndef KOKKOSBLAS2_GER_IMPL_HPP_
+#define KOKKOSBLAS2_GER_IMPL_HPP_
+
+#include "KokkosKernels_config.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_ArithTraits.hpp"
+
+namespace KokkosBlas {
+namespace Impl {
+
+// Split the flat index k of an entry of an M x N matrix into (i,j), such
+// that consecutive k touch consecutive entries in memory.
+template<class AViewType, class IndexType>
+KOKKOS_INLINE_FUNCTION void
+rank1_update_index (const AViewType& A, const IndexType k, IndexType& i, IndexType& j)
+{
+  if (std::is_same<typename AViewType::array_layout, Kokkos::LayoutRight>::value) {
+    const IndexType N = A.extent(1);
+    i = k / N;
+    j = k % N;
+  }
+  else {
+    const IndexType M = A.extent(0);
+    i = k % M;
+    j = k / M;
+  }
+}
+
+// A := A + alpha*x*y^T (Conj == false) or A + alpha*x*y^H (Conj ==
+// true). One thread updates one entry of A.
+template<class XViewType,
+         class YViewType,
+         class AViewType,
+         const bool Conj,
+         class IndexType = typename AViewType::size_type>
+struct GERFunctor {
+  typedef typename AViewType::non_const_value_type ScalarA;
+  typedef typename YViewType::non_const_value_type ScalarY;
+  typedef Kokkos::Details::ArithTraits<ScalarY> ATY;
+
+  ScalarA alpha;
+  XViewType x;
+  YViewType y;
+  AViewType A;
+
+  GERFunctor (const ScalarA& alpha_, const XViewType& x_,
+              const YViewType& y_, const AViewType& A_) :
+    alpha (alpha_), x (x_), y (y_), A (A_)
+  {
+    static_assert (std::is_integral<IndexType>::value,
+                   "IndexType must be an integer.");
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  operator () (const IndexType& k) const
+  {
+    IndexType i, j;
+    rank1_update_index (A, k, i, j);
+    A(i,j) += alpha * x(i) * (Conj ? ATY::conj (y(j)) : y(j));
+  }
+};
+
+} // namespace Impl
+} // namespace KokkosBlas
+
+#endif // KOKKOSBLAS2_GER_IMPL_HPP_
@@ -0,0 +1,209 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#ifndef KOKKOSBLAS2_GER_SPEC_HPP_
+#define KOKKOSBLAS2_GER_SPEC_HPP_
+
+#include "KokkosKernels_config.h"
+#include "Kokkos_Core.hpp"
+
+#if !defined(KOKKOSKERNELS_ETI_ONLY) || KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+#include<KokkosBlas2_ger_impl.hpp>
+#endif
+
+namespace KokkosBlas {
+namespace Impl {
+// Specialization struct which defines whether a specialization exists
+template<class XVT, class YVT, class AVT>
+struct ger_eti_spec_avail {
+  enum : bool { value = false };
+};
+}
+}
+
+
+//
+// Macro for declaration of full specialization availability
+// KokkosBlas::Impl::GER.  This is NOT for users!!!  All
+// the declarations of full specializations go in this header file.
+// We may spread out definitions (see _INST macro below) across one or
+// more .cpp files.
+//
+#define KOKKOSBLAS2_GER_ETI_SPEC_AVAIL( SCALAR, LAYOUT, EXEC_SPACE, MEM_SPACE ) \
+    template<> \
+    struct ger_eti_spec_avail< \
+         Kokkos::View<const SCALAR*, \
+                      typename std::conditional<std::is_same<LAYOUT,Kokkos::LayoutRight>::value, \
+                                                             Kokkos::LayoutLeft, LAYOUT>::type, \
+                      Kokkos::Device<EXEC_SPACE, MEM_SPACE>, \
+                      Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+         Kokkos::View<const SCALAR*, \
+                      typename std::conditional<std::is_same<LAYOUT,Kokkos::LayoutRight>::value, \
+                                                             Kokkos::LayoutLeft, LAYOUT>::type, \
+                      Kokkos::Device<EXEC_SPACE, MEM_SPACE>, \
+                      Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+         Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>, \
+                      Kokkos::MemoryTraits<Kokkos::Unmanaged> > \
+         > { enum : bool { value = true }; };
+
+// Include the actual specialization declarations
+#include<KokkosBlas2_ger_tpl_spec_avail.hpp>
+#include<generated_specializations_hpp/KokkosBlas2_ger_eti_spec_avail.hpp>
+
+namespace KokkosBlas {
+namespace Impl {
+
+//
+// ger
+//
+
+// Implementation of KokkosBlas::ger.
+template<class XViewType,
+         class YViewType,
+         class AViewType,
+         bool tpl_spec_avail = ger_tpl_spec_avail<XViewType, YViewType, AViewType>::value,
+         bool eti_spec_avail = ger_eti_spec_avail<XViewType, YViewType, AViewType>::value
+         >
+struct GER {
+  static void
+  ger (const char trans[],
+       typename AViewType::const_value_type& alpha,
+       const XViewType& x,
+       const YViewType& y,
+       const AViewType& A)
+#if !defined(KOKKOSKERNELS_ETI_ONLY) || KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+{
+  static_assert (Kokkos::Impl::is_view<XViewType>::value,
+                 "XViewType must be a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_view<YViewType>::value,
+                 "YViewType must be a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_view<AViewType>::value,
+                 "AViewType must be a Kokkos::View.");
+  static_assert (static_cast<int> (XViewType::rank) == 1,
+                 "XViewType must have rank 1.");
+  static_assert (static_cast<int> (YViewType::rank) == 1,
+                 "YViewType must have rank 1.");
+  static_assert (static_cast<int> (AViewType::rank) == 2,
+                 "AViewType must have rank 2.");
+
+  Kokkos::Profiling::pushRegion(eti_spec_avail?"KokkosBlas::ger[ETI]":"KokkosBlas::ger[noETI]");
+  typedef typename AViewType::execution_space execution_space;
+
+  const bool conj = (trans[0]=='H') || (trans[0]=='h') ||
+                    (trans[0]=='C') || (trans[0]=='c');
+  const size_t numEntries = size_t (A.extent(0)) * size_t (A.extent(1));
+
+  // Prefer int as the index type, but use a larger type if needed.
+  if (numEntries < static_cast<size_t> (INT_MAX)) {
+    typedef Kokkos::RangePolicy<execution_space, int> policy_type;
+    if (conj)
+      Kokkos::parallel_for ("KokkosBlas::ger", policy_type (0, numEntries),
+        GERFunctor<XViewType, YViewType, AViewType, true, int> (alpha, x, y, A));
+    else
+      Kokkos::parallel_for ("KokkosBlas::ger", policy_type (0, numEntries),
+        GERFunctor<XViewType, YViewType, AViewType, false, int> (alpha, x, y, A));
+  }
+  else {
+    typedef Kokkos::RangePolicy<execution_space, int64_t> policy_type;
+    if (conj)
+      Kokkos::parallel_for ("KokkosBlas::ger", policy_type (0, numEntries),
+        GERFunctor<XViewType, YViewType, AViewType, true, int64_t> (alpha, x, y, A));
+    else
+      Kokkos::parallel_for ("KokkosBlas::ger", policy_type (0, numEntries),
+        GERFunctor<XViewType, YViewType, AViewType, false, int64_t> (alpha, x, y, A));
+  }
+  Kokkos::Profiling::popRegion();
+}
+#else
+;
+#endif //!defined(KOKKOSKERNELS_ETI_ONLY) || KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+
+};
+
+} // namespace Impl
+} // namespace KokkosBlas
+
+
+//
+// Macro for declaration of full specialization of
+// KokkosBlas::Impl::GER.  This is NOT for users!!!
+// All the declarations of full specializations go in this header
+// file.  We may spread out definitions (see _DEF macro below) across
+// one or more .cpp files.
+//
+
+#define KOKKOSBLAS2_GER_ETI_SPEC_DECL( SCALAR, LAYOUT, EXEC_SPACE, MEM_SPACE ) \
+extern template struct GER< \
+     Kokkos::View<const SCALAR*, \
+                  typename std::conditional<std::is_same<LAYOUT,Kokkos::LayoutRight>::value, \
+                                                         Kokkos::LayoutLeft, LAYOUT>::type, \
+                  Kokkos::Device<EXEC_SPACE, MEM_SPACE>, \
+                  Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+     Kokkos::View<const SCALAR*, \
+                  typename std::conditional<std::is_same<LAYOUT,Kokkos::LayoutRight>::value, \
+                                                         Kokkos::LayoutLeft, LAYOUT>::type, \
+                  Kokkos::Device<EXEC_SPACE, MEM_SPACE>, \
+                  Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+     Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>, \
+                  Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+     false, true>;
+
+#define KOKKOSBLAS2_GER_ETI_SPEC_INST( SCALAR, LAYOUT, EXEC_SPACE, MEM_SPACE ) \
+template struct GER< \
+     Kokkos::View<const SCALAR*, \
+                  typename std::conditional<std::is_same<LAYOUT,Kokkos::LayoutRight>::value, \
+                                                         Kokkos::LayoutLeft, LAYOUT>::type, \
+                  Kokkos::Device<EXEC_SPACE, MEM_SPACE>, \
+                  Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+     Kokkos::View<const SCALAR*, \
+                  typename std::conditional<std::is_same<LAYOUT,Kokkos::LayoutRight>::value, \
+                                                         Kokkos::LayoutLeft, LAYOUT>::type, \
+                  Kokkos::Device<EXEC_SPACE, MEM_SPACE>, \
+                  Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+     Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>, \
+                  Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+     false, true>;
+
+#include<KokkosBlas2_ger_tpl_spec_decl.hpp>
+#include<generated_specializations_hpp/KokkosBlas2_ger_eti_spec_decl.hpp>
+
+#endif // KOKKOSBLAS2_GER_SPEC_HPP_
@@ -0,0 +1,243 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#ifndef KOKKOSBLAS2_SYMV_IMPL_HPP_
+#define KOKKOSBLAS2_SYMV_IMPL_HPP_
+
+#include "KokkosKernels_config.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_ArithTraits.hpp"
+
+namespace KokkosBlas {
+namespace Impl {
+
+// Block size of the blocked symv/hemv kernel.  A team owns this many
+// rows of the stored triangle and sweeps over them in square tiles of
+// this size, which stay in cache while the team uses them twice.
+struct impl_symv_blocked_size {
+  enum : int { block = 64 };
+};
+
+// Blocked symv/hemv for a symmetric (Conj == false) or Hermitian
+// (Conj == true) matrix A of which only the triangle selected by lower
+// is referenced.  Team I owns block row I of the stored triangle, i.e.
+// the tiles A_IJ with J <= I (lower) or J >= I (upper).  Each tile is
+// read once from memory and used for both of its products: the team
+// first reduces its rows into A_IJ x_J, one row per thread, and then its
+// columns into op(A_IJ)^T x_I, one column per thread, where op conjugates
+// for hemv.  The diagonal tile contributes its stored triangle to both,
+// without counting the diagonal twice.
+//
+// W(I,k) is team I's contribution to y(k).  The diagonal tile is
+// processed first, so that it initializes the entries of block row I.
+// SYMVBlockedFinal sums the contributions in a fixed order, so the result
+// does not depend on the schedule.
+template<class AViewType,
+         class XViewType,
+         class WViewType,
+         const bool Conj,
+         class IndexType = typename AViewType::size_type>
+struct BlockedSYMVFunctor {
+  typedef typename AViewType::execution_space execution_space;
+  typedef typename Kokkos::TeamPolicy<execution_space>::member_type member_type;
+  typedef typename AViewType::non_const_value_type ScalarA;
+  typedef typename WViewType::non_const_value_type w_value_type;
+  typedef Kokkos::Details::ArithTraits<ScalarA> ATA;
+
+  BlockedSYMVFunctor (const bool lower, const AViewType& A,
+                      const XViewType& x, const WViewType& W) :
+    lower_ (lower), A_ (A), x_ (x), W_ (W)
+  {
+    static_assert (std::is_integral<IndexType>::value,
+                   "IndexType must be an integer.");
+  }
+
+  // Whether A(i,j) is in the stored triangle
+  KOKKOS_INLINE_FUNCTION
+  bool stored (const IndexType i, const IndexType j) const {
+    return lower_ ? j <= i : j >= i;
+  }
+
+  // A(i,j) from the stored triangle.  The diagonal of a Hermitian
+  // matrix is real.
+  KOKKOS_INLINE_FUNCTION
+  ScalarA a (const IndexType i, const IndexType j) const {
+    return (Conj && i == j) ? ScalarA (ATA::real (A_(i,j))) : A_(i,j);
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  operator () (const member_type& team) const
+  {
+    const IndexType N = A_.extent(0);
+    const IndexType block = impl_symv_blocked_size::block;
+    const IndexType numBlocks = (N + block - 1) / block;
+    const IndexType I = team.league_rank ();
+    const IndexType i_begin = I * block;
+    const IndexType i_end = (i_begin + block < N) ? i_begin + block : N;
+    const IndexType numTiles = lower_ ? I + 1 : numBlocks - I;
+
+    for (IndexType t = 0; t < numTiles; ++t) {
+      // The diagonal tile first, then the others in order.
+      const IndexType J = (t == 0) ? I : (lower_ ? t - 1 : I + t);
+      const bool diag = (J == I);
+      const IndexType j_begin = J * block;
+      const IndexType j_end = (j_begin + block < N) ? j_begin + block : N;
+
+      // Rows of the tile: A_IJ x_J
+      Kokkos::parallel_for (Kokkos::TeamThreadRange (team, i_begin, i_end), [&] (const IndexType& i) {
+        w_value_type Ax_i;
+        Kokkos::parallel_reduce (Kokkos::ThreadVectorRange (team, j_end - j_begin), [&] (const IndexType& jj, w_value_type& val) {
+          const IndexType j = j_begin + jj;
+          if (!diag || stored (i,j))
+            val += a (i,j) * x_(j);
+        }, Ax_i);
+        Kokkos::single (Kokkos::PerThread (team), [&] () {
+          if (diag)
+            W_(I,i) = Ax_i;
+          else
+            W_(I,i) += Ax_i;
+        });
+      });
+      team.team_barrier ();
+
+      // Columns of the tile: op(A_IJ)^T x_I, from the same entries
+      Kokkos::parallel_for (Kokkos::TeamThreadRange (team, j_begin, j_end), [&] (const IndexType& j) {
+        w_value_type Ax_j;
+        Kokkos::parallel_reduce (Kokkos::ThreadVectorRange (team, i_end - i_begin), [&] (const IndexType& ii, w_value_type& val) {
+          const IndexType i = i_begin + ii;
+          if (!diag || (i != j && stored (i,j)))
+            val += (Conj ? ATA::conj (A_(i,j)) : A_(i,j)) * x_(i);
+        }, Ax_j);
+        Kokkos::single (Kokkos::PerThread (team), [&] () {
+          if (diag)
+            W_(I,j) += Ax_j;
+          else
+            W_(I,j) = Ax_j;
+        });
+      });
+      team.team_barrier ();
+    }
+  }
+
+private:
+  bool lower_;
+  typename AViewType::const_type A_;
+  typename XViewType::const_type x_;
+  WViewType W_;
+};
+
+// y = beta*y + alpha*(sum of the contributions of BlockedSYMVFunctor).
+// Entry k of block K gets contributions from the block rows I >= K
+// (lower) or I <= K (upper) only; the other entries of W are not set.
+template<class WViewType,
+         class YViewType,
+         class IndexType = typename YViewType::size_type>
+struct SYMVBlockedFinal {
+  typedef typename YViewType::non_const_value_type y_value_type;
+  typedef Kokkos::Details::ArithTraits<y_value_type> ATY;
+
+  bool lower_;
+  y_value_type alpha_;
+  y_value_type beta_;
+  typename WViewType::const_type W_;
+  YViewType y_;
+
+  SYMVBlockedFinal (const bool lower, const y_value_type& alpha, const WViewType& W,
+                    const y_value_type& beta, const YViewType& y) :
+    lower_ (lower), alpha_ (alpha), beta_ (beta), W_ (W), y_ (y) {}
+
+  KOKKOS_INLINE_FUNCTION void
+  operator () (const IndexType& k) const
+  {
+    const IndexType K = k / impl_symv_blocked_size::block;
+    const IndexType I_begin = lower_ ? K : 0;
+    const IndexType I_end = lower_ ? static_cast<IndexType> (W_.extent(0)) : K + 1;
+    y_value_type Ax_k = ATY::zero ();
+    for (IndexType I = I_begin; I < I_end; ++I)
+      Ax_k += W_(I,k);
+
+    // Don't read y if beta is zero, it may contain NaNs
+    y_(k) = (beta_ == ATY::zero () ? ATY::zero () : beta_ * y_(k)) + alpha_ * Ax_k;
+  }
+};
+
+// y := beta*y + alpha*A*x with BlockedSYMVFunctor and SYMVBlockedFinal.
+// The workspace W has one row per block row of A, i.e. N^2/block
+// entries, a small fraction of the N^2/2 entries of the stored triangle.
+template<class AViewType,
+         class XViewType,
+         class YViewType,
+         class IndexType>
+void
+blockedSymv (const bool lower,
+             const bool hermitian,
+             typename AViewType::const_value_type& alpha,
+             const AViewType& A,
+             const XViewType& x,
+             typename YViewType::const_value_type& beta,
+             const YViewType& y)
+{
+  typedef typename YViewType::non_const_value_type y_value_type;
+  typedef typename AViewType::execution_space execution_space;
+  typedef Kokkos::TeamPolicy<execution_space> team_policy_type;
+  typedef Kokkos::RangePolicy<execution_space, IndexType> range_policy_type;
+  typedef Kokkos::View<y_value_type**, Kokkos::LayoutRight,
+                       typename YViewType::device_type> w_view_type;
+
+  const IndexType N = A.extent(0);
+  const IndexType numBlocks = (N + impl_symv_blocked_size::block - 1) / impl_symv_blocked_size::block;
+  w_view_type W (Kokkos::ViewAllocateWithoutInitializing ("KokkosBlas::symv::W"), numBlocks, N);
+
+  if (hermitian)
+    Kokkos::parallel_for ("KokkosBlas::hemv[Blocked]", team_policy_type (numBlocks, Kokkos::AUTO),
+      BlockedSYMVFunctor<AViewType, XViewType, w_view_type, true, IndexType> (lower, A, x, W));
+  else
+    Kokkos::parallel_for ("KokkosBlas::symv[Blocked]", team_policy_type (numBlocks, Kokkos::AUTO),
+      BlockedSYMVFunctor<AViewType, XViewType, w_view_type, false, IndexType> (lower, A, x, W));
+  Kokkos::parallel_for ("KokkosBlas::symv[BlockedFinal]", range_policy_type (0, N),
+    SYMVBlockedFinal<w_view_type, YViewType, IndexType> (lower, alpha, W, beta, y));
+}
+
+} // namespace Impl
+} // namespace KokkosBlas
+
+#endif // KOKKOSBLAS2_SYMV_IMPL_HPP_
@@ -0,0 +1,116 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#ifndef KOKKOSBLAS2_SYR_IMPL_HPP_
+#define KOKKOSBLAS2_SYR_IMPL_HPP_
+
+#include "KokkosKernels_config.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_ArithTraits.hpp"
+#include "KokkosBlas2_ger_impl.hpp"
+
+namespace KokkosBlas {
+namespace Impl {
+
+// Symmetric (Conj == false) or Hermitian (Conj == true) rank-1 and
+// rank-2 updates of the triangle of A selected by lower:
+//
+//   Rank2 == false:  A := A + alpha*x*op(x)
+//   Rank2 == true:   A := A + alpha*x*op(y) + op(alpha)*y*op(x)
+//
+// with op(z) = z^T or z^H. One thread updates one entry of A; entries
+// outside of the triangle are neither read nor written. For Hermitian
+// updates the imaginary part of the diagonal is set to zero, as in the
+// BLAS.
+template<class XViewType,
+         class YViewType,
+         class AViewType,
+         const bool Rank2,
+         const bool Conj,
+         class IndexType = typename AViewType::size_type>
+struct SYRFunctor {
+  typedef typename AViewType::non_const_value_type ScalarA;
+  typedef Kokkos::Details::ArithTraits<ScalarA> ATA;
+
+  bool lower;
+  ScalarA alpha;
+  XViewType x;
+  YViewType y;
+  AViewType A;
+
+  SYRFunctor (const bool lower_, const ScalarA& alpha_, const XViewType& x_,
+              const YViewType& y_, const AViewType& A_) :
+    lower (lower_), alpha (alpha_), x (x_), y (y_), A (A_)
+  {
+    static_assert (std::is_integral<IndexType>::value,
+                   "IndexType must be an integer.");
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  ScalarA conj (const ScalarA& a) const {
+    return Conj ? ATA::conj (a) : a;
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  operator () (const IndexType& k) const
+  {
+    IndexType i, j;
+    rank1_update_index (A, k, i, j);
+    if (lower ? (j > i) : (j < i))
+      return;
+
+    ScalarA A_ij = A(i,j);
+    if (Rank2)
+      A_ij += alpha * ScalarA (x(i)) * conj (ScalarA (y(j)))
+            + conj (alpha) * ScalarA (y(i)) * conj (ScalarA (x(j)));
+    else
+      A_ij += alpha * ScalarA (x(i)) * conj (ScalarA (x(j)));
+    if (Conj && (i == j))
+      A_ij = ATA::real (A_ij);
+    A(i,j) = A_ij;
+  }
+};
+
+} // namespace Impl
+} // namespace KokkosBlas
+
+#endif // KOKKOSBLAS2_SYR_IMPL_HPP_
@@ -0,0 +1,105 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#ifndef KOKKOSBLAS2_TEAM_SYR_SPEC_HPP_
+#define KOKKOSBLAS2_TEAM_SYR_SPEC_HPP_
+
+#include <KokkosKernels_config.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ArithTraits.hpp>
+
+namespace KokkosBlas {
+namespace Experimental {
+namespace Impl {
+
+template<class XV, class YV, class MT, bool Rank2, bool Conj>
+struct team_syr_tpl_spec_avail {
+  constexpr static bool value = false;
+};
+
+// Unification and Specialization layer
+template<class TeamType, class XVector, class YVector, class MatrixType, bool Rank2, bool Conj,
+         bool tpl_spec_avail = team_syr_tpl_spec_avail<XVector,YVector,MatrixType,Rank2,Conj>::value>
+struct TeamSYR {
+  static KOKKOS_INLINE_FUNCTION void team_syr (const TeamType& team, const bool lower,
+      const typename MatrixType::non_const_value_type& alpha,
+      const XVector& x, const YVector& y, const MatrixType& A);
+};
+
+// Only the entries of the triangle selected by lower are updated. If
+// Rank2 is false, y is not referenced.
+template<class TeamType, class XVector, class YVector, class MatrixType, bool Rank2, bool Conj>
+struct TeamSYR<TeamType, XVector, YVector, MatrixType, Rank2, Conj, false>
+{
+  typedef typename MatrixType::non_const_value_type value_type;
+  typedef Kokkos::Details::ArithTraits<value_type> ATA;
+  static KOKKOS_INLINE_FUNCTION value_type conj (const value_type& a) {
+    return Conj ? ATA::conj(a) : a;
+  }
+  static KOKKOS_INLINE_FUNCTION void team_syr (const TeamType& team, const bool lower,
+      const typename MatrixType::non_const_value_type& alpha,
+      const XVector& x, const YVector& y, const MatrixType& A) {
+    const int N = A.extent(0);
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team,N), [&] (const int& i) {
+      const value_type alpha_x_i = alpha * x(i);
+      const value_type alpha_y_i = Rank2 ? conj(alpha) * y(i) : ATA::zero();
+      const int j_beg = lower ? 0 : i;
+      const int j_end = lower ? i+1 : N;
+      Kokkos::parallel_for(Kokkos::ThreadVectorRange(team,j_end-j_beg), [&] (const int& jj) {
+        const int j = j_beg + jj;
+        value_type A_ij = A(i,j);
+        if (Rank2)
+          A_ij += alpha_x_i * conj(y(j)) + alpha_y_i * conj(x(j));
+        else
+          A_ij += alpha_x_i * conj(x(j));
+        A(i,j) = (Conj && i == j) ? value_type(ATA::real(A_ij)) : A_ij;
+      });
+    });
+  }
+};
+
+}
+}
+}
+
+#endif
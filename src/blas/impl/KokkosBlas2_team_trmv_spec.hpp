@@ -0,0 +1,108 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#ifndef KOKKOSBLAS2_TEAM_TRMV_SPEC_HPP_
+#define KOKKOSBLAS2_TEAM_TRMV_SPEC_HPP_
+
+#include <KokkosKernels_config.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ArithTraits.hpp>
+#include <Kokkos_InnerProductSpaceTraits.hpp>
+
+namespace KokkosBlas {
+namespace Experimental {
+namespace Impl {
+
+template<class MT, class XV>
+struct team_trmv_tpl_spec_avail {
+  constexpr static bool value = false;
+};
+
+// Unification and Specialization layer
+template<class TeamType, class MatrixType, class XVector,
+         bool tpl_spec_avail = team_trmv_tpl_spec_avail<MatrixType,XVector>::value>
+struct TeamTRMV {
+  static KOKKOS_INLINE_FUNCTION void team_trmv (const TeamType& team,
+      const bool lower, const bool trans, const bool conj, const bool unit,
+      const MatrixType& A, const XVector& x);
+};
+
+// x = op(A)*x in place, without workspace. Row i of op(A)*x only needs
+// x(j) for j on one side of i, so the rows are computed one after the
+// other in an order where x(i) is no longer needed once it is
+// overwritten: ascending if op(A) is upper, descending if it is lower.
+// Each row is a team reduction, whose result is known to all threads
+// of the team only after all of them are done reading x.
+template<class TeamType, class MatrixType, class XVector>
+struct TeamTRMV<TeamType, MatrixType, XVector, false>
+{
+  typedef typename MatrixType::non_const_value_type value_type;
+  typedef Kokkos::Details::ArithTraits<value_type> ATA;
+  typedef typename Kokkos::Details::InnerProductSpaceTraits<value_type>::dot_type dot_type;
+  static KOKKOS_INLINE_FUNCTION void team_trmv (const TeamType& team,
+      const bool lower, const bool trans, const bool conj, const bool unit,
+      const MatrixType& A, const XVector& x) {
+    const int N = A.extent(0);
+    const bool op_lower = (lower != trans);
+
+    for (int k = 0; k < N; ++k) {
+      const int i = op_lower ? N-1-k : k;
+      const int j_beg = op_lower ? 0 : i + (unit ? 1 : 0);
+      const int j_end = op_lower ? i + (unit ? 0 : 1) : N;
+      dot_type Ax_i;
+      Kokkos::parallel_reduce(Kokkos::TeamThreadRange(team,j_beg,j_end), [&] (const int& j, dot_type& val ) {
+        const value_type A_ij = trans ? (conj ? ATA::conj(A(j,i)) : A(j,i)) : A(i,j);
+        val += A_ij * x(j);
+      },Ax_i);
+      Kokkos::single(Kokkos::PerTeam(team), [&] () {
+        x(i) = unit ? x(i) + Ax_i : value_type(Ax_i);
+      });
+      team.team_barrier();
+    }
+  }
+};
+
+}
+}
+}
+
+#endif
@@ -0,0 +1,106 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#ifndef KOKKOSBLAS2_TRMV_IMPL_HPP_
+#define KOKKOSBLAS2_TRMV_IMPL_HPP_
+
+#include "KokkosKernels_config.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_ArithTraits.hpp"
+
+namespace KokkosBlas {
+namespace Impl {
+
+// x := op(A)*x for a triangular matrix A. Since every entry of x may be
+// needed by several rows, the functor reads a copy x_in of the input
+// vector and writes the result to x_out. One thread computes one entry,
+// only the triangle of A selected by lower is referenced.
+template<class AViewType,
+         class XInViewType,
+         class XOutViewType,
+         class IndexType = typename AViewType::size_type>
+struct TRMVFunctor {
+  typedef typename AViewType::non_const_value_type ScalarA;
+  typedef typename XOutViewType::non_const_value_type ScalarX;
+  typedef Kokkos::Details::ArithTraits<ScalarA> ATA;
+
+  bool lower, trans, conj, unit;
+  AViewType A;
+  XInViewType x_in;
+  XOutViewType x_out;
+
+  TRMVFunctor (const bool lower_, const bool trans_, const bool conj_, const bool unit_,
+               const AViewType& A_, const XInViewType& x_in_, const XOutViewType& x_out_) :
+    lower (lower_), trans (trans_), conj (conj_), unit (unit_),
+    A (A_), x_in (x_in_), x_out (x_out_)
+  {
+    static_assert (std::is_integral<IndexType>::value,
+                   "IndexType must be an integer.");
+  }
+
+  // Entry (i,j) of op(A)
+  KOKKOS_INLINE_FUNCTION
+  ScalarA op_A (const IndexType i, const IndexType j) const {
+    if (!trans) return A(i,j);
+    return conj ? ATA::conj (A(j,i)) : A(j,i);
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  operator () (const IndexType& i) const
+  {
+    // op(A) is lower triangular if A is lower and not transposed, or
+    // upper and transposed.
+    const bool op_lower = (lower != trans);
+    const IndexType j_begin = op_lower ? 0 : i+1;
+    const IndexType j_end   = op_lower ? i : static_cast<IndexType> (A.extent(1));
+
+    ScalarX x_i = unit ? ScalarX (x_in(i)) : ScalarX (op_A (i,i) * x_in(i));
+    for (IndexType j = j_begin; j < j_end; ++j)
+      x_i += op_A (i,j) * x_in(j);
+    x_out(i) = x_i;
+  }
+};
+
+} // namespace Impl
+} // namespace KokkosBlas
+
+#endif // KOKKOSBLAS2_TRMV_IMPL_HPP_
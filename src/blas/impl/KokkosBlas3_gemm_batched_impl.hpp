@@ -0,0 +1,176 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#ifndef KOKKOS_BLAS3_GEMM_BATCHED_IMPL_HPP_
+#define KOKKOS_BLAS3_GEMM_BATCHED_IMPL_HPP_
+
+#include<Kokkos_Core.hpp>
+#include<Kokkos_ArithTraits.hpp>
+#include<KokkosBatched_Util.hpp>
+#include<KokkosBatched_Gemm_Decl.hpp>
+#include<KokkosBatched_Gemm_Serial_Impl.hpp>
+#include<KokkosBatched_Gemm_Team_Impl.hpp>
+
+namespace KokkosBlas {
+namespace Impl {
+
+// Batched gemm on rank-3 views (batch x rows x cols):
+//   C(l,:,:) = beta*C(l,:,:) + alpha*op(A(l,:,:))*op(B(l,:,:))
+//
+// Small matrices are computed one per thread with KokkosBatched::SerialGemm,
+// medium ones one per team with KokkosBatched::TeamGemm.  Large matrices are
+// handled by the caller with the rank-2 gemm on each slice.
+struct impl_gemm_batched_size {
+  // Largest dimension up to which a matrix is computed by a single thread.
+  enum : int { serial_max = 16 };
+  // Smallest dimension from which the rank-2 blocked gemm is used.
+  enum : int { blocked_min = 256 };
+};
+
+template<class ArgTransA, class ArgTransB,
+         class AViewType, class BViewType, class CViewType>
+struct GEMMBatchedSerialFunctor {
+  typedef typename CViewType::non_const_value_type ScalarC;
+
+  ScalarC alpha, beta;
+  AViewType A;
+  BViewType B;
+  CViewType C;
+
+  GEMMBatchedSerialFunctor(const ScalarC& alpha_, const AViewType& A_, const BViewType& B_,
+                           const ScalarC& beta_, const CViewType& C_):
+    alpha(alpha_),beta(beta_),A(A_),B(B_),C(C_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const int l) const {
+    auto Al = Kokkos::subview(A,l,Kokkos::ALL(),Kokkos::ALL());
+    auto Bl = Kokkos::subview(B,l,Kokkos::ALL(),Kokkos::ALL());
+    auto Cl = Kokkos::subview(C,l,Kokkos::ALL(),Kokkos::ALL());
+    KokkosBatched::Experimental::SerialGemm<ArgTransA,ArgTransB,
+      KokkosBatched::Experimental::Algo::Gemm::Blocked>::invoke(alpha,Al,Bl,beta,Cl);
+  }
+};
+
+template<class ExecSpace, class ArgTransA, class ArgTransB,
+         class AViewType, class BViewType, class CViewType>
+struct GEMMBatchedTeamFunctor {
+  typedef typename CViewType::non_const_value_type ScalarC;
+  typedef typename Kokkos::TeamPolicy<ExecSpace>::member_type member_type;
+
+  ScalarC alpha, beta;
+  AViewType A;
+  BViewType B;
+  CViewType C;
+
+  GEMMBatchedTeamFunctor(const ScalarC& alpha_, const AViewType& A_, const BViewType& B_,
+                         const ScalarC& beta_, const CViewType& C_):
+    alpha(alpha_),beta(beta_),A(A_),B(B_),C(C_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const member_type& member) const {
+    const int l = member.league_rank();
+    auto Al = Kokkos::subview(A,l,Kokkos::ALL(),Kokkos::ALL());
+    auto Bl = Kokkos::subview(B,l,Kokkos::ALL(),Kokkos::ALL());
+    auto Cl = Kokkos::subview(C,l,Kokkos::ALL(),Kokkos::ALL());
+    KokkosBatched::Experimental::TeamGemm<member_type,ArgTransA,ArgTransB,
+      KokkosBatched::Experimental::Algo::Gemm::Blocked>::invoke(member,alpha,Al,Bl,beta,Cl);
+  }
+};
+
+template<class AViewType, class BViewType, class CViewType>
+struct GEMMBatched {
+  typedef typename CViewType::execution_space ExecSpace;
+  typedef typename CViewType::non_const_value_type ScalarC;
+
+  template<class ArgTransA, class ArgTransB>
+  static void run(const bool use_team,
+                  const ScalarC& alpha, const AViewType& A, const BViewType& B,
+                  const ScalarC& beta, const CViewType& C) {
+    const int batch = C.extent_int(0);
+    if(use_team) {
+      GEMMBatchedTeamFunctor<ExecSpace,ArgTransA,ArgTransB,AViewType,BViewType,CViewType> functor(alpha,A,B,beta,C);
+      Kokkos::parallel_for("KokkosBlas::gemm[batched,team]",
+                           Kokkos::TeamPolicy<ExecSpace>(batch,Kokkos::AUTO),functor);
+    } else {
+      GEMMBatchedSerialFunctor<ArgTransA,ArgTransB,AViewType,BViewType,CViewType> functor(alpha,A,B,beta,C);
+      Kokkos::parallel_for("KokkosBlas::gemm[batched,serial]",
+                           Kokkos::RangePolicy<ExecSpace>(0,batch),functor);
+    }
+  }
+
+  template<class ArgTransA>
+  static void run(const char transB[], const bool use_team,
+                  const ScalarC& alpha, const AViewType& A, const BViewType& B,
+                  const ScalarC& beta, const CViewType& C) {
+    if(transB[0]=='N' || transB[0]=='n')
+      run<ArgTransA,KokkosBatched::Experimental::Trans::NoTranspose>(use_team,alpha,A,B,beta,C);
+    else
+      run<ArgTransA,KokkosBatched::Experimental::Trans::Transpose>(use_team,alpha,A,B,beta,C);
+  }
+
+  // Conjugate transpose is only supported for real scalars, where it is a transpose.
+  static void gemm(const char transA[], const char transB[],
+                   const ScalarC& alpha, const AViewType& A, const BViewType& B,
+                   const ScalarC& beta, const CViewType& C) {
+    const bool conjA = transA[0]=='C' || transA[0]=='c';
+    const bool conjB = transB[0]=='C' || transB[0]=='c';
+    if((conjA && Kokkos::Details::ArithTraits<typename AViewType::non_const_value_type>::is_complex) ||
+       (conjB && Kokkos::Details::ArithTraits<typename BViewType::non_const_value_type>::is_complex)) {
+      Kokkos::Impl::throw_runtime_exception("KokkosBlas::gemm: conjugate transpose of complex rank-3 views is only supported for large LayoutRight matrices.");
+    }
+
+    const int m = C.extent_int(1);
+    const int n = C.extent_int(2);
+    const int k = (transA[0]=='N' || transA[0]=='n') ? A.extent_int(2) : A.extent_int(1);
+    const int max_dim = m > n ? (m > k ? m : k) : (n > k ? n : k);
+    const bool use_team = max_dim > impl_gemm_batched_size::serial_max;
+
+    if(transA[0]=='N' || transA[0]=='n')
+      run<KokkosBatched::Experimental::Trans::NoTranspose>(transB,use_team,alpha,A,B,beta,C);
+    else
+      run<KokkosBatched::Experimental::Trans::Transpose>(transB,use_team,alpha,A,B,beta,C);
+  }
+};
+
+}
+}
+#endif
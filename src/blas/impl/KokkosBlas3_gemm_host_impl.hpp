@@ -0,0 +1,506 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#ifndef KOKKOS_BLAS3_GEMM_HOST_IMPL_HPP_
+#define KOKKOS_BLAS3_GEMM_HOST_IMPL_HPP_
+
+#include<Kokkos_Core.hpp>
+#include<Kokkos_ArithTraits.hpp>
+#include<KokkosBatched_Vector.hpp>
+
+#if !defined(__CUDA_ARCH__) && (defined(__AVX512F__) || defined(__AVX__) || defined(__AVX2__))
+#include<immintrin.h>
+#endif
+
+// Cache sizes (in bytes) used to derive the blocking of the host GEMM.
+// They can be overridden at configure time for a particular machine.
+#ifndef KOKKOSBLAS3_GEMM_HOST_L1_CACHE_SIZE
+#define KOKKOSBLAS3_GEMM_HOST_L1_CACHE_SIZE 32768
+#endif
+#ifndef KOKKOSBLAS3_GEMM_HOST_L2_CACHE_SIZE
+#if defined(__AVX512F__)
+#define KOKKOSBLAS3_GEMM_HOST_L2_CACHE_SIZE 1048576
+#else
+#define KOKKOSBLAS3_GEMM_HOST_L2_CACHE_SIZE 262144
+#endif
+#endif
+#ifndef KOKKOSBLAS3_GEMM_HOST_L3_CACHE_SIZE
+#define KOKKOSBLAS3_GEMM_HOST_L3_CACHE_SIZE 4194304
+#endif
+
+namespace KokkosBlas {
+namespace Impl {
+
+// Packed, cache-blocked GEMM for host execution spaces (GotoBLAS/BLIS scheme):
+//
+//   for jc in N step nc           B panel   (kc x nc) lives in L3
+//     for pc in K step kc         pack B panel, shared by all threads
+//       for ic in M step mc       A block   (mc x kc) lives in L2, packed once
+//                                 and shared by the threads splitting the jr loop
+//         for jr in nc step nr    B sliver  (kc x nr) lives in L1
+//           for ir in mc step mr  micro-kernel: mr x nr block of C in registers
+//
+// Packed A stores mr-row slivers with the mr entries of a column contiguous,
+// packed B stores nr-column slivers with the nr entries of a row contiguous,
+// so that the micro-kernel streams both with unit stride.  Edges are padded
+// with zeros and only the valid part of a micro tile is written back to C.
+
+// Whether the packed host kernel should be used for this execution space.
+template<class ExecSpace>
+struct impl_gemm_host_kernel_avail {
+  enum : bool { value = true };
+};
+
+#ifdef KOKKOS_ENABLE_CUDA
+template<>
+struct impl_gemm_host_kernel_avail<Kokkos::Cuda> {
+  enum : bool { value = false };
+};
+#endif
+#ifdef KOKKOS_ENABLE_ROCM
+template<>
+struct impl_gemm_host_kernel_avail<Kokkos::ROCm> {
+  enum : bool { value = false };
+};
+#endif
+
+// Register and cache blocking.  mr spans two SIMD registers of the host
+// vector length, nr is chosen so that the mr x nr accumulators fit into
+// the register file (32 zmm for AVX512, 16 ymm for AVX/AVX2).
+template<class ScalarA, class ScalarB, class ScalarC>
+struct impl_gemm_host_blocking {
+  enum : int {
+    vector_length = KokkosBatched::Experimental::DefaultVectorLength<ScalarC,Kokkos::HostSpace>::value,
+#if defined(__AVX512F__)
+    nr = 8,
+#elif defined(__AVX__) || defined(__AVX2__)
+    nr = 6,
+#else
+    nr = 4,
+#endif
+    mr = 2*vector_length,
+
+    // B sliver (kc x nr) takes half of L1, A block (mc x kc) half of L2
+    // and B panel (kc x nc) half of L3.
+    kc_l1 = (KOKKOSBLAS3_GEMM_HOST_L1_CACHE_SIZE/2)/(nr*int(sizeof(ScalarB))),
+    kc = kc_l1 < 64 ? 64 : kc_l1 > 512 ? 512 : kc_l1,
+    mc_l2 = ((KOKKOSBLAS3_GEMM_HOST_L2_CACHE_SIZE/2)/(kc*int(sizeof(ScalarA))))/mr*mr,
+    mc = mc_l2 < mr ? mr : mc_l2,
+    nc_l3 = ((KOKKOSBLAS3_GEMM_HOST_L3_CACHE_SIZE/2)/(kc*int(sizeof(ScalarB))))/nr*nr,
+    nc = nc_l3 < nr ? nr : nc_l3
+  };
+};
+
+// Access op(A)(i,j) for op = none (0), transpose (1) or conjugate transpose (2).
+template<int Transpose>
+struct impl_gemm_host_op;
+
+template<>
+struct impl_gemm_host_op<0> {
+  template<class ViewType>
+  KOKKOS_INLINE_FUNCTION
+  static typename ViewType::non_const_value_type get(const ViewType& A, const int i, const int j) { return A(i,j); }
+};
+template<>
+struct impl_gemm_host_op<1> {
+  template<class ViewType>
+  KOKKOS_INLINE_FUNCTION
+  static typename ViewType::non_const_value_type get(const ViewType& A, const int i, const int j) { return A(j,i); }
+};
+template<>
+struct impl_gemm_host_op<2> {
+  template<class ViewType>
+  KOKKOS_INLINE_FUNCTION
+  static typename ViewType::non_const_value_type get(const ViewType& A, const int i, const int j) {
+    return Kokkos::Details::ArithTraits<typename ViewType::non_const_value_type>::conj(A(j,i));
+  }
+};
+
+// Micro-kernel: ab(0:mr,0:nr) = sum_p a(0:mr,p) b(p,0:nr), with ab column major.
+// The generic version relies on the compiler to keep the accumulators in
+// registers and vectorize along mr.
+template<class ScalarA, class ScalarB, class ScalarC, int mr, int nr>
+struct impl_gemm_host_micro_kernel {
+  KOKKOS_INLINE_FUNCTION
+  static void invoke(const int kc,
+                     const ScalarA* KOKKOS_RESTRICT a,
+                     const ScalarB* KOKKOS_RESTRICT b,
+                     ScalarC* KOKKOS_RESTRICT ab) {
+    ScalarC c[mr*nr];
+    for(int k=0;k<mr*nr;++k)
+      c[k] = Kokkos::Details::ArithTraits<ScalarC>::zero();
+
+    for(int p=0;p<kc;++p) {
+      for(int j=0;j<nr;++j) {
+        const ScalarB b_pj = b[j];
+#if defined(KOKKOS_ENABLE_PRAGMA_IVDEP)
+#pragma ivdep
+#endif
+#if defined(KOKKOS_ENABLE_PRAGMA_VECTOR)
+#pragma vector always
+#endif
+        for(int i=0;i<mr;++i)
+          c[j*mr+i] += a[i]*b_pj;
+      }
+      a += mr;
+      b += nr;
+    }
+
+    for(int k=0;k<mr*nr;++k)
+      ab[k] = c[k];
+  }
+};
+
+#if !defined(__CUDA_ARCH__) && defined(__AVX512F__)
+// AVX512 double: 16 x 8 block held in 16 zmm registers.
+template<>
+struct impl_gemm_host_micro_kernel<double,double,double,16,8> {
+  inline
+  static void invoke(const int kc,
+                     const double* KOKKOS_RESTRICT a,
+                     const double* KOKKOS_RESTRICT b,
+                     double* KOKKOS_RESTRICT ab) {
+    __m512d c0[8], c1[8];
+    for(int j=0;j<8;++j) {
+      c0[j] = _mm512_setzero_pd();
+      c1[j] = _mm512_setzero_pd();
+    }
+    for(int p=0;p<kc;++p) {
+      const __m512d a0 = _mm512_loadu_pd(a);
+      const __m512d a1 = _mm512_loadu_pd(a+8);
+      for(int j=0;j<8;++j) {
+        const __m512d b_pj = _mm512_set1_pd(b[j]);
+        c0[j] = _mm512_fmadd_pd(a0, b_pj, c0[j]);
+        c1[j] = _mm512_fmadd_pd(a1, b_pj, c1[j]);
+      }
+      a += 16;
+      b += 8;
+    }
+    for(int j=0;j<8;++j) {
+      _mm512_storeu_pd(ab+j*16,   c0[j]);
+      _mm512_storeu_pd(ab+j*16+8, c1[j]);
+    }
+  }
+};
+
+// AVX512 float: 32 x 8 block held in 16 zmm registers.
+template<>
+struct impl_gemm_host_micro_kernel<float,float,float,32,8> {
+  inline
+  static void invoke(const int kc,
+                     const float* KOKKOS_RESTRICT a,
+                     const float* KOKKOS_RESTRICT b,
+                     float* KOKKOS_RESTRICT ab) {
+    __m512 c0[8], c1[8];
+    for(int j=0;j<8;++j) {
+      c0[j] = _mm512_setzero_ps();
+      c1[j] = _mm512_setzero_ps();
+    }
+    for(int p=0;p<kc;++p) {
+      const __m512 a0 = _mm512_loadu_ps(a);
+      const __m512 a1 = _mm512_loadu_ps(a+16);
+      for(int j=0;j<8;++j) {
+        const __m512 b_pj = _mm512_set1_ps(b[j]);
+        c0[j] = _mm512_fmadd_ps(a0, b_pj, c0[j]);
+        c1[j] = _mm512_fmadd_ps(a1, b_pj, c1[j]);
+      }
+      a += 32;
+      b += 8;
+    }
+    for(int j=0;j<8;++j) {
+      _mm512_storeu_ps(ab+j*32,    c0[j]);
+      _mm512_storeu_ps(ab+j*32+16, c1[j]);
+    }
+  }
+};
+#endif
+
+#if !defined(__CUDA_ARCH__) && !defined(__AVX512F__) && defined(__AVX2__) && defined(__FMA__)
+// AVX2 double: 8 x 6 block held in 12 ymm registers.
+template<>
+struct impl_gemm_host_micro_kernel<double,double,double,8,6> {
+  inline
+  static void invoke(const int kc,
+                     const double* KOKKOS_RESTRICT a,
+                     const double* KOKKOS_RESTRICT b,
+                     double* KOKKOS_RESTRICT ab) {
+    __m256d c0[6], c1[6];
+    for(int j=0;j<6;++j) {
+      c0[j] = _mm256_setzero_pd();
+      c1[j] = _mm256_setzero_pd();
+    }
+    for(int p=0;p<kc;++p) {
+      const __m256d a0 = _mm256_loadu_pd(a);
+      const __m256d a1 = _mm256_loadu_pd(a+4);
+      for(int j=0;j<6;++j) {
+        const __m256d b_pj = _mm256_broadcast_sd(b+j);
+        c0[j] = _mm256_fmadd_pd(a0, b_pj, c0[j]);
+        c1[j] = _mm256_fmadd_pd(a1, b_pj, c1[j]);
+      }
+      a += 8;
+      b += 6;
+    }
+    for(int j=0;j<6;++j) {
+      _mm256_storeu_pd(ab+j*8,   c0[j]);
+      _mm256_storeu_pd(ab+j*8+4, c1[j]);
+    }
+  }
+};
+#endif
+
+template<class ExecSpace, class ViewTypeA, class ViewTypeB, class ViewTypeC,
+         int TransposeA, int TransposeB>
+struct GEMMHostImpl {
+  typedef typename ViewTypeA::non_const_value_type ScalarA;
+  typedef typename ViewTypeB::non_const_value_type ScalarB;
+  typedef typename ViewTypeC::non_const_value_type ScalarC;
+  typedef Kokkos::Details::ArithTraits<ScalarC> ATC;
+
+  typedef impl_gemm_host_blocking<ScalarA,ScalarB,ScalarC> blocking;
+  enum : int { mr = blocking::mr,
+               nr = blocking::nr,
+               kc = blocking::kc,
+               mc = blocking::mc,
+               nc = blocking::nc };
+
+  typedef Kokkos::View<ScalarA*,typename ExecSpace::memory_space> PackedAViewType;
+  typedef Kokkos::View<ScalarB*,typename ExecSpace::memory_space> PackedBViewType;
+
+  struct PackATag {};
+  struct PackBTag {};
+  struct ScaleCTag {};
+
+  ViewTypeA A;
+  ViewTypeB B;
+  ViewTypeC C;
+  ScalarC alpha, beta;
+  int M, N, K;
+
+  PackedAViewType A_packed;
+  PackedBViewType B_packed;
+
+  // Current jc/pc block and batch of ic blocks, set by run() before each launch.
+  int jc, nb, pc, kb, ic_first;
+  int num_ic_blocks, num_jr_groups, panels_per_group;
+  ScalarC beta_block;
+
+  GEMMHostImpl(const ScalarC& alpha_, const ViewTypeA& A_, const ViewTypeB& B_, const ScalarC& beta_, const ViewTypeC& C_):
+    A(A_),B(B_),C(C_),alpha(alpha_),beta(beta_),
+    M(C_.extent_int(0)),N(C_.extent_int(1)),K(TransposeA>0?A_.extent_int(0):A_.extent_int(1)),
+    jc(0),nb(0),pc(0),kb(0),ic_first(0),num_ic_blocks(0),num_jr_groups(1),panels_per_group(0),beta_block(beta_) {}
+
+  void run() {
+    if(M==0 || N==0) return;
+    if(K==0 || alpha==ATC::zero()) {
+      Kokkos::parallel_for("KokkosBlas::gemm[host,scale]",
+                           Kokkos::RangePolicy<ExecSpace,ScaleCTag>(0,M),*this);
+      return;
+    }
+
+    const int kc_max = K<kc?K:kc;
+    const int nc_max = ((N<nc?N:nc)+nr-1)/nr*nr;
+    B_packed = PackedBViewType(Kokkos::ViewAllocateWithoutInitializing("KokkosBlas::gemm::B_packed"),
+                               size_t(kc_max)*nc_max);
+
+    // The A blocks are packed in batches of at most one block per thread,
+    // which bounds the buffer by the aggregate L2 of the machine.
+    const int concurrency = ExecSpace::concurrency();
+    const int total_ic_blocks = (M+mc-1)/mc;
+    const int ic_batch = total_ic_blocks < concurrency ? total_ic_blocks : concurrency;
+    A_packed = PackedAViewType(Kokkos::ViewAllocateWithoutInitializing("KokkosBlas::gemm::A_packed"),
+                               size_t(ic_batch)*mc*kc_max);
+
+    for(jc = 0; jc < N; jc += nc) {
+      nb = N-jc < nc ? N-jc : nc;
+      const int num_panels = (nb+nr-1)/nr;
+
+      for(pc = 0; pc < K; pc += kc) {
+        kb = K-pc < kc ? K-pc : kc;
+        beta_block = pc == 0 ? beta : ATC::one();
+
+        Kokkos::parallel_for("KokkosBlas::gemm[host,packB]",
+                             Kokkos::RangePolicy<ExecSpace,PackBTag>(0,num_panels),*this);
+
+        for(ic_first = 0; ic_first < M; ic_first += ic_batch*mc) {
+          num_ic_blocks = (M-ic_first+mc-1)/mc;
+          if(num_ic_blocks > ic_batch) num_ic_blocks = ic_batch;
+
+          Kokkos::parallel_for("KokkosBlas::gemm[host,packA]",
+                               Kokkos::RangePolicy<ExecSpace,PackATag>(0,num_ic_blocks*(mc/mr)),*this);
+
+          // Split the panel when there are fewer A blocks than threads.
+          num_jr_groups = (concurrency+num_ic_blocks-1)/num_ic_blocks;
+          if(num_jr_groups > num_panels) num_jr_groups = num_panels;
+          if(num_jr_groups < 1) num_jr_groups = 1;
+          panels_per_group = (num_panels+num_jr_groups-1)/num_jr_groups;
+
+          Kokkos::parallel_for("KokkosBlas::gemm[host]",
+                               Kokkos::RangePolicy<ExecSpace>(0,num_ic_blocks*num_jr_groups),*this);
+        }
+      }
+    }
+  }
+
+  // C = beta*C, used when op(A)*op(B) does not contribute.
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const ScaleCTag&, const int i) const {
+    for(int j=0;j<N;++j)
+      C(i,j) = beta == ATC::zero() ? ATC::zero() : beta*C(i,j);
+  }
+
+  // Pack the nr-column sliver jp of op(B)(pc:pc+kb, jc:jc+nb).
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const PackBTag&, const int jp) const {
+    ScalarB* KOKKOS_RESTRICT b = B_packed.data() + size_t(jp)*nr*kb;
+    const int j0 = jc+jp*nr;
+    const int jn = N-j0 < nr ? N-j0 : nr;
+    for(int p=0;p<kb;++p) {
+      for(int j=0;j<jn;++j)
+        b[p*nr+j] = impl_gemm_host_op<TransposeB>::get(B,pc+p,j0+j);
+      for(int j=jn;j<nr;++j)
+        b[p*nr+j] = Kokkos::Details::ArithTraits<ScalarB>::zero();
+    }
+  }
+
+  // Pack the mr-row sliver is of op(A)(ic:ic+mb, pc:pc+kb) for the ic
+  // block is/(mc/mr) of the current batch.
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const PackATag&, const int is) const {
+    const int ib = is/(mc/mr);
+    const int ic = ic_first+ib*mc;
+    const int ir = (is%(mc/mr))*mr;
+    const int mb = M-ic < mc ? M-ic : mc;
+    if(ir >= mb) return;
+
+    ScalarA* KOKKOS_RESTRICT a = A_packed.data() + size_t(ib)*mc*kb + ir*kb;
+    const int im = mb-ir < mr ? mb-ir : mr;
+    for(int p=0;p<kb;++p) {
+      for(int i=0;i<im;++i)
+        a[p*mr+i] = impl_gemm_host_op<TransposeA>::get(A,ic+ir+i,pc+p);
+      for(int i=im;i<mr;++i)
+        a[p*mr+i] = Kokkos::Details::ArithTraits<ScalarA>::zero();
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const int league_rank) const {
+    const int ib = league_rank/num_jr_groups;
+    const int ic = ic_first+ib*mc;
+    const int jg = league_rank%num_jr_groups;
+    const int mb = M-ic < mc ? M-ic : mc;
+    const ScalarA* a_packed = A_packed.data() + size_t(ib)*mc*kb;
+
+    const int num_panels = (nb+nr-1)/nr;
+    const int jp_begin = jg*panels_per_group;
+    const int jp_end = jp_begin+panels_per_group < num_panels ? jp_begin+panels_per_group : num_panels;
+
+    ScalarC ab[mr*nr];
+    for(int jp=jp_begin;jp<jp_end;++jp) {
+      const ScalarB* b = B_packed.data() + size_t(jp)*nr*kb;
+      const int j0 = jc+jp*nr;
+      const int jn = N-j0 < nr ? N-j0 : nr;
+      for(int ir=0;ir<mb;ir+=mr) {
+        const int i0 = ic+ir;
+        const int im = mb-ir < mr ? mb-ir : mr;
+        impl_gemm_host_micro_kernel<ScalarA,ScalarB,ScalarC,mr,nr>::invoke(kb,a_packed+ir*kb,b,ab);
+
+        // Update the valid part of the micro tile.
+        if(beta_block == ATC::zero()) {
+          for(int j=0;j<jn;++j)
+            for(int i=0;i<im;++i)
+              C(i0+i,j0+j) = alpha*ab[j*mr+i];
+        } else {
+          for(int j=0;j<jn;++j)
+            for(int i=0;i<im;++i)
+              C(i0+i,j0+j) = beta_block*C(i0+i,j0+j) + alpha*ab[j*mr+i];
+        }
+      }
+    }
+  }
+};
+
+// Runtime transpose flags to compile-time GEMMHostImpl.
+template<class ExecSpace, class ViewTypeA, class ViewTypeB, class ViewTypeC,
+         bool avail = impl_gemm_host_kernel_avail<ExecSpace>::value>
+struct impl_gemm_host_dispatch {
+  static int trans_mode(const char trans[]) {
+    return (trans[0]=='T' || trans[0]=='t') ? 1 :
+           (trans[0]=='C' || trans[0]=='c') ? 2 : 0;
+  }
+
+  template<int TransposeA, int TransposeB>
+  static void run(typename ViewTypeC::const_value_type& alpha, const ViewTypeA& A, const ViewTypeB& B,
+                  typename ViewTypeC::const_value_type& beta, const ViewTypeC& C) {
+    GEMMHostImpl<ExecSpace,ViewTypeA,ViewTypeB,ViewTypeC,TransposeA,TransposeB> gemm(alpha,A,B,beta,C);
+    gemm.run();
+  }
+
+  template<int TransposeA>
+  static void run(const int modeB,
+                  typename ViewTypeC::const_value_type& alpha, const ViewTypeA& A, const ViewTypeB& B,
+                  typename ViewTypeC::const_value_type& beta, const ViewTypeC& C) {
+    if(modeB == 0) run<TransposeA,0>(alpha,A,B,beta,C);
+    if(modeB == 1) run<TransposeA,1>(alpha,A,B,beta,C);
+    if(modeB == 2) run<TransposeA,2>(alpha,A,B,beta,C);
+  }
+
+  static void gemm(const char transA[], const char transB[],
+                   typename ViewTypeC::const_value_type& alpha, const ViewTypeA& A, const ViewTypeB& B,
+                   typename ViewTypeC::const_value_type& beta, const ViewTypeC& C) {
+    const int modeA = trans_mode(transA);
+    const int modeB = trans_mode(transB);
+    if(modeA == 0) run<0>(modeB,alpha,A,B,beta,C);
+    if(modeA == 1) run<1>(modeB,alpha,A,B,beta,C);
+    if(modeA == 2) run<2>(modeB,alpha,A,B,beta,C);
+  }
+};
+
+template<class ExecSpace, class ViewTypeA, class ViewTypeB, class ViewTypeC>
+struct impl_gemm_host_dispatch<ExecSpace,ViewTypeA,ViewTypeB,ViewTypeC,false> {
+  static void gemm(const char[], const char[],
+                   typename ViewTypeC::const_value_type&, const ViewTypeA&, const ViewTypeB&,
+                   typename ViewTypeC::const_value_type&, const ViewTypeC&) {}
+};
+
+}
+}
+#endif
@@ -49,6 +49,8 @@
 
 #if !defined(KOKKOSKERNELS_ETI_ONLY) || KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
 #include<KokkosBlas3_gemm_impl.hpp>
+#include<KokkosBlas3_gemm_host_impl.hpp>
+#include<KokkosBlas3_gemm_tall_skinny_impl.hpp>
 #endif
 
 namespace KokkosBlas {
@@ -133,6 +135,22 @@ struct GEMM {
   typedef typename AViewType::non_const_value_type ScalarA;
   typedef typename BViewType::non_const_value_type ScalarB;
   typedef typename CViewType::non_const_value_type ScalarC;
+  typedef typename CViewType::execution_space ExecSpace;
+
+  // Small result with a long inner dimension (e.g. Gram matrix X^T*Y of
+  // two multivectors): reduce over the rows instead of blocking C
+  if(impl_gemm_tall_skinny<ExecSpace,AViewType,BViewType,CViewType>::use(transA,transB,A,C)) {
+    impl_gemm_tall_skinny<ExecSpace,AViewType,BViewType,CViewType>::gemm(transA,transB,alpha,A,B,beta,C);
+    Kokkos::Profiling::popRegion();
+    return;
+  }
+
+  // On host execution spaces use the packed, cache-blocked kernel
+  if(impl_gemm_host_kernel_avail<ExecSpace>::value) {
+    impl_gemm_host_dispatch<ExecSpace,AViewType,BViewType,CViewType>::gemm(transA,transB,alpha,A,B,beta,C);
+    Kokkos::Profiling::popRegion();
+    return;
+  }
 
   // Define Blocking sizes (this will be used for scratch spaces)
   static constexpr int blockA0 = 24;
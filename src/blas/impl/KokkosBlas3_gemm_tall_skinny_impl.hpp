@@ -0,0 +1,308 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#ifndef KOKKOS_BLAS3_GEMM_TALL_SKINNY_IMPL_HPP_
+#define KOKKOS_BLAS3_GEMM_TALL_SKINNY_IMPL_HPP_
+
+#include<Kokkos_Core.hpp>
+#include<Kokkos_ArithTraits.hpp>
+#include<KokkosBlas3_gemm_host_impl.hpp>
+
+namespace KokkosBlas {
+namespace Impl {
+
+// C = beta*C + alpha*op(A)*B with op(A) = A^T or A^H, where C is small
+// (M x N, e.g. the k x k Gram matrix X^H*Y of two multivectors) and the
+// inner dimension K is very large. The blocked GEMM parallelizes over
+// blocks of C and therefore has almost no parallelism in this case.
+// Here the K rows of A and B are distributed over the threads instead,
+// every row is read exactly once and its outer product is accumulated
+// into a per-thread M x N partial result.
+//
+// syrk/herk with op(A) = A^T (A^H) reuse the kernels with B = A. Then uplo
+// ('L' or 'U') restricts all reads and writes of C to that triangle, and
+// herk drops the imaginary part of the diagonal. uplo = 'A' is plain gemm.
+struct impl_gemm_tall_skinny_size {
+  enum : int {
+    // Largest C handled (32 x 32), as the partial results live in
+    // per-thread reduction storage.
+    max_result_entries = 1024,
+    // K must be at least this many times max(M,N).
+    min_aspect_ratio = 32,
+    // Rows of A and B processed by one team on GPUs
+    team_rows = 512
+  };
+
+  KOKKOS_INLINE_FUNCTION
+  static bool in_triangle(const char uplo, const int i, const int j) {
+    return uplo == 'L' ? j <= i : (uplo == 'U' ? j >= i : true);
+  }
+};
+
+// Host: Kokkos array reduction, every thread owns a private M x N
+// accumulator and the join / final steps combine and write them to C.
+//
+// WARNING: NOT RECOMMENDED FOR CUDA (see SingleLevelTransposeGEMV).
+template<class AViewType,
+         class BViewType,
+         class CViewType,
+         const bool conj,
+         class IndexType = typename AViewType::size_type>
+struct GEMMTallSkinnyReduceFunctor {
+  typedef typename CViewType::non_const_value_type ScalarC;
+  typedef typename AViewType::non_const_value_type ScalarA;
+  typedef Kokkos::Details::ArithTraits<ScalarA> ATA;
+  typedef Kokkos::Details::ArithTraits<ScalarC> ATC;
+
+  typedef ScalarC value_type[];
+  IndexType value_count; // Kokkos needs this for reductions w/ array results
+
+  IndexType M, N;
+  ScalarA alpha;
+  ScalarC beta;
+  typename AViewType::const_type A;
+  typename BViewType::const_type B;
+  CViewType C;
+  char uplo;
+  bool real_diag;
+
+  GEMMTallSkinnyReduceFunctor (const ScalarA& alpha_, const AViewType& A_, const BViewType& B_,
+                               const ScalarC& beta_, const CViewType& C_,
+                               const char uplo_ = 'A', const bool real_diag_ = false):
+    value_count (C_.extent(0)*C_.extent(1)), M (C_.extent(0)), N (C_.extent(1)),
+    alpha (alpha_), beta (beta_), A (A_), B (B_), C (C_), uplo (uplo_), real_diag (real_diag_) {}
+
+  KOKKOS_INLINE_FUNCTION void
+  init (value_type C_cur) const
+  {
+    for (IndexType ij = 0; ij < value_count; ++ij) {
+      C_cur[ij] = ATC::zero ();
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  join (volatile value_type dst,
+        const volatile value_type src) const
+  {
+    for (IndexType ij = 0; ij < value_count; ++ij) {
+      dst[ij] += src[ij];
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  final (value_type C_result) const
+  {
+    for (IndexType i = 0; i < M; ++i) {
+      const IndexType j_begin = uplo == 'U' ? i : 0;
+      const IndexType j_end   = uplo == 'L' ? i+1 : N;
+      for (IndexType j = j_begin; j < j_end; ++j) {
+        // Don't read C if beta is zero, it may contain NaNs
+        const ScalarC C_ij = beta == ATC::zero () ? ATC::zero () : beta * C(i,j);
+        const ScalarC C_new = C_ij + alpha * C_result[i*N+j];
+        C(i,j) = (real_diag && i == j) ? ScalarC (ATC::real (C_new)) : C_new;
+      }
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  operator () (const IndexType& l, value_type C_cur) const
+  {
+    for (IndexType i = 0; i < M; ++i) {
+      const ScalarA A_li = conj ? ATA::conj (A(l,i)) : A(l,i);
+      const IndexType j_begin = uplo == 'U' ? i : 0;
+      const IndexType j_end   = uplo == 'L' ? i+1 : N;
+#ifdef KOKKOS_ENABLE_PRAGMA_IVDEP
+#pragma ivdep
+#endif
+      for (IndexType j = j_begin; j < j_end; ++j) {
+        C_cur[i*N+j] += A_li * B(l,j);
+      }
+    }
+  }
+};
+
+// GPU: a team takes a chunk of team_rows rows and each thread of the team
+// accumulates one entry of C over the chunk in a register. The chunk is
+// shared through the cache, so A and B are still streamed from memory
+// once. C must have been scaled by beta beforehand; the partial sums are
+// added atomically.
+template<class AViewType,
+         class BViewType,
+         class CViewType,
+         const bool conj>
+struct GEMMTallSkinnyTeamFunctor {
+  typedef typename CViewType::execution_space execution_space;
+  typedef Kokkos::TeamPolicy<execution_space> policy_type;
+  typedef typename policy_type::member_type member_type;
+  typedef typename CViewType::non_const_value_type ScalarC;
+  typedef typename AViewType::non_const_value_type ScalarA;
+  typedef Kokkos::Details::ArithTraits<ScalarA> ATA;
+  typedef Kokkos::Details::ArithTraits<ScalarC> ATC;
+
+  int M, N, K;
+  ScalarA alpha;
+  typename AViewType::const_type A;
+  typename BViewType::const_type B;
+  CViewType C;
+  char uplo;
+  bool real_diag;
+
+  GEMMTallSkinnyTeamFunctor (const ScalarA& alpha_, const AViewType& A_, const BViewType& B_,
+                             const CViewType& C_,
+                             const char uplo_ = 'A', const bool real_diag_ = false):
+    M (C_.extent(0)), N (C_.extent(1)), K (A_.extent(0)),
+    alpha (alpha_), A (A_), B (B_), C (C_), uplo (uplo_), real_diag (real_diag_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const member_type& team) const {
+    const int l_begin = team.league_rank()*impl_gemm_tall_skinny_size::team_rows;
+    const int l_end = (l_begin + impl_gemm_tall_skinny_size::team_rows < K) ?
+                       l_begin + impl_gemm_tall_skinny_size::team_rows : K;
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team,M*N), [&] (const int& ij) {
+      const int i = ij/N;
+      const int j = ij%N;
+      if(!impl_gemm_tall_skinny_size::in_triangle(uplo,i,j)) return;
+      ScalarC C_ij = ATC::zero();
+      for(int l=l_begin; l<l_end; l++)
+        C_ij += (conj ? ATA::conj(A(l,i)) : A(l,i))*B(l,j);
+      C_ij = alpha*C_ij;
+      if(real_diag && (i == j))
+        C_ij = ATC::real(C_ij);
+      Kokkos::atomic_add(&C(i,j), C_ij);
+    });
+  }
+};
+
+template<class CViewType>
+struct GEMMTallSkinnyScaleFunctor {
+  typedef typename CViewType::non_const_value_type ScalarC;
+  typedef Kokkos::Details::ArithTraits<ScalarC> ATC;
+
+  ScalarC beta;
+  CViewType C;
+  char uplo;
+  bool real_diag;
+
+  GEMMTallSkinnyScaleFunctor (const ScalarC& beta_, const CViewType& C_,
+                              const char uplo_ = 'A', const bool real_diag_ = false):
+    beta (beta_), C (C_), uplo (uplo_), real_diag (real_diag_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const int& i) const {
+    const int j_begin = uplo == 'U' ? i : 0;
+    const int j_end   = uplo == 'L' ? i+1 : static_cast<int>(C.extent(1));
+    for(int j=j_begin; j<j_end; j++) {
+      const ScalarC C_ij = beta == ATC::zero() ? ATC::zero() : beta*C(i,j);
+      C(i,j) = (real_diag && (i == j)) ? ScalarC(ATC::real(C_ij)) : C_ij;
+    }
+  }
+};
+
+template<class ExecSpace, class AViewType, class BViewType, class CViewType>
+struct impl_gemm_tall_skinny {
+  // Whether the tall-skinny kernel should be used for this problem
+  static bool use(const char transA[], const char transB[],
+                  const AViewType& A, const CViewType& C) {
+    const bool A_t = (transA[0]=='T') || (transA[0]=='t') || (transA[0]=='C') || (transA[0]=='c');
+    const bool B_n = (transB[0]=='N') || (transB[0]=='n');
+    const int64_t M = C.extent(0);
+    const int64_t N = C.extent(1);
+    const int64_t K = A.extent(0);
+    return A_t && B_n && (M > 0) && (N > 0) &&
+           (M*N <= impl_gemm_tall_skinny_size::max_result_entries) &&
+           (K >= impl_gemm_tall_skinny_size::min_aspect_ratio*(M > N ? M : N));
+  }
+
+  // Whether the tall-skinny kernel should be used for syrk/herk, C = A^T A
+  static bool use_syrk(const char trans[], const AViewType& A, const CViewType& C) {
+    return use(trans, "N", A, C);
+  }
+
+  template<bool conj>
+  static void gemm_conj(typename AViewType::const_value_type& alpha,
+                        const AViewType& A, const BViewType& B,
+                        typename CViewType::const_value_type& beta,
+                        const CViewType& C,
+                        const char uplo = 'A', const bool real_diag = false) {
+    const int K = A.extent(0);
+    if(impl_gemm_host_kernel_avail<ExecSpace>::value) {
+      Kokkos::parallel_reduce("KokkosBlas::gemm[TallSkinny]", Kokkos::RangePolicy<ExecSpace>(0,K),
+        GEMMTallSkinnyReduceFunctor<AViewType,BViewType,CViewType,conj>(alpha,A,B,beta,C,uplo,real_diag));
+    } else {
+      const int M = C.extent(0);
+      const int nteams = (K + impl_gemm_tall_skinny_size::team_rows - 1)/impl_gemm_tall_skinny_size::team_rows;
+      Kokkos::parallel_for("KokkosBlas::gemm[TallSkinnyScale]", Kokkos::RangePolicy<ExecSpace>(0,M),
+        GEMMTallSkinnyScaleFunctor<CViewType>(beta,C,uplo,real_diag));
+      Kokkos::parallel_for("KokkosBlas::gemm[TallSkinny]", Kokkos::TeamPolicy<ExecSpace>(nteams,Kokkos::AUTO),
+        GEMMTallSkinnyTeamFunctor<AViewType,BViewType,CViewType,conj>(alpha,A,B,C,uplo,real_diag));
+    }
+  }
+
+  static void gemm(const char transA[], const char /*transB*/[],
+                   typename AViewType::const_value_type& alpha,
+                   const AViewType& A, const BViewType& B,
+                   typename CViewType::const_value_type& beta,
+                   const CViewType& C) {
+    if((transA[0]=='C') || (transA[0]=='c'))
+      gemm_conj<true>(alpha,A,B,beta,C);
+    else
+      gemm_conj<false>(alpha,A,B,beta,C);
+  }
+
+  // Triangle uplo of C = beta*C + alpha*A^T*A (A^H*A if hermitian); B is A
+  static void syrk(const bool lower, const bool hermitian,
+                   typename AViewType::const_value_type& alpha,
+                   const AViewType& A,
+                   typename CViewType::const_value_type& beta,
+                   const CViewType& C) {
+    if(hermitian)
+      gemm_conj<true>(alpha,A,A,beta,C,lower?'L':'U',true);
+    else
+      gemm_conj<false>(alpha,A,A,beta,C,lower?'L':'U',false);
+  }
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,114 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_BLAS3_SYRK_IMPL_HPP_
+#define KOKKOS_BLAS3_SYRK_IMPL_HPP_
+
+#include<Kokkos_Core.hpp>
+#include<Kokkos_ArithTraits.hpp>
+
+namespace KokkosBlas {
+namespace Impl {
+
+// C := beta*C + alpha*op(A)*op(A)^T  (or ^H if Conj), updating only the
+// triangle of C selected by lower. One team works on one row of C: its
+// threads split the columns of that row which lie inside the triangle
+// and the vector lanes reduce over the inner dimension K.
+//
+// Trans == false: op(A) = A,        C is A.extent(0) x A.extent(0)
+// Trans == true:  op(A) = A^T (A^H), C is A.extent(1) x A.extent(1)
+template<class AViewType, class CViewType, bool Trans, bool Conj>
+struct SYRKFunctor {
+  typedef typename CViewType::execution_space execution_space;
+  typedef Kokkos::TeamPolicy<execution_space> policy_type;
+  typedef typename policy_type::member_type member_type;
+
+  typedef typename AViewType::non_const_value_type ScalarA;
+  typedef typename CViewType::non_const_value_type ScalarC;
+  typedef Kokkos::Details::ArithTraits<ScalarA> ATA;
+  typedef Kokkos::Details::ArithTraits<ScalarC> ATC;
+
+  bool lower;
+  int K;
+  ScalarA alpha;
+  ScalarC beta;
+  AViewType A;
+  CViewType C;
+
+  SYRKFunctor(const bool lower_, const ScalarA& alpha_, const AViewType& A_,
+              const ScalarC& beta_, const CViewType& C_):
+    lower(lower_), K(Trans?A_.extent(0):A_.extent(1)),
+    alpha(alpha_), beta(beta_), A(A_), C(C_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  ScalarA conj(const ScalarA& a) const {
+    return Conj ? ATA::conj(a) : a;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const member_type& team) const {
+    const int i = team.league_rank();
+    const int j_begin = lower ? 0   : i;
+    const int j_end   = lower ? i+1 : static_cast<int>(C.extent(1));
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team,j_begin,j_end), [&] (const int& j) {
+      ScalarC C_ij = ATC::zero();
+      Kokkos::parallel_reduce(Kokkos::ThreadVectorRange(team,K), [&] (const int& k, ScalarC& lsum) {
+        lsum += Trans ? conj(A(k,i))*A(k,j) : A(i,k)*conj(A(j,k));
+      },C_ij);
+      Kokkos::single(Kokkos::PerThread(team), [&] () {
+        // Don't read C if beta is zero, it may contain NaNs
+        ScalarC C_new = (beta == ATC::zero()) ? ScalarC(alpha*C_ij) : beta*C(i,j) + alpha*C_ij;
+        // The diagonal of a Hermitian matrix is real
+        if(Conj && (i == j))
+          C_new = ATC::real(C_new);
+        C(i,j) = C_new;
+      });
+    });
+  }
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,90 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_BLAS3_TRMM_IMPL_HPP_
+#define KOKKOS_BLAS3_TRMM_IMPL_HPP_
+
+#include<Kokkos_Core.hpp>
+#include<KokkosBlas3_trsm_impl.hpp>
+
+namespace KokkosBlas {
+namespace Impl {
+
+// B := alpha*op(A)*B or alpha*B*op(A), one right hand side per thread
+// (see TRSMTRMMBase). The product is formed in place: for lower M row r
+// only needs entries c <= r, so walk the rows from the bottom up; for
+// upper M walk them top down.
+template<class AViewType, class BViewType, bool Left, bool Conj>
+struct TRMMFunctor : public TRSMTRMMBase<AViewType,BViewType,Left,Conj> {
+  typedef TRSMTRMMBase<AViewType,BViewType,Left,Conj> base_type;
+  typedef typename base_type::ScalarB ScalarB;
+
+  TRMMFunctor(const char uplo[], const char transA[], const char diag[],
+              const ScalarB& alpha_, const AViewType& A_, const BViewType& B_):
+    base_type(uplo,transA,diag,alpha_,A_,B_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const int& l) const {
+    const int n = this->A.extent(0);
+    if(this->lower) {
+      for(int r=n-1; r>=0; r--) {
+        ScalarB x_r = this->unit ? this->x(l,r) : this->M(r,r)*this->x(l,r);
+        for(int c=0; c<r; c++)
+          x_r += this->M(r,c)*this->x(l,c);
+        this->x(l,r) = this->alpha*x_r;
+      }
+    } else {
+      for(int r=0; r<n; r++) {
+        ScalarB x_r = this->unit ? this->x(l,r) : this->M(r,r)*this->x(l,r);
+        for(int c=r+1; c<n; c++)
+          x_r += this->M(r,c)*this->x(l,c);
+        this->x(l,r) = this->alpha*x_r;
+      }
+    }
+  }
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,138 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_BLAS3_TRSM_IMPL_HPP_
+#define KOKKOS_BLAS3_TRSM_IMPL_HPP_
+
+#include<Kokkos_Core.hpp>
+#include<Kokkos_ArithTraits.hpp>
+
+namespace KokkosBlas {
+namespace Impl {
+
+// Both trsm and trmm act on the right hand sides independently: the
+// columns of B for side 'L' and the rows of B for side 'R'. For side 'R'
+// the equation X*op(A) = B is handled as op(A)^T*X^T = B^T, so in either
+// case every right hand side x is multiplied with (or solved against)
+// the same triangular matrix M:
+//
+//   side 'L': M = op(A)       side 'R': M = op(A)^T
+//
+// M(r,c) is either A(r,c) or A(c,r), conjugated for transA == 'C', and
+// M is lower triangular if exactly one of "A is lower" and "access is
+// transposed" holds.
+template<class AViewType, class BViewType, bool Left, bool Conj>
+struct TRSMTRMMBase {
+  typedef typename AViewType::non_const_value_type ScalarA;
+  typedef typename BViewType::non_const_value_type ScalarB;
+  typedef Kokkos::Details::ArithTraits<ScalarA> ATA;
+
+  bool transposed;
+  bool lower;
+  bool unit;
+  ScalarB alpha;
+  AViewType A;
+  BViewType B;
+
+  TRSMTRMMBase(const char uplo[], const char transA[], const char diag[],
+               const ScalarB& alpha_, const AViewType& A_, const BViewType& B_):
+    alpha(alpha_), A(A_), B(B_) {
+    const bool A_t = (transA[0]!='N') && (transA[0]!='n');
+    const bool A_lower = (uplo[0]=='L') || (uplo[0]=='l');
+    transposed = (Left == A_t);
+    lower = (A_lower != transposed);
+    unit = (diag[0]=='U') || (diag[0]=='u');
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  ScalarA M(const int r, const int c) const {
+    const ScalarA a = transposed ? A(c,r) : A(r,c);
+    return Conj ? ATA::conj(a) : a;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  ScalarB& x(const int l, const int r) const {
+    return Left ? B(r,l) : B(l,r);
+  }
+
+  int num_rhs() const {
+    return Left ? B.extent(1) : B.extent(0);
+  }
+};
+
+// B := alpha*inv(op(A))*B or alpha*B*inv(op(A)), one right hand side per
+// thread. Forward substitution for lower M, back substitution otherwise.
+template<class AViewType, class BViewType, bool Left, bool Conj>
+struct TRSMFunctor : public TRSMTRMMBase<AViewType,BViewType,Left,Conj> {
+  typedef TRSMTRMMBase<AViewType,BViewType,Left,Conj> base_type;
+  typedef typename base_type::ScalarB ScalarB;
+
+  TRSMFunctor(const char uplo[], const char transA[], const char diag[],
+              const ScalarB& alpha_, const AViewType& A_, const BViewType& B_):
+    base_type(uplo,transA,diag,alpha_,A_,B_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const int& l) const {
+    const int n = this->A.extent(0);
+    if(this->lower) {
+      for(int r=0; r<n; r++) {
+        ScalarB x_r = this->alpha*this->x(l,r);
+        for(int c=0; c<r; c++)
+          x_r -= this->M(r,c)*this->x(l,c);
+        this->x(l,r) = this->unit ? x_r : x_r/this->M(r,r);
+      }
+    } else {
+      for(int r=n-1; r>=0; r--) {
+        ScalarB x_r = this->alpha*this->x(l,r);
+        for(int c=r+1; c<n; c++)
+          x_r -= this->M(r,c)*this->x(l,c);
+        this->x(l,r) = this->unit ? x_r : x_r/this->M(r,r);
+      }
+    }
+  }
+};
+
+}
+}
+
+#endif
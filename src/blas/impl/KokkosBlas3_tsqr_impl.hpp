@@ -0,0 +1,307 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOSBLAS3_TSQR_IMPL_HPP_
+#define KOKKOSBLAS3_TSQR_IMPL_HPP_
+
+#include<Kokkos_Core.hpp>
+#include<Kokkos_ArithTraits.hpp>
+#include<KokkosBatched_Util.hpp>
+#include<KokkosBatched_QR_Decl.hpp>
+#include<KokkosBatched_QR_Serial_Internal.hpp>
+#include<KokkosBatched_Householder_Serial_Internal.hpp>
+
+namespace KokkosBlas {
+namespace Impl {
+
+// Tall-skinny QR of an m x k matrix A (m >> k) in two passes over A.
+//
+// Pass 1: the rows are split into P blocks, every block is QR factored
+//   with Householder reflectors (reflectors stored below the diagonal of
+//   the corresponding block of Q, tau in TauLoc) and its k x k R factor
+//   is copied to RT(p,:,:). The R factors are then combined pairwise in
+//   a binary tree: at the level with stride s, [R_p; R_{p+s}] is QR
+//   factored, the result goes to R_p and the reflectors to the upper
+//   triangle of R_{p+s} (tau in TauTree). R_0 is the final R.
+// Pass 2: starting from the root, the tree reflectors are applied top
+//   down to obtain a k x k matrix C_p per block, such that the block of
+//   Q is Q_p*[C_p; 0]. Every block forms Q_p explicitly in place and
+//   multiplies it with C_p.
+//
+// Everything but the tree works on one row block per thread, and the
+// tree only touches k x k matrices.
+//
+// The reflectors are computed and applied with the batched serial
+// Householder kernels, H = I - tau*v*v^H with v(0) = 1 (xLARFG).
+
+template<class AViewType, class QViewType, class RTViewType, class TauViewType>
+struct TSQRLocalFactorFunctor {
+  typedef typename QViewType::non_const_value_type Scalar;
+  typedef Kokkos::Details::ArithTraits<Scalar> ATS;
+
+  int m, k, nblocks;
+  AViewType A;
+  QViewType Q;
+  RTViewType RT;
+  TauViewType TauLoc;
+
+  TSQRLocalFactorFunctor(const AViewType& A_, const QViewType& Q_,
+                         const RTViewType& RT_, const TauViewType& TauLoc_):
+    m(A_.extent(0)), k(A_.extent(1)), nblocks(RT_.extent(0)),
+    A(A_), Q(Q_), RT(RT_), TauLoc(TauLoc_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const int& p) const {
+    const int r0 = (int64_t(p)*m)/nblocks;
+    const int r1 = (int64_t(p+1)*m)/nblocks;
+
+    for(int i=r0; i<r1; i++)
+      for(int c=0; c<k; c++)
+        Q(i,c) = A(i,c);
+
+    KokkosBatched::Experimental::SerialQR_Internal<KokkosBatched::Experimental::Algo::QR::Unblocked>::
+      invoke(r1-r0, k, &Q(r0,0), Q.stride_0(), Q.stride_1(), &TauLoc(p,0), TauLoc.stride_1());
+
+    for(int i=0; i<k; i++)
+      for(int c=0; c<k; c++)
+        RT(p,i,c) = (c>=i) ? Scalar(Q(r0+i,c)) : ATS::zero();
+  }
+};
+
+template<class RTViewType, class TauViewType>
+struct TSQRTreeFactorFunctor {
+  typedef typename RTViewType::non_const_value_type Scalar;
+  typedef Kokkos::Details::ArithTraits<Scalar> ATS;
+
+  int k, nblocks, stride;
+  RTViewType RT;
+  TauViewType TauTree;
+
+  TSQRTreeFactorFunctor(const int stride_, const RTViewType& RT_, const TauViewType& TauTree_):
+    k(RT_.extent(1)), nblocks(RT_.extent(0)), stride(stride_), RT(RT_), TauTree(TauTree_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const int& t) const {
+    const int p = 2*stride*t;
+    const int q = p + stride;
+    if(q >= nblocks)
+      return;
+
+    // Column j of [R_p; R_q] only has nonzeros in R_p(j,j) and R_q(0:j,j)
+    for(int j=0; j<k; j++) {
+      KokkosBatched::Experimental::SerialLeftHouseholderInternal::
+        invoke(j+1, &RT(p,j,j), &RT(q,0,j), RT.stride_1(), &TauTree(q,j));
+      KokkosBatched::Experimental::SerialApplyLeftHouseholderInternal::
+        invoke(j+1, k-j-1, ATS::conj(TauTree(q,j)),
+               &RT(q,0,j), RT.stride_1(),
+               &RT(p,j,j+1), RT.stride_2(),
+               &RT(q,0,j+1), RT.stride_1(), RT.stride_2());
+    }
+  }
+};
+
+// Writes R = D*R_0 and C_0 = D^H, where the unitary diagonal D makes the
+// diagonal of R real and non-negative.
+template<class RViewType, class RTViewType, class CViewType>
+struct TSQRRootFunctor {
+  typedef typename RTViewType::non_const_value_type Scalar;
+  typedef Kokkos::Details::ArithTraits<Scalar> ATS;
+  typedef typename ATS::mag_type mag_type;
+
+  int k;
+  RViewType R;
+  RTViewType RT;
+  CViewType C;
+
+  TSQRRootFunctor(const RViewType& R_, const RTViewType& RT_, const CViewType& C_):
+    k(RT_.extent(1)), R(R_), RT(RT_), C(C_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const int& i) const {
+    const mag_type r_abs = ATS::abs(RT(0,i,i));
+    const Scalar d = (r_abs == Kokkos::Details::ArithTraits<mag_type>::zero()) ?
+      ATS::one() : Scalar(ATS::conj(RT(0,i,i))/r_abs);
+    for(int c=0; c<k; c++) {
+      R(i,c) = (c>i) ? Scalar(d*RT(0,i,c)) : ((c==i) ? Scalar(r_abs) : ATS::zero());
+      C(0,i,c) = (c==i) ? Scalar(ATS::conj(d)) : ATS::zero();
+    }
+  }
+};
+
+template<class RTViewType, class TauViewType, class CViewType>
+struct TSQRTreeApplyFunctor {
+  typedef typename RTViewType::non_const_value_type Scalar;
+  typedef Kokkos::Details::ArithTraits<Scalar> ATS;
+
+  int k, nblocks, stride;
+  RTViewType RT;
+  TauViewType TauTree;
+  CViewType C;
+
+  TSQRTreeApplyFunctor(const int stride_, const RTViewType& RT_, const TauViewType& TauTree_,
+                       const CViewType& C_):
+    k(RT_.extent(1)), nblocks(RT_.extent(0)), stride(stride_), RT(RT_), TauTree(TauTree_), C(C_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const int& t) const {
+    const int p = 2*stride*t;
+    const int q = p + stride;
+    if(q >= nblocks)
+      return;
+
+    // [C_p; C_q] = H_0*...*H_{k-1}*[C_p; 0]
+    for(int i=0; i<k; i++)
+      for(int c=0; c<k; c++)
+        C(q,i,c) = ATS::zero();
+    for(int j=k-1; j>=0; j--)
+      KokkosBatched::Experimental::SerialApplyLeftHouseholderInternal::
+        invoke(j+1, k, Scalar(TauTree(q,j)),
+               &RT(q,0,j), RT.stride_1(),
+               &C(p,j,0), C.stride_2(),
+               &C(q,0,0), C.stride_1(), C.stride_2());
+  }
+};
+
+template<class QViewType, class TauViewType, class CViewType, class WorkViewType>
+struct TSQRLocalApplyFunctor {
+  typedef typename QViewType::non_const_value_type Scalar;
+  typedef Kokkos::Details::ArithTraits<Scalar> ATS;
+
+  int m, k, nblocks;
+  QViewType Q;
+  TauViewType TauLoc;
+  CViewType C;
+  WorkViewType W;
+
+  TSQRLocalApplyFunctor(const QViewType& Q_, const TauViewType& TauLoc_,
+                        const CViewType& C_, const WorkViewType& W_):
+    m(Q_.extent(0)), k(Q_.extent(1)), nblocks(C_.extent(0)),
+    Q(Q_), TauLoc(TauLoc_), C(C_), W(W_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const int& p) const {
+    const int r0 = (int64_t(p)*m)/nblocks;
+    const int r1 = (int64_t(p+1)*m)/nblocks;
+
+    // Form the first k columns of Q_p in place (xORG2R)
+    for(int j=k-1; j>=0; j--) {
+      const Scalar tau = TauLoc(p,j);
+      KokkosBatched::Experimental::SerialApplyLeftHouseholderInternal::
+        invoke(r1-r0-j-1, k-j-1, tau,
+               &Q(r0+j+1,j), Q.stride_0(),
+               &Q(r0+j,j+1), Q.stride_1(),
+               &Q(r0+j+1,j+1), Q.stride_0(), Q.stride_1());
+      for(int i=r0+j+1; i<r1; i++)
+        Q(i,j) *= -tau;
+      Q(r0+j,j) = ATS::one() - tau;
+      for(int i=r0; i<r0+j; i++)
+        Q(i,j) = ATS::zero();
+    }
+
+    // Q_p := Q_p*C_p, one row at a time
+    for(int i=r0; i<r1; i++) {
+      for(int c=0; c<k; c++) {
+        Scalar sum = ATS::zero();
+        for(int l=0; l<k; l++)
+          sum += Q(i,l)*C(p,l,c);
+        W(p,c) = sum;
+      }
+      for(int c=0; c<k; c++)
+        Q(i,c) = W(p,c);
+    }
+  }
+};
+
+template<class AViewType, class QViewType, class RViewType>
+void tsqr_impl(const AViewType& A, const QViewType& Q, const RViewType& R) {
+  typedef typename QViewType::execution_space execution_space;
+  typedef typename QViewType::non_const_value_type Scalar;
+  typedef Kokkos::View<Scalar***, Kokkos::LayoutRight, typename QViewType::device_type> RTViewType;
+  typedef Kokkos::View<Scalar**, Kokkos::LayoutRight, typename QViewType::device_type> TauViewType;
+  typedef Kokkos::RangePolicy<execution_space> policy_type;
+
+  const int64_t m = A.extent(0);
+  const int64_t k = A.extent(1);
+
+  // Every block needs at least k rows; below a few dozen rows a block
+  // is not worth a thread.
+  const int64_t min_block_rows = k < 64 ? 64 : k;
+  int64_t nblocks = m/min_block_rows;
+  if(nblocks > execution_space::concurrency())
+    nblocks = execution_space::concurrency();
+  if(nblocks < 1)
+    nblocks = 1;
+
+  RTViewType RT(Kokkos::ViewAllocateWithoutInitializing("TSQR::R"), nblocks, k, k);
+  RTViewType C(Kokkos::ViewAllocateWithoutInitializing("TSQR::C"), nblocks, k, k);
+  TauViewType TauLoc(Kokkos::ViewAllocateWithoutInitializing("TSQR::TauLoc"), nblocks, k);
+  TauViewType TauTree(Kokkos::ViewAllocateWithoutInitializing("TSQR::TauTree"), nblocks, k);
+  TauViewType W(Kokkos::ViewAllocateWithoutInitializing("TSQR::Work"), nblocks, k);
+
+  // Pass 1: local factorizations, then the reduction tree over the R factors
+  Kokkos::parallel_for("KokkosBlas::tsqr::LocalFactor", policy_type(0,nblocks),
+    TSQRLocalFactorFunctor<AViewType,QViewType,RTViewType,TauViewType>(A,Q,RT,TauLoc));
+  int stride = 1;
+  for(; stride<nblocks; stride*=2) {
+    const int npairs = (nblocks + 2*stride - 1)/(2*stride);
+    Kokkos::parallel_for("KokkosBlas::tsqr::TreeFactor", policy_type(0,npairs),
+      TSQRTreeFactorFunctor<RTViewType,TauViewType>(stride,RT,TauTree));
+  }
+
+  Kokkos::parallel_for("KokkosBlas::tsqr::Root", policy_type(0,k),
+    TSQRRootFunctor<RViewType,RTViewType,RTViewType>(R,RT,C));
+
+  // Pass 2: walk the tree back down, then form the blocks of Q
+  for(stride/=2; stride>=1; stride/=2) {
+    const int npairs = (nblocks + 2*stride - 1)/(2*stride);
+    Kokkos::parallel_for("KokkosBlas::tsqr::TreeApply", policy_type(0,npairs),
+      TSQRTreeApplyFunctor<RTViewType,TauViewType,RTViewType>(stride,RT,TauTree,C));
+  }
+  Kokkos::parallel_for("KokkosBlas::tsqr::LocalApply", policy_type(0,nblocks),
+    TSQRLocalApplyFunctor<QViewType,TauViewType,RTViewType,TauViewType>(Q,TauLoc,C,W));
+}
+
+}
+}
+
+#endif
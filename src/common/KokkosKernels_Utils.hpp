@@ -1002,6 +1002,49 @@ void permute_block_vector(
 
 }
 
+template <typename value_array_type, typename out_value_array_type, typename idx_array_type>
+struct PermuteMultiVector{
+  typedef typename idx_array_type::value_type idx;
+  value_array_type old_vector;
+  out_value_array_type new_vector;
+  idx_array_type old_to_new_mapping;
+  idx mapping_size;
+  idx num_vectors;
+  PermuteMultiVector(
+      value_array_type old_vector_,
+      out_value_array_type new_vector_,
+      idx_array_type old_to_new_mapping_):
+        old_vector(old_vector_), new_vector(new_vector_),old_to_new_mapping(old_to_new_mapping_),
+        mapping_size(old_to_new_mapping_.extent(0)), num_vectors(old_vector_.extent(1)){}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const idx &ii) const {
+
+    idx mapping = ii;
+    if (ii < mapping_size) mapping = old_to_new_mapping[ii];
+    for (idx i = 0; i < num_vectors; ++i){
+      new_vector(mapping, i) = old_vector(ii, i);
+    }
+  }
+};
+
+/**
+ * \brief Row permutation of a 2D view. Row ii of old_vector is copied to row old_to_new_index_map[ii] of new_vector.
+ */
+template <typename value_array_type, typename out_value_array_type, typename idx_array_type, typename MyExecSpace>
+void permute_multivector(
+    typename idx_array_type::value_type num_elements,
+    idx_array_type &old_to_new_index_map,
+    value_array_type &old_vector,
+    out_value_array_type &new_vector
+    ){
+  typedef Kokkos::RangePolicy<MyExecSpace> my_exec_space;
+
+  Kokkos::parallel_for("KokkosKernels::Impl::PermuteMultiVector", my_exec_space(0,num_elements),
+      PermuteMultiVector<value_array_type, out_value_array_type, idx_array_type>(old_vector, new_vector, old_to_new_index_map));
+
+}
+
 
 template <typename value_array_type, typename MyExecSpace>
 void zero_vector(
@@ -0,0 +1,390 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#ifndef KOKKOSBLAS1_COPY_TPL_SPEC_DECL_HPP_
+#define KOKKOSBLAS1_COPY_TPL_SPEC_DECL_HPP_
+
+// Generic Host side BLAS (could be MKL or whatever)
+#ifdef KOKKOSKERNELS_ENABLE_TPL_BLAS
+
+extern "C" void dcopy_( const int* N, const double* x, const int* x_inc,
+                        double* y, const int* y_inc);
+extern "C" void scopy_( const int* N, const float* x, const int* x_inc,
+                        float* y, const int* y_inc);
+extern "C" void zcopy_( const int* N, const std::complex<double>* x, const int* x_inc,
+                        std::complex<double>* y, const int* y_inc);
+extern "C" void ccopy_( const int* N, const std::complex<float>* x, const int* x_inc,
+                        std::complex<float>* y, const int* y_inc);
+
+namespace KokkosBlas {
+namespace Impl {
+
+
+namespace {
+  template<class XV, class YV>
+  inline void copy_print_specialization() {
+      #ifdef KOKKOSKERNELS_ENABLE_CHECK_SPECIALIZATION
+        printf("KokkosBlas1::copy<> TPL Blas specialization for < %s , %s >\n",typeid(XV).name(),typeid(YV).name());
+      #endif
+  }
+}
+
+#define KOKKOSBLAS1_DCOPY_TPL_SPEC_DECL_BLAS( LAYOUT, MEMSPACE, ETI_SPEC_AVAIL ) \
+template<class ExecSpace> \
+struct Copy< \
+Kokkos::View<const double*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+             Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+Kokkos::View<double*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+             Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+1,true, ETI_SPEC_AVAIL > { \
+  \
+  typedef Kokkos::View<const double*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged> > XV; \
+  typedef Kokkos::View<double*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged> > YV; \
+  typedef typename XV::size_type size_type; \
+  \
+  static void copy (const XV& X, const YV& Y) \
+  { \
+    const size_type numElems = X.extent(0); \
+    if ((numElems < static_cast<size_type> (INT_MAX)) && \
+        (X.stride(0) < static_cast<size_type> (INT_MAX)) && \
+        (Y.stride(0) < static_cast<size_type> (INT_MAX))) { \
+      copy_print_specialization<XV,YV>(); \
+      int N = numElems; \
+      const int incx = static_cast<int> (X.stride(0)); \
+      const int incy = static_cast<int> (Y.stride(0)); \
+      dcopy_(&N,X.data(),&incx,Y.data(),&incy); \
+    } else { \
+      Copy<XV,YV,1,false,ETI_SPEC_AVAIL>::copy(X,Y); \
+    } \
+  } \
+};
+
+#define KOKKOSBLAS1_SCOPY_TPL_SPEC_DECL_BLAS( LAYOUT, MEMSPACE, ETI_SPEC_AVAIL ) \
+template<class ExecSpace> \
+struct Copy< \
+Kokkos::View<const float*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+             Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+Kokkos::View<float*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+             Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+1,true, ETI_SPEC_AVAIL > { \
+  \
+  typedef Kokkos::View<const float*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged> > XV; \
+  typedef Kokkos::View<float*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged> > YV; \
+  typedef typename XV::size_type size_type; \
+  \
+  static void copy (const XV& X, const YV& Y) \
+  { \
+    const size_type numElems = X.extent(0); \
+    if ((numElems < static_cast<size_type> (INT_MAX)) && \
+        (X.stride(0) < static_cast<size_type> (INT_MAX)) && \
+        (Y.stride(0) < static_cast<size_type> (INT_MAX))) { \
+      copy_print_specialization<XV,YV>(); \
+      int N = numElems; \
+      const int incx = static_cast<int> (X.stride(0)); \
+      const int incy = static_cast<int> (Y.stride(0)); \
+      scopy_(&N,X.data(),&incx,Y.data(),&incy); \
+    } else { \
+      Copy<XV,YV,1,false,ETI_SPEC_AVAIL>::copy(X,Y); \
+    } \
+  } \
+};
+
+#define KOKKOSBLAS1_ZCOPY_TPL_SPEC_DECL_BLAS( LAYOUT, MEMSPACE, ETI_SPEC_AVAIL ) \
+template<class ExecSpace> \
+struct Copy< \
+Kokkos::View<const Kokkos::complex<double>*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+             Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+Kokkos::View<Kokkos::complex<double>*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+             Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+1,true, ETI_SPEC_AVAIL > { \
+  \
+  typedef Kokkos::View<const Kokkos::complex<double>*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged> > XV; \
+  typedef Kokkos::View<Kokkos::complex<double>*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged> > YV; \
+  typedef typename XV::size_type size_type; \
+  \
+  static void copy (const XV& X, const YV& Y) \
+  { \
+    const size_type numElems = X.extent(0); \
+    if ((numElems < static_cast<size_type> (INT_MAX)) && \
+        (X.stride(0) < static_cast<size_type> (INT_MAX)) && \
+        (Y.stride(0) < static_cast<size_type> (INT_MAX))) { \
+      copy_print_specialization<XV,YV>(); \
+      int N = numElems; \
+      const int incx = static_cast<int> (X.stride(0)); \
+      const int incy = static_cast<int> (Y.stride(0)); \
+      zcopy_(&N,reinterpret_cast<const std::complex<double>*>(X.data()),&incx,reinterpret_cast<std::complex<double>*>(Y.data()),&incy); \
+    } else { \
+      Copy<XV,YV,1,false,ETI_SPEC_AVAIL>::copy(X,Y); \
+    } \
+  } \
+};
+
+#define KOKKOSBLAS1_CCOPY_TPL_SPEC_DECL_BLAS( LAYOUT, MEMSPACE, ETI_SPEC_AVAIL ) \
+template<class ExecSpace> \
+struct Copy< \
+Kokkos::View<const Kokkos::complex<float>*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+             Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+Kokkos::View<Kokkos::complex<float>*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+             Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+1,true, ETI_SPEC_AVAIL > { \
+  \
+  typedef Kokkos::View<const Kokkos::complex<float>*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged> > XV; \
+  typedef Kokkos::View<Kokkos::complex<float>*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged> > YV; \
+  typedef typename XV::size_type size_type; \
+  \
+  static void copy (const XV& X, const YV& Y) \
+  { \
+    const size_type numElems = X.extent(0); \
+    if ((numElems < static_cast<size_type> (INT_MAX)) && \
+        (X.stride(0) < static_cast<size_type> (INT_MAX)) && \
+        (Y.stride(0) < static_cast<size_type> (INT_MAX))) { \
+      copy_print_specialization<XV,YV>(); \
+      int N = numElems; \
+      const int incx = static_cast<int> (X.stride(0)); \
+      const int incy = static_cast<int> (Y.stride(0)); \
+      ccopy_(&N,reinterpret_cast<const std::complex<float>*>(X.data()),&incx,reinterpret_cast<std::complex<float>*>(Y.data()),&incy); \
+    } else { \
+      Copy<XV,YV,1,false,ETI_SPEC_AVAIL>::copy(X,Y); \
+    } \
+  } \
+};
+
+KOKKOSBLAS1_DCOPY_TPL_SPEC_DECL_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS1_DCOPY_TPL_SPEC_DECL_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS1_DCOPY_TPL_SPEC_DECL_BLAS( Kokkos::LayoutStride, Kokkos::HostSpace, true)
+KOKKOSBLAS1_DCOPY_TPL_SPEC_DECL_BLAS( Kokkos::LayoutStride, Kokkos::HostSpace, false)
+
+KOKKOSBLAS1_SCOPY_TPL_SPEC_DECL_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS1_SCOPY_TPL_SPEC_DECL_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS1_SCOPY_TPL_SPEC_DECL_BLAS( Kokkos::LayoutStride, Kokkos::HostSpace, true)
+KOKKOSBLAS1_SCOPY_TPL_SPEC_DECL_BLAS( Kokkos::LayoutStride, Kokkos::HostSpace, false)
+
+KOKKOSBLAS1_ZCOPY_TPL_SPEC_DECL_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS1_ZCOPY_TPL_SPEC_DECL_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS1_ZCOPY_TPL_SPEC_DECL_BLAS( Kokkos::LayoutStride, Kokkos::HostSpace, true)
+KOKKOSBLAS1_ZCOPY_TPL_SPEC_DECL_BLAS( Kokkos::LayoutStride, Kokkos::HostSpace, false)
+
+KOKKOSBLAS1_CCOPY_TPL_SPEC_DECL_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS1_CCOPY_TPL_SPEC_DECL_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS1_CCOPY_TPL_SPEC_DECL_BLAS( Kokkos::LayoutStride, Kokkos::HostSpace, true)
+KOKKOSBLAS1_CCOPY_TPL_SPEC_DECL_BLAS( Kokkos::LayoutStride, Kokkos::HostSpace, false)
+
+
+}
+}
+
+#endif
+
+// cuBLAS
+#ifdef KOKKOSKERNELS_ENABLE_TPL_CUBLAS
+#include<KokkosBlas_tpl_spec.hpp>
+
+namespace KokkosBlas {
+namespace Impl {
+
+#define KOKKOSBLAS1_DCOPY_TPL_SPEC_DECL_CUBLAS( LAYOUT, MEMSPACE, ETI_SPEC_AVAIL ) \
+template<class ExecSpace> \
+struct Copy< \
+Kokkos::View<const double*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+             Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+Kokkos::View<double*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+             Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+1,true, ETI_SPEC_AVAIL > { \
+  \
+  typedef Kokkos::View<const double*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged> > XV; \
+  typedef Kokkos::View<double*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged> > YV; \
+  typedef typename XV::size_type size_type; \
+  \
+  static void copy (const XV& X, const YV& Y) \
+  { \
+    const size_type numElems = X.extent(0); \
+    if ((numElems < static_cast<size_type> (INT_MAX)) && \
+        (X.stride(0) < static_cast<size_type> (INT_MAX)) && \
+        (Y.stride(0) < static_cast<size_type> (INT_MAX))) { \
+      copy_print_specialization<XV,YV>(); \
+      const int N = static_cast<int> (numElems); \
+      const int incx = static_cast<int> (X.stride(0)); \
+      const int incy = static_cast<int> (Y.stride(0)); \
+      KokkosBlas::Impl::CudaBlasSingleton & s = KokkosBlas::Impl::CudaBlasSingleton::singleton(); \
+      cublasDcopy(s.handle, N, X.data(), incx, Y.data(), incy); \
+    } else { \
+      Copy<XV,YV,1,false,ETI_SPEC_AVAIL>::copy(X,Y); \
+    } \
+  } \
+};
+
+#define KOKKOSBLAS1_SCOPY_TPL_SPEC_DECL_CUBLAS( LAYOUT, MEMSPACE, ETI_SPEC_AVAIL ) \
+template<class ExecSpace> \
+struct Copy< \
+Kokkos::View<const float*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+             Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+Kokkos::View<float*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+             Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+1,true, ETI_SPEC_AVAIL > { \
+  \
+  typedef Kokkos::View<const float*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged> > XV; \
+  typedef Kokkos::View<float*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged> > YV; \
+  typedef typename XV::size_type size_type; \
+  \
+  static void copy (const XV& X, const YV& Y) \
+  { \
+    const size_type numElems = X.extent(0); \
+    if ((numElems < static_cast<size_type> (INT_MAX)) && \
+        (X.stride(0) < static_cast<size_type> (INT_MAX)) && \
+        (Y.stride(0) < static_cast<size_type> (INT_MAX))) { \
+      copy_print_specialization<XV,YV>(); \
+      const int N = static_cast<int> (numElems); \
+      const int incx = static_cast<int> (X.stride(0)); \
+      const int incy = static_cast<int> (Y.stride(0)); \
+      KokkosBlas::Impl::CudaBlasSingleton & s = KokkosBlas::Impl::CudaBlasSingleton::singleton(); \
+      cublasScopy(s.handle, N, X.data(), incx, Y.data(), incy); \
+    } else { \
+      Copy<XV,YV,1,false,ETI_SPEC_AVAIL>::copy(X,Y); \
+    } \
+  } \
+};
+
+#define KOKKOSBLAS1_ZCOPY_TPL_SPEC_DECL_CUBLAS( LAYOUT, MEMSPACE, ETI_SPEC_AVAIL ) \
+template<class ExecSpace> \
+struct Copy< \
+Kokkos::View<const Kokkos::complex<double>*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+             Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+Kokkos::View<Kokkos::complex<double>*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+             Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+1,true, ETI_SPEC_AVAIL > { \
+  \
+  typedef Kokkos::View<const Kokkos::complex<double>*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged> > XV; \
+  typedef Kokkos::View<Kokkos::complex<double>*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged> > YV; \
+  typedef typename XV::size_type size_type; \
+  \
+  static void copy (const XV& X, const YV& Y) \
+  { \
+    const size_type numElems = X.extent(0); \
+    if ((numElems < static_cast<size_type> (INT_MAX)) && \
+        (X.stride(0) < static_cast<size_type> (INT_MAX)) && \
+        (Y.stride(0) < static_cast<size_type> (INT_MAX))) { \
+      copy_print_specialization<XV,YV>(); \
+      const int N = static_cast<int> (numElems); \
+      const int incx = static_cast<int> (X.stride(0)); \
+      const int incy = static_cast<int> (Y.stride(0)); \
+      KokkosBlas::Impl::CudaBlasSingleton & s = KokkosBlas::Impl::CudaBlasSingleton::singleton(); \
+      cublasZcopy(s.handle, N, reinterpret_cast<const cuDoubleComplex*>(X.data()), incx, reinterpret_cast<cuDoubleComplex*>(Y.data()), incy); \
+    } else { \
+      Copy<XV,YV,1,false,ETI_SPEC_AVAIL>::copy(X,Y); \
+    } \
+  } \
+};
+
+#define KOKKOSBLAS1_CCOPY_TPL_SPEC_DECL_CUBLAS( LAYOUT, MEMSPACE, ETI_SPEC_AVAIL ) \
+template<class ExecSpace> \
+struct Copy< \
+Kokkos::View<const Kokkos::complex<float>*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+             Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+Kokkos::View<Kokkos::complex<float>*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+             Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+1,true, ETI_SPEC_AVAIL > { \
+  \
+  typedef Kokkos::View<const Kokkos::complex<float>*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged> > XV; \
+  typedef Kokkos::View<Kokkos::complex<float>*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged> > YV; \
+  typedef typename XV::size_type size_type; \
+  \
+  static void copy (const XV& X, const YV& Y) \
+  { \
+    const size_type numElems = X.extent(0); \
+    if ((numElems < static_cast<size_type> (INT_MAX)) && \
+        (X.stride(0) < static_cast<size_type> (INT_MAX)) && \
+        (Y.stride(0) < static_cast<size_type> (INT_MAX))) { \
+      copy_print_specialization<XV,YV>(); \
+      const int N = static_cast<int> (numElems); \
+      const int incx = static_cast<int> (X.stride(0)); \
+      const int incy = static_cast<int> (Y.stride(0)); \
+      KokkosBlas::Impl::CudaBlasSingleton & s = KokkosBlas::Impl::CudaBlasSingleton::singleton(); \
+      cublasCcopy(s.handle, N, reinterpret_cast<const cuComplex*>(X.data()), incx, reinterpret_cast<cuComplex*>(Y.data()), incy); \
+    } else { \
+      Copy<XV,YV,1,false,ETI_SPEC_AVAIL>::copy(X,Y); \
+    } \
+  } \
+};
+
+KOKKOSBLAS1_DCOPY_TPL_SPEC_DECL_CUBLAS( Kokkos::LayoutLeft, Kokkos::CudaSpace, true)
+KOKKOSBLAS1_DCOPY_TPL_SPEC_DECL_CUBLAS( Kokkos::LayoutLeft, Kokkos::CudaSpace, false)
+KOKKOSBLAS1_DCOPY_TPL_SPEC_DECL_CUBLAS( Kokkos::LayoutStride, Kokkos::CudaSpace, true)
+KOKKOSBLAS1_DCOPY_TPL_SPEC_DECL_CUBLAS( Kokkos::LayoutStride, Kokkos::CudaSpace, false)
+
+KOKKOSBLAS1_SCOPY_TPL_SPEC_DECL_CUBLAS( Kokkos::LayoutLeft, Kokkos::CudaSpace, true)
+KOKKOSBLAS1_SCOPY_TPL_SPEC_DECL_CUBLAS( Kokkos::LayoutLeft, Kokkos::CudaSpace, false)
+KOKKOSBLAS1_SCOPY_TPL_SPEC_DECL_CUBLAS( Kokkos::LayoutStride, Kokkos::CudaSpace, true)
+KOKKOSBLAS1_SCOPY_TPL_SPEC_DECL_CUBLAS( Kokkos::LayoutStride, Kokkos::CudaSpace, false)
+
+KOKKOSBLAS1_ZCOPY_TPL_SPEC_DECL_CUBLAS( Kokkos::LayoutLeft, Kokkos::CudaSpace, true)
+KOKKOSBLAS1_ZCOPY_TPL_SPEC_DECL_CUBLAS( Kokkos::LayoutLeft, Kokkos::CudaSpace, false)
+KOKKOSBLAS1_ZCOPY_TPL_SPEC_DECL_CUBLAS( Kokkos::LayoutStride, Kokkos::CudaSpace, true)
+KOKKOSBLAS1_ZCOPY_TPL_SPEC_DECL_CUBLAS( Kokkos::LayoutStride, Kokkos::CudaSpace, false)
+
+KOKKOSBLAS1_CCOPY_TPL_SPEC_DECL_CUBLAS( Kokkos::LayoutLeft, Kokkos::CudaSpace, true)
+KOKKOSBLAS1_CCOPY_TPL_SPEC_DECL_CUBLAS( Kokkos::LayoutLeft, Kokkos::CudaSpace, false)
+KOKKOSBLAS1_CCOPY_TPL_SPEC_DECL_CUBLAS( Kokkos::LayoutStride, Kokkos::CudaSpace, true)
+KOKKOSBLAS1_CCOPY_TPL_SPEC_DECL_CUBLAS( Kokkos::LayoutStride, Kokkos::CudaSpace, false)
+
+
+}
+}
+
+#endif
+
+#endif
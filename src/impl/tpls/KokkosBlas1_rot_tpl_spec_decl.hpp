@@ -0,0 +1,218 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#ifndef KOKKOSBLAS1_ROT_TPL_SPEC_DECL_HPP_
+#define KOKKOSBLAS1_ROT_TPL_SPEC_DECL_HPP_
+
+// Generic Host side BLAS (could be MKL or whatever)
+#ifdef KOKKOSKERNELS_ENABLE_TPL_BLAS
+
+extern "C" void drot_( const int* N, double* x, const int* x_inc,
+                       double* y, const int* y_inc,
+                       const double* c, const double* s);
+extern "C" void srot_( const int* N, float* x, const int* x_inc,
+                       float* y, const int* y_inc,
+                       const float* c, const float* s);
+
+namespace KokkosBlas {
+namespace Impl {
+
+
+namespace {
+  template<class XV, class YV>
+  inline void rot_print_specialization() {
+      #ifdef KOKKOSKERNELS_ENABLE_CHECK_SPECIALIZATION
+        printf("KokkosBlas1::rot<> TPL Blas specialization for < %s , %s >\n",typeid(XV).name(),typeid(YV).name());
+      #endif
+  }
+}
+
+#define KOKKOSBLAS1_DROT_TPL_SPEC_DECL_BLAS( LAYOUT, MEMSPACE, ETI_SPEC_AVAIL ) \
+template<class ExecSpace> \
+struct Rot< \
+Kokkos::View<double*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+             Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+Kokkos::View<double*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+             Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+1,true, ETI_SPEC_AVAIL > { \
+  \
+  typedef Kokkos::View<double*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged> > XV; \
+  typedef Kokkos::View<double*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged> > YV; \
+  typedef typename XV::size_type size_type; \
+  \
+  static void rot (const XV& X, const YV& Y, const double& c, const double& s) \
+  { \
+    const size_type numElems = X.extent(0); \
+    if ((numElems < static_cast<size_type> (INT_MAX)) && (X.data() != Y.data())) { \
+      rot_print_specialization<XV,YV>(); \
+      int N = numElems; \
+      int one = 1; \
+      drot_(&N,X.data(),&one,Y.data(),&one,&c,&s); \
+    } else { \
+      Rot<XV,YV,1,false,ETI_SPEC_AVAIL>::rot(X,Y,c,s); \
+    } \
+  } \
+};
+
+#define KOKKOSBLAS1_SROT_TPL_SPEC_DECL_BLAS( LAYOUT, MEMSPACE, ETI_SPEC_AVAIL ) \
+template<class ExecSpace> \
+struct Rot< \
+Kokkos::View<float*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+             Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+Kokkos::View<float*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+             Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+1,true, ETI_SPEC_AVAIL > { \
+  \
+  typedef Kokkos::View<float*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged> > XV; \
+  typedef Kokkos::View<float*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged> > YV; \
+  typedef typename XV::size_type size_type; \
+  \
+  static void rot (const XV& X, const YV& Y, const float& c, const float& s) \
+  { \
+    const size_type numElems = X.extent(0); \
+    if ((numElems < static_cast<size_type> (INT_MAX)) && (X.data() != Y.data())) { \
+      rot_print_specialization<XV,YV>(); \
+      int N = numElems; \
+      int one = 1; \
+      srot_(&N,X.data(),&one,Y.data(),&one,&c,&s); \
+    } else { \
+      Rot<XV,YV,1,false,ETI_SPEC_AVAIL>::rot(X,Y,c,s); \
+    } \
+  } \
+};
+
+KOKKOSBLAS1_DROT_TPL_SPEC_DECL_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS1_DROT_TPL_SPEC_DECL_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+
+KOKKOSBLAS1_SROT_TPL_SPEC_DECL_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS1_SROT_TPL_SPEC_DECL_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+
+
+}
+}
+
+#endif
+
+// cuBLAS
+#ifdef KOKKOSKERNELS_ENABLE_TPL_CUBLAS
+#include<KokkosBlas_tpl_spec.hpp>
+
+namespace KokkosBlas {
+namespace Impl {
+
+#define KOKKOSBLAS1_DROT_TPL_SPEC_DECL_CUBLAS( LAYOUT, MEMSPACE, ETI_SPEC_AVAIL ) \
+template<class ExecSpace> \
+struct Rot< \
+Kokkos::View<double*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+             Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+Kokkos::View<double*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+             Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+1,true, ETI_SPEC_AVAIL > { \
+  \
+  typedef Kokkos::View<double*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged> > XV; \
+  typedef Kokkos::View<double*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged> > YV; \
+  typedef typename XV::size_type size_type; \
+  \
+  static void rot (const XV& X, const YV& Y, const double& c, const double& s) \
+  { \
+    const size_type numElems = X.extent(0); \
+    if ((numElems < static_cast<size_type> (INT_MAX)) && (X.data() != Y.data())) { \
+      rot_print_specialization<XV,YV>(); \
+      const int N = static_cast<int> (numElems); \
+      constexpr int one = 1; \
+      KokkosBlas::Impl::CudaBlasSingleton & singleton = KokkosBlas::Impl::CudaBlasSingleton::singleton(); \
+      cublasDrot(singleton.handle, N, X.data(), one, Y.data(), one, &c, &s); \
+    } else { \
+      Rot<XV,YV,1,false,ETI_SPEC_AVAIL>::rot(X,Y,c,s); \
+    } \
+  } \
+};
+
+#define KOKKOSBLAS1_SROT_TPL_SPEC_DECL_CUBLAS( LAYOUT, MEMSPACE, ETI_SPEC_AVAIL ) \
+template<class ExecSpace> \
+struct Rot< \
+Kokkos::View<float*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+             Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+Kokkos::View<float*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+             Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+1,true, ETI_SPEC_AVAIL > { \
+  \
+  typedef Kokkos::View<float*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged> > XV; \
+  typedef Kokkos::View<float*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged> > YV; \
+  typedef typename XV::size_type size_type; \
+  \
+  static void rot (const XV& X, const YV& Y, const float& c, const float& s) \
+  { \
+    const size_type numElems = X.extent(0); \
+    if ((numElems < static_cast<size_type> (INT_MAX)) && (X.data() != Y.data())) { \
+      rot_print_specialization<XV,YV>(); \
+      const int N = static_cast<int> (numElems); \
+      constexpr int one = 1; \
+      KokkosBlas::Impl::CudaBlasSingleton & singleton = KokkosBlas::Impl::CudaBlasSingleton::singleton(); \
+      cublasSrot(singleton.handle, N, X.data(), one, Y.data(), one, &c, &s); \
+    } else { \
+      Rot<XV,YV,1,false,ETI_SPEC_AVAIL>::rot(X,Y,c,s); \
+    } \
+  } \
+};
+
+KOKKOSBLAS1_DROT_TPL_SPEC_DECL_CUBLAS( Kokkos::LayoutLeft, Kokkos::CudaSpace, true)
+KOKKOSBLAS1_DROT_TPL_SPEC_DECL_CUBLAS( Kokkos::LayoutLeft, Kokkos::CudaSpace, false)
+
+KOKKOSBLAS1_SROT_TPL_SPEC_DECL_CUBLAS( Kokkos::LayoutLeft, Kokkos::CudaSpace, true)
+KOKKOSBLAS1_SROT_TPL_SPEC_DECL_CUBLAS( Kokkos::LayoutLeft, Kokkos::CudaSpace, false)
+
+
+}
+}
+
+#endif
+
+#endif
@@ -0,0 +1,160 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#ifndef KOKKOSBLAS2_GER_TPL_SPEC_DECL_HPP_
+#define KOKKOSBLAS2_GER_TPL_SPEC_DECL_HPP_
+
+#ifdef KOKKOSKERNELS_ENABLE_TPL_BLAS
+extern "C" void dger_ ( const int* M, const int* N,
+                        const double* alpha,
+                        const double* X, const int* INCX,
+                        const double* Y, const int* INCY,
+                        double* A, const int* LDA);
+extern "C" void sger_ ( const int* M, const int* N,
+                        const float* alpha,
+                        const float* X, const int* INCX,
+                        const float* Y, const int* INCY,
+                        float* A, const int* LDA);
+extern "C" void zgeru_( const int* M, const int* N,
+                        const std::complex<double>* alpha,
+                        const std::complex<double>* X, const int* INCX,
+                        const std::complex<double>* Y, const int* INCY,
+                        std::complex<double>* A, const int* LDA);
+extern "C" void zgerc_( const int* M, const int* N,
+                        const std::complex<double>* alpha,
+                        const std::complex<double>* X, const int* INCX,
+                        const std::complex<double>* Y, const int* INCY,
+                        std::complex<double>* A, const int* LDA);
+extern "C" void cgeru_( const int* M, const int* N,
+                        const std::complex<float>* alpha,
+                        const std::complex<float>* X, const int* INCX,
+                        const std::complex<float>* Y, const int* INCY,
+                        std::complex<float>* A, const int* LDA);
+extern "C" void cgerc_( const int* M, const int* N,
+                        const std::complex<float>* alpha,
+                        const std::complex<float>* X, const int* INCX,
+                        const std::complex<float>* Y, const int* INCY,
+                        std::complex<float>* A, const int* LDA);
+
+namespace KokkosBlas {
+namespace Impl {
+
+// A LayoutRight matrix is seen by the BLAS as its transpose, which gets
+// the update y*x^T, so swap x and y. This is only instantiated for real
+// scalars, for which gerc is geru.
+#define KOKKOSBLAS2_XGER_BLAS( SCALAR_TYPE, BASE_SCALAR_TYPE, GERU_FN, GERC_FN, SCALAR_NAME, LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL ) \
+template<class ExecSpace> \
+struct GER< \
+     Kokkos::View<const SCALAR_TYPE*, Kokkos::LayoutLeft, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+                  Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+     Kokkos::View<const SCALAR_TYPE*, Kokkos::LayoutLeft, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+                  Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+     Kokkos::View<SCALAR_TYPE**, LAYOUT, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+                  Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+     true, ETI_SPEC_AVAIL> { \
+  typedef SCALAR_TYPE SCALAR; \
+  typedef Kokkos::View<const SCALAR*, Kokkos::LayoutLeft, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+      Kokkos::MemoryTraits<Kokkos::Unmanaged> > XViewType; \
+  typedef Kokkos::View<const SCALAR*, Kokkos::LayoutLeft, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+      Kokkos::MemoryTraits<Kokkos::Unmanaged> > YViewType; \
+  typedef Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+      Kokkos::MemoryTraits<Kokkos::Unmanaged> > AViewType; \
+ \
+  static void \
+  ger (const char trans[], \
+       typename AViewType::const_value_type& alpha, \
+       const XViewType& X, \
+       const YViewType& Y, \
+       const AViewType& A) { \
+    \
+    Kokkos::Profiling::pushRegion("KokkosBlas::ger[TPL_BLAS," SCALAR_NAME "]"); \
+    const bool conj = (trans[0]=='H') || (trans[0]=='h') || \
+                      (trans[0]=='C') || (trans[0]=='c'); \
+    constexpr int one = 1; \
+    \
+    const bool is_lr = std::is_same<Kokkos::LayoutRight,LAYOUT>::value; \
+    const int M = is_lr ? A.extent(1) : A.extent(0); \
+    const int N = is_lr ? A.extent(0) : A.extent(1); \
+    const int AST = is_lr?A.stride(0):A.stride(1), LDA = AST == 0 ? 1 : AST; \
+    const BASE_SCALAR_TYPE* x_blas = reinterpret_cast<const BASE_SCALAR_TYPE*>(is_lr ? Y.data() : X.data()); \
+    const BASE_SCALAR_TYPE* y_blas = reinterpret_cast<const BASE_SCALAR_TYPE*>(is_lr ? X.data() : Y.data()); \
+    \
+    if(conj) \
+      GERC_FN(&M,&N,reinterpret_cast<const BASE_SCALAR_TYPE*>(&alpha),x_blas,&one,y_blas,&one, \
+        reinterpret_cast<BASE_SCALAR_TYPE*>(A.data()),&LDA); \
+    else \
+      GERU_FN(&M,&N,reinterpret_cast<const BASE_SCALAR_TYPE*>(&alpha),x_blas,&one,y_blas,&one, \
+        reinterpret_cast<BASE_SCALAR_TYPE*>(A.data()),&LDA); \
+    Kokkos::Profiling::popRegion(); \
+  } \
+};
+
+#define KOKKOSBLAS2_DGER_BLAS( LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL ) \
+  KOKKOSBLAS2_XGER_BLAS( double, double, dger_, dger_, "double", LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL )
+#define KOKKOSBLAS2_SGER_BLAS( LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL ) \
+  KOKKOSBLAS2_XGER_BLAS( float, float, sger_, sger_, "float", LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL )
+#define KOKKOSBLAS2_ZGER_BLAS( LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL ) \
+  KOKKOSBLAS2_XGER_BLAS( Kokkos::complex<double>, std::complex<double>, zgeru_, zgerc_, "complex<double>", LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL )
+#define KOKKOSBLAS2_CGER_BLAS( LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL ) \
+  KOKKOSBLAS2_XGER_BLAS( Kokkos::complex<float>, std::complex<float>, cgeru_, cgerc_, "complex<float>", LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL )
+
+KOKKOSBLAS2_DGER_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS2_DGER_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS2_DGER_BLAS( Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS2_DGER_BLAS( Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+KOKKOSBLAS2_SGER_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS2_SGER_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS2_SGER_BLAS( Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS2_SGER_BLAS( Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+KOKKOSBLAS2_ZGER_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS2_ZGER_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+
+KOKKOSBLAS2_CGER_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS2_CGER_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+
+}
+}
+#endif // KOKKOSKERNELS_ENABLE_TPL_BLAS
+
+#endif
@@ -0,0 +1,128 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#ifndef KOKKOSBLAS2_SYMV_TPL_SPEC_DECL_HPP_
+#define KOKKOSBLAS2_SYMV_TPL_SPEC_DECL_HPP_
+
+#ifdef KOKKOSKERNELS_ENABLE_TPL_BLAS
+extern "C" void dsymv_( const char* uplo,
+                        const int* N,
+                        const double* alpha,
+                        const double* A, const int* LDA,
+                        const double* X, const int* INCX,
+                        const double* beta,
+                        double* Y, const int* INCY);
+extern "C" void ssymv_( const char* uplo,
+                        const int* N,
+                        const float* alpha,
+                        const float* A, const int* LDA,
+                        const float* X, const int* INCX,
+                        const float* beta,
+                        float* Y, const int* INCY);
+
+namespace KokkosBlas {
+namespace Impl {
+
+// A LayoutRight matrix is seen by the BLAS as its transpose, which for
+// a real symmetric matrix is the same matrix with the other triangle
+// stored, so just flip uplo. For real scalars hemv is symv.
+#define KOKKOSBLAS2_XSYMV_BLAS( SCALAR_TYPE, SYMV_FN, SCALAR_NAME, LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL ) \
+template<class ExecSpace> \
+struct SYMV< \
+     Kokkos::View<const SCALAR_TYPE**, LAYOUT, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+                  Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+     Kokkos::View<const SCALAR_TYPE*, Kokkos::LayoutLeft, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+                  Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+     Kokkos::View<SCALAR_TYPE*, Kokkos::LayoutLeft, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+                  Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+     true, ETI_SPEC_AVAIL> { \
+  typedef SCALAR_TYPE SCALAR; \
+  typedef Kokkos::View<const SCALAR**, LAYOUT, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+      Kokkos::MemoryTraits<Kokkos::Unmanaged> > AViewType; \
+  typedef Kokkos::View<const SCALAR*, Kokkos::LayoutLeft, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+      Kokkos::MemoryTraits<Kokkos::Unmanaged> > XViewType; \
+  typedef Kokkos::View<SCALAR*, Kokkos::LayoutLeft, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+      Kokkos::MemoryTraits<Kokkos::Unmanaged> > YViewType; \
+ \
+  static void \
+  symv (const char uplo[], \
+        const bool /* hermitian */, \
+        typename AViewType::const_value_type& alpha, \
+        const AViewType& A, \
+        const XViewType& X, \
+        typename YViewType::const_value_type& beta, \
+        const YViewType& Y) { \
+    \
+    Kokkos::Profiling::pushRegion("KokkosBlas::symv[TPL_BLAS," SCALAR_NAME "]"); \
+    const bool lower = (uplo[0]=='L') || (uplo[0]=='l'); \
+    const int N = A.extent(0); \
+    constexpr int one = 1; \
+    \
+    const bool is_lr = std::is_same<Kokkos::LayoutRight,LAYOUT>::value; \
+    const int AST = is_lr?A.stride(0):A.stride(1), LDA = AST == 0 ? 1 : AST; \
+    \
+    const char uplo_blas = (lower != is_lr) ? 'L' : 'U'; \
+    SYMV_FN(&uplo_blas,&N,&alpha,A.data(),&LDA,X.data(),&one,&beta,Y.data(),&one); \
+    Kokkos::Profiling::popRegion(); \
+  } \
+};
+
+#define KOKKOSBLAS2_DSYMV_BLAS( LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL ) \
+  KOKKOSBLAS2_XSYMV_BLAS( double, dsymv_, "double", LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL )
+#define KOKKOSBLAS2_SSYMV_BLAS( LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL ) \
+  KOKKOSBLAS2_XSYMV_BLAS( float, ssymv_, "float", LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL )
+
+KOKKOSBLAS2_DSYMV_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS2_DSYMV_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS2_DSYMV_BLAS( Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS2_DSYMV_BLAS( Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+KOKKOSBLAS2_SSYMV_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS2_SSYMV_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS2_SSYMV_BLAS( Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS2_SSYMV_BLAS( Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+}
+}
+#endif // KOKKOSKERNELS_ENABLE_TPL_BLAS
+
+#endif
@@ -0,0 +1,134 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#ifndef KOKKOSBLAS2_SYR_TPL_SPEC_DECL_HPP_
+#define KOKKOSBLAS2_SYR_TPL_SPEC_DECL_HPP_
+
+#ifdef KOKKOSKERNELS_ENABLE_TPL_BLAS
+extern "C" void dsyr_ ( const char* UPLO, const int* N,
+                        const double* alpha,
+                        const double* X, const int* INCX,
+                        double* A, const int* LDA);
+extern "C" void ssyr_ ( const char* UPLO, const int* N,
+                        const float* alpha,
+                        const float* X, const int* INCX,
+                        float* A, const int* LDA);
+extern "C" void dsyr2_( const char* UPLO, const int* N,
+                        const double* alpha,
+                        const double* X, const int* INCX,
+                        const double* Y, const int* INCY,
+                        double* A, const int* LDA);
+extern "C" void ssyr2_( const char* UPLO, const int* N,
+                        const float* alpha,
+                        const float* X, const int* INCX,
+                        const float* Y, const int* INCY,
+                        float* A, const int* LDA);
+
+namespace KokkosBlas {
+namespace Impl {
+
+// A LayoutRight matrix is seen by the BLAS as its transpose, so the
+// referenced triangle flips. For real scalars trans has no effect.
+#define KOKKOSBLAS2_XSYR_BLAS( SCALAR_TYPE, SYR_FN, SYR2_FN, SCALAR_NAME, LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL ) \
+template<class ExecSpace> \
+struct SYR< \
+     Kokkos::View<const SCALAR_TYPE*, Kokkos::LayoutLeft, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+                  Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+     Kokkos::View<const SCALAR_TYPE*, Kokkos::LayoutLeft, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+                  Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+     Kokkos::View<SCALAR_TYPE**, LAYOUT, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+                  Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+     true, ETI_SPEC_AVAIL> { \
+  typedef SCALAR_TYPE SCALAR; \
+  typedef Kokkos::View<const SCALAR*, Kokkos::LayoutLeft, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+      Kokkos::MemoryTraits<Kokkos::Unmanaged> > XViewType; \
+  typedef Kokkos::View<const SCALAR*, Kokkos::LayoutLeft, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+      Kokkos::MemoryTraits<Kokkos::Unmanaged> > YViewType; \
+  typedef Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+      Kokkos::MemoryTraits<Kokkos::Unmanaged> > AViewType; \
+ \
+  static void \
+  syr (const char /* trans */[], \
+       const char uplo[], \
+       const bool rank2, \
+       typename AViewType::const_value_type& alpha, \
+       const XViewType& X, \
+       const YViewType& Y, \
+       const AViewType& A) { \
+    \
+    Kokkos::Profiling::pushRegion("KokkosBlas::syr[TPL_BLAS," SCALAR_NAME "]"); \
+    const bool lower = (uplo[0]=='L') || (uplo[0]=='l'); \
+    constexpr int one = 1; \
+    \
+    const bool is_lr = std::is_same<Kokkos::LayoutRight,LAYOUT>::value; \
+    const char uplo_blas = (lower != is_lr) ? 'L' : 'U'; \
+    const int N = A.extent(0); \
+    const int AST = is_lr?A.stride(0):A.stride(1), LDA = AST == 0 ? 1 : AST; \
+    \
+    if(rank2) \
+      SYR2_FN(&uplo_blas,&N,&alpha,X.data(),&one,Y.data(),&one,A.data(),&LDA); \
+    else \
+      SYR_FN(&uplo_blas,&N,&alpha,X.data(),&one,A.data(),&LDA); \
+    Kokkos::Profiling::popRegion(); \
+  } \
+};
+
+#define KOKKOSBLAS2_DSYR_BLAS( LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL ) \
+  KOKKOSBLAS2_XSYR_BLAS( double, dsyr_, dsyr2_, "double", LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL )
+#define KOKKOSBLAS2_SSYR_BLAS( LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL ) \
+  KOKKOSBLAS2_XSYR_BLAS( float, ssyr_, ssyr2_, "float", LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL )
+
+KOKKOSBLAS2_DSYR_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS2_DSYR_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS2_DSYR_BLAS( Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS2_DSYR_BLAS( Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+KOKKOSBLAS2_SSYR_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS2_SSYR_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS2_SSYR_BLAS( Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS2_SSYR_BLAS( Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+}
+}
+#endif // KOKKOSKERNELS_ENABLE_TPL_BLAS
+
+#endif
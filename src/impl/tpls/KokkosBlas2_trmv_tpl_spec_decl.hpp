@@ -0,0 +1,138 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#ifndef KOKKOSBLAS2_TRMV_TPL_SPEC_DECL_HPP_
+#define KOKKOSBLAS2_TRMV_TPL_SPEC_DECL_HPP_
+
+#ifdef KOKKOSKERNELS_ENABLE_TPL_BLAS
+extern "C" void dtrmv_( const char* uplo, const char* trans, const char* diag,
+                        const int* N,
+                        const double* A, const int* LDA,
+                        double* X, const int* INCX);
+extern "C" void strmv_( const char* uplo, const char* trans, const char* diag,
+                        const int* N,
+                        const float* A, const int* LDA,
+                        float* X, const int* INCX);
+extern "C" void ztrmv_( const char* uplo, const char* trans, const char* diag,
+                        const int* N,
+                        const std::complex<double>* A, const int* LDA,
+                        std::complex<double>* X, const int* INCX);
+extern "C" void ctrmv_( const char* uplo, const char* trans, const char* diag,
+                        const int* N,
+                        const std::complex<float>* A, const int* LDA,
+                        std::complex<float>* X, const int* INCX);
+
+namespace KokkosBlas {
+namespace Impl {
+
+// A LayoutRight matrix is seen by the BLAS as its transpose, so flip
+// uplo and trans. This is only instantiated for real scalars, for which
+// 'C' is the same as 'T'.
+#define KOKKOSBLAS2_XTRMV_BLAS( SCALAR_TYPE, BASE_SCALAR_TYPE, TRMV_FN, SCALAR_NAME, LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL ) \
+template<class ExecSpace> \
+struct TRMV< \
+     Kokkos::View<const SCALAR_TYPE**, LAYOUT, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+                  Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+     Kokkos::View<SCALAR_TYPE*, Kokkos::LayoutLeft, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+                  Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+     true, ETI_SPEC_AVAIL> { \
+  typedef SCALAR_TYPE SCALAR; \
+  typedef Kokkos::View<const SCALAR**, LAYOUT, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+      Kokkos::MemoryTraits<Kokkos::Unmanaged> > AViewType; \
+  typedef Kokkos::View<SCALAR*, Kokkos::LayoutLeft, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+      Kokkos::MemoryTraits<Kokkos::Unmanaged> > XViewType; \
+ \
+  static void \
+  trmv (const char uplo[], \
+        const char trans[], \
+        const char diag[], \
+        const AViewType& A, \
+        const XViewType& X) { \
+    \
+    Kokkos::Profiling::pushRegion("KokkosBlas::trmv[TPL_BLAS," SCALAR_NAME "]"); \
+    const bool lower = (uplo[0]=='L') || (uplo[0]=='l'); \
+    const bool A_t = (trans[0]!='N') && (trans[0]!='n'); \
+    const int N = A.extent(0); \
+    constexpr int one = 1; \
+    \
+    const bool is_lr = std::is_same<Kokkos::LayoutRight,LAYOUT>::value; \
+    const int AST = is_lr?A.stride(0):A.stride(1), LDA = AST == 0 ? 1 : AST; \
+    \
+    const char uplo_blas = (lower != is_lr) ? 'L' : 'U'; \
+    const char trans_blas = is_lr ? (A_t ? 'N' : 'T') : trans[0]; \
+    TRMV_FN(&uplo_blas,&trans_blas,diag,&N, \
+      reinterpret_cast<const BASE_SCALAR_TYPE*>(A.data()),&LDA, \
+      reinterpret_cast<BASE_SCALAR_TYPE*>(X.data()),&one); \
+    Kokkos::Profiling::popRegion(); \
+  } \
+};
+
+#define KOKKOSBLAS2_DTRMV_BLAS( LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL ) \
+  KOKKOSBLAS2_XTRMV_BLAS( double, double, dtrmv_, "double", LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL )
+#define KOKKOSBLAS2_STRMV_BLAS( LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL ) \
+  KOKKOSBLAS2_XTRMV_BLAS( float, float, strmv_, "float", LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL )
+#define KOKKOSBLAS2_ZTRMV_BLAS( LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL ) \
+  KOKKOSBLAS2_XTRMV_BLAS( Kokkos::complex<double>, std::complex<double>, ztrmv_, "complex<double>", LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL )
+#define KOKKOSBLAS2_CTRMV_BLAS( LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL ) \
+  KOKKOSBLAS2_XTRMV_BLAS( Kokkos::complex<float>, std::complex<float>, ctrmv_, "complex<float>", LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL )
+
+KOKKOSBLAS2_DTRMV_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS2_DTRMV_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS2_DTRMV_BLAS( Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS2_DTRMV_BLAS( Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+KOKKOSBLAS2_STRMV_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS2_STRMV_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS2_STRMV_BLAS( Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS2_STRMV_BLAS( Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+KOKKOSBLAS2_ZTRMV_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS2_ZTRMV_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+
+KOKKOSBLAS2_CTRMV_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS2_CTRMV_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+
+}
+}
+#endif // KOKKOSKERNELS_ENABLE_TPL_BLAS
+
+#endif
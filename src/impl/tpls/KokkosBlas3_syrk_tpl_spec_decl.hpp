@@ -0,0 +1,177 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOSBLAS3_SYRK_TPL_SPEC_DECL_HPP_
+#define KOKKOSBLAS3_SYRK_TPL_SPEC_DECL_HPP_
+
+#ifdef KOKKOSKERNELS_ENABLE_TPL_BLAS
+extern "C" void dsyrk_( const char* uplo, const char* trans,
+                        const int* N, const int* K,
+                        const double* alpha,
+                        const double* A, const int* LDA,
+                        const double* beta,
+                        double* C, const int* LDC);
+extern "C" void ssyrk_( const char* uplo, const char* trans,
+                        const int* N, const int* K,
+                        const float* alpha,
+                        const float* A, const int* LDA,
+                        const float* beta,
+                        float* C, const int* LDC);
+extern "C" void zsyrk_( const char* uplo, const char* trans,
+                        const int* N, const int* K,
+                        const std::complex<double>* alpha,
+                        const std::complex<double>* A, const int* LDA,
+                        const std::complex<double>* beta,
+                        std::complex<double>* C, const int* LDC);
+extern "C" void csyrk_( const char* uplo, const char* trans,
+                        const int* N, const int* K,
+                        const std::complex<float>* alpha,
+                        const std::complex<float>* A, const int* LDA,
+                        const std::complex<float>* beta,
+                        std::complex<float>* C, const int* LDC);
+extern "C" void zherk_( const char* uplo, const char* trans,
+                        const int* N, const int* K,
+                        const double* alpha,
+                        const std::complex<double>* A, const int* LDA,
+                        const double* beta,
+                        std::complex<double>* C, const int* LDC);
+extern "C" void cherk_( const char* uplo, const char* trans,
+                        const int* N, const int* K,
+                        const float* alpha,
+                        const std::complex<float>* A, const int* LDA,
+                        const float* beta,
+                        std::complex<float>* C, const int* LDC);
+
+namespace KokkosBlas {
+namespace Impl {
+
+// A LayoutRight matrix is seen by the BLAS as its transpose. Since C is
+// symmetric (Hermitian), C^T (conj(C)) has the data of C's other triangle
+// and is updated with op(A) transposed, so flip uplo and trans.
+// For real scalars herk is syrk, the ?syrk_ routines accept trans = 'C'.
+#define KOKKOSBLAS3_XSYRK_BLAS( SCALAR_TYPE, BASE_SCALAR_TYPE, MAG_TYPE, SYRK_FN, HERK_FN, SCALAR_NAME, LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL ) \
+template<class ExecSpace> \
+struct SYRK< \
+     Kokkos::View<const SCALAR_TYPE**, LAYOUT, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+                  Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+     Kokkos::View<SCALAR_TYPE**, LAYOUT, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+                  Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+     true, ETI_SPEC_AVAIL> { \
+  typedef SCALAR_TYPE SCALAR; \
+  typedef Kokkos::View<const SCALAR**, LAYOUT, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+      Kokkos::MemoryTraits<Kokkos::Unmanaged> > AViewType; \
+  typedef Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+      Kokkos::MemoryTraits<Kokkos::Unmanaged> > CViewType; \
+ \
+  static void \
+  syrk (const char uplo[], \
+        const char trans[], \
+        const bool hermitian, \
+        typename AViewType::const_value_type& alpha, \
+        const AViewType& A, \
+        typename CViewType::const_value_type& beta, \
+        const CViewType& C) { \
+    \
+    Kokkos::Profiling::pushRegion("KokkosBlas::syrk[TPL_BLAS," SCALAR_NAME "]"); \
+    const bool A_t = (trans[0]!='N') && (trans[0]!='n'); \
+    const bool lower = (uplo[0]=='L') || (uplo[0]=='l'); \
+    const int N = C.extent(0); \
+    const int K = A.extent(A_t?0:1); \
+    \
+    const bool is_lr = std::is_same<Kokkos::LayoutRight,LAYOUT>::value; \
+    \
+    const int AST = is_lr?A.stride(0):A.stride(1), LDA = AST == 0 ? 1 : AST; \
+    const int CST = is_lr?C.stride(0):C.stride(1), LDC = CST == 0 ? 1 : CST; \
+    \
+    const char uplo_blas = (lower != is_lr) ? 'L' : 'U'; \
+    if(hermitian) { \
+      const char trans_blas = (A_t != is_lr) ? 'C' : 'N'; \
+      const MAG_TYPE alpha_r = Kokkos::Details::ArithTraits<SCALAR>::real(alpha); \
+      const MAG_TYPE beta_r = Kokkos::Details::ArithTraits<SCALAR>::real(beta); \
+      HERK_FN(&uplo_blas,&trans_blas,&N,&K, \
+        &alpha_r,reinterpret_cast<const BASE_SCALAR_TYPE*>(A.data()),&LDA, \
+        &beta_r,reinterpret_cast<BASE_SCALAR_TYPE*>(C.data()),&LDC); \
+    } else { \
+      const char trans_blas = (A_t != is_lr) ? 'T' : 'N'; \
+      SYRK_FN(&uplo_blas,&trans_blas,&N,&K, \
+        reinterpret_cast<const BASE_SCALAR_TYPE*>(&alpha),reinterpret_cast<const BASE_SCALAR_TYPE*>(A.data()),&LDA, \
+        reinterpret_cast<const BASE_SCALAR_TYPE*>(&beta),reinterpret_cast<BASE_SCALAR_TYPE*>(C.data()),&LDC); \
+    } \
+    Kokkos::Profiling::popRegion(); \
+  } \
+};
+
+#define KOKKOSBLAS3_DSYRK_BLAS( LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL ) \
+  KOKKOSBLAS3_XSYRK_BLAS( double, double, double, dsyrk_, dsyrk_, "double", LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL )
+#define KOKKOSBLAS3_SSYRK_BLAS( LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL ) \
+  KOKKOSBLAS3_XSYRK_BLAS( float, float, float, ssyrk_, ssyrk_, "float", LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL )
+#define KOKKOSBLAS3_ZSYRK_BLAS( LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL ) \
+  KOKKOSBLAS3_XSYRK_BLAS( Kokkos::complex<double>, std::complex<double>, double, zsyrk_, zherk_, "complex<double>", LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL )
+#define KOKKOSBLAS3_CSYRK_BLAS( LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL ) \
+  KOKKOSBLAS3_XSYRK_BLAS( Kokkos::complex<float>, std::complex<float>, float, csyrk_, cherk_, "complex<float>", LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL )
+
+KOKKOSBLAS3_DSYRK_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS3_DSYRK_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS3_DSYRK_BLAS( Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS3_DSYRK_BLAS( Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+KOKKOSBLAS3_SSYRK_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS3_SSYRK_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS3_SSYRK_BLAS( Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS3_SSYRK_BLAS( Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+KOKKOSBLAS3_ZSYRK_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS3_ZSYRK_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS3_ZSYRK_BLAS( Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS3_ZSYRK_BLAS( Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+KOKKOSBLAS3_CSYRK_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS3_CSYRK_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS3_CSYRK_BLAS( Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS3_CSYRK_BLAS( Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+}
+}
+#endif // KOKKOSKERNELS_ENABLE_TPL_BLAS
+
+#endif
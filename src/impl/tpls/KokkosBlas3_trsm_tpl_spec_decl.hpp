@@ -0,0 +1,161 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOSBLAS3_TRSM_TPL_SPEC_DECL_HPP_
+#define KOKKOSBLAS3_TRSM_TPL_SPEC_DECL_HPP_
+
+#ifdef KOKKOSKERNELS_ENABLE_TPL_BLAS
+extern "C" void dtrsm_( const char* side, const char* uplo,
+                        const char* transA, const char* diag,
+                        const int* M, const int* N,
+                        const double* alpha,
+                        const double* A, const int* LDA,
+                        double* B, const int* LDB);
+extern "C" void strsm_( const char* side, const char* uplo,
+                        const char* transA, const char* diag,
+                        const int* M, const int* N,
+                        const float* alpha,
+                        const float* A, const int* LDA,
+                        float* B, const int* LDB);
+extern "C" void ztrsm_( const char* side, const char* uplo,
+                        const char* transA, const char* diag,
+                        const int* M, const int* N,
+                        const std::complex<double>* alpha,
+                        const std::complex<double>* A, const int* LDA,
+                        std::complex<double>* B, const int* LDB);
+extern "C" void ctrsm_( const char* side, const char* uplo,
+                        const char* transA, const char* diag,
+                        const int* M, const int* N,
+                        const std::complex<float>* alpha,
+                        const std::complex<float>* A, const int* LDA,
+                        std::complex<float>* B, const int* LDB);
+
+namespace KokkosBlas {
+namespace Impl {
+
+// A LayoutRight B is seen by the BLAS as B^T, and op(A)*X = B is the same
+// as X^T*op(A)^T = B^T. Since A is transposed as well, op(A)^T on the BLAS
+// side uses the same trans, but side and uplo are flipped and M and N
+// swapped.
+#define KOKKOSBLAS3_XTRSM_BLAS( SCALAR_TYPE, BASE_SCALAR_TYPE, BLAS_FN, SCALAR_NAME, LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL ) \
+template<class ExecSpace> \
+struct TRSM< \
+     Kokkos::View<const SCALAR_TYPE**, LAYOUT, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+                  Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+     Kokkos::View<SCALAR_TYPE**, LAYOUT, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+                  Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+     true, ETI_SPEC_AVAIL> { \
+  typedef SCALAR_TYPE SCALAR; \
+  typedef Kokkos::View<const SCALAR**, LAYOUT, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+      Kokkos::MemoryTraits<Kokkos::Unmanaged> > AViewType; \
+  typedef Kokkos::View<SCALAR**, LAYOUT, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+      Kokkos::MemoryTraits<Kokkos::Unmanaged> > BViewType; \
+ \
+  static void \
+  trsm (const char side[], \
+        const char uplo[], \
+        const char transA[], \
+        const char diag[], \
+        typename BViewType::const_value_type& alpha, \
+        const AViewType& A, \
+        const BViewType& B) { \
+    \
+    Kokkos::Profiling::pushRegion("KokkosBlas::trsm[TPL_BLAS," SCALAR_NAME "]"); \
+    const bool left = (side[0]=='L') || (side[0]=='l'); \
+    const bool lower = (uplo[0]=='L') || (uplo[0]=='l'); \
+    const int M = B.extent(0); \
+    const int N = B.extent(1); \
+    \
+    const bool is_lr = std::is_same<Kokkos::LayoutRight,LAYOUT>::value; \
+    \
+    const int AST = is_lr?A.stride(0):A.stride(1), LDA = AST == 0 ? 1 : AST; \
+    const int BST = is_lr?B.stride(0):B.stride(1), LDB = BST == 0 ? 1 : BST; \
+    \
+    const char side_blas = (left != is_lr) ? 'L' : 'R'; \
+    const char uplo_blas = (lower != is_lr) ? 'L' : 'U'; \
+    if(!is_lr) \
+      BLAS_FN(&side_blas,&uplo_blas,transA,diag,&M,&N, \
+        reinterpret_cast<const BASE_SCALAR_TYPE*>(&alpha),reinterpret_cast<const BASE_SCALAR_TYPE*>(A.data()),&LDA, \
+        reinterpret_cast<BASE_SCALAR_TYPE*>(B.data()),&LDB); \
+    else \
+      BLAS_FN(&side_blas,&uplo_blas,transA,diag,&N,&M, \
+        reinterpret_cast<const BASE_SCALAR_TYPE*>(&alpha),reinterpret_cast<const BASE_SCALAR_TYPE*>(A.data()),&LDA, \
+        reinterpret_cast<BASE_SCALAR_TYPE*>(B.data()),&LDB); \
+    Kokkos::Profiling::popRegion(); \
+  } \
+};
+
+#define KOKKOSBLAS3_DTRSM_BLAS( LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL ) \
+  KOKKOSBLAS3_XTRSM_BLAS( double, double, dtrsm_, "double", LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL )
+#define KOKKOSBLAS3_STRSM_BLAS( LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL ) \
+  KOKKOSBLAS3_XTRSM_BLAS( float, float, strsm_, "float", LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL )
+#define KOKKOSBLAS3_ZTRSM_BLAS( LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL ) \
+  KOKKOSBLAS3_XTRSM_BLAS( Kokkos::complex<double>, std::complex<double>, ztrsm_, "complex<double>", LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL )
+#define KOKKOSBLAS3_CTRSM_BLAS( LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL ) \
+  KOKKOSBLAS3_XTRSM_BLAS( Kokkos::complex<float>, std::complex<float>, ctrsm_, "complex<float>", LAYOUT, MEM_SPACE, ETI_SPEC_AVAIL )
+
+KOKKOSBLAS3_DTRSM_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS3_DTRSM_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS3_DTRSM_BLAS( Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS3_DTRSM_BLAS( Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+KOKKOSBLAS3_STRSM_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS3_STRSM_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS3_STRSM_BLAS( Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS3_STRSM_BLAS( Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+KOKKOSBLAS3_ZTRSM_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS3_ZTRSM_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS3_ZTRSM_BLAS( Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS3_ZTRSM_BLAS( Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+KOKKOSBLAS3_CTRSM_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS3_CTRSM_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS3_CTRSM_BLAS( Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS3_CTRSM_BLAS( Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+}
+}
+#endif // KOKKOSKERNELS_ENABLE_TPL_BLAS
+
+#endif
@@ -0,0 +1,139 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file KokkosSparse_block_jacobi.hpp
+/// \brief Block Jacobi preconditioner, using the batched dense LU on
+///   the diagonal blocks of a sparse matrix.
+///
+/// Typical usage:
+/// \code
+///   Kokkos::View<scalar_type***, device_type> D ("D", numBlocks, bs, bs);
+///   KokkosSparse::getDiagBlocksCopy (D, A);
+///   KokkosSparse::Experimental::block_jacobi_numeric (D);
+///   KokkosSparse::Experimental::block_jacobi_apply (D, x, y); // x = D^{-1} y
+/// \endcode
+
+#ifndef KOKKOS_SPARSE_BLOCK_JACOBI_HPP_
+#define KOKKOS_SPARSE_BLOCK_JACOBI_HPP_
+
+#include "KokkosSparse_getDiagBlocksCopy.hpp"
+#include "KokkosSparse_block_jacobi_impl.hpp"
+#include <type_traits>
+
+namespace KokkosSparse {
+namespace Experimental {
+
+/// \brief Factors all diagonal blocks of D in place, in one batched launch.
+///
+/// \param D [in/out] 3-D Kokkos::View (numBlocks, bs, bs) of diagonal
+///   blocks, e.g. from KokkosSparse::getDiagBlocksCopy.  On output it
+///   holds the LU factors (no pivoting) of the blocks, or their inverses
+///   if \c explicit_inverse is true.
+/// \param explicit_inverse [in] If true, the blocks are inverted with
+///   InverseLU, and block_jacobi_apply uses Gemv instead of two Trsv.
+///   This is faster to apply for small blocks, at the cost of an extra
+///   O(bs^3) setup per block.
+///
+/// For host views of floating point types, the blocks are factored in
+/// the compact SIMD layout: they are packed l = DefaultVectorLength at a
+/// time into a temporary view of Vector<SIMD<T>,l>, factored there, and
+/// unpacked back into D.  The temporary is as large as D, rounded up to
+/// a multiple of l blocks (twice that with \c explicit_inverse).  On
+/// GPUs each thread factors one block in the scalar layout.
+/// block_jacobi_apply always works one block per thread on the scalar
+/// layout of D.
+template<class DiagBlocksType>
+void
+block_jacobi_numeric (const DiagBlocksType& D,
+                      const bool explicit_inverse = false)
+{
+  static_assert (Kokkos::Impl::is_view<DiagBlocksType>::value,
+                 "The DiagBlocksType template parameter must be a Kokkos::View.");
+  static_assert (static_cast<int> (DiagBlocksType::rank) == 3,
+                 "The DiagBlocksType template parameter must be a 3-D Kokkos::View.");
+
+  Impl::block_jacobi_numeric_impl (D, explicit_inverse,
+                                   std::integral_constant<bool, Impl::BlockJacobiUseCompact<DiagBlocksType>::value> ());
+}
+
+/// \brief Applies the block Jacobi preconditioner, x = D^{-1} y.
+///
+/// \param D [in] Diagonal blocks factored by block_jacobi_numeric.
+/// \param x [out] 1-D Kokkos::View, of the same length as y.
+/// \param y [in] 1-D Kokkos::View.  Its length may be less than
+///   numBlocks * bs; the last block is then partial.
+/// \param explicit_inverse [in] Must match the value given to block_jacobi_numeric.
+template<class DiagBlocksType,
+         class XType,
+         class YType>
+void
+block_jacobi_apply (const DiagBlocksType& D,
+                    const XType& x,
+                    const YType& y,
+                    const bool explicit_inverse = false)
+{
+  static_assert (Kokkos::Impl::is_view<XType>::value && static_cast<int> (XType::rank) == 1,
+                 "The XType template parameter must be a 1-D Kokkos::View.");
+  static_assert (Kokkos::Impl::is_view<YType>::value && static_cast<int> (YType::rank) == 1,
+                 "The YType template parameter must be a 1-D Kokkos::View.");
+  static_assert (std::is_same<typename XType::value_type, typename XType::non_const_value_type>::value,
+                 "The XType template parameter must be a nonconst Kokkos::View.");
+
+  typedef typename DiagBlocksType::execution_space execution_space;
+  typedef typename DiagBlocksType::size_type size_type;
+
+  const size_type bs = D.extent(1);
+  if (x.extent(0) != y.extent(0) || bs * D.extent(0) < y.extent(0)) {
+    Kokkos::Impl::throw_runtime_exception ("KokkosSparse::block_jacobi_apply: Dimensions of D, x and y do not match.");
+  }
+  const size_type numBlocks = bs == 0 ? 0 : (y.extent(0) + bs - 1) / bs;
+
+  Impl::BlockJacobiApplyFunctor<DiagBlocksType, XType, YType> functor (D, x, y, explicit_inverse);
+  Kokkos::parallel_for ("KokkosSparse::block_jacobi_apply",
+                        Kokkos::RangePolicy<execution_space> (0, numBlocks), functor);
+}
+
+} // namespace Experimental
+} // namespace KokkosSparse
+
+#endif // KOKKOS_SPARSE_BLOCK_JACOBI_HPP_
@@ -49,6 +49,29 @@
 
 namespace KokkosSparse{
 
+  namespace Impl{
+
+    //x and y of the apply functions are either vectors, or 2D views with a column for each right hand side.
+    template <typename internal_view_t, typename view_t>
+    internal_view_t gs_unmanaged_vector(const view_t &v, std::false_type){
+      return internal_view_t(v.data(), v.extent(0));
+    }
+
+    template <typename internal_view_t, typename view_t>
+    internal_view_t gs_unmanaged_vector(const view_t &v, std::true_type){
+      static_assert (!std::is_same<typename internal_view_t::array_layout, Kokkos::LayoutStride>::value,
+                     "KokkosSparse::gauss_seidel_apply: multiple right hand sides should be in LayoutLeft or LayoutRight.");
+      return internal_view_t(v.data(), v.extent(0), v.extent(1));
+    }
+
+    template <typename internal_view_t, typename view_t>
+    internal_view_t gs_unmanaged_vector(const view_t &v){
+      static_assert (view_t::rank == 1 || view_t::rank == 2,
+                     "KokkosSparse::gauss_seidel_apply: x and y should be rank 1 or rank 2 views.");
+      return gs_unmanaged_vector<internal_view_t>(v, std::integral_constant<bool, view_t::rank == 2>());
+    }
+  }
+
   namespace Experimental{
 
     template <typename KernelHandle, typename lno_row_view_t_, typename lno_nnz_view_t_>
@@ -286,6 +309,12 @@ namespace KokkosSparse{
                            );
     }
 
+    /// \brief Applies numIter symmetric Gauss-Seidel sweeps (a forward sweep followed by a backward sweep).
+    ///
+    /// Each row is updated as x_i += omega * (y_i - A_i x) / a_ii, so this is SSOR when omega != 1.
+    /// It is the parallel counterpart of KokkosSparse::Impl::Sequential::gaussSeidel, where the rows
+    /// are visited in the order of the colors (or clusters) instead of the order of the row indices.
+    /// x and y are either vectors, or 2D views with a column for each right hand side.
     template <typename KernelHandle,
               typename lno_row_view_t_,
               typename lno_nnz_view_t_,
@@ -360,13 +389,13 @@ namespace KokkosSparse{
 
 
       typedef Kokkos::View<
-        typename y_scalar_view_t::const_value_type*,
+        typename y_scalar_view_t::const_data_type,
         typename KokkosKernels::Impl::GetUnifiedLayout<y_scalar_view_t>::array_layout,
         typename y_scalar_view_t::device_type,
         Kokkos::MemoryTraits<Kokkos::Unmanaged> > Internal_yscalar_nnz_view_t_;
 
       typedef Kokkos::View<
-        typename x_scalar_view_t::non_const_value_type*,
+        typename x_scalar_view_t::non_const_data_type,
         typename KokkosKernels::Impl::GetUnifiedLayout<x_scalar_view_t>::array_layout,
         typename x_scalar_view_t::device_type,
         Kokkos::MemoryTraits<Kokkos::Unmanaged> > Internal_xscalar_nnz_view_t_;
@@ -384,8 +413,8 @@ namespace KokkosSparse{
       Internal_alno_nnz_view_t_ const_a_l (entries.data(), entries.extent(0));
       Internal_ascalar_nnz_view_t_ const_a_v (values.data(), values.extent(0));
 
-      Internal_xscalar_nnz_view_t_ nonconst_x_v (x_lhs_output_vec.data(), x_lhs_output_vec.extent(0));
-      Internal_yscalar_nnz_view_t_ const_y_v (y_rhs_input_vec.data(), y_rhs_input_vec.extent(0));
+      Internal_xscalar_nnz_view_t_ nonconst_x_v = KokkosSparse::Impl::gs_unmanaged_vector<Internal_xscalar_nnz_view_t_>(x_lhs_output_vec);
+      Internal_yscalar_nnz_view_t_ const_y_v = KokkosSparse::Impl::gs_unmanaged_vector<Internal_yscalar_nnz_view_t_>(y_rhs_input_vec);
 
       using namespace KokkosSparse::Impl;
 
@@ -435,6 +464,8 @@ namespace KokkosSparse{
                                    omega,
                                    numIter);
     }
+    /// \brief Applies numIter forward Gauss-Seidel (SOR for omega != 1) sweeps.
+    /// See symmetric_gauss_seidel_apply for the update and the arguments.
     template <class KernelHandle,
               typename lno_row_view_t_,
               typename lno_nnz_view_t_,
@@ -509,13 +540,13 @@ namespace KokkosSparse{
 
 
       typedef Kokkos::View<
-        typename y_scalar_view_t::const_value_type*,
+        typename y_scalar_view_t::const_data_type,
         typename KokkosKernels::Impl::GetUnifiedLayout<y_scalar_view_t>::array_layout,
         typename y_scalar_view_t::device_type,
         Kokkos::MemoryTraits<Kokkos::Unmanaged> > Internal_yscalar_nnz_view_t_;
 
       typedef Kokkos::View<
-        typename x_scalar_view_t::non_const_value_type*,
+        typename x_scalar_view_t::non_const_data_type,
         typename KokkosKernels::Impl::GetUnifiedLayout<x_scalar_view_t>::array_layout,
         typename x_scalar_view_t::device_type,
         Kokkos::MemoryTraits<Kokkos::Unmanaged> > Internal_xscalar_nnz_view_t_;
@@ -532,8 +563,8 @@ namespace KokkosSparse{
       Internal_alno_nnz_view_t_ const_a_l (entries.data(), entries.extent(0));
       Internal_ascalar_nnz_view_t_ const_a_v (values.data(), values.extent(0));
 
-      Internal_xscalar_nnz_view_t_ nonconst_x_v (x_lhs_output_vec.data(), x_lhs_output_vec.extent(0));
-      Internal_yscalar_nnz_view_t_ const_y_v (y_rhs_input_vec.data(), y_rhs_input_vec.extent(0));
+      Internal_xscalar_nnz_view_t_ nonconst_x_v = KokkosSparse::Impl::gs_unmanaged_vector<Internal_xscalar_nnz_view_t_>(x_lhs_output_vec);
+      Internal_yscalar_nnz_view_t_ const_y_v = KokkosSparse::Impl::gs_unmanaged_vector<Internal_yscalar_nnz_view_t_>(y_rhs_input_vec);
 
 
 
@@ -586,6 +617,8 @@ namespace KokkosSparse{
                                        omega,
                                        numIter);
     }
+    /// \brief Applies numIter backward Gauss-Seidel (SOR for omega != 1) sweeps, visiting the colors in reverse order.
+    /// See symmetric_gauss_seidel_apply for the update and the arguments.
     template <class KernelHandle,
               typename lno_row_view_t_,
               typename lno_nnz_view_t_,
@@ -660,13 +693,13 @@ namespace KokkosSparse{
 
 
       typedef Kokkos::View<
-        typename y_scalar_view_t::const_value_type*,
+        typename y_scalar_view_t::const_data_type,
         typename KokkosKernels::Impl::GetUnifiedLayout<y_scalar_view_t>::array_layout,
         typename y_scalar_view_t::device_type,
         Kokkos::MemoryTraits<Kokkos::Unmanaged> > Internal_yscalar_nnz_view_t_;
 
       typedef Kokkos::View<
-        typename x_scalar_view_t::non_const_value_type*,
+        typename x_scalar_view_t::non_const_data_type,
         typename KokkosKernels::Impl::GetUnifiedLayout<x_scalar_view_t>::array_layout,
         typename x_scalar_view_t::device_type,
         Kokkos::MemoryTraits<Kokkos::Unmanaged> > Internal_xscalar_nnz_view_t_;
@@ -682,8 +715,8 @@ namespace KokkosSparse{
       Internal_alno_nnz_view_t_ const_a_l (entries.data(), entries.extent(0));
       Internal_ascalar_nnz_view_t_ const_a_v (values.data(), values.extent(0));
 
-      Internal_xscalar_nnz_view_t_ nonconst_x_v (x_lhs_output_vec.data(), x_lhs_output_vec.extent(0));
-      Internal_yscalar_nnz_view_t_ const_y_v (y_rhs_input_vec.data(), y_rhs_input_vec.extent(0));
+      Internal_xscalar_nnz_view_t_ nonconst_x_v = KokkosSparse::Impl::gs_unmanaged_vector<Internal_xscalar_nnz_view_t_>(x_lhs_output_vec);
+      Internal_yscalar_nnz_view_t_ const_y_v = KokkosSparse::Impl::gs_unmanaged_vector<Internal_yscalar_nnz_view_t_>(y_rhs_input_vec);
 
 
       using namespace KokkosSparse::Impl;
@@ -50,7 +50,10 @@
 
 namespace KokkosSparse{
 
-  enum GSAlgorithm{GS_DEFAULT, GS_PERMUTED, GS_TEAM};
+  //GS_TWOSTAGE does not color the graph. It splits A into L+D+U and approximates
+  //the triangular solve of each sweep with a number of inner Jacobi sweeps.
+  //GS_CLUSTER colors clusters of consecutive rows, and the rows of a cluster are relaxed sequentially by one thread.
+  enum GSAlgorithm{GS_DEFAULT, GS_PERMUTED, GS_TEAM, GS_TWOSTAGE, GS_CLUSTER};
 
   template <class size_type_, class lno_t_, class scalar_t_,
             class ExecutionSpace,
@@ -79,6 +82,8 @@ namespace KokkosSparse{
     typedef typename Kokkos::View<nnz_scalar_t *, HandleTempMemorySpace> scalar_temp_work_view_t;
     typedef typename Kokkos::View<nnz_scalar_t *, HandlePersistentMemorySpace> scalar_persistent_work_view_t;
     typedef typename scalar_persistent_work_view_t::HostMirror scalar_persistent_work_host_view_t; //Host view type
+    //multiple right hand sides. LayoutRight so that the values of all vectors for a row are contiguous.
+    typedef typename Kokkos::View<nnz_scalar_t **, Kokkos::LayoutRight, HandlePersistentMemorySpace> scalar_persistent_work_view2d_t;
 
     typedef typename Kokkos::View<nnz_lno_t *, HandleTempMemorySpace> nnz_lno_temp_work_view_t;
     typedef typename Kokkos::View<nnz_lno_t *, HandlePersistentMemorySpace> nnz_lno_persistent_work_view_t;
@@ -104,6 +109,8 @@ namespace KokkosSparse{
 
     scalar_persistent_work_view_t permuted_y_vector;
     scalar_persistent_work_view_t permuted_x_vector;
+    scalar_persistent_work_view2d_t permuted_y_multivector;
+    scalar_persistent_work_view2d_t permuted_x_multivector;
 
     int suggested_vector_size;
     int suggested_team_size;
@@ -113,6 +120,15 @@ namespace KokkosSparse{
 
     nnz_lno_t max_nnz_input_row, num_values_in_l1, num_values_in_l2, num_big_rows;
     size_t level_1_mem, level_2_mem;
+
+    //two-stage GS: number of inner jacobi sweeps, and the work vectors used by them.
+    int num_inner_sweeps;
+    scalar_persistent_work_view_t residual_vector;
+    scalar_persistent_work_view_t inner_x_vector;
+    scalar_persistent_work_view_t inner_x_vector_tmp;
+
+    //cluster GS: number of consecutive rows aggregated into a cluster.
+    nnz_lno_t cluster_size;
   public:
 
     /**
@@ -124,8 +140,11 @@ namespace KokkosSparse{
       color_set_xadj(), color_sets(), numColors(0),
       permuted_xadj(),  permuted_adj(), permuted_adj_vals(), old_to_new_map(),
       called_symbolic(false), called_numeric(false), permuted_y_vector(), permuted_x_vector(),
+      permuted_y_multivector(), permuted_x_multivector(),
       suggested_vector_size(0), suggested_team_size(0), permuted_inverse_diagonal(), block_size(1), max_nnz_input_row(-1),
-      num_values_in_l1(-1), num_values_in_l2(-1),num_big_rows(0), level_1_mem(0), level_2_mem(0)
+      num_values_in_l1(-1), num_values_in_l2(-1),num_big_rows(0), level_1_mem(0), level_2_mem(0),
+      num_inner_sweeps(1), residual_vector(), inner_x_vector(), inner_x_vector_tmp(),
+      cluster_size(16)
     {
       if (gs == GS_DEFAULT){
         this->choose_default_algorithm();
@@ -313,6 +332,35 @@ namespace KokkosSparse{
 
     scalar_persistent_work_view_t get_permuted_y_vector (){return this->permuted_y_vector;}
     scalar_persistent_work_view_t get_permuted_x_vector (){return this->permuted_x_vector;}
+
+    void allocate_x_y_multivectors(nnz_lno_t num_rows, nnz_lno_t num_cols, nnz_lno_t num_vectors){
+      if(permuted_y_multivector.extent(0) != size_t(num_rows) || permuted_y_multivector.extent(1) != size_t(num_vectors)){
+        permuted_y_multivector = scalar_persistent_work_view2d_t("PERMUTED Y MULTIVECTOR", num_rows, num_vectors);
+      }
+      if(permuted_x_multivector.extent(0) != size_t(num_cols) || permuted_x_multivector.extent(1) != size_t(num_vectors)){
+        permuted_x_multivector = scalar_persistent_work_view2d_t("PERMUTED X MULTIVECTOR", num_cols, num_vectors);
+      }
+    }
+
+    scalar_persistent_work_view2d_t get_permuted_y_multivector (){return this->permuted_y_multivector;}
+    scalar_persistent_work_view2d_t get_permuted_x_multivector (){return this->permuted_x_multivector;}
+
+    void set_num_inner_sweeps(int num_inner_sweeps_){this->num_inner_sweeps = num_inner_sweeps_;}
+    int get_num_inner_sweeps() const {return this->num_inner_sweeps;}
+
+    void allocate_inner_vectors(nnz_lno_t num_rows){
+      if(residual_vector.extent(0) != size_t(num_rows)){
+        residual_vector = scalar_persistent_work_view_t("RESIDUAL VECTOR", num_rows);
+        inner_x_vector = scalar_persistent_work_view_t("INNER X VECTOR", num_rows);
+        inner_x_vector_tmp = scalar_persistent_work_view_t("INNER X VECTOR TMP", num_rows);
+      }
+    }
+    scalar_persistent_work_view_t get_residual_vector (){return this->residual_vector;}
+    scalar_persistent_work_view_t get_inner_x_vector (){return this->inner_x_vector;}
+    scalar_persistent_work_view_t get_inner_x_vector_tmp (){return this->inner_x_vector_tmp;}
+
+    void set_cluster_size(nnz_lno_t cluster_size_){this->cluster_size = cluster_size_;}
+    nnz_lno_t get_cluster_size() const {return this->cluster_size;}
     void vector_team_size(
                           int max_allowed_team_size,
                           int &suggested_vector_size_,
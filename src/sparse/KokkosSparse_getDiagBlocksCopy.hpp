@@ -0,0 +1,124 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file KokkosSparse_getDiagBlocksCopy.hpp
+/// \brief Get a copy of the diagonal blocks of a KokkosSparse::CrsMatrix
+///   or a KokkosSparse::Experimental::BlockCrsMatrix.
+
+#ifndef KOKKOS_SPARSE_GETDIAGBLOCKSCOPY_HPP_
+#define KOKKOS_SPARSE_GETDIAGBLOCKSCOPY_HPP_
+
+#include "KokkosSparse_getDiagBlocksCopy_impl.hpp"
+#include <type_traits>
+
+namespace KokkosSparse {
+
+/// \brief Copy the diagonal blocks of A into D.
+///
+/// \param D [out] 3-D Kokkos::View of size (numBlocks, bs, bs).  The
+///   block size bs is D.extent(1), and numBlocks must be
+///   ceil(A.numRows() / bs).  The last block is padded with the
+///   identity if bs does not divide the number of rows.
+/// \param A [in] The sparse matrix from which to get the diagonal blocks.
+template<class DiagBlocksType,
+         class ScalarType, class OrdinalType, class Device, class MemoryTraits, class SizeType>
+void
+getDiagBlocksCopy (const DiagBlocksType& D,
+                   const CrsMatrix<ScalarType, OrdinalType, Device, MemoryTraits, SizeType>& A)
+{
+  static_assert (Kokkos::Impl::is_view<DiagBlocksType>::value,
+                 "The DiagBlocksType template parameter must be a Kokkos::View.");
+  static_assert (static_cast<int> (DiagBlocksType::rank) == 3,
+                 "The DiagBlocksType template parameter must be a 3-D Kokkos::View.");
+  static_assert (std::is_same<DiagBlocksType, typename DiagBlocksType::non_const_type>::value,
+                 "The DiagBlocksType template parameter must be a nonconst Kokkos::View.");
+
+  typedef CrsMatrix<ScalarType, OrdinalType, Device, MemoryTraits, SizeType> crs_matrix_type;
+  typedef typename crs_matrix_type::execution_space execution_space;
+  typedef Kokkos::RangePolicy<execution_space, OrdinalType> policy_type;
+
+  const OrdinalType blockSize = static_cast<OrdinalType> (D.extent(1));
+  const OrdinalType numBlocks = blockSize == 0 ? 0 : (A.numRows () + blockSize - 1) / blockSize;
+  if (D.extent(1) != D.extent(2) || static_cast<OrdinalType> (D.extent(0)) != numBlocks) {
+    Kokkos::Impl::throw_runtime_exception ("KokkosSparse::getDiagBlocksCopy: D must be of size (ceil(numRows / bs), bs, bs).");
+  }
+
+  Impl::CrsMatrixGetDiagBlocksCopyFunctor<DiagBlocksType, crs_matrix_type> functor (D, A);
+  Kokkos::parallel_for ("KokkosSparse::getDiagBlocksCopy", policy_type (0, numBlocks), functor);
+}
+
+/// \brief Copy the diagonal blocks of the BlockCrsMatrix A into D.
+///
+/// \param D [out] 3-D Kokkos::View of size (A.numRows(), A.blockDim(), A.blockDim()).
+/// \param A [in] The block sparse matrix from which to get the diagonal blocks.
+template<class DiagBlocksType,
+         class ScalarType, class OrdinalType, class Device, class MemoryTraits, class SizeType>
+void
+getDiagBlocksCopy (const DiagBlocksType& D,
+                   const Experimental::BlockCrsMatrix<ScalarType, OrdinalType, Device, MemoryTraits, SizeType>& A)
+{
+  static_assert (Kokkos::Impl::is_view<DiagBlocksType>::value,
+                 "The DiagBlocksType template parameter must be a Kokkos::View.");
+  static_assert (static_cast<int> (DiagBlocksType::rank) == 3,
+                 "The DiagBlocksType template parameter must be a 3-D Kokkos::View.");
+  static_assert (std::is_same<DiagBlocksType, typename DiagBlocksType::non_const_type>::value,
+                 "The DiagBlocksType template parameter must be a nonconst Kokkos::View.");
+
+  typedef Experimental::BlockCrsMatrix<ScalarType, OrdinalType, Device, MemoryTraits, SizeType> block_crs_matrix_type;
+  typedef typename block_crs_matrix_type::execution_space execution_space;
+  typedef Kokkos::RangePolicy<execution_space, OrdinalType> policy_type;
+
+  const OrdinalType numBlockRows = A.numRows ();
+  if (static_cast<OrdinalType> (D.extent(0)) != numBlockRows ||
+      static_cast<OrdinalType> (D.extent(1)) != A.blockDim () ||
+      static_cast<OrdinalType> (D.extent(2)) != A.blockDim ()) {
+    Kokkos::Impl::throw_runtime_exception ("KokkosSparse::getDiagBlocksCopy: D must be of size (numRows, blockDim, blockDim).");
+  }
+
+  Impl::BlockCrsMatrixGetDiagBlocksCopyFunctor<DiagBlocksType, block_crs_matrix_type> functor (D, A);
+  Kokkos::parallel_for ("KokkosSparse::getDiagBlocksCopy", policy_type (0, numBlockRows), functor);
+}
+
+} // namespace KokkosSparse
+
+#endif // KOKKOS_SPARSE_GETDIAGBLOCKSCOPY_HPP_
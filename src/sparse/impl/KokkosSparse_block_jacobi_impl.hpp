@@ -0,0 +1,307 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_SPARSE_IMPL_BLOCK_JACOBI_HPP_
+#define KOKKOS_SPARSE_IMPL_BLOCK_JACOBI_HPP_
+
+#include "Kokkos_Core.hpp"
+#include "Kokkos_ArithTraits.hpp"
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_LU_Decl.hpp"
+#include "KokkosBatched_LU_Serial_Impl.hpp"
+#include "KokkosBatched_InverseLU_Decl.hpp"
+#include "KokkosBatched_InverseLU_Serial_Impl.hpp"
+#include "KokkosBatched_Trsv_Decl.hpp"
+#include "KokkosBatched_Trsv_Serial_Impl.hpp"
+#include "KokkosBatched_Trsm_Decl.hpp"
+#include "KokkosBatched_Trsm_Serial_Impl.hpp"
+#include "KokkosBatched_Gemv_Decl.hpp"
+#include "KokkosBatched_Gemv_Serial_Impl.hpp"
+#include "KokkosBatched_Pack_Decl.hpp"
+#include "KokkosBatched_Pack_Impl.hpp"
+#include <type_traits>
+
+namespace KokkosSparse {
+namespace Impl {
+
+/// \brief Factors every diagonal block in place with the batched LU
+///   (no pivoting), and optionally replaces the factors with the inverse.
+///
+/// InverseLU only sets the diagonal of its workspace, so each block's
+/// row of W is zeroed here; W itself may be uninitialized.
+///
+/// \tparam DiagBlocksType 3-D Kokkos::View (numBlocks, bs, bs)
+/// \tparam WorkType 2-D Kokkos::View (numBlocks, bs*bs), only used for the inverse.
+template<class DiagBlocksType,
+         class WorkType>
+struct BlockJacobiFactorFunctor {
+  typedef typename DiagBlocksType::size_type size_type;
+  typedef typename DiagBlocksType::non_const_value_type scalar_type;
+
+  BlockJacobiFactorFunctor (const DiagBlocksType& D,
+                            const WorkType& W,
+                            const bool invert) :
+    D_ (D), W_ (W), invert_ (invert)
+  {}
+
+  KOKKOS_INLINE_FUNCTION void
+  operator () (const size_type& blk) const
+  {
+    namespace KB = KokkosBatched::Experimental;
+    auto A = Kokkos::subview (D_, blk, Kokkos::ALL (), Kokkos::ALL ());
+    KB::SerialLU<KB::Algo::LU::Unblocked>::invoke (A);
+    if (invert_) {
+      const scalar_type ZERO = Kokkos::Details::ArithTraits<scalar_type>::zero ();
+      auto W = Kokkos::subview (W_, blk, Kokkos::ALL ());
+      for (size_type k = 0; k < W.extent(0); ++k) {
+        W(k) = ZERO;
+      }
+      KB::SerialInverseLU<KB::Algo::InverseLU::Unblocked>::invoke (A, W);
+    }
+  }
+
+private:
+  DiagBlocksType D_;
+  WorkType W_;
+  bool invert_;
+};
+
+/// \brief Factors the diagonal blocks in the compact SIMD layout.
+///
+/// Pack k interleaves blocks [k*l, (k+1)*l) of D in Vector<SIMD<T>,l>
+/// values.  Each thread packs one pack into Dc, factors (and inverts) it,
+/// and unpacks it back into D, so D ends up with the same factors as with
+/// BlockJacobiFactorFunctor.  SerialInverseLU takes its alpha in the value
+/// type, which cannot be compared against zero for SIMD vectors, so the
+/// inverse is formed here with the same two Trsm and a scalar alpha.
+///
+/// \tparam DiagBlocksType 3-D Kokkos::View (numBlocks, bs, bs)
+/// \tparam CompactBlocksType 3-D Kokkos::View (numPacks, bs, bs) of Vector<SIMD<T>,l>;
+///   also used for the workspace of the inverse.
+template<class DiagBlocksType,
+         class CompactBlocksType>
+struct BlockJacobiCompactFactorFunctor {
+  typedef typename DiagBlocksType::size_type size_type;
+  typedef typename DiagBlocksType::non_const_value_type scalar_type;
+  typedef typename CompactBlocksType::non_const_value_type vector_type;
+
+  BlockJacobiCompactFactorFunctor (const DiagBlocksType& D,
+                                   const CompactBlocksType& Dc,
+                                   const CompactBlocksType& Wc,
+                                   const bool invert) :
+    D_ (D), Dc_ (Dc), Wc_ (Wc), invert_ (invert)
+  {}
+
+  KOKKOS_INLINE_FUNCTION void
+  operator () (const size_type& pack) const
+  {
+    namespace KB = KokkosBatched::Experimental;
+    auto A = Kokkos::subview (Dc_, pack, Kokkos::ALL (), Kokkos::ALL ());
+    KB::SerialPack<KB::Trans::NoTranspose>::invoke (D_, pack, A);
+    KB::SerialLU<KB::Algo::LU::Unblocked>::invoke (A);
+    if (invert_) {
+      const scalar_type ZERO = Kokkos::Details::ArithTraits<scalar_type>::zero ();
+      const scalar_type ONE = Kokkos::Details::ArithTraits<scalar_type>::one ();
+      const size_type bs = A.extent(0);
+      auto W = Kokkos::subview (Wc_, pack, Kokkos::ALL (), Kokkos::ALL ());
+      for (size_type i = 0; i < bs; ++i) {
+        for (size_type j = 0; j < bs; ++j) {
+          W(i,j) = vector_type (i == j ? ONE : ZERO);
+        }
+      }
+      KB::SerialTrsm<KB::Side::Left, KB::Uplo::Lower, KB::Trans::NoTranspose, KB::Diag::Unit,
+                     KB::Algo::Trsm::Unblocked>::invoke (ONE, A, W);
+      KB::SerialTrsm<KB::Side::Left, KB::Uplo::Upper, KB::Trans::NoTranspose, KB::Diag::NonUnit,
+                     KB::Algo::Trsm::Unblocked>::invoke (ONE, A, W);
+      for (size_type i = 0; i < bs; ++i) {
+        for (size_type j = 0; j < bs; ++j) {
+          A(i,j) = W(i,j);
+        }
+      }
+    }
+    KB::SerialUnpack<KB::Trans::NoTranspose>::invoke (A, pack, D_);
+  }
+
+private:
+  DiagBlocksType D_;
+  CompactBlocksType Dc_;
+  CompactBlocksType Wc_;
+  bool invert_;
+};
+
+/// \brief Whether block_jacobi_numeric factors D in the compact SIMD layout.
+///
+/// This is the case for host views of the scalar types that have a
+/// DefaultVectorLength larger than one (the real and complex floating
+/// point types).  On GPUs one block per thread already vectorizes
+/// across threads.
+template<class DiagBlocksType>
+struct BlockJacobiUseCompact {
+  typedef typename DiagBlocksType::non_const_value_type scalar_type;
+  typedef typename DiagBlocksType::memory_space memory_space;
+  typedef KokkosBatched::Experimental::PackTraits<scalar_type, memory_space> pack_traits;
+
+  enum : bool { value = (std::is_same<memory_space, Kokkos::HostSpace>::value &&
+                         static_cast<int> (pack_traits::vector_length) > 1) };
+};
+
+//! Factors the blocks one per thread in the scalar layout.
+template<class DiagBlocksType>
+void
+block_jacobi_numeric_impl (const DiagBlocksType& D,
+                           const bool explicit_inverse,
+                           std::false_type)
+{
+  typedef typename DiagBlocksType::execution_space execution_space;
+  typedef typename DiagBlocksType::size_type size_type;
+  typedef Kokkos::View<typename DiagBlocksType::non_const_value_type**,
+                       Kokkos::LayoutRight,
+                       typename DiagBlocksType::device_type> work_type;
+
+  const size_type numBlocks = D.extent(0);
+  const size_type bs = D.extent(1);
+  work_type W;
+  if (explicit_inverse) {
+    W = work_type (Kokkos::ViewAllocateWithoutInitializing ("KokkosSparse::block_jacobi::W"), numBlocks, bs * bs);
+  }
+
+  BlockJacobiFactorFunctor<DiagBlocksType, work_type> functor (D, W, explicit_inverse);
+  Kokkos::parallel_for ("KokkosSparse::block_jacobi_numeric",
+                        Kokkos::RangePolicy<execution_space> (0, numBlocks), functor);
+}
+
+//! Factors the blocks l per thread in the compact SIMD layout.
+template<class DiagBlocksType>
+void
+block_jacobi_numeric_impl (const DiagBlocksType& D,
+                           const bool explicit_inverse,
+                           std::true_type)
+{
+  typedef typename DiagBlocksType::execution_space execution_space;
+  typedef typename DiagBlocksType::size_type size_type;
+  typedef typename BlockJacobiUseCompact<DiagBlocksType>::pack_traits pack_traits;
+  typedef typename pack_traits::vector_type vector_type;
+  typedef Kokkos::View<vector_type***, Kokkos::LayoutRight,
+                       typename DiagBlocksType::device_type> compact_blocks_type;
+
+  const size_type numPacks = pack_traits::npacks (D.extent(0));
+  const size_type bs = D.extent(1);
+  compact_blocks_type Dc (Kokkos::ViewAllocateWithoutInitializing ("KokkosSparse::block_jacobi::Dc"), numPacks, bs, bs);
+  compact_blocks_type Wc;
+  if (explicit_inverse) {
+    Wc = compact_blocks_type (Kokkos::ViewAllocateWithoutInitializing ("KokkosSparse::block_jacobi::Wc"), numPacks, bs, bs);
+  }
+
+  BlockJacobiCompactFactorFunctor<DiagBlocksType, compact_blocks_type> functor (D, Dc, Wc, explicit_inverse);
+  Kokkos::parallel_for ("KokkosSparse::block_jacobi_numeric",
+                        Kokkos::RangePolicy<execution_space> (0, numPacks), functor);
+}
+
+/// \brief Computes x = D^{-1} y block by block.
+///
+/// If the blocks hold the LU factors, each block is solved with a unit
+/// lower and a non-unit upper triangular solve (Trsv).  If the blocks
+/// hold the inverse, each block is applied with a Gemv.
+///
+/// \tparam DiagBlocksType 3-D Kokkos::View (numBlocks, bs, bs)
+/// \tparam XType 1-D Kokkos::View, output
+/// \tparam YType 1-D Kokkos::View, input
+template<class DiagBlocksType,
+         class XType,
+         class YType>
+struct BlockJacobiApplyFunctor {
+  typedef typename DiagBlocksType::size_type size_type;
+  typedef typename DiagBlocksType::non_const_value_type scalar_type;
+
+  BlockJacobiApplyFunctor (const DiagBlocksType& D,
+                           const XType& x,
+                           const YType& y,
+                           const bool inverted) :
+    D_ (D), x_ (x), y_ (y), inverted_ (inverted),
+    blockSize_ (D.extent(1)), numRows_ (y.extent(0))
+  {}
+
+  KOKKOS_INLINE_FUNCTION void
+  operator () (const size_type& blk) const
+  {
+    namespace KB = KokkosBatched::Experimental;
+    const scalar_type ZERO = Kokkos::Details::ArithTraits<scalar_type>::zero ();
+    const scalar_type ONE = Kokkos::Details::ArithTraits<scalar_type>::one ();
+
+    // The last block may be partial; its padding is the identity, so
+    // only the leading rows and columns are used.
+    const size_type begin = blk * blockSize_;
+    const size_type m = begin + blockSize_ > numRows_ ? numRows_ - begin : blockSize_;
+    const Kokkos::pair<size_type, size_type> range (0, m);
+    const Kokkos::pair<size_type, size_type> rows (begin, begin + m);
+
+    auto A = Kokkos::subview (D_, blk, range, range);
+    auto x = Kokkos::subview (x_, rows);
+    auto y = Kokkos::subview (y_, rows);
+    if (inverted_) {
+      KB::SerialGemv<KB::Trans::NoTranspose, KB::Algo::Gemv::Unblocked>::invoke (ONE, A, y, ZERO, x);
+    }
+    else {
+      for (size_type i = 0; i < m; ++i) {
+        x(i) = y(i);
+      }
+      KB::SerialTrsv<KB::Uplo::Lower, KB::Trans::NoTranspose, KB::Diag::Unit,
+                     KB::Algo::Trsv::Unblocked>::invoke (ONE, A, x);
+      KB::SerialTrsv<KB::Uplo::Upper, KB::Trans::NoTranspose, KB::Diag::NonUnit,
+                     KB::Algo::Trsv::Unblocked>::invoke (ONE, A, x);
+    }
+  }
+
+private:
+  DiagBlocksType D_;
+  XType x_;
+  YType y_;
+  bool inverted_;
+  size_type blockSize_;
+  size_type numRows_;
+};
+
+} // namespace Impl
+} // namespace KokkosSparse
+
+#endif // KOKKOS_SPARSE_IMPL_BLOCK_JACOBI_HPP_
@@ -0,0 +1,385 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include "KokkosKernels_Utils.hpp"
+#include <Kokkos_Core.hpp>
+#include <Kokkos_MemoryTraits.hpp>
+#include "KokkosSparse_gauss_seidel_common_impl.hpp"
+#include "KokkosGraph_graph_color.hpp"
+#ifndef _KOKKOSCLUSTERGSIMP_HPP
+#define _KOKKOSCLUSTERGSIMP_HPP
+
+namespace KokkosSparse{
+
+
+  namespace Impl{
+
+    //Cluster Gauss-Seidel. Consecutive rows are aggregated into clusters of cluster_size rows,
+    //and the coarse graph of the clusters is colored instead of the graph of the rows.
+    //Clusters of the same color are processed in parallel, and the rows of a cluster are
+    //processed sequentially by a single thread. This gives far fewer colors than the point
+    //multicolor GS, and convergence closer to the sequential GS.
+    //The vectors are not permuted, apply works directly on the given x and y.
+    template <typename HandleType, typename lno_row_view_t_, typename lno_nnz_view_t_, typename scalar_nnz_view_t_>
+    class ClusterGaussSeidel{
+
+    public:
+
+      typedef lno_row_view_t_ in_lno_row_view_t;
+      typedef lno_nnz_view_t_ in_lno_nnz_view_t;
+      typedef scalar_nnz_view_t_ in_scalar_nnz_view_t;
+
+      typedef typename HandleType::HandleExecSpace MyExecSpace;
+      typedef typename HandleType::HandleTempMemorySpace MyTempMemorySpace;
+      typedef typename HandleType::HandlePersistentMemorySpace MyPersistentMemorySpace;
+
+      typedef typename HandleType::size_type size_type;
+      typedef typename HandleType::nnz_lno_t nnz_lno_t;
+      typedef typename HandleType::nnz_scalar_t nnz_scalar_t;
+
+      typedef typename in_lno_row_view_t::const_type const_lno_row_view_t;
+      typedef typename lno_nnz_view_t_::const_type const_lno_nnz_view_t;
+      typedef typename scalar_nnz_view_t_::const_type const_scalar_nnz_view_t;
+
+      typedef typename HandleType::row_lno_temp_work_view_t row_lno_temp_work_view_t;
+      typedef typename HandleType::nnz_lno_temp_work_view_t nnz_lno_temp_work_view_t;
+      typedef typename HandleType::nnz_lno_persistent_work_view_t nnz_lno_persistent_work_view_t;
+      typedef typename HandleType::nnz_lno_persistent_work_host_view_t nnz_lno_persistent_work_host_view_t;
+      typedef typename HandleType::scalar_persistent_work_view_t scalar_persistent_work_view_t;
+
+      typedef typename HandleType::GraphColoringHandleType::color_t color_t;
+
+      typedef Kokkos::RangePolicy<MyExecSpace> my_exec_space;
+
+      struct ForwardTag{};
+      struct BackwardTag{};
+
+    private:
+      HandleType *handle;
+      nnz_lno_t num_rows, num_cols;
+
+      const_lno_row_view_t row_map;
+      const_lno_nnz_view_t entries;
+      const_scalar_nnz_view_t values;
+
+      const_scalar_nnz_view_t given_inverse_diagonal;
+
+      bool have_diagonal_given;
+    public:
+
+      //coarse graph of the clusters. Since the clusters are consecutive rows,
+      //the coarse row map is a strided copy of the fine row map,
+      //and each fine column index is mapped to its cluster.
+      //Columns that are not owned (col >= num_rows) and columns inside the cluster itself
+      //are mapped to num_clusters, which the symmetrization drops as out of range.
+      struct Create_Coarse_Graph{
+        const_lno_row_view_t _xadj;
+        const_lno_nnz_view_t _adj;
+        row_lno_temp_work_view_t _coarse_xadj;
+        nnz_lno_temp_work_view_t _coarse_adj;
+        nnz_lno_t num_rows, num_clusters, cluster_size;
+
+        Create_Coarse_Graph(const_lno_row_view_t xadj_, const_lno_nnz_view_t adj_,
+                            row_lno_temp_work_view_t coarse_xadj_, nnz_lno_temp_work_view_t coarse_adj_,
+                            nnz_lno_t num_rows_, nnz_lno_t num_clusters_, nnz_lno_t cluster_size_):
+          _xadj(xadj_), _adj(adj_), _coarse_xadj(coarse_xadj_), _coarse_adj(coarse_adj_),
+          num_rows(num_rows_), num_clusters(num_clusters_), cluster_size(cluster_size_){}
+
+        KOKKOS_INLINE_FUNCTION
+        void operator()(const nnz_lno_t &cluster) const {
+          nnz_lno_t row_begin = cluster * cluster_size;
+          if (row_begin > num_rows) row_begin = num_rows;
+          _coarse_xadj[cluster] = _xadj[row_begin];
+          if (cluster == num_clusters) return;
+
+          nnz_lno_t row_end = row_begin + cluster_size;
+          if (row_end > num_rows) row_end = num_rows;
+          for (size_type adjind = _xadj[row_begin]; adjind < _xadj[row_end]; ++adjind){
+            const nnz_lno_t colIndex = _adj[adjind];
+            const nnz_lno_t coarseIndex = colIndex < num_rows ? colIndex / cluster_size : num_clusters;
+            _coarse_adj[adjind] = coarseIndex == cluster ? num_clusters : coarseIndex;
+          }
+        }
+      };
+
+      template <typename x_value_array_type, typename y_value_array_type>
+      struct ClusterGS_Functor{
+        const_lno_row_view_t _xadj;
+        const_lno_nnz_view_t _adj;
+        const_scalar_nnz_view_t _adj_vals;
+        scalar_persistent_work_view_t _inverse_diagonal;
+
+        x_value_array_type _Xvector;
+        y_value_array_type _Yvector;
+
+        //clusters of the current color.
+        nnz_lno_persistent_work_view_t _color_adj;
+        nnz_lno_t _color_set_begin;
+
+        nnz_lno_t num_rows, cluster_size;
+        nnz_scalar_t omega;
+
+        ClusterGS_Functor(const_lno_row_view_t xadj_, const_lno_nnz_view_t adj_, const_scalar_nnz_view_t adj_vals_,
+                          scalar_persistent_work_view_t inverse_diagonal_,
+                          x_value_array_type Xvector_, y_value_array_type Yvector_,
+                          nnz_lno_persistent_work_view_t color_adj_,
+                          nnz_lno_t num_rows_, nnz_lno_t cluster_size_, nnz_scalar_t omega_):
+          _xadj(xadj_), _adj(adj_), _adj_vals(adj_vals_), _inverse_diagonal(inverse_diagonal_),
+          _Xvector(Xvector_), _Yvector(Yvector_),
+          _color_adj(color_adj_), _color_set_begin(0),
+          num_rows(num_rows_), cluster_size(cluster_size_), omega(omega_){}
+
+        KOKKOS_INLINE_FUNCTION
+        void relax_row(const nnz_lno_t &ii) const {
+          const size_type row_end = _xadj[ii + 1];
+          nnz_scalar_t sum = _Yvector[ii];
+          for (size_type adjind = _xadj[ii]; adjind < row_end; ++adjind){
+            sum -= _adj_vals[adjind] * _Xvector[_adj[adjind]];
+          }
+          _Xvector[ii] += omega * sum * _inverse_diagonal[ii];
+        }
+
+        KOKKOS_INLINE_FUNCTION
+        void operator()(const ForwardTag&, const nnz_lno_t &ii) const {
+          const nnz_lno_t cluster = _color_adj[_color_set_begin + ii];
+          const nnz_lno_t row_begin = cluster * cluster_size;
+          nnz_lno_t row_end = row_begin + cluster_size;
+          if (row_end > num_rows) row_end = num_rows;
+          for (nnz_lno_t row = row_begin; row < row_end; ++row){
+            relax_row(row);
+          }
+        }
+
+        KOKKOS_INLINE_FUNCTION
+        void operator()(const BackwardTag&, const nnz_lno_t &ii) const {
+          const nnz_lno_t cluster = _color_adj[_color_set_begin + ii];
+          const nnz_lno_t row_begin = cluster * cluster_size;
+          nnz_lno_t row_end = row_begin + cluster_size;
+          if (row_end > num_rows) row_end = num_rows;
+          for (nnz_lno_t row = row_end; row > row_begin; --row){
+            relax_row(row - 1);
+          }
+        }
+      };
+
+      /**
+       * \brief constructor
+       */
+      ClusterGaussSeidel(HandleType *handle_,
+                         nnz_lno_t num_rows_,
+                         nnz_lno_t num_cols_,
+                         const_lno_row_view_t row_map_,
+                         const_lno_nnz_view_t entries_,
+                         const_scalar_nnz_view_t values_):
+        handle(handle_), num_rows(num_rows_), num_cols(num_cols_),
+        row_map(row_map_), entries(entries_), values(values_),
+        have_diagonal_given(false){}
+
+      ClusterGaussSeidel(HandleType *handle_,
+                         nnz_lno_t num_rows_,
+                         nnz_lno_t num_cols_,
+                         const_lno_row_view_t row_map_,
+                         const_lno_nnz_view_t entries_):
+        handle(handle_), num_rows(num_rows_), num_cols(num_cols_),
+        row_map(row_map_), entries(entries_), values(),
+        have_diagonal_given(false){}
+
+      ClusterGaussSeidel(HandleType *handle_,
+                         nnz_lno_t num_rows_,
+                         nnz_lno_t num_cols_,
+                         const_lno_row_view_t row_map_,
+                         const_lno_nnz_view_t entries_,
+                         const_scalar_nnz_view_t values_,
+                         const_scalar_nnz_view_t given_inverse_diagonal_):
+        handle(handle_), num_rows(num_rows_), num_cols(num_cols_),
+        row_map(row_map_), entries(entries_), values(values_),
+        given_inverse_diagonal(given_inverse_diagonal_),
+        have_diagonal_given(true){}
+
+      void initialize_symbolic(){
+        typename HandleType::GaussSeidelHandleType *gsHandler = this->handle->get_gs_handle();
+        if (gsHandler->get_block_size() > 1){
+          throw std::runtime_error ("GS_CLUSTER does not support block size larger than 1.\n");
+        }
+
+        typename HandleType::GraphColoringHandleType *gchandle = this->handle->get_graph_coloring_handle();
+        if (gchandle == NULL){
+          this->handle->create_graph_coloring_handle();
+          gsHandler->set_owner_of_coloring();
+          gchandle = this->handle->get_graph_coloring_handle();
+        }
+
+        nnz_lno_t cluster_size = gsHandler->get_cluster_size();
+        if (cluster_size < 1) cluster_size = 1;
+        const nnz_lno_t num_clusters = (num_rows + cluster_size - 1) / cluster_size;
+        const size_type nnz = entries.extent(0);
+
+        row_lno_temp_work_view_t coarse_xadj ("coarse_xadj", num_clusters + 1);
+        nnz_lno_temp_work_view_t coarse_adj (Kokkos::ViewAllocateWithoutInitializing("coarse_adj"), nnz);
+        Kokkos::parallel_for("KokkosSparse::ClusterGaussSeidel::create_coarse_graph",
+                             my_exec_space(0, num_clusters + 1),
+                             Create_Coarse_Graph(row_map, entries, coarse_xadj, coarse_adj,
+                                                 num_rows, num_clusters, cluster_size));
+        MyExecSpace::fence();
+
+        //the coarse graph has repeated edges and is not symmetric even if the matrix is.
+        //Symmetrization merges the repeated edges; self loops were already filtered
+        //above, since the symmetrization would keep (and duplicate) them.
+        {
+          row_lno_temp_work_view_t tmp_xadj;
+          nnz_lno_temp_work_view_t tmp_adj;
+          KokkosKernels::Impl::symmetrize_graph_symbolic_hashmap
+            < row_lno_temp_work_view_t, nnz_lno_temp_work_view_t,
+              row_lno_temp_work_view_t, nnz_lno_temp_work_view_t,
+              MyExecSpace>
+            (num_clusters, coarse_xadj, coarse_adj, tmp_xadj, tmp_adj);
+          KokkosGraph::Experimental::graph_color_symbolic
+            <HandleType, row_lno_temp_work_view_t, nnz_lno_temp_work_view_t>
+            (this->handle, num_clusters, num_clusters, tmp_xadj, tmp_adj);
+        }
+        color_t numColors = gchandle->get_num_colors();
+        typename HandleType::GraphColoringHandleType::color_view_t colors = gchandle->get_vertex_colors();
+
+        nnz_lno_persistent_work_view_t color_xadj;
+        nnz_lno_persistent_work_view_t color_adj;
+        KokkosKernels::Impl::create_reverse_map
+          <typename HandleType::GraphColoringHandleType::color_view_t,
+           nnz_lno_persistent_work_view_t, MyExecSpace>
+          (num_clusters, numColors, colors, color_xadj, color_adj);
+        MyExecSpace::fence();
+
+        nnz_lno_persistent_work_host_view_t h_color_xadj = Kokkos::create_mirror_view (color_xadj);
+        Kokkos::deep_copy (h_color_xadj, color_xadj);
+        MyExecSpace::fence();
+
+        gsHandler->set_color_set_xadj(h_color_xadj);
+        gsHandler->set_color_set_adj(color_adj);
+        gsHandler->set_num_colors(numColors);
+        gsHandler->set_call_symbolic(true);
+      }
+
+      void initialize_numeric(){
+        typename HandleType::GaussSeidelHandleType *gsHandler = this->handle->get_gs_handle();
+        if (gsHandler->is_symbolic_called() == false){
+          this->initialize_symbolic();
+        }
+
+        scalar_persistent_work_view_t inverse_diagonal ("inverse_diagonal", num_rows);
+        if (!have_diagonal_given){
+          Kokkos::parallel_for("KokkosSparse::ClusterGaussSeidel::get_inverse_diagonals",
+                               my_exec_space(0, num_rows),
+                               Get_Inverse_Diagonals<const_lno_row_view_t, const_lno_nnz_view_t,
+                                                     const_scalar_nnz_view_t, scalar_persistent_work_view_t>
+                               (row_map, entries, values, inverse_diagonal));
+        }
+        else {
+          Kokkos::deep_copy(inverse_diagonal, given_inverse_diagonal);
+        }
+        MyExecSpace::fence();
+        gsHandler->set_permuted_inverse_diagonal(inverse_diagonal);
+        gsHandler->set_call_numeric(true);
+      }
+
+      template <typename x_value_array_type, typename y_value_array_type>
+      void apply(
+                 x_value_array_type x_lhs_output_vec,
+                 y_value_array_type y_rhs_input_vec,
+                 bool init_zero_x_vector = false,
+                 int numIter = 1,
+                 nnz_scalar_t omega = Kokkos::Details::ArithTraits<nnz_scalar_t>::one(),
+                 bool apply_forward = true,
+                 bool apply_backward = true,
+                 bool /*update_y_vector*/ = true){
+
+        typename HandleType::GaussSeidelHandleType *gsHandler = this->handle->get_gs_handle();
+        if (gsHandler->is_numeric_called() == false){
+          this->initialize_numeric();
+        }
+
+        if (init_zero_x_vector){
+          KokkosKernels::Impl::zero_vector<x_value_array_type, MyExecSpace>(num_cols, x_lhs_output_vec);
+        }
+
+        nnz_lno_t cluster_size = gsHandler->get_cluster_size();
+        if (cluster_size < 1) cluster_size = 1;
+
+        typedef ClusterGS_Functor<x_value_array_type, y_value_array_type> functor_t;
+        functor_t gs(row_map, entries, values,
+                     gsHandler->get_permuted_inverse_diagonal(),
+                     x_lhs_output_vec, y_rhs_input_vec,
+                     gsHandler->get_color_adj(),
+                     num_rows, cluster_size, omega);
+
+        nnz_lno_persistent_work_host_view_t h_color_xadj = gsHandler->get_color_xadj();
+        const nnz_lno_t numColors = gsHandler->get_num_colors();
+
+        for (int i = 0; i < numIter; ++i){
+          if (apply_forward){
+            for (nnz_lno_t c = 0; c < numColors; ++c){
+              this->template sweep_color<ForwardTag>(gs, h_color_xadj(c), h_color_xadj(c + 1));
+            }
+          }
+          if (apply_backward){
+            for (nnz_lno_t c = numColors; c > 0; --c){
+              this->template sweep_color<BackwardTag>(gs, h_color_xadj(c - 1), h_color_xadj(c));
+            }
+          }
+        }
+        MyExecSpace::fence();
+      }
+
+    private:
+
+      template <typename sweep_tag, typename functor_t>
+      void sweep_color(functor_t &gs, nnz_lno_t color_index_begin, nnz_lno_t color_index_end){
+        if (color_index_begin >= color_index_end) return;
+        gs._color_set_begin = color_index_begin;
+        Kokkos::parallel_for("KokkosSparse::ClusterGaussSeidel::sweep",
+                             Kokkos::RangePolicy<sweep_tag, MyExecSpace>(0, color_index_end - color_index_begin), gs);
+        MyExecSpace::fence();
+      }
+    };
+
+  }
+}
+#endif
@@ -0,0 +1,92 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef _KOKKOSGSCOMMONIMP_HPP
+#define _KOKKOSGSCOMMONIMP_HPP
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ArithTraits.hpp>
+
+namespace KokkosSparse{
+
+
+  namespace Impl{
+
+    //Functors shared by the point Gauss-Seidel variants that work on the
+    //unpermuted matrix (GS_TWOSTAGE and GS_CLUSTER).
+
+    //Inverts the diagonal entry of each row. Rows without a stored
+    //diagonal entry are left untouched, so the inverse diagonal view
+    //should be zero initialized.
+    template <typename row_view_t, typename nnz_view_t, typename scalar_view_t, typename diag_view_t>
+    struct Get_Inverse_Diagonals{
+      typedef typename row_view_t::non_const_value_type size_type;
+      typedef typename nnz_view_t::non_const_value_type nnz_lno_t;
+      typedef typename diag_view_t::non_const_value_type nnz_scalar_t;
+
+      row_view_t _xadj;
+      nnz_view_t _adj;
+      scalar_view_t _adj_vals;
+      diag_view_t _inverse_diagonal;
+      nnz_scalar_t one;
+
+      Get_Inverse_Diagonals(row_view_t xadj_, nnz_view_t adj_, scalar_view_t adj_vals_,
+                            diag_view_t inverse_diagonal_):
+        _xadj(xadj_), _adj(adj_), _adj_vals(adj_vals_), _inverse_diagonal(inverse_diagonal_),
+        one(Kokkos::Details::ArithTraits<nnz_scalar_t>::one()){}
+
+      KOKKOS_INLINE_FUNCTION
+      void operator()(const nnz_lno_t &row_id) const {
+        const size_type row_end = _xadj[row_id + 1];
+        for (size_type adjind = _xadj[row_id]; adjind < row_end; ++adjind){
+          if (_adj[adjind] == row_id){
+            _inverse_diagonal[row_id] = one / _adj_vals[adjind];
+            break;
+          }
+        }
+      }
+    };
+
+  }
+}
+#endif
@@ -104,6 +104,7 @@ namespace KokkosSparse{
 
       typedef typename HandleType::scalar_temp_work_view_t scalar_temp_work_view_t;
       typedef typename HandleType::scalar_persistent_work_view_t scalar_persistent_work_view_t;
+      typedef typename HandleType::GaussSeidelHandleType::scalar_persistent_work_view2d_t scalar_persistent_work_view2d_t;
 
       typedef Kokkos::RangePolicy<MyExecSpace> my_exec_space;
       typedef nnz_lno_t color_t;
@@ -520,6 +521,98 @@ namespace KokkosSparse{
         }
       };
 
+      //point GS with multiple right hand sides.
+      //The vectors are stored in LayoutRight, so each row of the matrix is read once,
+      //and is applied to all vectors with contiguous (vectorizable) accesses.
+      struct PSGS_MV{
+        enum { vector_chunk_size = 16 };
+
+        row_lno_persistent_work_view_t _xadj;
+        nnz_lno_persistent_work_view_t _adj; // CSR storage of the graph.
+        scalar_persistent_work_view_t _adj_vals; // CSR storage of the graph.
+
+        scalar_persistent_work_view2d_t _Xvector /*output*/;
+        scalar_persistent_work_view2d_t _Yvector;
+        nnz_lno_t _color_set_begin;
+        nnz_lno_t _color_set_end;
+
+        scalar_persistent_work_view_t _permuted_inverse_diagonal;
+        nnz_lno_t num_vectors;
+        nnz_lno_t team_work_size;
+
+        nnz_scalar_t omega;
+
+        PSGS_MV(row_lno_persistent_work_view_t xadj_, nnz_lno_persistent_work_view_t adj_, scalar_persistent_work_view_t adj_vals_,
+                scalar_persistent_work_view2d_t Xvector_, scalar_persistent_work_view2d_t Yvector_,
+                scalar_persistent_work_view_t permuted_inverse_diagonal_,
+                nnz_scalar_t omega_,
+                nnz_lno_t team_work_size_ = 1):
+          _xadj( xadj_),
+          _adj( adj_),
+          _adj_vals( adj_vals_),
+          _Xvector( Xvector_),
+          _Yvector( Yvector_),
+          _color_set_begin(0), _color_set_end(0),
+          _permuted_inverse_diagonal(permuted_inverse_diagonal_),
+          num_vectors(Xvector_.extent(1)),
+          team_work_size(team_work_size_),
+          omega(omega_){}
+
+        //range policy: the vectors are processed in chunks of vector_chunk_size,
+        //and each row of the matrix is read once per chunk.
+        KOKKOS_INLINE_FUNCTION
+        void operator()(const nnz_lno_t &ii) const {
+
+          size_type row_begin = _xadj[ii];
+          size_type row_end = _xadj[ii + 1];
+          nnz_scalar_t invDiagonalVal = _permuted_inverse_diagonal[ii];
+
+          for (nnz_lno_t chunk_begin = 0; chunk_begin < num_vectors; chunk_begin += vector_chunk_size){
+            const nnz_lno_t chunk_size = KOKKOSKERNELS_MACRO_MIN(nnz_lno_t(vector_chunk_size), num_vectors - chunk_begin);
+            nnz_scalar_t sum[vector_chunk_size];
+
+            for (nnz_lno_t v = 0; v < chunk_size; ++v){
+              sum[v] = _Yvector(ii, chunk_begin + v);
+            }
+            for (size_type adjind = row_begin; adjind < row_end; ++adjind){
+              nnz_lno_t colIndex = _adj[adjind];
+              nnz_scalar_t val = _adj_vals[adjind];
+#ifdef KOKKOS_ENABLE_PRAGMA_IVDEP
+#pragma ivdep
+#endif
+              for (nnz_lno_t v = 0; v < chunk_size; ++v){
+                sum[v] -= val * _Xvector(colIndex, chunk_begin + v);
+              }
+            }
+            for (nnz_lno_t v = 0; v < chunk_size; ++v){
+              _Xvector(ii, chunk_begin + v) += omega * sum[v] * invDiagonalVal;
+            }
+          }
+        }
+
+        //team policy: each thread processes a row, and the vector lanes are distributed over the vectors.
+        KOKKOS_INLINE_FUNCTION
+        void operator()(const team_member_t & teamMember) const {
+
+          const nnz_lno_t team_row_begin = teamMember.league_rank() * team_work_size + _color_set_begin;
+          const nnz_lno_t team_row_end = KOKKOSKERNELS_MACRO_MIN(team_row_begin + team_work_size, _color_set_end);
+
+          Kokkos::parallel_for(Kokkos::TeamThreadRange(teamMember, team_row_begin, team_row_end), [&] (const nnz_lno_t& ii) {
+              size_type row_begin = _xadj[ii];
+              size_type row_end = _xadj[ii + 1];
+              nnz_scalar_t invDiagonalVal = _permuted_inverse_diagonal[ii];
+
+              Kokkos::parallel_for(Kokkos::ThreadVectorRange(teamMember, num_vectors), [&] (const nnz_lno_t& v) {
+                  nnz_scalar_t sum = _Yvector(ii, v);
+                  for (size_type adjind = row_begin; adjind < row_end; ++adjind){
+                    sum -= _adj_vals[adjind] * _Xvector(_adj[adjind], v);
+                  }
+                  _Xvector(ii, v) += omega * sum * invDiagonalVal;
+                });
+            });
+        }
+      };
+
 
 
       /**
@@ -1517,6 +1610,131 @@ namespace KokkosSparse{
         }
       }
 
+      //multiple right hand sides. x and y are 2D views, with a column per vector.
+      template <typename x_value_array_type, typename y_value_array_type>
+      void apply_multivector(
+                             x_value_array_type x_lhs_output_vec,
+                             y_value_array_type y_rhs_input_vec,
+                             bool init_zero_x_vector = false,
+                             int numIter = 1,
+                             nnz_scalar_t omega = Kokkos::Details::ArithTraits<nnz_scalar_t>::one(),
+                             bool apply_forward = true,
+                             bool apply_backward = true,
+                             bool update_y_vector = true){
+        typename HandleType::GaussSeidelHandleType *gsHandler = this->handle->get_gs_handle();
+        if (gsHandler->is_numeric_called() == false){
+          this->initialize_numeric();
+        }
+        if (gsHandler->get_block_size() > 1){
+          throw std::runtime_error ("Gauss-Seidel with multiple right hand sides does not support block size larger than 1.\n");
+        }
+
+        const nnz_lno_t num_vectors = x_lhs_output_vec.extent(1);
+        gsHandler->allocate_x_y_multivectors(this->num_rows, this->num_cols, num_vectors);
+        scalar_persistent_work_view2d_t Permuted_Yvector = gsHandler->get_permuted_y_multivector();
+        scalar_persistent_work_view2d_t Permuted_Xvector = gsHandler->get_permuted_x_multivector();
+
+        nnz_lno_persistent_work_view_t old_to_new_map = gsHandler->get_old_to_new_map();
+        nnz_lno_persistent_work_view_t color_adj = gsHandler->get_color_adj();
+
+        if (update_y_vector){
+          KokkosKernels::Impl::permute_multivector
+            <y_value_array_type, scalar_persistent_work_view2d_t,
+             nnz_lno_persistent_work_view_t, MyExecSpace>(
+                                                          num_rows,
+                                                          old_to_new_map,
+                                                          y_rhs_input_vec,
+                                                          Permuted_Yvector);
+        }
+        MyExecSpace::fence();
+        if(init_zero_x_vector){
+          Kokkos::deep_copy (Permuted_Xvector, Kokkos::Details::ArithTraits<nnz_scalar_t>::zero ());
+        }
+        else{
+          KokkosKernels::Impl::permute_multivector
+            <x_value_array_type, scalar_persistent_work_view2d_t,
+             nnz_lno_persistent_work_view_t, MyExecSpace>(
+                                                          num_cols,
+                                                          old_to_new_map,
+                                                          x_lhs_output_vec,
+                                                          Permuted_Xvector);
+        }
+        MyExecSpace::fence();
+
+        color_t numColors = gsHandler->get_num_colors();
+        nnz_lno_persistent_work_host_view_t h_color_xadj = gsHandler->get_color_xadj();
+
+        if (gsHandler->get_algorithm_type() == GS_PERMUTED){
+          PSGS_MV gs(gsHandler->get_new_xadj(), gsHandler->get_new_adj(), gsHandler->get_new_adj_val(),
+                     Permuted_Xvector, Permuted_Yvector, gsHandler->get_permuted_inverse_diagonal(), omega);
+          for (int i = 0; i < numIter; ++i){
+            this->DoPSGS_MV(gs, numColors, h_color_xadj, apply_forward, apply_backward, false, 1, 1, 1);
+          }
+        }
+        else {
+          //the vector lanes are used for the right hand sides.
+          int vector_size = 1;
+          if (this->handle->get_handle_exec_space() == KokkosKernels::Impl::Exec_CUDA){
+            while (vector_size < num_vectors && vector_size < 32) vector_size *= 2;
+          }
+          int suggested_team_size = this->handle->get_suggested_team_size(vector_size);
+          nnz_lno_t team_row_chunk_size = this->handle->get_team_work_size(suggested_team_size, MyExecSpace::concurrency(), num_rows);
+
+          PSGS_MV gs(gsHandler->get_new_xadj(), gsHandler->get_new_adj(), gsHandler->get_new_adj_val(),
+                     Permuted_Xvector, Permuted_Yvector, gsHandler->get_permuted_inverse_diagonal(), omega,
+                     team_row_chunk_size);
+          for (int i = 0; i < numIter; ++i){
+            this->DoPSGS_MV(gs, numColors, h_color_xadj, apply_forward, apply_backward,
+                            true, team_row_chunk_size, suggested_team_size, vector_size);
+          }
+        }
+
+        KokkosKernels::Impl::permute_multivector
+          <scalar_persistent_work_view2d_t, x_value_array_type,
+           nnz_lno_persistent_work_view_t, MyExecSpace>(
+                                                        num_cols,
+                                                        color_adj,
+                                                        Permuted_Xvector,
+                                                        x_lhs_output_vec);
+        MyExecSpace::fence();
+      }
+
+      void DoPSGS_MV(PSGS_MV &gs, color_t numColors, nnz_lno_persistent_work_host_view_t h_color_xadj,
+                     bool apply_forward, bool apply_backward, bool use_teams,
+                     nnz_lno_t team_row_chunk_size, int suggested_team_size, int vector_size){
+        if (apply_forward){
+          for (color_t i = 0; i < numColors; ++i){
+            gs._color_set_begin = h_color_xadj(i);
+            gs._color_set_end = h_color_xadj(i + 1);
+            this->launch_PSGS_MV(gs, use_teams, team_row_chunk_size, suggested_team_size, vector_size);
+          }
+        }
+        if (apply_backward && numColors){
+          for (color_t i = numColors - 1; ; --i){
+            gs._color_set_begin = h_color_xadj(i);
+            gs._color_set_end = h_color_xadj(i + 1);
+            this->launch_PSGS_MV(gs, use_teams, team_row_chunk_size, suggested_team_size, vector_size);
+            if (i == 0){
+              break;
+            }
+          }
+        }
+      }
+
+      void launch_PSGS_MV(PSGS_MV &gs, bool use_teams,
+                          nnz_lno_t team_row_chunk_size, int suggested_team_size, int vector_size){
+        if (use_teams){
+          nnz_lno_t overall_work = gs._color_set_end - gs._color_set_begin;
+          Kokkos::parallel_for ("KokkosSparse::GaussSeidel::Team_PSGS_MV",
+                                team_policy_t(overall_work / team_row_chunk_size + 1, suggested_team_size, vector_size), gs);
+        }
+        else {
+          Kokkos::parallel_for ("KokkosSparse::GaussSeidel::PSGS_MV",
+                                my_exec_space (gs._color_set_begin, gs._color_set_end), gs);
+        }
+        MyExecSpace::fence();
+      }
+
       void IterativePSGS(
                          Team_PSGS &gs,
                          color_t numColors,
@@ -51,6 +51,8 @@
 // Include the actual functors
 #if !defined(KOKKOSKERNELS_ETI_ONLY) || KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
 #include "KokkosSparse_gauss_seidel_impl.hpp"
+#include "KokkosSparse_twostage_gauss_seidel_impl.hpp"
+#include "KokkosSparse_cluster_gauss_seidel_impl.hpp"
 #endif
 
 namespace KokkosSparse {
@@ -236,6 +238,20 @@ namespace KokkosSparse {
                              a_lno_view_t entries,
                              bool is_graph_symmetric){
 
+        if (handle->get_gs_handle()->get_algorithm_type() == GS_TWOSTAGE){
+          typedef typename Impl::TwostageGaussSeidel<KernelHandle, a_size_view_t_,
+                                                     a_lno_view_t, typename KernelHandle::in_scalar_nnz_view_t> SGS;
+          SGS sgs(handle, num_rows, num_cols, row_map, entries);
+          sgs.initialize_symbolic();
+          return;
+        }
+        if (handle->get_gs_handle()->get_algorithm_type() == GS_CLUSTER){
+          typedef typename Impl::ClusterGaussSeidel<KernelHandle, a_size_view_t_,
+                                                    a_lno_view_t, typename KernelHandle::in_scalar_nnz_view_t> SGS;
+          SGS sgs(handle, num_rows, num_cols, row_map, entries);
+          sgs.initialize_symbolic();
+          return;
+        }
         typedef typename Impl::GaussSeidel<KernelHandle, a_size_view_t_,
                                            a_lno_view_t, typename KernelHandle::in_scalar_nnz_view_t> SGS;
         SGS sgs(handle,num_rows, num_cols, row_map, entries, is_graph_symmetric);
@@ -257,6 +273,22 @@ namespace KokkosSparse {
                            a_scalar_view_t values,
                            bool is_graph_symmetric
                            ){
+        if (handle->get_gs_handle()->get_algorithm_type() == GS_TWOSTAGE){
+          typedef typename Impl::TwostageGaussSeidel
+            <KernelHandle,a_size_view_t_,
+             a_lno_view_t,a_scalar_view_t> SGS;
+          SGS sgs(handle, num_rows, num_cols, row_map, entries, values);
+          sgs.initialize_numeric();
+          return;
+        }
+        if (handle->get_gs_handle()->get_algorithm_type() == GS_CLUSTER){
+          typedef typename Impl::ClusterGaussSeidel
+            <KernelHandle,a_size_view_t_,
+             a_lno_view_t,a_scalar_view_t> SGS;
+          SGS sgs(handle, num_rows, num_cols, row_map, entries, values);
+          sgs.initialize_numeric();
+          return;
+        }
         typedef typename Impl::GaussSeidel
           <KernelHandle,a_size_view_t_,
            a_lno_view_t,a_scalar_view_t> SGS;
@@ -274,6 +306,22 @@ namespace KokkosSparse {
                            a_scalar_view_t given_inverse_diagonal,
                            bool is_graph_symmetric
                            ){
+        if (handle->get_gs_handle()->get_algorithm_type() == GS_TWOSTAGE){
+          typedef typename Impl::TwostageGaussSeidel
+            <KernelHandle,a_size_view_t_,
+             a_lno_view_t,a_scalar_view_t> SGS;
+          SGS sgs(handle, num_rows, num_cols, row_map, entries, values, given_inverse_diagonal);
+          sgs.initialize_numeric();
+          return;
+        }
+        if (handle->get_gs_handle()->get_algorithm_type() == GS_CLUSTER){
+          typedef typename Impl::ClusterGaussSeidel
+            <KernelHandle,a_size_view_t_,
+             a_lno_view_t,a_scalar_view_t> SGS;
+          SGS sgs(handle, num_rows, num_cols, row_map, entries, values, given_inverse_diagonal);
+          sgs.initialize_numeric();
+          return;
+        }
         typedef typename Impl::GaussSeidel
           <KernelHandle,a_size_view_t_,
            a_lno_view_t,a_scalar_view_t> SGS;
@@ -300,7 +348,87 @@ namespace KokkosSparse {
                          bool init_zero_x_vector,
                          bool update_y_vector,
                          typename KernelHandle::nnz_scalar_t omega, int numIter, bool apply_forward, bool apply_backward){
+        //x and y are either single vectors or 2D views with multiple right hand sides.
+        gauss_seidel_apply_rank(handle, num_rows, num_cols, row_map, entries, values,
+                                x_lhs_output_vec, y_rhs_input_vec, init_zero_x_vector, update_y_vector,
+                                omega, numIter, apply_forward, apply_backward,
+                                std::integral_constant<bool, x_scalar_view_t::rank == 2>());
+      }
+
+      static void
+      gauss_seidel_apply_rank(
+                         KernelHandle *handle,
+                         typename KernelHandle::const_nnz_lno_t num_rows,
+                         typename KernelHandle::const_nnz_lno_t num_cols,
+                         a_size_view_t_ row_map,
+                         a_lno_view_t entries,
+                         a_scalar_view_t values,
+                         x_scalar_view_t x_lhs_output_vec,
+                         y_scalar_view_t y_rhs_input_vec,
+                         bool init_zero_x_vector,
+                         bool update_y_vector,
+                         typename KernelHandle::nnz_scalar_t omega, int numIter, bool apply_forward, bool apply_backward,
+                         std::true_type){
+        if (handle->get_gs_handle()->get_algorithm_type() == GS_TWOSTAGE ||
+            handle->get_gs_handle()->get_algorithm_type() == GS_CLUSTER){
+          throw std::runtime_error ("Gauss-Seidel with multiple right hand sides is only supported by the multicolor algorithms.\n");
+        }
+        typedef typename Impl::GaussSeidel <KernelHandle,
+                                            a_size_view_t_, a_lno_view_t,a_scalar_view_t > SGS;
+        SGS sgs(handle, num_rows, num_cols, row_map, entries, values);
+        sgs.apply_multivector(
+                              x_lhs_output_vec,
+                              y_rhs_input_vec,
+                              init_zero_x_vector,
+                              numIter,
+                              omega,
+                              apply_forward,
+                              apply_backward, update_y_vector);
+      }
 
+      static void
+      gauss_seidel_apply_rank(
+                         KernelHandle *handle,
+                         typename KernelHandle::const_nnz_lno_t num_rows,
+                         typename KernelHandle::const_nnz_lno_t num_cols,
+                         a_size_view_t_ row_map,
+                         a_lno_view_t entries,
+                         a_scalar_view_t values,
+                         x_scalar_view_t x_lhs_output_vec,
+                         y_scalar_view_t y_rhs_input_vec,
+                         bool init_zero_x_vector,
+                         bool update_y_vector,
+                         typename KernelHandle::nnz_scalar_t omega, int numIter, bool apply_forward, bool apply_backward,
+                         std::false_type){
+
+        if (handle->get_gs_handle()->get_algorithm_type() == GS_TWOSTAGE){
+          typedef typename Impl::TwostageGaussSeidel <KernelHandle,
+                                                      a_size_view_t_, a_lno_view_t,a_scalar_view_t > SGS;
+          SGS sgs(handle, num_rows, num_cols, row_map, entries, values);
+          sgs.apply(
+                    x_lhs_output_vec,
+                    y_rhs_input_vec,
+                    init_zero_x_vector,
+                    numIter,
+                    omega,
+                    apply_forward,
+                    apply_backward, update_y_vector);
+          return;
+        }
+        if (handle->get_gs_handle()->get_algorithm_type() == GS_CLUSTER){
+          typedef typename Impl::ClusterGaussSeidel <KernelHandle,
+                                                     a_size_view_t_, a_lno_view_t,a_scalar_view_t > SGS;
+          SGS sgs(handle, num_rows, num_cols, row_map, entries, values);
+          sgs.apply(
+                    x_lhs_output_vec,
+                    y_rhs_input_vec,
+                    init_zero_x_vector,
+                    numIter,
+                    omega,
+                    apply_forward,
+                    apply_backward, update_y_vector);
+          return;
+        }
         typedef typename Impl::GaussSeidel <KernelHandle,
                                             a_size_view_t_, a_lno_view_t,a_scalar_view_t > SGS;
         SGS sgs(handle, num_rows, num_cols, row_map, entries, values);
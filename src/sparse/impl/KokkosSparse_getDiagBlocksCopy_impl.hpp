@@ -0,0 +1,161 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_SPARSE_IMPL_GETDIAGBLOCKSCOPY_HPP_
+#define KOKKOS_SPARSE_IMPL_GETDIAGBLOCKSCOPY_HPP_
+
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_BlockCrsMatrix.hpp"
+#include "KokkosKernels_config.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_ArithTraits.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+/// \brief Functor that copies the diagonal blocks of a CrsMatrix.
+///
+/// Block b of D holds rows and columns [b*bs, (b+1)*bs) of A, where
+/// bs = D.extent(1).  If the number of rows is not a multiple of bs,
+/// the rows and columns of the last block that are outside of A are
+/// filled with the identity, so that the block can still be factored.
+///
+/// \tparam DiagBlocksType 3-D Kokkos::View (numBlocks, bs, bs)
+/// \tparam CrsMatrixType Specialization of KokkosSparse::CrsMatrix
+template<class DiagBlocksType,
+         class CrsMatrixType>
+struct CrsMatrixGetDiagBlocksCopyFunctor {
+  typedef typename CrsMatrixType::ordinal_type LO; // local ordinal type
+  typedef typename DiagBlocksType::non_const_value_type scalar_type;
+
+  CrsMatrixGetDiagBlocksCopyFunctor (const DiagBlocksType& D,
+                                     const CrsMatrixType& A) :
+    D_ (D), A_ (A), blockSize_ (D.extent(1)), numRows_ (A.numRows ())
+  {}
+
+  /// \param lclBlock [in] The current diagonal block.
+  KOKKOS_INLINE_FUNCTION void
+  operator () (const LO& lclBlock) const
+  {
+    const scalar_type ZERO = Kokkos::Details::ArithTraits<scalar_type>::zero ();
+    const scalar_type ONE = Kokkos::Details::ArithTraits<scalar_type>::one ();
+    const LO blockBegin = lclBlock * blockSize_;
+
+    for (LO i = 0; i < blockSize_; ++i) {
+      for (LO j = 0; j < blockSize_; ++j) {
+        D_(lclBlock, i, j) = ZERO;
+      }
+    }
+    for (LO i = 0; i < blockSize_; ++i) {
+      const LO lclRow = blockBegin + i;
+      if (lclRow >= numRows_) {
+        D_(lclBlock, i, i) = ONE;
+        continue;
+      }
+      auto curRow = A_.rowConst (lclRow);
+      for (LO k = 0; k < curRow.length; ++k) {
+        const LO col = curRow.colidx(k);
+        if (col >= blockBegin && col < blockBegin + blockSize_ && col < numRows_) {
+          // Duplicate entries are summed.
+          D_(lclBlock, i, col - blockBegin) += curRow.value(k);
+        }
+      }
+    }
+  }
+
+private:
+  //! 3-D Kokkos::View into which to store the diagonal blocks.
+  DiagBlocksType D_;
+  //! The sparse matrix from which to get the diagonal blocks.
+  CrsMatrixType A_;
+  LO blockSize_;
+  LO numRows_;
+};
+
+/// \brief Functor that copies the diagonal blocks of a BlockCrsMatrix.
+///
+/// Block b of D is the block in block row b and block column b of A.
+/// If block row b has no diagonal block, block b of D is zero.
+///
+/// \tparam DiagBlocksType 3-D Kokkos::View (numBlockRows, blockDim, blockDim)
+/// \tparam BlockCrsMatrixType Specialization of KokkosSparse::Experimental::BlockCrsMatrix
+template<class DiagBlocksType,
+         class BlockCrsMatrixType>
+struct BlockCrsMatrixGetDiagBlocksCopyFunctor {
+  typedef typename BlockCrsMatrixType::ordinal_type LO; // local ordinal type
+  typedef typename DiagBlocksType::non_const_value_type scalar_type;
+
+  BlockCrsMatrixGetDiagBlocksCopyFunctor (const DiagBlocksType& D,
+                                          const BlockCrsMatrixType& A) :
+    D_ (D), A_ (A)
+  {}
+
+  /// \param lclBlockRow [in] The current (local) block row of the sparse matrix.
+  KOKKOS_INLINE_FUNCTION void
+  operator () (const LO& lclBlockRow) const
+  {
+    const scalar_type ZERO = Kokkos::Details::ArithTraits<scalar_type>::zero ();
+    const LO blockDim = A_.blockDim ();
+    const LO INV = Kokkos::Details::ArithTraits<LO>::max ();
+
+    auto curBlockRow = A_.block_row_Const (lclBlockRow);
+    const LO offset = curBlockRow.findRelBlockOffset (lclBlockRow);
+    for (LO i = 0; i < blockDim; ++i) {
+      for (LO j = 0; j < blockDim; ++j) {
+        D_(lclBlockRow, i, j) = (offset == INV) ? ZERO :
+          curBlockRow.local_block_value (offset, i, j);
+      }
+    }
+  }
+
+private:
+  //! 3-D Kokkos::View into which to store the diagonal blocks.
+  DiagBlocksType D_;
+  //! The sparse matrix from which to get the diagonal blocks.
+  BlockCrsMatrixType A_;
+};
+
+} // namespace Impl
+} // namespace KokkosSparse
+
+#endif // KOKKOS_SPARSE_IMPL_GETDIAGBLOCKSCOPY_HPP_
@@ -0,0 +1,306 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include "KokkosKernels_Utils.hpp"
+#include <Kokkos_Core.hpp>
+#include <Kokkos_MemoryTraits.hpp>
+#include "KokkosSparse_gauss_seidel_common_impl.hpp"
+#ifndef _KOKKOSTWOSTAGEGSIMP_HPP
+#define _KOKKOSTWOSTAGEGSIMP_HPP
+
+namespace KokkosSparse{
+
+
+  namespace Impl{
+
+    //Two-stage Gauss-Seidel. A is split into L + D + U, and
+    //each outer sweep computes x = x + omega * (D + L)^{-1} (y - A x) (or with D + U for backward sweeps).
+    //The triangular solve is not done exactly. Instead it is approximated by a few inner Jacobi sweeps:
+    //  z_0 = D^{-1} r,  z_{k+1} = D^{-1} (r - L z_k).
+    //No coloring or permutation is required, and every sweep is a single launch over all rows.
+    template <typename HandleType, typename lno_row_view_t_, typename lno_nnz_view_t_, typename scalar_nnz_view_t_>
+    class TwostageGaussSeidel{
+
+    public:
+
+      typedef lno_row_view_t_ in_lno_row_view_t;
+      typedef lno_nnz_view_t_ in_lno_nnz_view_t;
+      typedef scalar_nnz_view_t_ in_scalar_nnz_view_t;
+
+      typedef typename HandleType::HandleExecSpace MyExecSpace;
+      typedef typename HandleType::HandleTempMemorySpace MyTempMemorySpace;
+      typedef typename HandleType::HandlePersistentMemorySpace MyPersistentMemorySpace;
+
+      typedef typename HandleType::size_type size_type;
+      typedef typename HandleType::nnz_lno_t nnz_lno_t;
+      typedef typename HandleType::nnz_scalar_t nnz_scalar_t;
+
+      typedef typename in_lno_row_view_t::const_type const_lno_row_view_t;
+      typedef typename lno_nnz_view_t_::const_type const_lno_nnz_view_t;
+      typedef typename scalar_nnz_view_t_::const_type const_scalar_nnz_view_t;
+
+      typedef typename HandleType::scalar_persistent_work_view_t scalar_persistent_work_view_t;
+
+      typedef Kokkos::RangePolicy<MyExecSpace> my_exec_space;
+
+      struct ResidualTag{};
+      struct LowerSweepTag{};
+      struct UpperSweepTag{};
+      struct UpdateTag{};
+
+    private:
+      HandleType *handle;
+      nnz_lno_t num_rows, num_cols;
+
+      const_lno_row_view_t row_map;
+      const_lno_nnz_view_t entries;
+      const_scalar_nnz_view_t values;
+
+      const_scalar_nnz_view_t given_inverse_diagonal;
+
+      bool have_diagonal_given;
+    public:
+
+      template <typename x_value_array_type, typename y_value_array_type>
+      struct TwostageGS_Functor{
+        const_lno_row_view_t _xadj;
+        const_lno_nnz_view_t _adj;
+        const_scalar_nnz_view_t _adj_vals;
+        scalar_persistent_work_view_t _inverse_diagonal;
+
+        x_value_array_type _Xvector;
+        y_value_array_type _Yvector;
+
+        scalar_persistent_work_view_t _residual;
+        //current and the next iterate of the inner jacobi sweeps.
+        scalar_persistent_work_view_t _inner_x;
+        scalar_persistent_work_view_t _inner_x_next;
+
+        nnz_lno_t num_rows;
+        nnz_scalar_t omega;
+
+        TwostageGS_Functor(const_lno_row_view_t xadj_, const_lno_nnz_view_t adj_, const_scalar_nnz_view_t adj_vals_,
+                           scalar_persistent_work_view_t inverse_diagonal_,
+                           x_value_array_type Xvector_, y_value_array_type Yvector_,
+                           scalar_persistent_work_view_t residual_,
+                           scalar_persistent_work_view_t inner_x_,
+                           scalar_persistent_work_view_t inner_x_next_,
+                           nnz_lno_t num_rows_, nnz_scalar_t omega_):
+          _xadj(xadj_), _adj(adj_), _adj_vals(adj_vals_), _inverse_diagonal(inverse_diagonal_),
+          _Xvector(Xvector_), _Yvector(Yvector_),
+          _residual(residual_), _inner_x(inner_x_), _inner_x_next(inner_x_next_),
+          num_rows(num_rows_), omega(omega_){}
+
+        //r = y - A x, and the first inner iterate z_0 = D^{-1} r.
+        KOKKOS_INLINE_FUNCTION
+        void operator()(const ResidualTag&, const nnz_lno_t &ii) const {
+          const size_type row_end = _xadj[ii + 1];
+          nnz_scalar_t sum = _Yvector[ii];
+          for (size_type adjind = _xadj[ii]; adjind < row_end; ++adjind){
+            sum -= _adj_vals[adjind] * _Xvector[_adj[adjind]];
+          }
+          _residual[ii] = sum;
+          _inner_x[ii] = sum * _inverse_diagonal[ii];
+        }
+
+        //z_{k+1} = D^{-1} (r - L z_k)
+        KOKKOS_INLINE_FUNCTION
+        void operator()(const LowerSweepTag&, const nnz_lno_t &ii) const {
+          const size_type row_end = _xadj[ii + 1];
+          nnz_scalar_t sum = _residual[ii];
+          for (size_type adjind = _xadj[ii]; adjind < row_end; ++adjind){
+            const nnz_lno_t colIndex = _adj[adjind];
+            if (colIndex < ii){
+              sum -= _adj_vals[adjind] * _inner_x[colIndex];
+            }
+          }
+          _inner_x_next[ii] = sum * _inverse_diagonal[ii];
+        }
+
+        //z_{k+1} = D^{-1} (r - U z_k)
+        KOKKOS_INLINE_FUNCTION
+        void operator()(const UpperSweepTag&, const nnz_lno_t &ii) const {
+          const size_type row_end = _xadj[ii + 1];
+          nnz_scalar_t sum = _residual[ii];
+          for (size_type adjind = _xadj[ii]; adjind < row_end; ++adjind){
+            const nnz_lno_t colIndex = _adj[adjind];
+            if (colIndex > ii && colIndex < num_rows){
+              sum -= _adj_vals[adjind] * _inner_x[colIndex];
+            }
+          }
+          _inner_x_next[ii] = sum * _inverse_diagonal[ii];
+        }
+
+        //x = x + omega * z
+        KOKKOS_INLINE_FUNCTION
+        void operator()(const UpdateTag&, const nnz_lno_t &ii) const {
+          _Xvector[ii] += omega * _inner_x[ii];
+        }
+      };
+
+      /**
+       * \brief constructor
+       */
+      TwostageGaussSeidel(HandleType *handle_,
+                          nnz_lno_t num_rows_,
+                          nnz_lno_t num_cols_,
+                          const_lno_row_view_t row_map_,
+                          const_lno_nnz_view_t entries_,
+                          const_scalar_nnz_view_t values_):
+        handle(handle_), num_rows(num_rows_), num_cols(num_cols_),
+        row_map(row_map_), entries(entries_), values(values_),
+        have_diagonal_given(false){}
+
+      TwostageGaussSeidel(HandleType *handle_,
+                          nnz_lno_t num_rows_,
+                          nnz_lno_t num_cols_,
+                          const_lno_row_view_t row_map_,
+                          const_lno_nnz_view_t entries_):
+        handle(handle_), num_rows(num_rows_), num_cols(num_cols_),
+        row_map(row_map_), entries(entries_), values(),
+        have_diagonal_given(false){}
+
+      TwostageGaussSeidel(HandleType *handle_,
+                          nnz_lno_t num_rows_,
+                          nnz_lno_t num_cols_,
+                          const_lno_row_view_t row_map_,
+                          const_lno_nnz_view_t entries_,
+                          const_scalar_nnz_view_t values_,
+                          const_scalar_nnz_view_t given_inverse_diagonal_):
+        handle(handle_), num_rows(num_rows_), num_cols(num_cols_),
+        row_map(row_map_), entries(entries_), values(values_),
+        given_inverse_diagonal(given_inverse_diagonal_),
+        have_diagonal_given(true){}
+
+      //there is no coloring; symbolic phase only allocates the work vectors.
+      void initialize_symbolic(){
+        typename HandleType::GaussSeidelHandleType *gsHandler = this->handle->get_gs_handle();
+        if (gsHandler->get_block_size() > 1){
+          throw std::runtime_error ("GS_TWOSTAGE does not support block size larger than 1.\n");
+        }
+        gsHandler->allocate_inner_vectors(this->num_rows);
+        gsHandler->set_call_symbolic(true);
+      }
+
+      void initialize_numeric(){
+        typename HandleType::GaussSeidelHandleType *gsHandler = this->handle->get_gs_handle();
+        if (gsHandler->is_symbolic_called() == false){
+          this->initialize_symbolic();
+        }
+
+        scalar_persistent_work_view_t inverse_diagonal ("inverse_diagonal", num_rows);
+        if (!have_diagonal_given){
+          Kokkos::parallel_for("KokkosSparse::TwostageGaussSeidel::get_inverse_diagonals",
+                               my_exec_space(0, num_rows),
+                               Get_Inverse_Diagonals<const_lno_row_view_t, const_lno_nnz_view_t,
+                                                     const_scalar_nnz_view_t, scalar_persistent_work_view_t>
+                               (row_map, entries, values, inverse_diagonal));
+        }
+        else {
+          Kokkos::deep_copy(inverse_diagonal, given_inverse_diagonal);
+        }
+        MyExecSpace::fence();
+        gsHandler->set_permuted_inverse_diagonal(inverse_diagonal);
+        gsHandler->set_call_numeric(true);
+      }
+
+      template <typename x_value_array_type, typename y_value_array_type>
+      void apply(
+                 x_value_array_type x_lhs_output_vec,
+                 y_value_array_type y_rhs_input_vec,
+                 bool init_zero_x_vector = false,
+                 int numIter = 1,
+                 nnz_scalar_t omega = Kokkos::Details::ArithTraits<nnz_scalar_t>::one(),
+                 bool apply_forward = true,
+                 bool apply_backward = true,
+                 bool /*update_y_vector*/ = true){
+
+        typename HandleType::GaussSeidelHandleType *gsHandler = this->handle->get_gs_handle();
+        if (gsHandler->is_numeric_called() == false){
+          this->initialize_numeric();
+        }
+
+        if (init_zero_x_vector){
+          KokkosKernels::Impl::zero_vector<x_value_array_type, MyExecSpace>(num_cols, x_lhs_output_vec);
+        }
+
+        typedef TwostageGS_Functor<x_value_array_type, y_value_array_type> functor_t;
+        functor_t gs(row_map, entries, values,
+                     gsHandler->get_permuted_inverse_diagonal(),
+                     x_lhs_output_vec, y_rhs_input_vec,
+                     gsHandler->get_residual_vector(),
+                     gsHandler->get_inner_x_vector(),
+                     gsHandler->get_inner_x_vector_tmp(),
+                     num_rows, omega);
+
+        const int num_inner_sweeps = gsHandler->get_num_inner_sweeps();
+        for (int i = 0; i < numIter; ++i){
+          if (apply_forward){
+            this->template sweep<LowerSweepTag>(gs, num_inner_sweeps);
+          }
+          if (apply_backward){
+            this->template sweep<UpperSweepTag>(gs, num_inner_sweeps);
+          }
+        }
+      }
+
+    private:
+
+      template <typename sweep_tag, typename functor_t>
+      void sweep(functor_t &gs, int num_inner_sweeps){
+        Kokkos::parallel_for("KokkosSparse::TwostageGaussSeidel::residual",
+                             Kokkos::RangePolicy<ResidualTag, MyExecSpace>(0, num_rows), gs);
+        for (int k = 0; k < num_inner_sweeps; ++k){
+          Kokkos::parallel_for("KokkosSparse::TwostageGaussSeidel::inner_sweep",
+                               Kokkos::RangePolicy<sweep_tag, MyExecSpace>(0, num_rows), gs);
+          std::swap(gs._inner_x, gs._inner_x_next);
+        }
+        Kokkos::parallel_for("KokkosSparse::TwostageGaussSeidel::update",
+                             Kokkos::RangePolicy<UpdateTag, MyExecSpace>(0, num_rows), gs);
+        MyExecSpace::fence();
+      }
+    };
+
+  }
+}
+#endif
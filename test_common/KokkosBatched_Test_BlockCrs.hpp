@@ -44,6 +44,10 @@
 #include "KokkosBatched_LU_Serial_Impl.hpp"
 #include "KokkosBatched_LU_Team_Impl.hpp"
 
+#include "KokkosBatched_BlockTridiag_Decl.hpp"
+#include "KokkosBatched_BlockTridiag_Serial_Impl.hpp"
+#include "KokkosBatched_BlockTridiag_Team_Impl.hpp"
+
 #include "KokkosBatched_Test_BlockCrs_Util.hpp"
 
 namespace KokkosBatched {
@@ -83,33 +87,10 @@ namespace KokkosBatched {
         auto B = Kokkos::subview(_TB, ij, Kokkos::ALL(), Kokkos::ALL(), Kokkos::ALL());
         auto C = Kokkos::subview(_TC, ij, Kokkos::ALL(), Kokkos::ALL(), Kokkos::ALL());
 
-        auto AA = Kokkos::subview(A, 0,   Kokkos::ALL(), Kokkos::ALL());
-        auto BB = Kokkos::subview(B, 0,   Kokkos::ALL(), Kokkos::ALL());
-        auto CC = Kokkos::subview(C, 0,   Kokkos::ALL(), Kokkos::ALL());
-        auto DD = AA;
-
         const auto tiny = Kokkos::Details::ArithTraits<magnitude_scalar_type>::epsilon()*100;
 
-        const ordinal_type kend = _m - 1;
-        for (ordinal_type k=0;k<kend;++k) {
-          AA.assign_data( &A(k  ,0,0) );
-          BB.assign_data( &B(k  ,0,0) );
-          CC.assign_data( &C(k  ,0,0) );
-          DD.assign_data( &A(k+1,0,0) );
-
-          SerialAddRadial::invoke(tiny, AA);
-          SerialLU<LU_AlgoTagType>
-            ::invoke(AA);
-          SerialTrsm<Side::Left,Uplo::Lower,Trans::NoTranspose,Diag::Unit,Trsm_AlgoTagType>
-            ::invoke(1.0, AA, BB);
-          SerialTrsm<Side::Right,Uplo::Upper,Trans::NoTranspose,Diag::NonUnit,Trsm_AlgoTagType>
-            ::invoke(1.0, AA, CC);
-          SerialGemm<Trans::NoTranspose,Trans::NoTranspose,Gemm_AlgoTagType>
-            ::invoke(-1.0, CC, BB, 1.0, DD);
-        }
-        AA.assign_data( &A(kend,0,0) );
-        SerialLU<LU_AlgoTagType>
-          ::invoke(AA);
+        SerialBlockTridiagFactorizeImpl<LU_AlgoTagType,Trsm_AlgoTagType,Gemm_AlgoTagType>
+          ::invoke(A, B, C, tiny);
       }
 
       template<typename MemberType>
@@ -127,43 +108,11 @@ namespace KokkosBatched {
 
               const auto tiny = Kokkos::Details::ArithTraits<magnitude_scalar_type>::epsilon()*100;
 
-              const ordinal_type kend = _m - 1;
-              {
-                auto AA = Kokkos::subview(A, 0,   Kokkos::ALL(), Kokkos::ALL());
-                auto BB = Kokkos::subview(B, 0,   Kokkos::ALL(), Kokkos::ALL());
-                auto CC = Kokkos::subview(C, 0,   Kokkos::ALL(), Kokkos::ALL());
-                auto DD = AA;
-
-                for (ordinal_type k=0;k<kend;++k) {
-
-                  AA.assign_data( &A(k  ,0,0) );
-                  BB.assign_data( &B(k  ,0,0) );
-                  CC.assign_data( &C(k  ,0,0) );
-                  DD.assign_data( &A(k+1,0,0) );
-                  
-                  member.team_barrier();
-                  TeamAddRadial<MemberType>::invoke(member, tiny, AA);
-                  member.team_barrier();
-                  TeamLU<MemberType,LU_AlgoTagType>
-                    ::invoke(member, AA);
-                  member.team_barrier();
-                  TeamTrsm<MemberType,Side::Left,Uplo::Lower,Trans::NoTranspose,Diag::Unit,Trsm_AlgoTagType>
-                    ::invoke(member, 1.0, AA, BB);
-                  TeamTrsm<MemberType,Side::Right,Uplo::Upper,Trans::NoTranspose,Diag::NonUnit,Trsm_AlgoTagType>
-                    ::invoke(member, 1.0, AA, CC);
-                  member.team_barrier();
-                  TeamGemm<MemberType,Trans::NoTranspose,Trans::NoTranspose,Gemm_AlgoTagType>
-                    ::invoke(member, -1.0, CC, BB, 1.0, DD);
-                }
-                {
-                  member.team_barrier();
-                  AA.assign_data( &A(kend,0,0) );
-                  TeamLU<MemberType,LU_AlgoTagType>
-                    ::invoke(member, AA);
-                }
-              }
+              TeamBlockTridiagFactorizeImpl<MemberType,LU_AlgoTagType,Trsm_AlgoTagType,Gemm_AlgoTagType>
+                ::invoke(member, A, B, C, tiny);
 #if 0
               { // 0.028 vs 0.035; without subview it performs 0.028
+                const ordinal_type kend = _m - 1;
                 const int as0 = A.stride_1(), as1 = A.stride_2();
                 const int bs0 = B.stride_1(), bs1 = B.stride_2();
                 const int cs0 = C.stride_1(), cs1 = C.stride_2();
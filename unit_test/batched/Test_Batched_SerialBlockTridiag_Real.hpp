@@ -0,0 +1,24 @@
+#if defined(KOKKOSKERNELS_INST_FLOAT)
+TEST_F( TestCategory, batched_scalar_serial_block_tridiag_float ) {
+  typedef Algo::BlockTridiag::Unblocked algo_tag_type;
+  test_batched_block_tridiag<TestExecSpace,float,algo_tag_type>();
+}
+#endif
+
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F( TestCategory, batched_scalar_serial_block_tridiag_double ) {
+  typedef Algo::BlockTridiag::Unblocked algo_tag_type;
+  test_batched_block_tridiag<TestExecSpace,double,algo_tag_type>();
+}
+TEST_F( TestCategory, batched_scalar_serial_block_tridiag_blocked_double ) {
+  typedef Algo::BlockTridiag::Blocked algo_tag_type;
+  test_batched_block_tridiag<TestExecSpace,double,algo_tag_type>();
+}
+#if !defined(KOKKOS_ENABLE_CUDA)
+TEST_F( TestCategory, batched_vector_serial_block_tridiag_simd_double4 ) {
+  typedef Algo::BlockTridiag::Unblocked algo_tag_type;
+  test_batched_block_tridiag<TestExecSpace,Vector<SIMD<double>,4>,algo_tag_type>();
+}
+#endif
+#endif
@@ -0,0 +1,6 @@
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE)
+TEST_F( TestCategory, batched_scalar_serial_cholesky_dcomplex ) {
+  typedef Algo::Cholesky::Unblocked algo_tag_type;
+  test_batched_cholesky<TestExecSpace,Kokkos::complex<double>,algo_tag_type>();
+}
+#endif
@@ -0,0 +1,195 @@
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+
+//#include "KokkosBatched_Vector.hpp"
+
+#include "KokkosBatched_Gemm_Decl.hpp"
+#include "KokkosBatched_Gemm_Serial_Impl.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+using namespace KokkosBatched::Experimental;
+
+namespace Test {
+
+  template<typename TA, typename TB>
+  struct ParamTag { 
+    typedef TA transA;
+    typedef TB transB;
+  };
+ 
+  template<typename DeviceType,
+           typename ViewType,
+           typename ScalarType,
+           typename ParamTagType,
+           int M, int N, int K>
+  struct Functor_TestBatchedSerialGemmFixed {
+    ViewType _a, _b, _c;
+    
+    ScalarType _alpha, _beta;
+    
+    KOKKOS_INLINE_FUNCTION
+    Functor_TestBatchedSerialGemmFixed(const ScalarType alpha, 
+                                       const ViewType &a,
+                                       const ViewType &b,
+                                       const ScalarType beta,
+                                       const ViewType &c)
+      : _a(a), _b(b), _c(c), _alpha(alpha), _beta(beta) {}
+    
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const int k) const {
+      auto aa = Kokkos::subview(_a, k, Kokkos::ALL(), Kokkos::ALL());
+      auto bb = Kokkos::subview(_b, k, Kokkos::ALL(), Kokkos::ALL());
+      auto cc = Kokkos::subview(_c, k, Kokkos::ALL(), Kokkos::ALL());
+      
+      SerialGemmFixed<typename ParamTagType::transA,
+        typename ParamTagType::transB,
+        M,N,K>::
+        invoke(_alpha, aa, bb, _beta, cc);
+    }
+    
+    inline
+    void run() {
+      Kokkos::RangePolicy<DeviceType> policy(0, _c.extent(0));
+      Kokkos::parallel_for(policy, *this);            
+    }
+  };
+
+  template<typename DeviceType,
+           typename ViewType,
+           typename ScalarType,
+           typename ParamTagType>
+  struct Functor_TestBatchedSerialGemmUnblocked {
+    ViewType _a, _b, _c;
+    
+    ScalarType _alpha, _beta;
+    
+    KOKKOS_INLINE_FUNCTION
+    Functor_TestBatchedSerialGemmUnblocked(const ScalarType alpha, 
+                                           const ViewType &a,
+                                           const ViewType &b,
+                                           const ScalarType beta,
+                                           const ViewType &c)
+      : _a(a), _b(b), _c(c), _alpha(alpha), _beta(beta) {}
+    
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const int k) const {
+      auto aa = Kokkos::subview(_a, k, Kokkos::ALL(), Kokkos::ALL());
+      auto bb = Kokkos::subview(_b, k, Kokkos::ALL(), Kokkos::ALL());
+      auto cc = Kokkos::subview(_c, k, Kokkos::ALL(), Kokkos::ALL());
+      
+      SerialGemm<typename ParamTagType::transA,
+        typename ParamTagType::transB,
+        Algo::Gemm::Unblocked>::
+        invoke(_alpha, aa, bb, _beta, cc);
+    }
+    
+    inline
+    void run() {
+      Kokkos::RangePolicy<DeviceType> policy(0, _c.extent(0));
+      Kokkos::parallel_for(policy, *this);            
+    }
+  };
+    
+  template<typename DeviceType,
+           typename ViewType,
+           typename ScalarType,
+           typename ParamTagType,
+           int M, int N, int K>
+  void impl_test_batched_gemm_fixed(const int nbatch, const ScalarType alpha, const ScalarType beta) {
+    typedef typename ViewType::value_type value_type;
+    typedef Kokkos::Details::ArithTraits<value_type> ats;
+
+    const bool 
+      is_trans_a = std::is_same<typename ParamTagType::transA,Trans::Transpose>::value,
+      is_trans_b = std::is_same<typename ParamTagType::transB,Trans::Transpose>::value;
+
+    /// randomized input testing views
+    ViewType
+      a0("a0", nbatch, is_trans_a ? K : M, is_trans_a ? M : K), 
+      b0("b0", nbatch, is_trans_b ? N : K, is_trans_b ? K : N), 
+      c0("c0", nbatch, M, N), c1("c1", nbatch, M, N);
+
+    Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> random(13718);
+    Kokkos::fill_random(a0, random, value_type(1.0));
+    Kokkos::fill_random(b0, random, value_type(1.0));
+    Kokkos::fill_random(c0, random, value_type(1.0));
+
+    Kokkos::fence();
+
+    Kokkos::deep_copy(c1, c0);
+
+    /// test body
+    Functor_TestBatchedSerialGemmUnblocked<DeviceType,ViewType,ScalarType,
+      ParamTagType>(alpha, a0, b0, beta, c0).run();
+    Functor_TestBatchedSerialGemmFixed<DeviceType,ViewType,ScalarType,
+      ParamTagType,M,N,K>(alpha, a0, b0, beta, c1).run();
+
+    Kokkos::fence();
+
+    /// for comparison send it to host
+    typename ViewType::HostMirror c0_host = Kokkos::create_mirror_view(c0);
+    typename ViewType::HostMirror c1_host = Kokkos::create_mirror_view(c1);
+
+    Kokkos::deep_copy(c0_host, c0);
+    Kokkos::deep_copy(c1_host, c1);
+
+    /// check c0 = c1 ; this eps is about 10^-14
+    typedef typename ats::mag_type mag_type;
+    mag_type sum(1), diff(0);
+    const mag_type eps = 1.0e3 * ats::epsilon();
+
+    for (int k=0;k<nbatch;++k) 
+      for (int i=0;i<M;++i) 
+        for (int j=0;j<N;++j) {
+          sum  += ats::abs(c0_host(k,i,j));
+          diff += ats::abs(c0_host(k,i,j)-c1_host(k,i,j));
+        }
+    EXPECT_NEAR_KK( diff/sum, 0, eps);
+  }
+
+  template<typename DeviceType,
+           typename ViewType,
+           typename ScalarType,
+           typename ParamTagType>
+  void impl_test_batched_gemm_fixed_sizes(const int nbatch) {
+    const ScalarType alpha = 1.5, beta = 3.0, one = 1.0, zero = 0.0;
+
+    impl_test_batched_gemm_fixed<DeviceType,ViewType,ScalarType,ParamTagType,2,2,2>(nbatch, alpha, beta);
+    impl_test_batched_gemm_fixed<DeviceType,ViewType,ScalarType,ParamTagType,3,3,3>(nbatch, alpha, beta);
+    impl_test_batched_gemm_fixed<DeviceType,ViewType,ScalarType,ParamTagType,4,4,4>(nbatch, alpha, beta);
+    impl_test_batched_gemm_fixed<DeviceType,ViewType,ScalarType,ParamTagType,5,5,5>(nbatch, alpha, beta);
+    impl_test_batched_gemm_fixed<DeviceType,ViewType,ScalarType,ParamTagType,6,6,6>(nbatch, alpha, beta);
+    impl_test_batched_gemm_fixed<DeviceType,ViewType,ScalarType,ParamTagType,7,7,7>(nbatch, alpha, beta);
+    impl_test_batched_gemm_fixed<DeviceType,ViewType,ScalarType,ParamTagType,8,8,8>(nbatch, alpha, beta);
+
+    impl_test_batched_gemm_fixed<DeviceType,ViewType,ScalarType,ParamTagType,3,6,2>(nbatch, alpha, beta);
+    impl_test_batched_gemm_fixed<DeviceType,ViewType,ScalarType,ParamTagType,6,3,8>(nbatch, alpha, one);
+    impl_test_batched_gemm_fixed<DeviceType,ViewType,ScalarType,ParamTagType,3,3,6>(nbatch, alpha, zero);
+    impl_test_batched_gemm_fixed<DeviceType,ViewType,ScalarType,ParamTagType,6,6,3>(nbatch, zero, beta);
+  }
+}
+
+template<typename DeviceType, 
+         typename ValueType, 
+         typename ScalarType,
+         typename ParamTagType>
+int test_batched_gemm_fixed() {
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) 
+  {
+    typedef Kokkos::View<ValueType***,Kokkos::LayoutLeft,DeviceType> ViewType;
+    Test::impl_test_batched_gemm_fixed_sizes<DeviceType,ViewType,ScalarType,ParamTagType>(   0);
+    Test::impl_test_batched_gemm_fixed_sizes<DeviceType,ViewType,ScalarType,ParamTagType>(1024);
+  }
+#endif
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) 
+  {
+    typedef Kokkos::View<ValueType***,Kokkos::LayoutRight,DeviceType> ViewType;
+    Test::impl_test_batched_gemm_fixed_sizes<DeviceType,ViewType,ScalarType,ParamTagType>(   0);
+    Test::impl_test_batched_gemm_fixed_sizes<DeviceType,ViewType,ScalarType,ParamTagType>(1024);
+  }
+#endif
+  
+  return 0;
+}
@@ -0,0 +1,40 @@
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE)
+
+/// dcomplex, dcomplex
+
+TEST_F( TestCategory, batched_scalar_serial_gemm_fixed_nt_nt_dcomplex_dcomplex ) {
+  typedef ::Test::ParamTag<Trans::NoTranspose,Trans::NoTranspose> param_tag_type;
+  test_batched_gemm_fixed<TestExecSpace,Kokkos::complex<double>,Kokkos::complex<double>,param_tag_type>();
+}
+TEST_F( TestCategory, batched_scalar_serial_gemm_fixed_t_nt_dcomplex_dcomplex ) {
+  typedef ::Test::ParamTag<Trans::Transpose,Trans::NoTranspose> param_tag_type;
+  test_batched_gemm_fixed<TestExecSpace,Kokkos::complex<double>,Kokkos::complex<double>,param_tag_type>();
+}
+TEST_F( TestCategory, batched_scalar_serial_gemm_fixed_nt_t_dcomplex_dcomplex ) {
+  typedef ::Test::ParamTag<Trans::NoTranspose,Trans::Transpose> param_tag_type;
+  test_batched_gemm_fixed<TestExecSpace,Kokkos::complex<double>,Kokkos::complex<double>,param_tag_type>();
+}
+TEST_F( TestCategory, batched_scalar_serial_gemm_fixed_t_t_dcomplex_dcomplex ) {
+  typedef ::Test::ParamTag<Trans::Transpose,Trans::Transpose> param_tag_type;
+  test_batched_gemm_fixed<TestExecSpace,Kokkos::complex<double>,Kokkos::complex<double>,param_tag_type>();
+}
+
+/// dcomplex, double
+
+TEST_F( TestCategory, batched_scalar_serial_gemm_fixed_nt_nt_dcomplex_double ) {
+  typedef ::Test::ParamTag<Trans::NoTranspose,Trans::NoTranspose> param_tag_type;
+  test_batched_gemm_fixed<TestExecSpace,Kokkos::complex<double>,double,param_tag_type>();
+}
+TEST_F( TestCategory, batched_scalar_serial_gemm_fixed_t_nt_dcomplex_double ) {
+  typedef ::Test::ParamTag<Trans::Transpose,Trans::NoTranspose> param_tag_type;
+  test_batched_gemm_fixed<TestExecSpace,Kokkos::complex<double>,double,param_tag_type>();
+}
+TEST_F( TestCategory, batched_scalar_serial_gemm_fixed_nt_t_dcomplex_double ) {
+  typedef ::Test::ParamTag<Trans::NoTranspose,Trans::Transpose> param_tag_type;
+  test_batched_gemm_fixed<TestExecSpace,Kokkos::complex<double>,double,param_tag_type>();
+}
+TEST_F( TestCategory, batched_scalar_serial_gemm_fixed_t_t_dcomplex_double ) {
+  typedef ::Test::ParamTag<Trans::Transpose,Trans::Transpose> param_tag_type;
+  test_batched_gemm_fixed<TestExecSpace,Kokkos::complex<double>,double,param_tag_type>();
+}
+#endif
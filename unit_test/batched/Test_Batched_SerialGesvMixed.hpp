@@ -0,0 +1,237 @@
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+
+#include "KokkosBatched_Vector.hpp"
+
+#include "KokkosBatched_Gesv_Decl.hpp"
+#include "KokkosBatched_Gesv_Serial_Impl.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+using namespace KokkosBatched::Experimental;
+
+namespace Test {
+
+  template<typename DeviceType,
+           typename AViewType,
+           typename FViewType,
+           typename bViewType,
+           typename dViewType,
+           typename InfoViewType,
+           typename AlgoTagType>
+  struct Functor_TestBatchedSerialGesvMixed {
+    AViewType _a;
+    FViewType _f;
+    bViewType _b, _x, _r;
+    dViewType _d;
+    InfoViewType _info;
+    Kokkos::View<int*,DeviceType> _ret;
+    int _max_iter;
+
+    KOKKOS_INLINE_FUNCTION
+    Functor_TestBatchedSerialGesvMixed(const AViewType &a, const FViewType &f,
+                                       const bViewType &b, const bViewType &x,
+                                       const bViewType &r, const dViewType &d,
+                                       const InfoViewType &info,
+                                       const Kokkos::View<int*,DeviceType> &ret,
+                                       const int max_iter)
+      : _a(a), _f(f), _b(b), _x(x), _r(r), _d(d), _info(info), _ret(ret), _max_iter(max_iter) {}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const int k) const {
+      auto aa = Kokkos::subview(_a, k, Kokkos::ALL(), Kokkos::ALL());
+      auto ff = Kokkos::subview(_f, k, Kokkos::ALL(), Kokkos::ALL());
+      auto bb = Kokkos::subview(_b, k, Kokkos::ALL());
+      auto xx = Kokkos::subview(_x, k, Kokkos::ALL());
+      auto rr = Kokkos::subview(_r, k, Kokkos::ALL());
+      auto dd = Kokkos::subview(_d, k, Kokkos::ALL());
+      auto ii = Kokkos::subview(_info, k, Kokkos::ALL());
+
+      _ret(k) = SerialGesvMixed<AlgoTagType>::invoke(aa, ff, bb, xx, rr, dd, ii, _max_iter);
+    }
+
+    inline
+    void run() {
+      Kokkos::RangePolicy<DeviceType> policy(0, _a.extent(0));
+      Kokkos::parallel_for(policy, *this);
+    }
+  };
+
+  template<typename DeviceType,
+           typename ViewType,
+           typename LowValueType,
+           typename AlgoTagType>
+  void impl_test_batched_gesv_mixed(const int N, const int BlkSize) {
+    typedef typename ViewType::value_type value_type;
+    typedef PivotTraits<value_type> traits;
+    typedef typename traits::value_type scalar_type;
+    typedef Kokkos::Details::ArithTraits<scalar_type> ats;
+    enum : int { vl = traits::vector_length };
+
+    typedef Kokkos::View<LowValueType***,typename ViewType::array_layout,DeviceType> FViewType;
+    typedef Kokkos::View<value_type**,typename ViewType::array_layout,DeviceType> bViewType;
+    typedef Kokkos::View<LowValueType**,typename ViewType::array_layout,DeviceType> dViewType;
+    typedef Kokkos::View<int**,typename ViewType::array_layout,DeviceType> InfoViewType;
+
+    /// randomized diagonally dominant input so that the float factors are
+    /// good enough for the refinement to converge
+    ViewType a0("a0", N, BlkSize, BlkSize), a1("a1", N, BlkSize, BlkSize);
+    bViewType b0("b0", N, BlkSize), x1("x1", N, BlkSize), r1("r1", N, BlkSize);
+    FViewType f1("f1", N, BlkSize, BlkSize);
+    dViewType d1("d1", N, BlkSize);
+    InfoViewType info1("info1", N, vl);
+    Kokkos::View<int*,DeviceType> ret1("ret1", N);
+
+    Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> random(13718);
+    Kokkos::fill_random(a0, random, value_type(1.0));
+    Kokkos::fill_random(b0, random, value_type(1.0));
+
+    Kokkos::fence();
+
+    typename ViewType::HostMirror a0_host = Kokkos::create_mirror_view(a0);
+    Kokkos::deep_copy(a0_host, a0);
+    for (int k=0;k<N;++k)
+      for (int i=0;i<BlkSize;++i)
+        a0_host(k,i,i) += value_type(BlkSize);
+    Kokkos::deep_copy(a0, a0_host);
+    Kokkos::deep_copy(a1, a0);
+
+    typename bViewType::HostMirror
+      b0_host = Kokkos::create_mirror_view(b0),
+      x1_host = Kokkos::create_mirror_view(x1);
+    typename InfoViewType::HostMirror info1_host = Kokkos::create_mirror_view(info1);
+    typename Kokkos::View<int*,DeviceType>::HostMirror ret1_host = Kokkos::create_mirror_view(ret1);
+
+    Kokkos::deep_copy(b0_host, b0);
+
+    typedef typename ats::mag_type mag_type;
+    const mag_type eps = 1.0e3 * ats::epsilon();
+
+    /// without refinement steps the float solution is not accurate in double
+    if (BlkSize > 0) {
+      Functor_TestBatchedSerialGesvMixed
+        <DeviceType,ViewType,FViewType,bViewType,dViewType,InfoViewType,AlgoTagType>
+        (a1, f1, b0, x1, r1, d1, info1, ret1, 0).run();
+
+      Kokkos::fence();
+
+      Kokkos::deep_copy(info1_host, info1);
+      Kokkos::deep_copy(ret1_host, ret1);
+      for (int k=0;k<N;++k) {
+        EXPECT_EQ( ret1_host(k), 1 );
+        for (int v=0;v<vl;++v)
+          EXPECT_EQ( info1_host(k,v), -1 );
+      }
+    }
+
+    Functor_TestBatchedSerialGesvMixed
+      <DeviceType,ViewType,FViewType,bViewType,dViewType,InfoViewType,AlgoTagType>
+      (a1, f1, b0, x1, r1, d1, info1, ret1, 30).run();
+
+    Kokkos::fence();
+
+    /// check convergence flags and the residual b - A x against the
+    /// original A in double precision
+    typename ViewType::HostMirror a1_host = Kokkos::create_mirror_view(a1);
+    Kokkos::deep_copy(a1_host, a1);
+    Kokkos::deep_copy(x1_host, x1);
+    Kokkos::deep_copy(info1_host, info1);
+    Kokkos::deep_copy(ret1_host, ret1);
+
+    mag_type sum(1), diff(0), amod(0);
+    for (int k=0;k<N;++k) {
+      EXPECT_EQ( ret1_host(k), 0 );
+      for (int v=0;v<vl;++v) {
+        EXPECT_TRUE( info1_host(k,v) >= 0 && info1_host(k,v) <= 30 );
+        for (int i=0;i<BlkSize;++i) {
+          scalar_type r = traits::value(b0_host(k,i), v);
+          for (int j=0;j<BlkSize;++j) {
+            r -= traits::value(a0_host(k,i,j), v)*traits::value(x1_host(k,j), v);
+            amod += ats::abs(traits::value(a0_host(k,i,j), v) - traits::value(a1_host(k,i,j), v));
+          }
+          sum  += ats::abs(traits::value(b0_host(k,i), v));
+          diff += ats::abs(r);
+        }
+      }
+    }
+    EXPECT_NEAR_KK( diff/sum, 0, eps);
+    EXPECT_EQ( amod, mag_type(0) );
+
+    /// lane 0 of the even packs does not fit in low precision; it must fail
+    /// without a factorization while the other lanes still converge
+    if (BlkSize > 0) {
+      typedef typename PivotTraits<LowValueType>::value_type low_scalar_type;
+      const scalar_type big = scalar_type(4)*Kokkos::Details::ArithTraits<low_scalar_type>::max();
+      for (int k=0;k<N;k+=2)
+        for (int i=0;i<BlkSize;++i)
+          for (int j=0;j<BlkSize;++j)
+            traits::value(a0_host(k,i,j), 0) *= big;
+      Kokkos::deep_copy(a1, a0_host);
+
+      Functor_TestBatchedSerialGesvMixed
+        <DeviceType,ViewType,FViewType,bViewType,dViewType,InfoViewType,AlgoTagType>
+        (a1, f1, b0, x1, r1, d1, info1, ret1, 30).run();
+
+      Kokkos::fence();
+
+      Kokkos::deep_copy(x1_host, x1);
+      Kokkos::deep_copy(info1_host, info1);
+      Kokkos::deep_copy(ret1_host, ret1);
+
+      mag_type sum(1), diff(0);
+      for (int k=0;k<N;++k) {
+        const bool overflow = (k%2 == 0);
+        EXPECT_EQ( ret1_host(k), overflow ? 1 : 0 );
+        for (int v=0;v<vl;++v) {
+          if (overflow && v == 0) {
+            EXPECT_EQ( info1_host(k,v), -1 );
+            for (int i=0;i<BlkSize;++i)
+              EXPECT_EQ( traits::value(x1_host(k,i), v), scalar_type(0) );
+          } else {
+            EXPECT_TRUE( info1_host(k,v) >= 0 && info1_host(k,v) <= 30 );
+            for (int i=0;i<BlkSize;++i) {
+              scalar_type r = traits::value(b0_host(k,i), v);
+              for (int j=0;j<BlkSize;++j)
+                r -= traits::value(a0_host(k,i,j), v)*traits::value(x1_host(k,j), v);
+              sum  += ats::abs(traits::value(b0_host(k,i), v));
+              diff += ats::abs(r);
+            }
+          }
+        }
+      }
+      EXPECT_NEAR_KK( diff/sum, 0, eps);
+    }
+  }
+}
+
+
+template<typename DeviceType,
+         typename ValueType,
+         typename LowValueType,
+         typename AlgoTagType>
+int test_batched_gesv_mixed() {
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT)
+  {
+    typedef Kokkos::View<ValueType***,Kokkos::LayoutLeft,DeviceType> ViewType;
+    Test::impl_test_batched_gesv_mixed<DeviceType,ViewType,LowValueType,AlgoTagType>(     0, 10);
+    for (int i=0;i<10;++i) {
+      //printf("Testing: LayoutLeft,  Blksize %d\n", i);
+      Test::impl_test_batched_gesv_mixed<DeviceType,ViewType,LowValueType,AlgoTagType>(1024, i);
+    }
+  }
+#endif
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT)
+  {
+    typedef Kokkos::View<ValueType***,Kokkos::LayoutRight,DeviceType> ViewType;
+    Test::impl_test_batched_gesv_mixed<DeviceType,ViewType,LowValueType,AlgoTagType>(     0, 10);
+    for (int i=0;i<10;++i) {
+      //printf("Testing: LayoutRight, Blksize %d\n", i);
+      Test::impl_test_batched_gesv_mixed<DeviceType,ViewType,LowValueType,AlgoTagType>(1024, i);
+    }
+  }
+#endif
+
+  return 0;
+}
+
@@ -0,0 +1,20 @@
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F( TestCategory, batched_scalar_serial_gesv_mixed_double_float ) {
+  typedef Algo::Gesv::Unblocked algo_tag_type;
+  test_batched_gesv_mixed<TestExecSpace,double,float,algo_tag_type>();
+}
+TEST_F( TestCategory, batched_scalar_serial_gesv_mixed_blocked_double_float ) {
+  typedef Algo::Gesv::Blocked algo_tag_type;
+  test_batched_gesv_mixed<TestExecSpace,double,float,algo_tag_type>();
+}
+#if !defined(KOKKOS_ENABLE_CUDA)
+TEST_F( TestCategory, batched_vector_serial_gesv_mixed_simd_double4_float4 ) {
+  typedef Algo::Gesv::Unblocked algo_tag_type;
+  test_batched_gesv_mixed<TestExecSpace,Vector<SIMD<double>,4>,Vector<SIMD<float>,4>,algo_tag_type>();
+}
+TEST_F( TestCategory, batched_vector_serial_gesv_mixed_simd_double8_float8 ) {
+  typedef Algo::Gesv::Blocked algo_tag_type;
+  test_batched_gesv_mixed<TestExecSpace,Vector<SIMD<double>,8>,Vector<SIMD<float>,8>,algo_tag_type>();
+}
+#endif
+#endif
@@ -0,0 +1,147 @@
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+
+//#include "KokkosBatched_Vector.hpp"
+
+#include "KokkosBatched_LU_Decl.hpp"
+#include "KokkosBatched_LU_Serial_Impl.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+using namespace KokkosBatched::Experimental;
+
+namespace Test {
+
+  template<typename DeviceType,
+           typename ViewType,
+           int M>
+  struct Functor_TestBatchedSerialLUFixed {
+    ViewType _a;
+
+    KOKKOS_INLINE_FUNCTION
+    Functor_TestBatchedSerialLUFixed(const ViewType &a) 
+      : _a(a) {} 
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const int k) const {
+      auto aa = Kokkos::subview(_a, k, Kokkos::ALL(), Kokkos::ALL());
+
+      for (int i=0;i<M;++i)
+        aa(i,i) += 10.0;
+
+      SerialLUFixed<M>::invoke(aa);
+    }
+
+    inline
+    void run() {
+      Kokkos::RangePolicy<DeviceType> policy(0, _a.extent(0));
+      Kokkos::parallel_for(policy, *this);
+    }
+  };
+
+  template<typename DeviceType,
+           typename ViewType>
+  struct Functor_TestBatchedSerialLUUnblocked {
+    ViewType _a;
+
+    KOKKOS_INLINE_FUNCTION
+    Functor_TestBatchedSerialLUUnblocked(const ViewType &a) 
+      : _a(a) {} 
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const int k) const {
+      auto aa = Kokkos::subview(_a, k, Kokkos::ALL(), Kokkos::ALL());
+
+      for (int i=0;i<static_cast<int>(aa.extent(0));++i)
+        aa(i,i) += 10.0;
+
+      SerialLU<Algo::LU::Unblocked>::invoke(aa);
+    }
+
+    inline
+    void run() {
+      Kokkos::RangePolicy<DeviceType> policy(0, _a.extent(0));
+      Kokkos::parallel_for(policy, *this);
+    }
+  };
+
+  template<typename DeviceType,
+           typename ViewType,
+           int M>
+  void impl_test_batched_lu_fixed(const int N) {
+    typedef typename ViewType::value_type value_type;
+    typedef Kokkos::Details::ArithTraits<value_type> ats;
+
+    /// randomized input testing views
+    ViewType
+      a0("a0", N, M, M), a1("a1", N, M, M);
+
+    Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> random(13718);
+    Kokkos::fill_random(a0, random, value_type(1.0));
+
+    Kokkos::fence();
+
+    Kokkos::deep_copy(a1, a0);
+
+    Functor_TestBatchedSerialLUUnblocked<DeviceType,ViewType>(a0).run();
+    Functor_TestBatchedSerialLUFixed<DeviceType,ViewType,M>(a1).run();
+
+    Kokkos::fence();
+
+    /// for comparison send it to host
+    typename ViewType::HostMirror a0_host = Kokkos::create_mirror_view(a0);
+    typename ViewType::HostMirror a1_host = Kokkos::create_mirror_view(a1);
+
+    Kokkos::deep_copy(a0_host, a0);
+    Kokkos::deep_copy(a1_host, a1);
+
+    /// check a0 = a1 ; this eps is about 10^-14
+    typedef typename ats::mag_type mag_type;
+    mag_type sum(1), diff(0);
+    const mag_type eps = 1.0e3 * ats::epsilon();
+
+    for (int k=0;k<N;++k)
+      for (int i=0;i<M;++i)
+        for (int j=0;j<M;++j) {
+          sum  += ats::abs(a0_host(k,i,j));
+          diff += ats::abs(a0_host(k,i,j)-a1_host(k,i,j));
+        }
+    EXPECT_NEAR_KK( diff/sum, 0, eps);
+  }
+
+  template<typename DeviceType,
+           typename ViewType>
+  void impl_test_batched_lu_fixed_sizes(const int N) {
+    impl_test_batched_lu_fixed<DeviceType,ViewType,1>(N);
+    impl_test_batched_lu_fixed<DeviceType,ViewType,2>(N);
+    impl_test_batched_lu_fixed<DeviceType,ViewType,3>(N);
+    impl_test_batched_lu_fixed<DeviceType,ViewType,4>(N);
+    impl_test_batched_lu_fixed<DeviceType,ViewType,5>(N);
+    impl_test_batched_lu_fixed<DeviceType,ViewType,6>(N);
+    impl_test_batched_lu_fixed<DeviceType,ViewType,7>(N);
+    impl_test_batched_lu_fixed<DeviceType,ViewType,8>(N);
+  }
+}
+
+
+template<typename DeviceType,
+         typename ValueType>
+int test_batched_lu_fixed() {
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT)
+  {
+    typedef Kokkos::View<ValueType***,Kokkos::LayoutLeft,DeviceType> ViewType;
+    Test::impl_test_batched_lu_fixed_sizes<DeviceType,ViewType>(   0);
+    Test::impl_test_batched_lu_fixed_sizes<DeviceType,ViewType>(1024);
+  }
+#endif
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT)
+  {
+    typedef Kokkos::View<ValueType***,Kokkos::LayoutRight,DeviceType> ViewType;
+    Test::impl_test_batched_lu_fixed_sizes<DeviceType,ViewType>(   0);
+    Test::impl_test_batched_lu_fixed_sizes<DeviceType,ViewType>(1024);
+  }
+#endif
+
+  return 0;
+}
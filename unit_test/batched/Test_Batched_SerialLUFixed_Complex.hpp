@@ -0,0 +1,5 @@
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE)
+TEST_F( TestCategory, batched_scalar_serial_lu_fixed_dcomplex ) {
+  test_batched_lu_fixed<TestExecSpace,Kokkos::complex<double> >();
+}
+#endif
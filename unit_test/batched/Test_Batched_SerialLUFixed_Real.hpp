@@ -0,0 +1,12 @@
+#if defined(KOKKOSKERNELS_INST_FLOAT)
+TEST_F( TestCategory, batched_scalar_serial_lu_fixed_float ) {
+  test_batched_lu_fixed<TestExecSpace,float>();
+}
+#endif
+
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F( TestCategory, batched_scalar_serial_lu_fixed_double ) {
+  test_batched_lu_fixed<TestExecSpace,double>();
+}
+#endif
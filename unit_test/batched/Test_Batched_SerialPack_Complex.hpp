@@ -0,0 +1,10 @@
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE)
+#if !defined(KOKKOS_ENABLE_CUDA)
+TEST_F( TestCategory, batched_vector_serial_pack_nt_simd_dcomplex2 ) {
+  test_batched_pack<TestExecSpace,Vector<SIMD<Kokkos::complex<double> >,2>,Trans::NoTranspose>();
+}
+TEST_F( TestCategory, batched_vector_serial_pack_t_simd_dcomplex2 ) {
+  test_batched_pack<TestExecSpace,Vector<SIMD<Kokkos::complex<double> >,2>,Trans::Transpose>();
+}
+#endif
+#endif
@@ -0,0 +1,26 @@
+#if defined(KOKKOSKERNELS_INST_FLOAT)
+#if !defined(KOKKOS_ENABLE_CUDA)
+TEST_F( TestCategory, batched_vector_serial_pack_nt_simd_float8 ) {
+  test_batched_pack<TestExecSpace,Vector<SIMD<float>,8>,Trans::NoTranspose>();
+}
+TEST_F( TestCategory, batched_vector_serial_pack_t_simd_float8 ) {
+  test_batched_pack<TestExecSpace,Vector<SIMD<float>,8>,Trans::Transpose>();
+}
+#endif
+#endif
+
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+#if !defined(KOKKOS_ENABLE_CUDA)
+TEST_F( TestCategory, batched_vector_serial_pack_nt_simd_double4 ) {
+  test_batched_pack<TestExecSpace,Vector<SIMD<double>,4>,Trans::NoTranspose>();
+}
+TEST_F( TestCategory, batched_vector_serial_pack_t_simd_double4 ) {
+  test_batched_pack<TestExecSpace,Vector<SIMD<double>,4>,Trans::Transpose>();
+}
+TEST_F( TestCategory, batched_vector_serial_pack_nt_simd_double_default ) {
+  typedef PackTraits<double,TestExecSpace::memory_space>::vector_type vector_type;
+  test_batched_pack<TestExecSpace,vector_type,Trans::NoTranspose>();
+}
+#endif
+#endif
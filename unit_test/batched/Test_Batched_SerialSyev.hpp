@@ -0,0 +1,169 @@
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+
+#include "KokkosBatched_Vector.hpp"
+
+#include "KokkosBatched_Syev_Decl.hpp"
+#include "KokkosBatched_Syev_Serial_Impl.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+using namespace KokkosBatched::Experimental;
+
+namespace Test {
+
+  template<typename DeviceType,
+           typename AViewType,
+           typename wViewType,
+           typename AlgoTagType>
+  struct Functor_TestBatchedSerialSyev {
+    AViewType _a, _v;
+    wViewType _w;
+
+    KOKKOS_INLINE_FUNCTION
+    Functor_TestBatchedSerialSyev(const AViewType &a, const wViewType &w, const AViewType &v)
+      : _a(a), _v(v), _w(w) {}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const int k) const {
+      auto aa = Kokkos::subview(_a, k, Kokkos::ALL(), Kokkos::ALL());
+      auto ww = Kokkos::subview(_w, k, Kokkos::ALL());
+      auto vv = Kokkos::subview(_v, k, Kokkos::ALL(), Kokkos::ALL());
+
+      SerialSyev<AlgoTagType>::invoke(aa, ww, vv);
+    }
+
+    inline
+    void run() {
+      Kokkos::RangePolicy<DeviceType> policy(0, _a.extent(0));
+      Kokkos::parallel_for(policy, *this);
+    }
+  };
+
+  template<typename DeviceType,
+           typename AViewType,
+           typename wViewType,
+           typename AlgoTagType>
+  void impl_test_batched_syev(const int N, const int BlkSize, const bool is_rank_one) {
+    typedef typename AViewType::value_type value_type;
+    typedef PivotTraits<value_type> traits;
+    typedef typename traits::value_type scalar_type;
+    typedef Kokkos::Details::ArithTraits<scalar_type> ats;
+    enum : int { vl = traits::vector_length };
+
+    /// randomized symmetric input
+    AViewType
+      a0("a0", N, BlkSize, BlkSize), a1("a1", N, BlkSize, BlkSize), v1("v1", N, BlkSize, BlkSize);
+    wViewType
+      w1("w1", N, BlkSize);
+
+    Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> random(13718);
+    Kokkos::fill_random(a0, random, value_type(1.0));
+
+    Kokkos::fence();
+
+    typename AViewType::HostMirror a0_host = Kokkos::create_mirror_view(a0);
+    Kokkos::deep_copy(a0_host, a0);
+
+    /// A = (A + A^T)/2, or A = u u^T with u the first column of the random
+    /// matrix, which has BlkSize-1 zero eigenvalues and one equal to u^T u
+    std::vector<scalar_type> u(BlkSize), utu(N*vl, scalar_type(0));
+    for (int k=0;k<N;++k)
+      for (int v=0;v<vl;++v) {
+        if (is_rank_one) {
+          for (int i=0;i<BlkSize;++i) {
+            u[i] = traits::value(a0_host(k,i,0), v);
+            utu[k*vl+v] += u[i]*u[i];
+          }
+          for (int i=0;i<BlkSize;++i)
+            for (int j=0;j<BlkSize;++j)
+              traits::value(a0_host(k,i,j), v) = u[i]*u[j];
+        } else {
+          for (int i=0;i<BlkSize;++i)
+            for (int j=0;j<i;++j) {
+              scalar_type
+                &aij = traits::value(a0_host(k,i,j), v),
+                &aji = traits::value(a0_host(k,j,i), v);
+              aij = aji = (aij + aji)/2;
+            }
+        }
+      }
+    Kokkos::deep_copy(a0, a0_host);
+    Kokkos::deep_copy(a1, a0);
+
+    Functor_TestBatchedSerialSyev<DeviceType,AViewType,wViewType,AlgoTagType>(a1, w1, v1).run();
+
+    Kokkos::fence();
+
+    /// for comparison send it to host
+    typename AViewType::HostMirror v1_host = Kokkos::create_mirror_view(v1);
+    typename wViewType::HostMirror w1_host = Kokkos::create_mirror_view(w1);
+
+    Kokkos::deep_copy(v1_host, v1);
+    Kokkos::deep_copy(w1_host, w1);
+
+    /// check A V = V diag(w), V^T V = I and w ascending
+    typedef typename ats::mag_type mag_type;
+    mag_type sum(1), diff(0), orth(0);
+    const mag_type eps = 1.0e3 * ats::epsilon();
+
+    for (int k=0;k<N;++k)
+      for (int v=0;v<vl;++v)
+        for (int i=0;i<BlkSize;++i) {
+          if (i > 0) EXPECT_TRUE( traits::value(w1_host(k,i-1), v) <= traits::value(w1_host(k,i), v) );
+          for (int j=0;j<BlkSize;++j) {
+            scalar_type av(0), vv(0);
+            for (int p=0;p<BlkSize;++p) {
+              av += traits::value(a0_host(k,i,p), v)*traits::value(v1_host(k,p,j), v);
+              vv += traits::value(v1_host(k,p,i), v)*traits::value(v1_host(k,p,j), v);
+            }
+            sum  += ats::abs(traits::value(a0_host(k,i,j), v));
+            diff += ats::abs(av - traits::value(v1_host(k,i,j), v)*traits::value(w1_host(k,j), v));
+            orth += ats::abs(vv - scalar_type(i == j ? 1 : 0));
+          }
+        }
+    EXPECT_NEAR_KK( diff/sum, 0, eps);
+    EXPECT_NEAR_KK( orth/(N*BlkSize*BlkSize*vl+1), 0, eps);
+
+    /// all but the largest eigenvalue of u u^T vanish
+    if (is_rank_one)
+      for (int k=0;k<N;++k)
+        for (int v=0;v<vl;++v)
+          for (int i=0;i<BlkSize-1;++i)
+            EXPECT_NEAR_KK( traits::value(w1_host(k,i), v)/(utu[k*vl+v] + 1), 0, eps);
+  }
+}
+
+
+template<typename DeviceType,
+         typename ValueType,
+         typename AlgoTagType>
+int test_batched_syev() {
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT)
+  {
+    typedef Kokkos::View<ValueType***,Kokkos::LayoutLeft,DeviceType> AViewType;
+    typedef Kokkos::View<ValueType**, Kokkos::LayoutLeft,DeviceType> wViewType;
+    Test::impl_test_batched_syev<DeviceType,AViewType,wViewType,AlgoTagType>(   0, 10, false);
+    for (int i=0;i<10;++i) {
+      //printf("Testing: LayoutLeft,  Blksize %d\n", i);
+      Test::impl_test_batched_syev<DeviceType,AViewType,wViewType,AlgoTagType>(1024,  i, false);
+      Test::impl_test_batched_syev<DeviceType,AViewType,wViewType,AlgoTagType>(1024,  i, true);
+    }
+  }
+#endif
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT)
+  {
+    typedef Kokkos::View<ValueType***,Kokkos::LayoutRight,DeviceType> AViewType;
+    typedef Kokkos::View<ValueType**, Kokkos::LayoutRight,DeviceType> wViewType;
+    Test::impl_test_batched_syev<DeviceType,AViewType,wViewType,AlgoTagType>(   0, 10, false);
+    for (int i=0;i<10;++i) {
+      //printf("Testing: LayoutRight, Blksize %d\n", i);
+      Test::impl_test_batched_syev<DeviceType,AViewType,wViewType,AlgoTagType>(1024,  i, false);
+      Test::impl_test_batched_syev<DeviceType,AViewType,wViewType,AlgoTagType>(1024,  i, true);
+    }
+  }
+#endif
+
+  return 0;
+}
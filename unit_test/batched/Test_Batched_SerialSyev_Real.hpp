@@ -0,0 +1,42 @@
+#if defined(KOKKOSKERNELS_INST_FLOAT)
+TEST_F( TestCategory, batched_scalar_serial_syev_jacobi_float ) {
+  typedef Algo::Syev::Jacobi algo_tag_type;
+  test_batched_syev<TestExecSpace,float,algo_tag_type>();
+}
+TEST_F( TestCategory, batched_scalar_serial_syev_closed_form_float ) {
+  typedef Algo::Syev::ClosedForm algo_tag_type;
+  test_batched_syev<TestExecSpace,float,algo_tag_type>();
+}
+#if !defined(KOKKOS_ENABLE_CUDA)
+TEST_F( TestCategory, batched_vector_serial_syev_jacobi_simd_float8 ) {
+  typedef Algo::Syev::Jacobi algo_tag_type;
+  test_batched_syev<TestExecSpace,Vector<SIMD<float>,8>,algo_tag_type>();
+}
+TEST_F( TestCategory, batched_vector_serial_syev_closed_form_simd_float8 ) {
+  typedef Algo::Syev::ClosedForm algo_tag_type;
+  test_batched_syev<TestExecSpace,Vector<SIMD<float>,8>,algo_tag_type>();
+}
+#endif
+#endif
+
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F( TestCategory, batched_scalar_serial_syev_jacobi_double ) {
+  typedef Algo::Syev::Jacobi algo_tag_type;
+  test_batched_syev<TestExecSpace,double,algo_tag_type>();
+}
+TEST_F( TestCategory, batched_scalar_serial_syev_closed_form_double ) {
+  typedef Algo::Syev::ClosedForm algo_tag_type;
+  test_batched_syev<TestExecSpace,double,algo_tag_type>();
+}
+#if !defined(KOKKOS_ENABLE_CUDA)
+TEST_F( TestCategory, batched_vector_serial_syev_jacobi_simd_double4 ) {
+  typedef Algo::Syev::Jacobi algo_tag_type;
+  test_batched_syev<TestExecSpace,Vector<SIMD<double>,4>,algo_tag_type>();
+}
+TEST_F( TestCategory, batched_vector_serial_syev_closed_form_simd_double4 ) {
+  typedef Algo::Syev::ClosedForm algo_tag_type;
+  test_batched_syev<TestExecSpace,Vector<SIMD<double>,4>,algo_tag_type>();
+}
+#endif
+#endif
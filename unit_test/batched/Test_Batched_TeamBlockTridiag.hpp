@@ -0,0 +1,244 @@
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+
+#include "KokkosBatched_Vector.hpp"
+
+#include "KokkosBatched_BlockTridiag_Decl.hpp"
+#include "KokkosBatched_BlockTridiag_Serial_Impl.hpp"
+#include "KokkosBatched_BlockTridiag_Team_Impl.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+using namespace KokkosBatched::Experimental;
+
+namespace Test {
+
+  template<typename DeviceType,
+           typename OrdinalViewType,
+           typename ValuesViewType,
+           typename LineViewType,
+           typename AViewType,
+           typename XViewType,
+           typename AlgoTagType>
+  struct Functor_TestBatchedTeamBlockTridiag {
+    OrdinalViewType _rowptr, _colidx;
+    ValuesViewType _values;
+    LineViewType _line;
+    AViewType _a, _b, _c;
+    XViewType _x;
+
+    KOKKOS_INLINE_FUNCTION
+    Functor_TestBatchedTeamBlockTridiag(const OrdinalViewType &rowptr, const OrdinalViewType &colidx,
+                                        const ValuesViewType &values, const LineViewType &line,
+                                        const AViewType &a, const AViewType &b, const AViewType &c,
+                                        const XViewType &x)
+      : _rowptr(rowptr), _colidx(colidx), _values(values), _line(line),
+        _a(a), _b(b), _c(c), _x(x) {}
+
+    template<typename MemberType>
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const MemberType &member) const {
+      const int k = member.league_rank();
+      typedef PivotTraits<typename AViewType::non_const_value_type> traits;
+
+      auto aa = Kokkos::subview(_a, k, Kokkos::ALL(), Kokkos::ALL(), Kokkos::ALL());
+      auto bb = Kokkos::subview(_b, k, Kokkos::ALL(), Kokkos::ALL(), Kokkos::ALL());
+      auto cc = Kokkos::subview(_c, k, Kokkos::ALL(), Kokkos::ALL(), Kokkos::ALL());
+      auto xx = Kokkos::subview(_x, k, Kokkos::ALL(), Kokkos::ALL(), Kokkos::ALL());
+
+      for (int v=0;v<traits::vector_length;++v) {
+        auto ll = Kokkos::subview(_line, k*traits::vector_length+v, Kokkos::ALL());
+        TeamExtractBlockTridiag<MemberType>::invoke(member, _rowptr, _colidx, _values, ll, v, aa, bb, cc);
+      }
+      member.team_barrier();
+      TeamBlockTridiagFactorize<MemberType,AlgoTagType>::invoke(member, aa, bb, cc);
+      member.team_barrier();
+      TeamBlockTridiagSolve<MemberType,AlgoTagType>::invoke(member, aa, bb, cc, xx);
+    }
+
+    inline
+    void run() {
+      const int league_size = _a.extent(0);
+      Kokkos::TeamPolicy<DeviceType> policy(league_size, Kokkos::AUTO);
+      Kokkos::parallel_for(policy, *this);
+    }
+  };
+
+  template<typename DeviceType,
+           typename ViewType,
+           typename AlgoTagType>
+  void impl_test_batched_block_tridiag(const int N, const int BlkSize) {
+    typedef typename ViewType::value_type value_type;
+    typedef PivotTraits<value_type> traits;
+    typedef typename traits::value_type scalar_type;
+    typedef Kokkos::Details::ArithTraits<scalar_type> ats;
+    enum : int { vl = traits::vector_length };
+
+    typedef Kokkos::View<int*,Kokkos::LayoutRight,DeviceType> OrdinalViewType;
+    typedef Kokkos::View<int**,Kokkos::LayoutRight,DeviceType> LineViewType;
+    typedef Kokkos::View<scalar_type***,Kokkos::LayoutRight,DeviceType> ValuesViewType;
+    typedef Kokkos::View<scalar_type****,Kokkos::LayoutRight,DeviceType> ScalarViewType;
+
+    /// nt = N*vl independent block tridiagonal systems with m block rows and
+    /// nrhs right hand sides; system t lives in lane t%vl of pack t/vl
+    const int nt = N*vl, m = 5, nrhs = 3;
+
+    ScalarViewType a0("a0", nt, m,   BlkSize, BlkSize);
+    ScalarViewType b0("b0", nt, m-1, BlkSize, BlkSize);
+    ScalarViewType c0("c0", nt, m-1, BlkSize, BlkSize);
+    ScalarViewType x0("x0", nt, m,   BlkSize, nrhs);
+
+    Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> random(13718);
+    Kokkos::fill_random(a0, random, scalar_type(1.0));
+    Kokkos::fill_random(b0, random, scalar_type(1.0));
+    Kokkos::fill_random(c0, random, scalar_type(1.0));
+    Kokkos::fill_random(x0, random, scalar_type(1.0));
+
+    Kokkos::fence();
+
+    typename ScalarViewType::HostMirror a0_host = Kokkos::create_mirror_view(a0);
+    typename ScalarViewType::HostMirror b0_host = Kokkos::create_mirror_view(b0);
+    typename ScalarViewType::HostMirror c0_host = Kokkos::create_mirror_view(c0);
+    typename ScalarViewType::HostMirror x0_host = Kokkos::create_mirror_view(x0);
+
+    Kokkos::deep_copy(a0_host, a0);
+    Kokkos::deep_copy(b0_host, b0);
+    Kokkos::deep_copy(c0_host, c0);
+    Kokkos::deep_copy(x0_host, x0);
+
+    /// block diagonal dominance so that the factorization does not need pivoting
+    for (int t=0;t<nt;++t)
+      for (int k=0;k<m;++k)
+        for (int i=0;i<BlkSize;++i)
+          a0_host(t,k,i,i) += scalar_type(4*BlkSize);
+
+    /// block crs matrix holding all systems; the rows of line t are numbered
+    /// in reverse order and couple to the next line, which must be dropped
+    const int nrows = nt*m;
+    std::vector<int> rowptr(nrows+1, 0), colidx;
+    std::vector<int> blkidx; // 0: a, 1: b, 2: c, 3: off line
+    for (int row=0;row<nrows;++row) {
+      const int t = row/m, k = m-1-row%m;
+      if (k+1 < m)  { colidx.push_back(row-1); blkidx.push_back(1); }
+      /**/          { colidx.push_back(row);   blkidx.push_back(0); }
+      if (k > 0)    { colidx.push_back(row+1); blkidx.push_back(2); }
+      if (t+1 < nt) { colidx.push_back(row+m); blkidx.push_back(3); }
+      rowptr[row+1] = colidx.size();
+    }
+
+    const int nnz = colidx.size();
+    OrdinalViewType rowptr1("rowptr1", nrows+1), colidx1("colidx1", nnz);
+    ValuesViewType values1("values1", nnz, BlkSize, BlkSize);
+    LineViewType line1("line1", nt, m);
+
+    typename OrdinalViewType::HostMirror rowptr1_host = Kokkos::create_mirror_view(rowptr1);
+    typename OrdinalViewType::HostMirror colidx1_host = Kokkos::create_mirror_view(colidx1);
+    typename ValuesViewType::HostMirror values1_host = Kokkos::create_mirror_view(values1);
+    typename LineViewType::HostMirror line1_host = Kokkos::create_mirror_view(line1);
+
+    for (int row=0;row<=nrows;++row)
+      rowptr1_host(row) = rowptr[row];
+    for (int t=0;t<nt;++t)
+      for (int k=0;k<m;++k) {
+        const int row = t*m + (m-1-k);
+        line1_host(t,k) = row;
+        for (int c=rowptr[row];c<rowptr[row+1];++c) {
+          colidx1_host(c) = colidx[c];
+          for (int i=0;i<BlkSize;++i)
+            for (int j=0;j<BlkSize;++j)
+              switch (blkidx[c]) {
+              case 0: values1_host(c,i,j) = a0_host(t,k,  i,j); break;
+              case 1: values1_host(c,i,j) = b0_host(t,k,  i,j); break;
+              case 2: values1_host(c,i,j) = c0_host(t,k-1,i,j); break;
+              case 3: values1_host(c,i,j) = scalar_type(1.0);   break;
+              }
+        }
+      }
+
+    Kokkos::deep_copy(rowptr1, rowptr1_host);
+    Kokkos::deep_copy(colidx1, colidx1_host);
+    Kokkos::deep_copy(values1, values1_host);
+    Kokkos::deep_copy(line1, line1_host);
+
+    /// right hand sides b = T x0
+    ViewType a1("a1", N, m,   BlkSize, BlkSize);
+    ViewType b1("b1", N, m-1, BlkSize, BlkSize);
+    ViewType c1("c1", N, m-1, BlkSize, BlkSize);
+    ViewType x1("x1", N, m,   BlkSize, nrhs);
+
+    typename ViewType::HostMirror x1_host = Kokkos::create_mirror_view(x1);
+
+    for (int t=0;t<nt;++t)
+      for (int k=0;k<m;++k)
+        for (int i=0;i<BlkSize;++i)
+          for (int r=0;r<nrhs;++r) {
+            scalar_type bval(0);
+            for (int j=0;j<BlkSize;++j) {
+              /**/       bval += a0_host(t,k,  i,j)*x0_host(t,k,  j,r);
+              if (k+1<m) bval += b0_host(t,k,  i,j)*x0_host(t,k+1,j,r);
+              if (k>0)   bval += c0_host(t,k-1,i,j)*x0_host(t,k-1,j,r);
+            }
+            traits::value(x1_host(t/vl,k,i,r),t%vl) = bval;
+          }
+
+    Kokkos::deep_copy(x1, x1_host);
+
+    Functor_TestBatchedTeamBlockTridiag<DeviceType,
+      OrdinalViewType,ValuesViewType,LineViewType,ViewType,ViewType,
+      AlgoTagType>(rowptr1, colidx1, values1, line1, a1, b1, c1, x1).run();
+
+    Kokkos::fence();
+
+    /// check the residual b - T x against the original T; this eps is about 10^-13
+    Kokkos::deep_copy(x1_host, x1);
+
+    typedef typename ats::mag_type mag_type;
+    mag_type sum(1), diff(0);
+    const mag_type eps = 1.0e3 * ats::epsilon();
+
+    for (int t=0;t<nt;++t)
+      for (int k=0;k<m;++k)
+        for (int i=0;i<BlkSize;++i)
+          for (int r=0;r<nrhs;++r) {
+            scalar_type res(0);
+            for (int j=0;j<BlkSize;++j) {
+              res += a0_host(t,k,i,j)*(x0_host(t,k,j,r) - traits::value(x1_host(t/vl,k,j,r),t%vl));
+              sum += ats::abs(a0_host(t,k,i,j))*ats::abs(x0_host(t,k,j,r));
+              if (k+1<m) res += b0_host(t,k,  i,j)*(x0_host(t,k+1,j,r) - traits::value(x1_host(t/vl,k+1,j,r),t%vl));
+              if (k>0)   res += c0_host(t,k-1,i,j)*(x0_host(t,k-1,j,r) - traits::value(x1_host(t/vl,k-1,j,r),t%vl));
+            }
+            diff += ats::abs(res);
+          }
+    EXPECT_NEAR_KK( diff/sum, 0, eps);
+  }
+}
+
+
+template<typename DeviceType,
+         typename ValueType,
+         typename AlgoTagType>
+int test_batched_block_tridiag() {
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT)
+  {
+    typedef Kokkos::View<ValueType****,Kokkos::LayoutLeft,DeviceType> ViewType;
+    Test::impl_test_batched_block_tridiag<DeviceType,ViewType,AlgoTagType>(     0, 10);
+    for (int i=0;i<10;++i) {
+      //printf("Testing: LayoutLeft,  Blksize %d\n", i);
+      Test::impl_test_batched_block_tridiag<DeviceType,ViewType,AlgoTagType>(1024,  i);
+    }
+  }
+#endif
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT)
+  {
+    typedef Kokkos::View<ValueType****,Kokkos::LayoutRight,DeviceType> ViewType;
+    Test::impl_test_batched_block_tridiag<DeviceType,ViewType,AlgoTagType>(     0, 10);
+    for (int i=0;i<10;++i) {
+      //printf("Testing: LayoutRight, Blksize %d\n", i);
+      Test::impl_test_batched_block_tridiag<DeviceType,ViewType,AlgoTagType>(1024,  i);
+    }
+  }
+#endif
+
+  return 0;
+}
@@ -0,0 +1,6 @@
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE)
+TEST_F( TestCategory, batched_scalar_team_block_tridiag_dcomplex ) {
+  typedef Algo::BlockTridiag::Unblocked algo_tag_type;
+  test_batched_block_tridiag<TestExecSpace,Kokkos::complex<double>,algo_tag_type>();
+}
+#endif
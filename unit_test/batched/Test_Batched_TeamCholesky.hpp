@@ -0,0 +1,164 @@
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+
+#include "KokkosBatched_Vector.hpp"
+
+#include "KokkosBatched_Cholesky_Decl.hpp"
+#include "KokkosBatched_Cholesky_Serial_Impl.hpp"
+#include "KokkosBatched_Cholesky_Team_Impl.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+using namespace KokkosBatched::Experimental;
+
+namespace Test {
+
+  template<typename DeviceType,
+           typename AViewType,
+           typename bViewType,
+           typename AlgoTagType>
+  struct Functor_TestBatchedTeamCholesky {
+    AViewType _a;
+    bViewType _b;
+
+    KOKKOS_INLINE_FUNCTION
+    Functor_TestBatchedTeamCholesky(const AViewType &a, const bViewType &b) 
+      : _a(a), _b(b) {} 
+
+    template<typename MemberType>
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const MemberType &member) const {
+      const int k = member.league_rank();
+      auto aa = Kokkos::subview(_a, k, Kokkos::ALL(), Kokkos::ALL());
+      auto bb = Kokkos::subview(_b, k, Kokkos::ALL());
+
+      TeamCholesky<MemberType,AlgoTagType>::invoke(member, aa);
+      member.team_barrier();
+      TeamCholeskySolve<MemberType,AlgoTagType>::invoke(member, aa, bb);
+    }
+
+    inline
+    void run() {
+      const int league_size = _a.extent(0);
+      Kokkos::TeamPolicy<DeviceType> policy(league_size, Kokkos::AUTO);
+      Kokkos::parallel_for(policy, *this);
+    }
+  };
+
+  template<typename DeviceType,
+           typename ViewType,
+           typename AlgoTagType>
+  void impl_test_batched_cholesky(const int N, const int BlkSize) {
+    typedef typename ViewType::value_type value_type;
+    typedef PivotTraits<value_type> traits;
+    typedef typename traits::value_type scalar_type;
+    typedef Kokkos::Details::ArithTraits<scalar_type> ats;
+    enum : int { vl = traits::vector_length };
+
+    typedef Kokkos::View<value_type**,typename ViewType::array_layout,DeviceType> bViewType;
+    typedef Kokkos::View<scalar_type****,Kokkos::LayoutRight,DeviceType> ScalarViewType;
+    typedef Kokkos::View<scalar_type***,Kokkos::LayoutRight,DeviceType> ScalarVectorViewType;
+
+    /// randomized input; each SIMD lane is an independent problem
+    ScalarViewType r0("r0", N, BlkSize, BlkSize, vl);
+    ScalarVectorViewType x0("x0", N, BlkSize, vl);
+
+    Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> random(13718);
+    Kokkos::fill_random(r0, random, scalar_type(1.0));
+    Kokkos::fill_random(x0, random, scalar_type(1.0));
+
+    Kokkos::fence();
+
+    typename ScalarViewType::HostMirror r0_host = Kokkos::create_mirror_view(r0);
+    typename ScalarVectorViewType::HostMirror x0_host = Kokkos::create_mirror_view(x0);
+
+    Kokkos::deep_copy(r0_host, r0);
+    Kokkos::deep_copy(x0_host, x0);
+
+    /// s0 = r0 r0^H + BlkSize I is Hermitian positive definite
+    typename ScalarViewType::HostMirror s0_host("s0_host", N, BlkSize, BlkSize, vl);
+    for (int k=0;k<N;++k)
+      for (int i=0;i<BlkSize;++i)
+        for (int j=0;j<BlkSize;++j)
+          for (int v=0;v<vl;++v) {
+            scalar_type sval(i == j ? BlkSize : 0);
+            for (int l=0;l<BlkSize;++l)
+              sval += r0_host(k,i,l,v)*ats::conj(r0_host(k,j,l,v));
+            s0_host(k,i,j,v) = sval;
+          }
+
+    ViewType a1("a1", N, BlkSize, BlkSize);
+    bViewType b1("b1", N, BlkSize);
+
+    typename ViewType::HostMirror a1_host = Kokkos::create_mirror_view(a1);
+    typename bViewType::HostMirror b1_host = Kokkos::create_mirror_view(b1);
+
+    for (int k=0;k<N;++k)
+      for (int i=0;i<BlkSize;++i)
+        for (int v=0;v<vl;++v) {
+          scalar_type bval(0);
+          for (int j=0;j<BlkSize;++j) {
+            traits::value(a1_host(k,i,j),v) = s0_host(k,i,j,v);
+            bval += s0_host(k,i,j,v)*x0_host(k,j,v);
+          }
+          traits::value(b1_host(k,i),v) = bval;
+        }
+
+    Kokkos::deep_copy(a1, a1_host);
+    Kokkos::deep_copy(b1, b1_host);
+
+    Functor_TestBatchedTeamCholesky<DeviceType,ViewType,bViewType,AlgoTagType>(a1, b1).run();
+
+    Kokkos::fence();
+
+    /// check the residual b - S x; this eps is about 10^-13
+    Kokkos::deep_copy(b1_host, b1);
+
+    typedef typename ats::mag_type mag_type;
+    mag_type sum(1), diff(0);
+    const mag_type eps = 1.0e3 * ats::epsilon();
+
+    for (int k=0;k<N;++k)
+      for (int i=0;i<BlkSize;++i)
+        for (int v=0;v<vl;++v) {
+          scalar_type r(0);
+          for (int j=0;j<BlkSize;++j) {
+            const scalar_type sij = s0_host(k,i,j,v);
+            r    += sij*(x0_host(k,j,v) - traits::value(b1_host(k,j),v));
+            sum  += ats::abs(sij)*ats::abs(x0_host(k,j,v));
+          }
+          diff += ats::abs(r);
+        }
+    EXPECT_NEAR_KK( diff/sum, 0, eps);
+  }
+}
+
+
+template<typename DeviceType,
+         typename ValueType,
+         typename AlgoTagType>
+int test_batched_cholesky() {
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT)
+  {
+    typedef Kokkos::View<ValueType***,Kokkos::LayoutLeft,DeviceType> ViewType;
+    Test::impl_test_batched_cholesky<DeviceType,ViewType,AlgoTagType>(     0, 10);
+    for (int i=0;i<10;++i) {                                                                                        
+      //printf("Testing: LayoutLeft,  Blksize %d\n", i); 
+      Test::impl_test_batched_cholesky<DeviceType,ViewType,AlgoTagType>(1024,  i);
+    }
+  }
+#endif
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT)
+  {
+    typedef Kokkos::View<ValueType***,Kokkos::LayoutRight,DeviceType> ViewType;
+    Test::impl_test_batched_cholesky<DeviceType,ViewType,AlgoTagType>(     0, 10);
+    for (int i=0;i<10;++i) {                                                                                        
+      //printf("Testing: LayoutRight, Blksize %d\n", i); 
+      Test::impl_test_batched_cholesky<DeviceType,ViewType,AlgoTagType>(1024,  i);
+    }
+  }
+#endif
+
+  return 0;
+}
@@ -0,0 +1,163 @@
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+
+#include "KokkosBatched_Vector.hpp"
+
+#include "KokkosBatched_Gesv_Decl.hpp"
+#include "KokkosBatched_Gesv_Serial_Impl.hpp"
+#include "KokkosBatched_Gesv_Team_Impl.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+using namespace KokkosBatched::Experimental;
+
+namespace Test {
+
+  template<typename DeviceType,
+           typename AViewType,
+           typename PivViewType,
+           typename bViewType,
+           typename AlgoTagType>
+  struct Functor_TestBatchedTeamGesv {
+    AViewType _a;
+    PivViewType _p;
+    bViewType _b;
+
+    KOKKOS_INLINE_FUNCTION
+    Functor_TestBatchedTeamGesv(const AViewType &a, const PivViewType &p, const bViewType &b) 
+      : _a(a), _p(p), _b(b) {} 
+
+    template<typename MemberType>
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const MemberType &member) const {
+      const int k = member.league_rank();
+      auto aa = Kokkos::subview(_a, k, Kokkos::ALL(), Kokkos::ALL());
+      auto pp = Kokkos::subview(_p, k, Kokkos::ALL());
+      auto bb = Kokkos::subview(_b, k, Kokkos::ALL());
+
+      TeamGesv<MemberType,AlgoTagType>::invoke(member, aa, pp, bb);
+    }
+
+    inline
+    void run() {
+      const int league_size = _a.extent(0);
+      Kokkos::TeamPolicy<DeviceType> policy(league_size, Kokkos::AUTO);
+      Kokkos::parallel_for(policy, *this);
+    }
+  };
+
+  template<typename DeviceType,
+           typename ViewType,
+           typename AlgoTagType>
+  void impl_test_batched_gesv(const int N, const int BlkSize) {
+    typedef typename ViewType::value_type value_type;
+    typedef PivotTraits<value_type> traits;
+    typedef typename traits::value_type scalar_type;
+    typedef typename traits::pivot_type pivot_type;
+    typedef Kokkos::Details::ArithTraits<scalar_type> ats;
+    enum : int { vl = traits::vector_length };
+
+    typedef Kokkos::View<value_type**,typename ViewType::array_layout,DeviceType> bViewType;
+    typedef Kokkos::View<pivot_type**,typename ViewType::array_layout,DeviceType> PivViewType;
+    typedef Kokkos::View<scalar_type****,Kokkos::LayoutRight,DeviceType> ScalarViewType;
+    typedef Kokkos::View<scalar_type***,Kokkos::LayoutRight,DeviceType> ScalarVectorViewType;
+
+    /// randomized input with a zero diagonal so that the solve must pivot;
+    /// each SIMD lane is an independent problem
+    ScalarViewType a0("a0", N, BlkSize, BlkSize, vl);
+    ScalarVectorViewType x0("x0", N, BlkSize, vl);
+
+    Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> random(13718);
+    Kokkos::fill_random(a0, random, scalar_type(1.0));
+    Kokkos::fill_random(x0, random, scalar_type(1.0));
+
+    Kokkos::fence();
+
+    typename ScalarViewType::HostMirror a0_host = Kokkos::create_mirror_view(a0);
+    typename ScalarVectorViewType::HostMirror x0_host = Kokkos::create_mirror_view(x0);
+
+    Kokkos::deep_copy(a0_host, a0);
+    Kokkos::deep_copy(x0_host, x0);
+
+    if (BlkSize > 1)
+      for (int k=0;k<N;++k)
+        for (int i=0;i<BlkSize;++i)
+          for (int v=0;v<vl;++v)
+            a0_host(k,i,i,v) = 0;
+
+    ViewType a1("a1", N, BlkSize, BlkSize);
+    bViewType b1("b1", N, BlkSize);
+    PivViewType p1("p1", N, BlkSize);
+
+    typename ViewType::HostMirror a1_host = Kokkos::create_mirror_view(a1);
+    typename bViewType::HostMirror b1_host = Kokkos::create_mirror_view(b1);
+
+    for (int k=0;k<N;++k)
+      for (int i=0;i<BlkSize;++i)
+        for (int v=0;v<vl;++v) {
+          scalar_type bval(0);
+          for (int j=0;j<BlkSize;++j) {
+            traits::value(a1_host(k,i,j),v) = a0_host(k,i,j,v);
+            bval += a0_host(k,i,j,v)*x0_host(k,j,v);
+          }
+          traits::value(b1_host(k,i),v) = bval;
+        }
+
+    Kokkos::deep_copy(a1, a1_host);
+    Kokkos::deep_copy(b1, b1_host);
+
+    Functor_TestBatchedTeamGesv<DeviceType,ViewType,PivViewType,bViewType,AlgoTagType>(a1, p1, b1).run();
+
+    Kokkos::fence();
+
+    /// check the residual b - A x against the original A; this eps is about 10^-13
+    Kokkos::deep_copy(b1_host, b1);
+
+    typedef typename ats::mag_type mag_type;
+    mag_type sum(1), diff(0);
+    const mag_type eps = 1.0e3 * ats::epsilon();
+
+    for (int k=0;k<N;++k)
+      for (int i=0;i<BlkSize;++i)
+        for (int v=0;v<vl;++v) {
+          scalar_type r(0);
+          for (int j=0;j<BlkSize;++j) {
+            const scalar_type aij = a0_host(k,i,j,v);
+            r    += aij*(x0_host(k,j,v) - traits::value(b1_host(k,j),v));
+            sum  += ats::abs(aij)*ats::abs(x0_host(k,j,v));
+          }
+          diff += ats::abs(r);
+        }
+    EXPECT_NEAR_KK( diff/sum, 0, eps);
+  }
+}
+
+
+template<typename DeviceType,
+         typename ValueType,
+         typename AlgoTagType>
+int test_batched_gesv() {
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT)
+  {
+    typedef Kokkos::View<ValueType***,Kokkos::LayoutLeft,DeviceType> ViewType;
+    Test::impl_test_batched_gesv<DeviceType,ViewType,AlgoTagType>(     0, 10);
+    for (int i=0;i<10;++i) {                                                                                        
+      //printf("Testing: LayoutLeft,  Blksize %d\n", i); 
+      Test::impl_test_batched_gesv<DeviceType,ViewType,AlgoTagType>(1024,  i);
+    }
+  }
+#endif
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT)
+  {
+    typedef Kokkos::View<ValueType***,Kokkos::LayoutRight,DeviceType> ViewType;
+    Test::impl_test_batched_gesv<DeviceType,ViewType,AlgoTagType>(     0, 10);
+    for (int i=0;i<10;++i) {                                                                                        
+      //printf("Testing: LayoutRight, Blksize %d\n", i); 
+      Test::impl_test_batched_gesv<DeviceType,ViewType,AlgoTagType>(1024,  i);
+    }
+  }
+#endif
+
+  return 0;
+}
@@ -0,0 +1,6 @@
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE)
+TEST_F( TestCategory, batched_scalar_team_gesv_dcomplex ) {
+  typedef Algo::Gesv::Unblocked algo_tag_type;
+  test_batched_gesv<TestExecSpace,Kokkos::complex<double>,algo_tag_type>();
+}
+#endif
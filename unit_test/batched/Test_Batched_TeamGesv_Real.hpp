@@ -0,0 +1,20 @@
+#if defined(KOKKOSKERNELS_INST_FLOAT)
+TEST_F( TestCategory, batched_scalar_team_gesv_float ) {
+  typedef Algo::Gesv::Unblocked algo_tag_type;
+  test_batched_gesv<TestExecSpace,float,algo_tag_type>();
+}
+#endif
+
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F( TestCategory, batched_scalar_team_gesv_double ) {
+  typedef Algo::Gesv::Unblocked algo_tag_type;
+  test_batched_gesv<TestExecSpace,double,algo_tag_type>();
+}
+#if !defined(KOKKOS_ENABLE_CUDA)
+TEST_F( TestCategory, batched_vector_team_gesv_simd_double4 ) {
+  typedef Algo::Gesv::Unblocked algo_tag_type;
+  test_batched_gesv<TestExecSpace,Vector<SIMD<double>,4>,algo_tag_type>();
+}
+#endif
+#endif
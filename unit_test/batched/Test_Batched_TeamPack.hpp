@@ -0,0 +1,132 @@
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+
+#include "KokkosBatched_Vector.hpp"
+
+#include "KokkosBatched_Pack_Decl.hpp"
+#include "KokkosBatched_Pack_Impl.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+using namespace KokkosBatched::Experimental;
+
+namespace Test {
+
+  template<typename DeviceType,
+           typename AViewType,
+           typename CViewType,
+           typename ArgTrans>
+  struct Functor_TestBatchedTeamPack {
+    AViewType _a, _b;
+    CViewType _c;
+
+    KOKKOS_INLINE_FUNCTION
+    Functor_TestBatchedTeamPack(const AViewType &a, const CViewType &c, const AViewType &b)
+      : _a(a), _b(b), _c(c) {}
+
+    template<typename MemberType>
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const MemberType &member) const {
+      const int k = member.league_rank();
+      auto cc = Kokkos::subview(_c, k, Kokkos::ALL(), Kokkos::ALL());
+
+      TeamPack<MemberType,ArgTrans>::invoke(member, _a, k, cc);
+      member.team_barrier();
+      TeamUnpack<MemberType,ArgTrans>::invoke(member, cc, k, _b);
+    }
+
+    inline
+    void run() {
+      const int league_size = _c.extent(0);
+      Kokkos::TeamPolicy<DeviceType> policy(league_size, Kokkos::AUTO);
+      Kokkos::parallel_for(policy, *this);
+    }
+  };
+
+  template<typename DeviceType,
+           typename VectorType,
+           typename LayoutType,
+           typename ArgTrans>
+  void impl_test_batched_team_pack(const int nbatch, const int m, const int n) {
+    typedef typename VectorType::value_type scalar_type;
+    typedef Kokkos::Details::ArithTraits<scalar_type> ats;
+    enum : int { vl = VectorType::vector_length };
+
+    typedef Kokkos::View<scalar_type***,LayoutType,DeviceType> AViewType;
+    typedef Kokkos::View<VectorType***,LayoutType,DeviceType> CViewType;
+
+    const bool is_trans = std::is_same<ArgTrans,Trans::Transpose>::value;
+    const int npacks = (nbatch + vl - 1)/vl;
+
+    /// standard layout input a0, compact c1 and standard output b1
+    AViewType a0("a0", nbatch, m, n), b1("b1", nbatch, m, n);
+    CViewType c1("c1", npacks, is_trans ? n : m, is_trans ? m : n);
+
+    Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> random(13718);
+    Kokkos::fill_random(a0, random, scalar_type(1.0));
+
+    Kokkos::fence();
+
+    Functor_TestBatchedTeamPack<DeviceType,AViewType,CViewType,ArgTrans>(a0, c1, b1).run();
+
+    Kokkos::fence();
+
+    /// pack and unpack only move data; the results are exact
+    typename AViewType::HostMirror a0_host = Kokkos::create_mirror_view(a0);
+    typename AViewType::HostMirror b1_host = Kokkos::create_mirror_view(b1);
+    typename CViewType::HostMirror c1_host = Kokkos::create_mirror_view(c1);
+
+    Kokkos::deep_copy(a0_host, a0);
+    Kokkos::deep_copy(b1_host, b1);
+    Kokkos::deep_copy(c1_host, c1);
+
+    typedef typename ats::mag_type mag_type;
+    mag_type diff(0);
+    const mag_type eps = ats::epsilon();
+
+    /// every lane of the compact view, including the replicated tail lanes
+    for (int k=0;k<npacks;++k)
+      for (int v=0;v<vl;++v) {
+        const int p = (k*vl+v < nbatch ? k*vl+v : nbatch-1);
+        for (int i=0;i<m;++i)
+          for (int j=0;j<n;++j)
+            diff += ats::abs(a0_host(p,i,j) - (is_trans ? c1_host(k,j,i)[v] : c1_host(k,i,j)[v]));
+      }
+
+    /// round trip
+    for (int p=0;p<nbatch;++p)
+      for (int i=0;i<m;++i)
+        for (int j=0;j<n;++j)
+          diff += ats::abs(a0_host(p,i,j) - b1_host(p,i,j));
+
+    EXPECT_NEAR_KK( diff, 0, eps);
+  }
+}
+
+
+template<typename DeviceType,
+         typename VectorType,
+         typename ArgTrans>
+int test_batched_team_pack() {
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT)
+  {
+    Test::impl_test_batched_team_pack<DeviceType,VectorType,Kokkos::LayoutLeft,ArgTrans>(0, 10, 10);
+    for (int i=0;i<10;++i) {
+      //printf("Testing: LayoutLeft,  Blksize %d\n", i);
+      Test::impl_test_batched_team_pack<DeviceType,VectorType,Kokkos::LayoutLeft,ArgTrans>(1021, i, i+2);
+    }
+  }
+#endif
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT)
+  {
+    Test::impl_test_batched_team_pack<DeviceType,VectorType,Kokkos::LayoutRight,ArgTrans>(0, 10, 10);
+    for (int i=0;i<10;++i) {
+      //printf("Testing: LayoutRight, Blksize %d\n", i);
+      Test::impl_test_batched_team_pack<DeviceType,VectorType,Kokkos::LayoutRight,ArgTrans>(1021, i, i+2);
+    }
+  }
+#endif
+
+  return 0;
+}
@@ -0,0 +1,162 @@
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+
+#include "KokkosBatched_Vector.hpp"
+
+#include "KokkosBatched_QR_Decl.hpp"
+#include "KokkosBatched_QR_Team_Impl.hpp"
+#include "KokkosBatched_ApplyQ_Decl.hpp"
+#include "KokkosBatched_ApplyQ_Team_Impl.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+using namespace KokkosBatched::Experimental;
+
+namespace Test {
+
+  template<typename DeviceType,
+           typename AViewType,
+           typename tViewType,
+           typename AlgoTagType>
+  struct Functor_TestBatchedTeamQR {
+    AViewType _a, _b, _c;
+    tViewType _t;
+
+    KOKKOS_INLINE_FUNCTION
+    Functor_TestBatchedTeamQR(const AViewType &a, const tViewType &t, 
+                              const AViewType &b, const AViewType &c) 
+      : _a(a), _b(b), _c(c), _t(t) {} 
+
+    template<typename MemberType>
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const MemberType &member) const {
+      const int k = member.league_rank();
+      auto aa = Kokkos::subview(_a, k, Kokkos::ALL(), Kokkos::ALL());
+      auto bb = Kokkos::subview(_b, k, Kokkos::ALL(), Kokkos::ALL());
+      auto cc = Kokkos::subview(_c, k, Kokkos::ALL(), Kokkos::ALL());
+      auto tt = Kokkos::subview(_t, k, Kokkos::ALL());
+
+      TeamQR<MemberType,AlgoTagType>::invoke(member, aa, tt);
+      member.team_barrier();
+
+      // b = R 
+      if (member.team_rank() == 0) {
+        for (int i=0;i<static_cast<int>(aa.extent(0));++i)
+          for (int j=0;j<static_cast<int>(aa.extent(1));++j)
+            bb(i,j) = i <= j ? aa(i,j) : typename AViewType::non_const_value_type(0);
+      }
+      member.team_barrier();
+
+      // b := Q R, c := Q^H c
+      TeamApplyQ<MemberType,Side::Left,Trans::NoTranspose,AlgoTagType>::invoke(member, aa, tt, bb);
+      TeamApplyQ<MemberType,Side::Left,Trans::Transpose,  AlgoTagType>::invoke(member, aa, tt, cc);
+    }
+
+    inline
+    void run() {
+      const int league_size = _a.extent(0);
+      Kokkos::TeamPolicy<DeviceType> policy(league_size, Kokkos::AUTO);
+      Kokkos::parallel_for(policy, *this);
+    }
+  };
+
+  template<typename DeviceType,
+           typename ViewType,
+           typename AlgoTagType>
+  void impl_test_batched_qr(const int N, const int BlkSize) {
+    typedef typename ViewType::value_type value_type;
+    typedef PivotTraits<value_type> traits;
+    typedef typename traits::value_type scalar_type;
+    typedef Kokkos::Details::ArithTraits<scalar_type> ats;
+    enum : int { vl = traits::vector_length };
+
+    typedef Kokkos::View<value_type**,typename ViewType::array_layout,DeviceType> tViewType;
+    typedef Kokkos::View<scalar_type****,Kokkos::LayoutRight,DeviceType> ScalarViewType;
+
+    /// tall input (least squares shape); each SIMD lane is an independent problem
+    const int m = BlkSize + 3, n = BlkSize;
+
+    ScalarViewType a0("a0", N, m, n, vl);
+
+    Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> random(13718);
+    Kokkos::fill_random(a0, random, scalar_type(1.0));
+
+    Kokkos::fence();
+
+    typename ScalarViewType::HostMirror a0_host = Kokkos::create_mirror_view(a0);
+    Kokkos::deep_copy(a0_host, a0);
+
+    ViewType a1("a1", N, m, n), b1("b1", N, m, n), c1("c1", N, m, n);
+    tViewType t1("t1", N, n);
+
+    typename ViewType::HostMirror a1_host = Kokkos::create_mirror_view(a1);
+    typename ViewType::HostMirror b1_host = Kokkos::create_mirror_view(b1);
+    typename ViewType::HostMirror c1_host = Kokkos::create_mirror_view(c1);
+
+    for (int k=0;k<N;++k)
+      for (int i=0;i<m;++i)
+        for (int j=0;j<n;++j)
+          for (int v=0;v<vl;++v) 
+            traits::value(a1_host(k,i,j),v) = a0_host(k,i,j,v);
+
+    Kokkos::deep_copy(a1, a1_host);
+    Kokkos::deep_copy(c1, a1_host);
+
+    Functor_TestBatchedTeamQR<DeviceType,ViewType,tViewType,AlgoTagType>(a1, t1, b1, c1).run();
+
+    Kokkos::fence();
+
+    /// check Q R = A and Q^H A = R; this eps is about 10^-13
+    Kokkos::deep_copy(a1_host, a1);
+    Kokkos::deep_copy(b1_host, b1);
+    Kokkos::deep_copy(c1_host, c1);
+
+    typedef typename ats::mag_type mag_type;
+    mag_type sum(1), diff_qr(0), diff_qha(0);
+    const mag_type eps = 1.0e3 * ats::epsilon();
+
+    for (int k=0;k<N;++k)
+      for (int i=0;i<m;++i)
+        for (int j=0;j<n;++j)
+          for (int v=0;v<vl;++v) {
+            const scalar_type 
+              aij = a0_host(k,i,j,v),
+              rij = i <= j ? traits::value(a1_host(k,i,j),v) : scalar_type(0);
+            sum      += ats::abs(aij);
+            diff_qr  += ats::abs(aij - traits::value(b1_host(k,i,j),v));
+            diff_qha += ats::abs(rij - traits::value(c1_host(k,i,j),v));
+          }
+    EXPECT_NEAR_KK( diff_qr/sum,  0, eps);
+    EXPECT_NEAR_KK( diff_qha/sum, 0, eps);
+  }
+}
+
+
+template<typename DeviceType,
+         typename ValueType,
+         typename AlgoTagType>
+int test_batched_qr() {
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT)
+  {
+    typedef Kokkos::View<ValueType***,Kokkos::LayoutLeft,DeviceType> ViewType;
+    Test::impl_test_batched_qr<DeviceType,ViewType,AlgoTagType>(     0, 10);
+    for (int i=0;i<10;++i) {                                                                                        
+      //printf("Testing: LayoutLeft,  Blksize %d\n", i); 
+      Test::impl_test_batched_qr<DeviceType,ViewType,AlgoTagType>(1024,  i);
+    }
+  }
+#endif
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT)
+  {
+    typedef Kokkos::View<ValueType***,Kokkos::LayoutRight,DeviceType> ViewType;
+    Test::impl_test_batched_qr<DeviceType,ViewType,AlgoTagType>(     0, 10);
+    for (int i=0;i<10;++i) {                                                                                        
+      //printf("Testing: LayoutRight, Blksize %d\n", i); 
+      Test::impl_test_batched_qr<DeviceType,ViewType,AlgoTagType>(1024,  i);
+    }
+  }
+#endif
+
+  return 0;
+}
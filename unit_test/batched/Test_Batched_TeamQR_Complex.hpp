@@ -0,0 +1,6 @@
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE)
+TEST_F( TestCategory, batched_scalar_team_qr_dcomplex ) {
+  typedef Algo::QR::Unblocked algo_tag_type;
+  test_batched_qr<TestExecSpace,Kokkos::complex<double>,algo_tag_type>();
+}
+#endif
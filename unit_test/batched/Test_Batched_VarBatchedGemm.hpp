@@ -0,0 +1,133 @@
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+
+#include "KokkosBatched_VarBatched_Decl.hpp"
+#include "KokkosBatched_VarBatched_Impl.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+using namespace KokkosBatched::Experimental;
+
+namespace Test {
+
+  template<typename TA, typename TB>
+  struct ParamTag {
+    typedef TA transA;
+    typedef TB transB;
+  };
+
+  template<typename DeviceType,
+           typename ValueType,
+           typename ScalarType,
+           typename ParamTagType>
+  void impl_test_batched_var_gemm(const int N, const int MaxSize) {
+    typedef typename ParamTagType::transA transA;
+    typedef typename ParamTagType::transB transB;
+    typedef Kokkos::View<int*,DeviceType> size_view_type;
+    typedef Kokkos::View<ValueType*,DeviceType> value_view_type;
+    typedef Kokkos::Details::ArithTraits<ValueType> ats;
+
+    enum : bool { is_trans_a = std::is_same<transA,Trans::Transpose>::value,
+                  is_trans_b = std::is_same<transB,Trans::Transpose>::value };
+
+    /// mixed sizes including empty entries; every third entry is square
+    size_view_type
+      m("m", N), n("n", N), k("k", N),
+      a_offset("a_offset", N), b_offset("b_offset", N), c_offset("c_offset", N);
+    typename size_view_type::HostMirror
+      m_host = Kokkos::create_mirror_view(m),
+      n_host = Kokkos::create_mirror_view(n),
+      k_host = Kokkos::create_mirror_view(k),
+      a_offset_host = Kokkos::create_mirror_view(a_offset),
+      b_offset_host = Kokkos::create_mirror_view(b_offset),
+      c_offset_host = Kokkos::create_mirror_view(c_offset);
+
+    int a_size = 0, b_size = 0, c_size = 0;
+    for (int p=0;p<N;++p) {
+      m_host(p) = (7*p+3)%(MaxSize+1);
+      n_host(p) = (p%3 == 0 ? m_host(p) : (5*p+1)%(MaxSize+1));
+      k_host(p) = (p%3 == 0 ? m_host(p) : (3*p+2)%(MaxSize+1));
+      a_offset_host(p) = a_size; a_size += m_host(p)*k_host(p);
+      b_offset_host(p) = b_size; b_size += k_host(p)*n_host(p);
+      c_offset_host(p) = c_size; c_size += m_host(p)*n_host(p);
+    }
+    Kokkos::deep_copy(m, m_host);
+    Kokkos::deep_copy(n, n_host);
+    Kokkos::deep_copy(k, k_host);
+    Kokkos::deep_copy(a_offset, a_offset_host);
+    Kokkos::deep_copy(b_offset, b_offset_host);
+    Kokkos::deep_copy(c_offset, c_offset_host);
+
+    /// randomized input
+    value_view_type
+      a("a", a_size), b("b", b_size), c0("c0", c_size), c1("c1", c_size);
+
+    Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> random(13718);
+    Kokkos::fill_random(a,  random, ValueType(1.0));
+    Kokkos::fill_random(b,  random, ValueType(1.0));
+    Kokkos::fill_random(c0, random, ValueType(1.0));
+
+    Kokkos::fence();
+
+    Kokkos::deep_copy(c1, c0);
+
+    VarBatchedGemm<transA,transB>::invoke(ScalarType(1.5), m, n, k, a, a_offset, b, b_offset, ScalarType(3.0), c1, c_offset);
+
+    Kokkos::fence();
+
+    /// for comparison send it to host
+    typename value_view_type::HostMirror
+      a_host  = Kokkos::create_mirror_view(a),
+      b_host  = Kokkos::create_mirror_view(b),
+      c0_host = Kokkos::create_mirror_view(c0),
+      c1_host = Kokkos::create_mirror_view(c1);
+
+    Kokkos::deep_copy(a_host,  a);
+    Kokkos::deep_copy(b_host,  b);
+    Kokkos::deep_copy(c0_host, c0);
+    Kokkos::deep_copy(c1_host, c1);
+
+    /// reference: column major op(A(p)) op(B(p)) with leading dimensions
+    /// equal to the number of rows of the stored matrices
+    typedef typename ats::mag_type mag_type;
+    mag_type sum(1), diff(0);
+    const mag_type eps = 1.0e3 * ats::epsilon();
+
+    for (int p=0;p<N;++p) {
+      const int mm = m_host(p), nn = n_host(p), kk = k_host(p);
+      // an empty last entry has offset == extent, which is not a valid
+      // index; A and B may be empty while C is not (kk == 0)
+      if (mm == 0 || nn == 0) continue;
+      const ValueType
+        *A = a_host.data() + a_offset_host(p),
+        *B = b_host.data() + b_offset_host(p),
+        *C0 = &c0_host(c_offset_host(p)),
+        *C1 = &c1_host(c_offset_host(p));
+      for (int i=0;i<mm;++i)
+        for (int j=0;j<nn;++j) {
+          ValueType ab(0);
+          for (int l=0;l<kk;++l)
+            ab += ( is_trans_a ? A[l+i*kk] : A[i+l*mm] ) * ( is_trans_b ? B[j+l*nn] : B[l+j*kk] );
+          const ValueType cij = ScalarType(3.0)*C0[i+j*mm] + ScalarType(1.5)*ab;
+          sum  += ats::abs(cij);
+          diff += ats::abs(cij - C1[i+j*mm]);
+        }
+    }
+    EXPECT_NEAR_KK( diff/sum, 0, eps);
+  }
+}
+
+template<typename DeviceType,
+         typename ValueType,
+         typename ScalarType,
+         typename ParamTagType>
+int test_batched_var_gemm() {
+  Test::impl_test_batched_var_gemm<DeviceType,ValueType,ScalarType,ParamTagType>(   0, 20);
+  Test::impl_test_batched_var_gemm<DeviceType,ValueType,ScalarType,ParamTagType>(1024,  8);
+  Test::impl_test_batched_var_gemm<DeviceType,ValueType,ScalarType,ParamTagType>(1024, 20);
+  Test::impl_test_batched_var_gemm<DeviceType,ValueType,ScalarType,ParamTagType>(  64, 70);
+
+  return 0;
+}
+
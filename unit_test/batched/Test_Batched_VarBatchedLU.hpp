@@ -0,0 +1,94 @@
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+
+#include "KokkosBatched_VarBatched_Decl.hpp"
+#include "KokkosBatched_VarBatched_Impl.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+using namespace KokkosBatched::Experimental;
+
+namespace Test {
+
+  template<typename DeviceType,
+           typename ValueType>
+  void impl_test_batched_var_lu(const int N, const int MaxSize) {
+    typedef Kokkos::View<int*,DeviceType> size_view_type;
+    typedef Kokkos::View<ValueType*,DeviceType> value_view_type;
+    typedef Kokkos::Details::ArithTraits<ValueType> ats;
+
+    /// mixed sizes including empty entries
+    size_view_type n("n", N), a_offset("a_offset", N);
+    typename size_view_type::HostMirror
+      n_host = Kokkos::create_mirror_view(n),
+      a_offset_host = Kokkos::create_mirror_view(a_offset);
+
+    int a_size = 0;
+    for (int p=0;p<N;++p) {
+      n_host(p) = (7*p+3)%(MaxSize+1);
+      a_offset_host(p) = a_size; a_size += n_host(p)*n_host(p);
+    }
+    Kokkos::deep_copy(n, n_host);
+    Kokkos::deep_copy(a_offset, a_offset_host);
+
+    /// randomized diagonally dominant input
+    value_view_type a0("a0", a_size), a1("a1", a_size);
+
+    Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> random(13718);
+    Kokkos::fill_random(a0, random, ValueType(1.0));
+
+    Kokkos::fence();
+
+    typename value_view_type::HostMirror a0_host = Kokkos::create_mirror_view(a0);
+    Kokkos::deep_copy(a0_host, a0);
+    for (int p=0;p<N;++p)
+      for (int i=0;i<n_host(p);++i)
+        a0_host(a_offset_host(p)+i+i*n_host(p)) += ValueType(n_host(p));
+    Kokkos::deep_copy(a0, a0_host);
+    Kokkos::deep_copy(a1, a0);
+
+    VarBatchedLU::invoke(n, a1, a_offset);
+
+    Kokkos::fence();
+
+    /// for comparison send it to host
+    typename value_view_type::HostMirror a1_host = Kokkos::create_mirror_view(a1);
+    Kokkos::deep_copy(a1_host, a1);
+
+    /// check L U = A with unit diagonal L
+    typedef typename ats::mag_type mag_type;
+    mag_type sum(1), diff(0);
+    const mag_type eps = 1.0e3 * ats::epsilon();
+
+    for (int p=0;p<N;++p) {
+      const int nn = n_host(p);
+      // an empty last entry has offset == extent, which is not a valid index
+      if (nn == 0) continue;
+      const ValueType
+        *A0 = &a0_host(a_offset_host(p)),
+        *A1 = &a1_host(a_offset_host(p));
+      for (int i=0;i<nn;++i)
+        for (int j=0;j<nn;++j) {
+          ValueType lu(0);
+          for (int l=0;l<=(i < j ? i : j);++l)
+            lu += (l == i ? ValueType(1) : A1[i+l*nn])*A1[l+j*nn];
+          sum  += ats::abs(A0[i+j*nn]);
+          diff += ats::abs(A0[i+j*nn] - lu);
+        }
+    }
+    EXPECT_NEAR_KK( diff/sum, 0, eps);
+  }
+}
+
+template<typename DeviceType,
+         typename ValueType>
+int test_batched_var_lu() {
+  Test::impl_test_batched_var_lu<DeviceType,ValueType>(   0, 20);
+  Test::impl_test_batched_var_lu<DeviceType,ValueType>(1024,  8);
+  Test::impl_test_batched_var_lu<DeviceType,ValueType>(1024, 20);
+  Test::impl_test_batched_var_lu<DeviceType,ValueType>(  64, 70);
+
+  return 0;
+}
+
@@ -0,0 +1,5 @@
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE)
+TEST_F( TestCategory, batched_scalar_var_batched_lu_dcomplex ) {
+  test_batched_var_lu<TestExecSpace,Kokkos::complex<double> >();
+}
+#endif
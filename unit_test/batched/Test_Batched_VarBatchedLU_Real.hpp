@@ -0,0 +1,12 @@
+#if defined(KOKKOSKERNELS_INST_FLOAT)
+TEST_F( TestCategory, batched_scalar_var_batched_lu_float ) {
+  test_batched_var_lu<TestExecSpace,float>();
+}
+#endif
+
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F( TestCategory, batched_scalar_var_batched_lu_double ) {
+  test_batched_var_lu<TestExecSpace,double>();
+}
+#endif
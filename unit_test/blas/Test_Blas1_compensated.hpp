@@ -0,0 +1,205 @@
+#include<gtest/gtest.h>
+#include<Kokkos_Core.hpp>
+#include<Kokkos_Random.hpp>
+#include<KokkosBlas1_dot.hpp>
+#include<KokkosBlas1_nrm2.hpp>
+#include<KokkosBlas1_sum.hpp>
+#include<KokkosBlas1_compensated.hpp>
+#include<KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+  template<class ViewTypeA, class Device>
+  void impl_test_compensated(int N) {
+
+    typedef typename ViewTypeA::value_type ScalarA;
+    typedef Kokkos::Details::ArithTraits<ScalarA> AT;
+    typedef typename AT::mag_type mag_type;
+
+    const double eps = std::is_same<mag_type,float>::value?2*1e-5:1e-7;
+
+    ViewTypeA x("X",N);
+    ViewTypeA y("Y",N);
+
+    // Well conditioned: same result as the default reductions
+    {
+      Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+      Kokkos::fill_random(x,rand_pool,ScalarA(10));
+      Kokkos::fill_random(y,rand_pool,ScalarA(10));
+
+      const ScalarA dot_expected = KokkosBlas::dot(x,y);
+      const ScalarA sum_expected = KokkosBlas::sum(x);
+      const mag_type nrm2_expected = KokkosBlas::nrm2(x);
+
+      const ScalarA dot_result = KokkosBlas::Experimental::compensated_dot(x,y);
+      const ScalarA sum_result = KokkosBlas::Experimental::compensated_sum(x);
+      const mag_type nrm2_result = KokkosBlas::Experimental::compensated_nrm2(x);
+      EXPECT_NEAR_KK( dot_result, dot_expected, eps*N );
+      EXPECT_NEAR_KK( sum_result, sum_expected, eps*N );
+      EXPECT_NEAR_KK( nrm2_result, nrm2_expected, eps*nrm2_expected );
+
+      // The global reduction mode redirects the default interface
+      KokkosBlas::Experimental::set_reduction_mode(KokkosBlas::Experimental::REDUCTION_COMPENSATED);
+      EXPECT_NEAR_KK( KokkosBlas::dot(x,y), dot_result, AT::epsilon()*AT::abs(dot_result) );
+      EXPECT_NEAR_KK( KokkosBlas::sum(x), sum_result, AT::epsilon()*AT::abs(sum_result) );
+      EXPECT_NEAR_KK( KokkosBlas::nrm2(x), nrm2_result, AT::epsilon()*nrm2_result );
+      KokkosBlas::Experimental::set_reduction_mode(KokkosBlas::Experimental::REDUCTION_DEFAULT);
+    }
+
+    // Ill conditioned: large entries +-big cancel exactly, the result is
+    // the sum of the small ones, which naive summation loses entirely.
+    {
+      typename ViewTypeA::HostMirror h_x = Kokkos::create_mirror_view(x);
+      typename ViewTypeA::HostMirror h_y = Kokkos::create_mirror_view(y);
+      const mag_type big = 1.0/(AT::epsilon()*AT::epsilon());
+      ScalarA sum_exact = 0;
+      ScalarA dot_exact = 0;
+      for(int i=0; i<N; i++) {
+        const int k = i%4;
+        h_x(i) = k==0 ? (i+2<N ? ScalarA(big*(1+i%3)) : ScalarA(0)) :
+                 k==2 ? ScalarA(-big*(1+(i-2)%3)) : ScalarA(0.5);
+        h_y(i) = k==1 ? ScalarA(2) : ScalarA(1);
+        if(k==1 || k==3) {
+          sum_exact += ScalarA(0.5);
+          dot_exact += ScalarA(0.5)*h_y(i);
+        }
+      }
+      Kokkos::deep_copy(x,h_x);
+      Kokkos::deep_copy(y,h_y);
+
+      const ScalarA dot_result = KokkosBlas::Experimental::compensated_dot(x,y);
+      const ScalarA sum_result = KokkosBlas::Experimental::compensated_sum(x);
+      EXPECT_NEAR_KK( dot_result, dot_exact, eps*(1+AT::abs(dot_exact)) );
+      EXPECT_NEAR_KK( sum_result, sum_exact, eps*(1+AT::abs(sum_exact)) );
+    }
+  }
+
+  template<class ViewTypeA, class Device>
+  void impl_test_compensated_mv(int N, int K) {
+
+    typedef typename ViewTypeA::value_type ScalarA;
+    typedef Kokkos::Details::ArithTraits<ScalarA> AT;
+    typedef typename AT::mag_type mag_type;
+
+    typedef multivector_layout_adapter<ViewTypeA> vfA_type;
+
+    typename vfA_type::BaseType b_x("X",N,K);
+    typename vfA_type::BaseType b_y("Y",N,K);
+
+    ViewTypeA x = vfA_type::view(b_x);
+    ViewTypeA y = vfA_type::view(b_y);
+
+    Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+    Kokkos::fill_random(b_x,rand_pool,ScalarA(10));
+    Kokkos::fill_random(b_y,rand_pool,ScalarA(10));
+
+    const double eps = std::is_same<mag_type,float>::value?2*1e-5:1e-7;
+
+    Kokkos::View<ScalarA*,Kokkos::HostSpace> r_dot("Dot::Result",K);
+    Kokkos::View<ScalarA*,Kokkos::HostSpace> r_sum("Sum::Result",K);
+    Kokkos::View<mag_type*,Kokkos::HostSpace> r_nrm2("Nrm2::Result",K);
+    Kokkos::View<ScalarA*,Kokkos::HostSpace> r2_dot("Dot::Result",K);
+    Kokkos::View<ScalarA*,Kokkos::HostSpace> r2_sum("Sum::Result",K);
+    Kokkos::View<mag_type*,Kokkos::HostSpace> r2_nrm2("Nrm2::Result",K);
+
+    KokkosBlas::dot(r_dot,x,y);
+    KokkosBlas::sum(r_sum,x);
+    KokkosBlas::nrm2(r_nrm2,x);
+
+    KokkosBlas::Experimental::compensated_dot(r2_dot,x,y);
+    KokkosBlas::Experimental::compensated_sum(r2_sum,x);
+    KokkosBlas::Experimental::compensated_nrm2(r2_nrm2,x);
+    for(int k=0; k<K; k++) {
+      EXPECT_NEAR_KK( r2_dot(k), r_dot(k), eps*N );
+      EXPECT_NEAR_KK( r2_sum(k), r_sum(k), eps*N );
+      EXPECT_NEAR_KK( r2_nrm2(k), r_nrm2(k), eps*r_nrm2(k) );
+    }
+
+    // A multivector with one column is combined with every column of the
+    // other operand, in either order, also through the global reduction mode
+    typename vfA_type::BaseType b_x1("X1",N,1);
+    ViewTypeA x1 = vfA_type::view(b_x1);
+    Kokkos::deep_copy(Kokkos::subview(x1,Kokkos::ALL(),0),Kokkos::subview(x,Kokkos::ALL(),0));
+
+    Kokkos::View<ScalarA*,Kokkos::HostSpace> r3_dot("Dot::Result",K);
+    Kokkos::View<ScalarA*,Kokkos::HostSpace> r4_dot("Dot::Result",K);
+    KokkosBlas::dot(r_dot,x1,y);
+    KokkosBlas::Experimental::compensated_dot(r2_dot,x1,y);
+    KokkosBlas::Experimental::compensated_dot(r3_dot,y,x1);
+    KokkosBlas::Experimental::set_reduction_mode(KokkosBlas::Experimental::REDUCTION_COMPENSATED);
+    KokkosBlas::dot(r4_dot,x1,y);
+    KokkosBlas::Experimental::set_reduction_mode(KokkosBlas::Experimental::REDUCTION_DEFAULT);
+    for(int k=0; k<K; k++) {
+      EXPECT_NEAR_KK( r2_dot(k), r_dot(k), eps*N );
+      EXPECT_NEAR_KK( r3_dot(k), AT::conj(r_dot(k)), eps*N );
+      EXPECT_NEAR_KK( r4_dot(k), r_dot(k), eps*N );
+    }
+  }
+}
+
+template<class ScalarA, class Device>
+int test_compensated() {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA*, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  Test::impl_test_compensated<view_type_a_ll, Device>(0);
+  Test::impl_test_compensated<view_type_a_ll, Device>(13);
+  Test::impl_test_compensated<view_type_a_ll, Device>(1024);
+  Test::impl_test_compensated<view_type_a_ll, Device>(132231);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA*, Kokkos::LayoutRight, Device> view_type_a_lr;
+  Test::impl_test_compensated<view_type_a_lr, Device>(0);
+  Test::impl_test_compensated<view_type_a_lr, Device>(13);
+  Test::impl_test_compensated<view_type_a_lr, Device>(1024);
+  Test::impl_test_compensated<view_type_a_lr, Device>(132231);
+#endif
+  return 1;
+}
+
+template<class ScalarA, class Device>
+int test_compensated_mv() {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  Test::impl_test_compensated_mv<view_type_a_ll, Device>(0,5);
+  Test::impl_test_compensated_mv<view_type_a_ll, Device>(13,5);
+  Test::impl_test_compensated_mv<view_type_a_ll, Device>(1024,5);
+  Test::impl_test_compensated_mv<view_type_a_ll, Device>(132231,5);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutRight, Device> view_type_a_lr;
+  Test::impl_test_compensated_mv<view_type_a_lr, Device>(0,5);
+  Test::impl_test_compensated_mv<view_type_a_lr, Device>(13,5);
+  Test::impl_test_compensated_mv<view_type_a_lr, Device>(1024,5);
+  Test::impl_test_compensated_mv<view_type_a_lr, Device>(132231,5);
+#endif
+  return 1;
+}
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, compensated_double ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::compensated_double");
+    test_compensated<double,TestExecSpace> ();
+  Kokkos::Profiling::popRegion();
+}
+TEST_F( TestCategory, compensated_mv_double ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::compensated_mv_double");
+    test_compensated_mv<double,TestExecSpace> ();
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, compensated_complex_double ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::compensated_complex_double");
+    test_compensated<Kokkos::complex<double>,TestExecSpace> ();
+  Kokkos::Profiling::popRegion();
+}
+TEST_F( TestCategory, compensated_mv_complex_double ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::compensated_mv_complex_double");
+    test_compensated_mv<Kokkos::complex<double>,TestExecSpace> ();
+  Kokkos::Profiling::popRegion();
+}
+#endif
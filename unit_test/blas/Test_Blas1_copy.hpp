@@ -0,0 +1,215 @@
+#include<gtest/gtest.h>
+#include<Kokkos_Core.hpp>
+#include<Kokkos_Random.hpp>
+#include<KokkosBlas1_copy.hpp>
+#include<KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+  template<class ViewTypeA, class ViewTypeB, class Device>
+  void impl_test_copy(int N) {
+
+    typedef typename ViewTypeA::value_type ScalarA;
+    typedef typename ViewTypeB::value_type ScalarB;
+
+    typedef Kokkos::View<ScalarA*[2],
+       typename std::conditional<
+                std::is_same<typename ViewTypeA::array_layout,Kokkos::LayoutStride>::value,
+                Kokkos::LayoutRight, Kokkos::LayoutLeft>::type,Device> BaseTypeA;
+    typedef Kokkos::View<ScalarB*[2],
+       typename std::conditional<
+                std::is_same<typename ViewTypeB::array_layout,Kokkos::LayoutStride>::value,
+                Kokkos::LayoutRight, Kokkos::LayoutLeft>::type,Device> BaseTypeB;
+
+    BaseTypeA b_x("X",N);
+    BaseTypeB b_y("Y",N);
+
+    ViewTypeA x = Kokkos::subview(b_x,Kokkos::ALL(),0);
+    ViewTypeB y = Kokkos::subview(b_y,Kokkos::ALL(),0);
+    typename ViewTypeA::const_type c_x = x;
+
+    typename BaseTypeA::HostMirror h_b_x = Kokkos::create_mirror_view(b_x);
+    typename BaseTypeB::HostMirror h_b_y = Kokkos::create_mirror_view(b_y);
+
+    Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+    Kokkos::fill_random(b_x,rand_pool,ScalarA(10));
+    Kokkos::fill_random(b_y,rand_pool,ScalarB(10));
+    Kokkos::deep_copy(h_b_x,b_x);
+    typename BaseTypeB::HostMirror h_b_y_org = Kokkos::create_mirror(b_y);
+    Kokkos::deep_copy(h_b_y_org,b_y);
+
+    KokkosBlas::copy(x,y);
+    Kokkos::deep_copy(h_b_y,b_y);
+    for(int i=0;i<N;i++) {
+      EXPECT_EQ( h_b_y(i,0), h_b_x(i,0) );
+      // the second column must be left alone
+      EXPECT_EQ( h_b_y(i,1), h_b_y_org(i,1) );
+    }
+
+    Kokkos::deep_copy(b_y,ScalarB());
+    KokkosBlas::copy(c_x,y);
+    Kokkos::deep_copy(h_b_y,b_y);
+    for(int i=0;i<N;i++)
+      EXPECT_EQ( h_b_y(i,0), h_b_x(i,0) );
+  }
+
+  template<class ViewTypeA, class ViewTypeB, class Device>
+  void impl_test_copy_mv(int N, int K) {
+
+    typedef multivector_layout_adapter<ViewTypeA> vfA_type;
+    typedef multivector_layout_adapter<ViewTypeB> vfB_type;
+
+    typename vfA_type::BaseType b_x("A",N,K);
+    typename vfB_type::BaseType b_y("B",N,K);
+
+    ViewTypeA x = vfA_type::view(b_x);
+    ViewTypeB y = vfB_type::view(b_y);
+
+    typedef multivector_layout_adapter<typename ViewTypeA::HostMirror> h_vfA_type;
+    typedef multivector_layout_adapter<typename ViewTypeB::HostMirror> h_vfB_type;
+
+    typename h_vfA_type::BaseType h_b_x = Kokkos::create_mirror_view(b_x);
+    typename h_vfB_type::BaseType h_b_y = Kokkos::create_mirror_view(b_y);
+
+    typename ViewTypeA::HostMirror h_x = h_vfA_type::view(h_b_x);
+    typename ViewTypeB::HostMirror h_y = h_vfB_type::view(h_b_y);
+
+    Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+    Kokkos::fill_random(b_x,rand_pool,typename ViewTypeA::value_type(10));
+    Kokkos::deep_copy(h_b_x,b_x);
+
+    typename ViewTypeA::const_type c_x = x;
+
+    KokkosBlas::copy(c_x,y);
+    Kokkos::deep_copy(h_b_y,b_y);
+    for(int i=0;i<N;i++)
+      for(int j=0;j<K;j++)
+        EXPECT_EQ( h_y(i,j), h_x(i,j) );
+  }
+
+  // Copy rows of a LayoutLeft matrix (stride M) into a contiguous vector
+  // and back into another row.
+  template<class Scalar, class Device>
+  void impl_test_copy_strided(int M, int N) {
+    typedef Kokkos::View<Scalar**,Kokkos::LayoutLeft,Device> matrix_type;
+    typedef Kokkos::View<Scalar*,Kokkos::LayoutLeft,Device> vector_type;
+
+    matrix_type A("A",M,N);
+    vector_type v("v",N);
+
+    Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+    Kokkos::fill_random(A,rand_pool,Scalar(10));
+
+    typename matrix_type::HostMirror h_A_org = Kokkos::create_mirror(A);
+    Kokkos::deep_copy(h_A_org,A);
+
+    KokkosBlas::copy(Kokkos::subview(A,0,Kokkos::ALL()),v);
+    KokkosBlas::copy(v,Kokkos::subview(A,M-1,Kokkos::ALL()));
+
+    typename matrix_type::HostMirror h_A = Kokkos::create_mirror_view(A);
+    typename vector_type::HostMirror h_v = Kokkos::create_mirror_view(v);
+    Kokkos::deep_copy(h_A,A);
+    Kokkos::deep_copy(h_v,v);
+    for(int j=0;j<N;j++) {
+      EXPECT_EQ( h_v(j), h_A_org(0,j) );
+      EXPECT_EQ( h_A(M-1,j), h_A_org(0,j) );
+      for(int i=0;i<M-1;i++)
+        EXPECT_EQ( h_A(i,j), h_A_org(i,j) );
+    }
+  }
+}
+
+template<class ScalarA, class ScalarB, class Device>
+int test_copy() {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA*, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  typedef Kokkos::View<ScalarB*, Kokkos::LayoutLeft, Device> view_type_b_ll;
+  Test::impl_test_copy<view_type_a_ll, view_type_b_ll, Device>(0);
+  Test::impl_test_copy<view_type_a_ll, view_type_b_ll, Device>(13);
+  Test::impl_test_copy<view_type_a_ll, view_type_b_ll, Device>(1024);
+  Test::impl_test_copy<view_type_a_ll, view_type_b_ll, Device>(132231);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA*, Kokkos::LayoutRight, Device> view_type_a_lr;
+  typedef Kokkos::View<ScalarB*, Kokkos::LayoutRight, Device> view_type_b_lr;
+  Test::impl_test_copy<view_type_a_lr, view_type_b_lr, Device>(0);
+  Test::impl_test_copy<view_type_a_lr, view_type_b_lr, Device>(13);
+  Test::impl_test_copy<view_type_a_lr, view_type_b_lr, Device>(1024);
+  Test::impl_test_copy<view_type_a_lr, view_type_b_lr, Device>(132231);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTSTRIDE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA*, Kokkos::LayoutStride, Device> view_type_a_ls;
+  typedef Kokkos::View<ScalarB*, Kokkos::LayoutStride, Device> view_type_b_ls;
+  Test::impl_test_copy<view_type_a_ls, view_type_b_ls, Device>(0);
+  Test::impl_test_copy<view_type_a_ls, view_type_b_ls, Device>(13);
+  Test::impl_test_copy<view_type_a_ls, view_type_b_ls, Device>(1024);
+  Test::impl_test_copy<view_type_a_ls, view_type_b_ls, Device>(132231);
+#endif
+
+#if !defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS)
+  Test::impl_test_copy<view_type_a_ls, view_type_b_ll, Device>(1024);
+  Test::impl_test_copy<view_type_a_ll, view_type_b_ls, Device>(1024);
+  Test::impl_test_copy<view_type_a_lr, view_type_b_ls, Device>(1024);
+  Test::impl_test_copy_strided<ScalarA, Device>(1, 13);
+  Test::impl_test_copy_strided<ScalarA, Device>(17, 1024);
+#endif
+
+  return 1;
+}
+
+template<class ScalarA, class ScalarB, class Device>
+int test_copy_mv() {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  typedef Kokkos::View<ScalarB**, Kokkos::LayoutLeft, Device> view_type_b_ll;
+  Test::impl_test_copy_mv<view_type_a_ll, view_type_b_ll, Device>(0,5);
+  Test::impl_test_copy_mv<view_type_a_ll, view_type_b_ll, Device>(13,5);
+  Test::impl_test_copy_mv<view_type_a_ll, view_type_b_ll, Device>(1024,5);
+  Test::impl_test_copy_mv<view_type_a_ll, view_type_b_ll, Device>(132231,5);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutRight, Device> view_type_a_lr;
+  typedef Kokkos::View<ScalarB**, Kokkos::LayoutRight, Device> view_type_b_lr;
+  Test::impl_test_copy_mv<view_type_a_lr, view_type_b_lr, Device>(0,5);
+  Test::impl_test_copy_mv<view_type_a_lr, view_type_b_lr, Device>(13,5);
+  Test::impl_test_copy_mv<view_type_a_lr, view_type_b_lr, Device>(1024,5);
+  Test::impl_test_copy_mv<view_type_a_lr, view_type_b_lr, Device>(132231,5);
+#endif
+
+#if !defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS)
+  Test::impl_test_copy_mv<view_type_a_lr, view_type_b_ll, Device>(1024,5);
+#endif
+
+  return 1;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, copy_float ) {
+    test_copy<float,float,TestExecSpace> ();
+}
+TEST_F( TestCategory, copy_mv_float ) {
+    test_copy_mv<float,float,TestExecSpace> ();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, copy_double ) {
+    test_copy<double,double,TestExecSpace> ();
+}
+TEST_F( TestCategory, copy_mv_double ) {
+    test_copy_mv<double,double,TestExecSpace> ();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, copy_complex_double ) {
+    test_copy<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ();
+}
+TEST_F( TestCategory, copy_mv_complex_double ) {
+    test_copy_mv<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ();
+}
+#endif
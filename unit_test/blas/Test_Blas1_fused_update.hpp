@@ -0,0 +1,173 @@
+#include<gtest/gtest.h>
+#include<Kokkos_Core.hpp>
+#include<Kokkos_Random.hpp>
+#include<KokkosBlas.hpp>
+#include<KokkosBlas1_fused_update.hpp>
+#include<KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+  template<class ViewType, class Device>
+  void impl_test_fused_update(int N) {
+
+    typedef typename ViewType::value_type Scalar;
+    typedef Kokkos::Details::ArithTraits<Scalar> AT;
+    typedef Kokkos::Details::InnerProductSpaceTraits<Scalar> IPT;
+    typedef typename AT::mag_type mag_type;
+
+    const Scalar a = 3;
+    const Scalar b = 5;
+    const Scalar c = 7;
+    const double eps = std::is_same<mag_type,float>::value?2*1e-5:1e-7;
+
+    // 10 vectors: x, y, z, w for axpby_nrm2 / update_dot and
+    // n, m, z, q, s, p, x, r, u, w for pipelined CG
+    const int num_vecs = 10;
+    std::vector<ViewType> v;
+    std::vector<typename ViewType::HostMirror> h_v;
+    Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+    for(int k=0; k<num_vecs; k++) {
+      v.push_back(ViewType("V",N));
+      Kokkos::fill_random(v[k],rand_pool,Scalar(1));
+      // Deep copies, as the reference is computed in place on the host
+      h_v.push_back(Kokkos::create_mirror(v[k]));
+      Kokkos::deep_copy(h_v[k],v[k]);
+    }
+    typename ViewType::HostMirror h_r = Kokkos::create_mirror_view(v[0]);
+
+    // axpby_nrm2: v1 = a*v0 + b*v1
+    {
+      mag_type expected = 0;
+      for(int i=0; i<N; i++) {
+        h_v[1](i) = a*h_v[0](i) + b*h_v[1](i);
+        expected += AT::abs(h_v[1](i))*AT::abs(h_v[1](i));
+      }
+      expected = Kokkos::Details::ArithTraits<mag_type>::sqrt(expected);
+
+      mag_type result = KokkosBlas::Experimental::axpby_nrm2(a,v[0],b,v[1]);
+      EXPECT_NEAR_KK( result, expected, eps*expected );
+      Kokkos::deep_copy(h_r,v[1]);
+      for(int i=0; i<N; i++)
+        EXPECT_NEAR_KK( h_r(i), h_v[1](i), eps*(1+AT::abs(h_v[1](i))) );
+    }
+
+    // update_dot: v2 = a*v0 + b*v1 + c*v2, dot(v2,v3)
+    {
+      typename IPT::dot_type expected = 0;
+      for(int i=0; i<N; i++) {
+        h_v[2](i) = a*h_v[0](i) + b*h_v[1](i) + c*h_v[2](i);
+        expected += IPT::dot(h_v[2](i),h_v[3](i));
+      }
+
+      typename IPT::dot_type result = KokkosBlas::Experimental::update_dot(a,v[0],b,v[1],c,v[2],v[3]);
+      EXPECT_NEAR_KK( result, expected, eps*AT::abs(expected)*N );
+      Kokkos::deep_copy(h_r,v[2]);
+      for(int i=0; i<N; i++)
+        EXPECT_NEAR_KK( h_r(i), h_v[2](i), eps*(1+AT::abs(h_v[2](i))) );
+    }
+
+    // pipelined CG
+    {
+      const Scalar alpha = 0.25;
+      const Scalar beta = 0.5;
+      typename IPT::dot_type gamma = 0, delta = 0;
+      mag_type rr = 0;
+      for(int i=0; i<N; i++) {
+        Scalar& n = h_v[0](i); Scalar& m = h_v[1](i);
+        Scalar& z = h_v[2](i); Scalar& q = h_v[3](i);
+        Scalar& s = h_v[4](i); Scalar& p = h_v[5](i);
+        Scalar& x = h_v[6](i); Scalar& r = h_v[7](i);
+        Scalar& u = h_v[8](i); Scalar& w = h_v[9](i);
+        z = n + beta*z; q = m + beta*q; s = w + beta*s; p = u + beta*p;
+        x += alpha*p; r -= alpha*s; u -= alpha*q; w -= alpha*z;
+        gamma += IPT::dot(r,u);
+        delta += IPT::dot(w,u);
+        rr += AT::abs(r)*AT::abs(r);
+      }
+
+      auto result = KokkosBlas::Experimental::pipelined_cg_update(alpha,beta,v[0],v[1],v[2],v[3],v[4],
+                                                                  v[5],v[6],v[7],v[8],v[9]);
+      EXPECT_NEAR_KK( result.gamma, gamma, eps*N );
+      EXPECT_NEAR_KK( result.delta, delta, eps*N );
+      EXPECT_NEAR_KK( result.rr, rr, eps*rr );
+      for(int k=2; k<num_vecs; k++) {
+        Kokkos::deep_copy(h_r,v[k]);
+        for(int i=0; i<N; i++)
+          EXPECT_NEAR_KK( h_r(i), h_v[k](i), eps*(1+AT::abs(h_v[k](i))) );
+      }
+    }
+  }
+
+  // The fused kernels through the umbrella header, against the unfused
+  // KokkosBlas calls they replace.
+  template<class ViewType, class Device>
+  void impl_test_fused_update_unfused(int N) {
+
+    typedef typename ViewType::value_type Scalar;
+    typedef Kokkos::Details::ArithTraits<Scalar> AT;
+    typedef Kokkos::Details::InnerProductSpaceTraits<Scalar> IPT;
+    typedef typename AT::mag_type mag_type;
+
+    const Scalar a = 3;
+    const Scalar b = 5;
+    const Scalar c = 7;
+    const double eps = std::is_same<mag_type,float>::value?2*1e-5:1e-7;
+
+    ViewType x("X",N), y0("Y0",N), y1("Y1",N), z0("Z0",N), z1("Z1",N), w("W",N);
+    Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+    Kokkos::fill_random(x,rand_pool,Scalar(1));
+    Kokkos::fill_random(y0,rand_pool,Scalar(1));
+    Kokkos::fill_random(z0,rand_pool,Scalar(1));
+    Kokkos::fill_random(w,rand_pool,Scalar(1));
+    Kokkos::deep_copy(y1,y0);
+    Kokkos::deep_copy(z1,z0);
+
+    KokkosBlas::axpby(a,x,b,y0);
+    const mag_type expected_nrm2 = KokkosBlas::nrm2(y0);
+    const mag_type result_nrm2 = KokkosBlas::Experimental::axpby_nrm2(a,x,b,y1);
+    EXPECT_NEAR_KK( result_nrm2, expected_nrm2, eps*expected_nrm2 );
+
+    KokkosBlas::update(a,x,b,y0,c,z0);
+    const typename IPT::dot_type expected_dot = KokkosBlas::dot(z0,w);
+    const typename IPT::dot_type result_dot = KokkosBlas::Experimental::update_dot(a,x,b,y1,c,z1,w);
+    EXPECT_NEAR_KK( result_dot, expected_dot, eps*AT::abs(expected_dot)*N );
+  }
+}
+
+template<class Scalar, class Device>
+int test_fused_update() {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<Scalar*, Kokkos::LayoutLeft, Device> view_type_ll;
+  Test::impl_test_fused_update<view_type_ll, Device>(0);
+  Test::impl_test_fused_update<view_type_ll, Device>(13);
+  Test::impl_test_fused_update<view_type_ll, Device>(1024);
+  Test::impl_test_fused_update<view_type_ll, Device>(132231);
+  Test::impl_test_fused_update_unfused<view_type_ll, Device>(0);
+  Test::impl_test_fused_update_unfused<view_type_ll, Device>(1024);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<Scalar*, Kokkos::LayoutRight, Device> view_type_lr;
+  Test::impl_test_fused_update<view_type_lr, Device>(0);
+  Test::impl_test_fused_update<view_type_lr, Device>(13);
+  Test::impl_test_fused_update<view_type_lr, Device>(1024);
+  Test::impl_test_fused_update_unfused<view_type_lr, Device>(1024);
+#endif
+  return 1;
+}
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, fused_update_double ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::fused_update_double");
+    test_fused_update<double,TestExecSpace> ();
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, fused_update_complex_double ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::fused_update_complex_double");
+    test_fused_update<Kokkos::complex<double>,TestExecSpace> ();
+  Kokkos::Profiling::popRegion();
+}
+#endif
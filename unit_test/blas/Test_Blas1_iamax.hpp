@@ -0,0 +1,200 @@
+#include<gtest/gtest.h>
+#include<Kokkos_Core.hpp>
+#include<Kokkos_Random.hpp>
+#include<KokkosBlas1_iamax.hpp>
+#include<KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+  // Reference BLAS magnitude |Re(x)| + |Im(x)|
+  template<class Scalar>
+  typename Kokkos::Details::ArithTraits<Scalar>::mag_type iamax_ref_abs1(const Scalar& x) {
+    typedef Kokkos::Details::ArithTraits<Scalar> AT;
+    typedef Kokkos::Details::ArithTraits<typename AT::mag_type> ATM;
+    return ATM::abs(AT::real(x)) + ATM::abs(AT::imag(x));
+  }
+
+  // Sequential reference: 1-based index of the first extreme entry
+  template<class ViewType>
+  size_t iamax_ref(const ViewType& h_x, int j, bool find_max) {
+    const int N = h_x.extent(0);
+    if(N == 0) return 0;
+    size_t idx = 1;
+    auto best = iamax_ref_abs1(h_x(0,j));
+    for(int i=1; i<N; i++) {
+      const auto val = iamax_ref_abs1(h_x(i,j));
+      if(find_max ? val > best : val < best) {
+        best = val;
+        idx = i+1;
+      }
+    }
+    return idx;
+  }
+
+  // Put two entries with the largest and two with the smallest
+  // magnitude into column j, so that the tie rule is exercised.
+  template<class ViewType>
+  void iamax_make_ties(const ViewType& h_x, int j) {
+    typedef typename ViewType::value_type Scalar;
+    const int N = h_x.extent(0);
+    if(N < 8) return;
+    h_x((N/3+j)%N,j) = Scalar(-10);
+    h_x((2*N/3+j)%N,j) = Scalar(10);
+    h_x((N/4+j)%N,j) = Scalar(0);
+    h_x((N/2+j)%N,j) = Scalar(0);
+  }
+
+  template<class ViewTypeA, class Device>
+  void impl_test_iamax(int N) {
+
+    typedef typename ViewTypeA::value_type ScalarA;
+    typedef typename ViewTypeA::size_type size_type;
+
+    typedef Kokkos::View<ScalarA*[2],
+       typename std::conditional<
+                std::is_same<typename ViewTypeA::array_layout,Kokkos::LayoutStride>::value,
+                Kokkos::LayoutRight, Kokkos::LayoutLeft>::type,Device> BaseTypeA;
+
+    BaseTypeA b_x("X",N);
+    ViewTypeA x = Kokkos::subview(b_x,Kokkos::ALL(),0);
+    typename ViewTypeA::const_type c_x = x;
+
+    typename BaseTypeA::HostMirror h_b_x = Kokkos::create_mirror_view(b_x);
+
+    Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+    Kokkos::fill_random(b_x,rand_pool,ScalarA(1));
+    Kokkos::deep_copy(h_b_x,b_x);
+    iamax_make_ties(h_b_x,0);
+    Kokkos::deep_copy(b_x,h_b_x);
+
+    const size_type expected_max = iamax_ref(h_b_x,0,true);
+    const size_type expected_min = iamax_ref(h_b_x,0,false);
+
+    EXPECT_EQ( KokkosBlas::iamax(x), expected_max );
+    EXPECT_EQ( KokkosBlas::iamax(c_x), expected_max );
+    EXPECT_EQ( KokkosBlas::iamin(x), expected_min );
+    EXPECT_EQ( KokkosBlas::iamin(c_x), expected_min );
+
+    Kokkos::View<size_type,Kokkos::HostSpace> r("Iamax::Result");
+    KokkosBlas::iamax(r,c_x);
+    EXPECT_EQ( r(), expected_max );
+    KokkosBlas::iamin(r,c_x);
+    EXPECT_EQ( r(), expected_min );
+  }
+
+  template<class ViewTypeA, class Device>
+  void impl_test_iamax_mv(int N, int K) {
+
+    typedef typename ViewTypeA::size_type size_type;
+    typedef typename ViewTypeA::value_type ScalarA;
+
+    typedef multivector_layout_adapter<ViewTypeA> vfA_type;
+
+    typename vfA_type::BaseType b_x("A",N,K);
+
+    ViewTypeA x = vfA_type::view(b_x);
+
+    typedef multivector_layout_adapter<typename ViewTypeA::HostMirror> h_vfA_type;
+
+    typename h_vfA_type::BaseType h_b_x = Kokkos::create_mirror_view(b_x);
+
+    typename ViewTypeA::HostMirror h_x = h_vfA_type::view(h_b_x);
+
+    Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+    Kokkos::fill_random(b_x,rand_pool,ScalarA(1));
+    Kokkos::deep_copy(h_b_x,b_x);
+    for(int j=0; j<K; j++)
+      iamax_make_ties(h_x,j);
+    Kokkos::deep_copy(b_x,h_b_x);
+
+    typename ViewTypeA::const_type c_x = x;
+
+    Kokkos::View<size_type*,Kokkos::HostSpace> r("Iamax::Result",K);
+
+    KokkosBlas::iamax(r,c_x);
+    for(int j=0; j<K; j++)
+      EXPECT_EQ( r(j), iamax_ref(h_x,j,true) );
+
+    KokkosBlas::iamin(r,c_x);
+    for(int j=0; j<K; j++)
+      EXPECT_EQ( r(j), iamax_ref(h_x,j,false) );
+  }
+}
+
+template<class ScalarA, class Device>
+int test_iamax() {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA*, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  Test::impl_test_iamax<view_type_a_ll, Device>(0);
+  Test::impl_test_iamax<view_type_a_ll, Device>(13);
+  Test::impl_test_iamax<view_type_a_ll, Device>(1024);
+  Test::impl_test_iamax<view_type_a_ll, Device>(132231);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA*, Kokkos::LayoutRight, Device> view_type_a_lr;
+  Test::impl_test_iamax<view_type_a_lr, Device>(0);
+  Test::impl_test_iamax<view_type_a_lr, Device>(13);
+  Test::impl_test_iamax<view_type_a_lr, Device>(1024);
+  Test::impl_test_iamax<view_type_a_lr, Device>(132231);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTSTRIDE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA*, Kokkos::LayoutStride, Device> view_type_a_ls;
+  Test::impl_test_iamax<view_type_a_ls, Device>(0);
+  Test::impl_test_iamax<view_type_a_ls, Device>(13);
+  Test::impl_test_iamax<view_type_a_ls, Device>(1024);
+  Test::impl_test_iamax<view_type_a_ls, Device>(132231);
+#endif
+
+  return 1;
+}
+
+template<class ScalarA, class Device>
+int test_iamax_mv() {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  Test::impl_test_iamax_mv<view_type_a_ll, Device>(0,5);
+  Test::impl_test_iamax_mv<view_type_a_ll, Device>(13,5);
+  Test::impl_test_iamax_mv<view_type_a_ll, Device>(1024,5);
+  Test::impl_test_iamax_mv<view_type_a_ll, Device>(132231,5);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutRight, Device> view_type_a_lr;
+  Test::impl_test_iamax_mv<view_type_a_lr, Device>(0,5);
+  Test::impl_test_iamax_mv<view_type_a_lr, Device>(13,5);
+  Test::impl_test_iamax_mv<view_type_a_lr, Device>(1024,5);
+  Test::impl_test_iamax_mv<view_type_a_lr, Device>(132231,5);
+#endif
+
+  return 1;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, iamax_float ) {
+    test_iamax<float,TestExecSpace> ();
+}
+TEST_F( TestCategory, iamax_mv_float ) {
+    test_iamax_mv<float,TestExecSpace> ();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, iamax_double ) {
+    test_iamax<double,TestExecSpace> ();
+}
+TEST_F( TestCategory, iamax_mv_double ) {
+    test_iamax_mv<double,TestExecSpace> ();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, iamax_complex_double ) {
+    test_iamax<Kokkos::complex<double>,TestExecSpace> ();
+}
+TEST_F( TestCategory, iamax_mv_complex_double ) {
+    test_iamax_mv<Kokkos::complex<double>,TestExecSpace> ();
+}
+#endif
@@ -0,0 +1,247 @@
+#include<gtest/gtest.h>
+#include<Kokkos_Core.hpp>
+#include<Kokkos_Random.hpp>
+#include<KokkosBlas1_dot.hpp>
+#include<KokkosBlas1_nrm2.hpp>
+#include<KokkosBlas1_sum.hpp>
+#include<KokkosBlas1_reproducible.hpp>
+#include<KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+  // The reduction of Op with the launches split into chunks of chunkSize
+  template<class Op, class XV, class YV>
+  typename Op::value_type reproducible_chunked(const XV& x, const YV& y, int chunkSize) {
+    typename Op::value_type result;
+    Kokkos::View<typename Op::value_type, Kokkos::HostSpace,
+                 Kokkos::MemoryTraits<Kokkos::Unmanaged> > r(&result);
+    KokkosBlas::Impl::reproducible_reduce<Op>("KokkosBlas::Test::reproducible", r, x, y, chunkSize);
+    return result;
+  }
+
+  // The same reductions on a host copy of x and y run by Kokkos::Serial,
+  // i.e. with a single thread, if the test space is also a host space
+  template<class ViewTypeA, class Device,
+           bool is_host = std::is_same<typename Device::memory_space,Kokkos::HostSpace>::value>
+  struct ReproducibleSerialCheck {
+    static void check(const ViewTypeA&, const ViewTypeA&,
+                      const typename ViewTypeA::non_const_value_type&,
+                      const typename ViewTypeA::non_const_value_type&,
+                      const typename Kokkos::Details::ArithTraits<typename ViewTypeA::non_const_value_type>::mag_type&) {}
+  };
+
+#if defined(KOKKOS_ENABLE_SERIAL)
+  template<class ViewTypeA, class Device>
+  struct ReproducibleSerialCheck<ViewTypeA,Device,true> {
+    static void check(const ViewTypeA& x, const ViewTypeA& y,
+                      const typename ViewTypeA::non_const_value_type& dot_result,
+                      const typename ViewTypeA::non_const_value_type& sum_result,
+                      const typename Kokkos::Details::ArithTraits<typename ViewTypeA::non_const_value_type>::mag_type& nrm2_result) {
+      typedef Kokkos::View<typename ViewTypeA::const_data_type, typename ViewTypeA::array_layout,
+                           Kokkos::Device<Kokkos::Serial,Kokkos::HostSpace>,
+                           Kokkos::MemoryTraits<Kokkos::Unmanaged> > serial_view_type;
+      serial_view_type xs(x.data(), x.extent(0)), ys(y.data(), y.extent(0));
+      EXPECT_TRUE( KokkosBlas::Experimental::reproducible_dot(xs,ys) == dot_result );
+      EXPECT_TRUE( KokkosBlas::Experimental::reproducible_sum(xs) == sum_result );
+      EXPECT_TRUE( KokkosBlas::Experimental::reproducible_nrm2(xs) == nrm2_result );
+    }
+  };
+#endif
+
+  template<class ViewTypeA, class Device>
+  void impl_test_reproducible(int N) {
+
+    typedef typename ViewTypeA::value_type ScalarA;
+    typedef Kokkos::Details::ArithTraits<ScalarA> AT;
+    typedef typename AT::mag_type mag_type;
+
+    const double eps = std::is_same<mag_type,float>::value?2*1e-5:1e-7;
+
+    ViewTypeA x("X",N);
+    ViewTypeA y("Y",N);
+
+    Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+    Kokkos::fill_random(x,rand_pool,ScalarA(10));
+    Kokkos::fill_random(y,rand_pool,ScalarA(10));
+
+    // Same result as the default reductions up to rounding
+    const ScalarA dot_expected = KokkosBlas::dot(x,y);
+    const ScalarA sum_expected = KokkosBlas::sum(x);
+    const mag_type nrm2_expected = KokkosBlas::nrm2(x);
+
+    const ScalarA dot_result = KokkosBlas::Experimental::reproducible_dot(x,y);
+    const ScalarA sum_result = KokkosBlas::Experimental::reproducible_sum(x);
+    const mag_type nrm2_result = KokkosBlas::Experimental::reproducible_nrm2(x);
+    EXPECT_NEAR_KK( dot_result, dot_expected, eps*N );
+    EXPECT_NEAR_KK( sum_result, sum_expected, eps*N );
+    EXPECT_NEAR_KK( nrm2_result, nrm2_expected, eps*nrm2_expected );
+
+    // Bitwise identical when repeated
+    for(int rep=0; rep<3; rep++) {
+      EXPECT_TRUE( KokkosBlas::Experimental::reproducible_dot(x,y) == dot_result );
+      EXPECT_TRUE( KokkosBlas::Experimental::reproducible_sum(x) == sum_result );
+      EXPECT_TRUE( KokkosBlas::Experimental::reproducible_nrm2(x) == nrm2_result );
+    }
+
+    // Bitwise identical under different chunkings of the launches, i.e.
+    // different assignments of blocks and tree nodes to threads
+    typedef KokkosBlas::Impl::ReproducibleDotOp<ViewTypeA,ViewTypeA> dot_op;
+    typedef KokkosBlas::Impl::ReproducibleSumOp<ViewTypeA> sum_op;
+    typedef KokkosBlas::Impl::ReproducibleNrm2Op<ViewTypeA> nrm2_op;
+    const int chunk_sizes[] = { 1, 3, 64, 4096 };
+    for(int chunk_size : chunk_sizes) {
+      EXPECT_TRUE( reproducible_chunked<dot_op>(x,y,chunk_size) == dot_result );
+      EXPECT_TRUE( reproducible_chunked<sum_op>(x,x,chunk_size) == sum_result );
+      EXPECT_TRUE( reproducible_chunked<nrm2_op>(x,x,chunk_size) == nrm2_result );
+    }
+
+    // Bitwise identical with a single thread
+    ReproducibleSerialCheck<ViewTypeA,Device>::check(x,y,dot_result,sum_result,nrm2_result);
+
+    // The global reduction mode redirects the default interface
+    KokkosBlas::Experimental::set_reduction_mode(KokkosBlas::Experimental::REDUCTION_REPRODUCIBLE);
+    EXPECT_TRUE( KokkosBlas::dot(x,y) == dot_result );
+    EXPECT_TRUE( KokkosBlas::sum(x) == sum_result );
+    EXPECT_TRUE( KokkosBlas::nrm2(x) == nrm2_result );
+    KokkosBlas::Experimental::set_reduction_mode(KokkosBlas::Experimental::REDUCTION_DEFAULT);
+  }
+
+  template<class ViewTypeA, class Device>
+  void impl_test_reproducible_mv(int N, int K) {
+
+    typedef typename ViewTypeA::value_type ScalarA;
+    typedef Kokkos::Details::ArithTraits<ScalarA> AT;
+    typedef typename AT::mag_type mag_type;
+
+    typedef multivector_layout_adapter<ViewTypeA> vfA_type;
+
+    typename vfA_type::BaseType b_x("X",N,K);
+    typename vfA_type::BaseType b_y("Y",N,K);
+
+    ViewTypeA x = vfA_type::view(b_x);
+    ViewTypeA y = vfA_type::view(b_y);
+
+    Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+    Kokkos::fill_random(b_x,rand_pool,ScalarA(10));
+    Kokkos::fill_random(b_y,rand_pool,ScalarA(10));
+
+    const double eps = std::is_same<mag_type,float>::value?2*1e-5:1e-7;
+
+    Kokkos::View<ScalarA*,Kokkos::HostSpace> r_dot("Dot::Result",K);
+    Kokkos::View<ScalarA*,Kokkos::HostSpace> r_sum("Sum::Result",K);
+    Kokkos::View<mag_type*,Kokkos::HostSpace> r_nrm2("Nrm2::Result",K);
+    Kokkos::View<ScalarA*,Kokkos::HostSpace> r2_dot("Dot::Result",K);
+    Kokkos::View<ScalarA*,Kokkos::HostSpace> r2_sum("Sum::Result",K);
+    Kokkos::View<mag_type*,Kokkos::HostSpace> r2_nrm2("Nrm2::Result",K);
+
+    KokkosBlas::dot(r_dot,x,y);
+    KokkosBlas::sum(r_sum,x);
+    KokkosBlas::nrm2(r_nrm2,x);
+
+    KokkosBlas::Experimental::reproducible_dot(r2_dot,x,y);
+    KokkosBlas::Experimental::reproducible_sum(r2_sum,x);
+    KokkosBlas::Experimental::reproducible_nrm2(r2_nrm2,x);
+    for(int k=0; k<K; k++) {
+      EXPECT_NEAR_KK( r2_dot(k), r_dot(k), eps*N );
+      EXPECT_NEAR_KK( r2_sum(k), r_sum(k), eps*N );
+      EXPECT_NEAR_KK( r2_nrm2(k), r_nrm2(k), eps*r_nrm2(k) );
+    }
+
+    // Every column gives the same result as the single vector version
+    for(int k=0; k<K; k++) {
+      auto x_k = Kokkos::subview(x,Kokkos::ALL(),k);
+      auto y_k = Kokkos::subview(y,Kokkos::ALL(),k);
+      EXPECT_TRUE( KokkosBlas::Experimental::reproducible_dot(x_k,y_k) == r2_dot(k) );
+      EXPECT_TRUE( KokkosBlas::Experimental::reproducible_sum(x_k) == r2_sum(k) );
+      EXPECT_TRUE( KokkosBlas::Experimental::reproducible_nrm2(x_k) == r2_nrm2(k) );
+    }
+
+    // A multivector with one column is combined with every column of the
+    // other operand, in either order, also through the global reduction mode
+    typename vfA_type::BaseType b_x1("X1",N,1);
+    ViewTypeA x1 = vfA_type::view(b_x1);
+    Kokkos::deep_copy(Kokkos::subview(x1,Kokkos::ALL(),0),Kokkos::subview(x,Kokkos::ALL(),0));
+    auto x1_0 = Kokkos::subview(x1,Kokkos::ALL(),0);
+
+    Kokkos::View<ScalarA*,Kokkos::HostSpace> r3_dot("Dot::Result",K);
+    Kokkos::View<ScalarA*,Kokkos::HostSpace> r4_dot("Dot::Result",K);
+    KokkosBlas::Experimental::reproducible_dot(r2_dot,x1,y);
+    KokkosBlas::Experimental::reproducible_dot(r3_dot,y,x1);
+    KokkosBlas::Experimental::set_reduction_mode(KokkosBlas::Experimental::REDUCTION_REPRODUCIBLE);
+    KokkosBlas::dot(r4_dot,x1,y);
+    KokkosBlas::Experimental::set_reduction_mode(KokkosBlas::Experimental::REDUCTION_DEFAULT);
+    for(int k=0; k<K; k++) {
+      auto y_k = Kokkos::subview(y,Kokkos::ALL(),k);
+      EXPECT_TRUE( KokkosBlas::Experimental::reproducible_dot(x1_0,y_k) == r2_dot(k) );
+      EXPECT_TRUE( KokkosBlas::Experimental::reproducible_dot(y_k,x1_0) == r3_dot(k) );
+      EXPECT_TRUE( r4_dot(k) == r2_dot(k) );
+    }
+  }
+}
+
+template<class ScalarA, class Device>
+int test_reproducible() {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA*, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  Test::impl_test_reproducible<view_type_a_ll, Device>(0);
+  Test::impl_test_reproducible<view_type_a_ll, Device>(13);
+  Test::impl_test_reproducible<view_type_a_ll, Device>(1024);
+  Test::impl_test_reproducible<view_type_a_ll, Device>(132231);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA*, Kokkos::LayoutRight, Device> view_type_a_lr;
+  Test::impl_test_reproducible<view_type_a_lr, Device>(0);
+  Test::impl_test_reproducible<view_type_a_lr, Device>(13);
+  Test::impl_test_reproducible<view_type_a_lr, Device>(1024);
+  Test::impl_test_reproducible<view_type_a_lr, Device>(132231);
+#endif
+  return 1;
+}
+
+template<class ScalarA, class Device>
+int test_reproducible_mv() {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  Test::impl_test_reproducible_mv<view_type_a_ll, Device>(0,5);
+  Test::impl_test_reproducible_mv<view_type_a_ll, Device>(13,5);
+  Test::impl_test_reproducible_mv<view_type_a_ll, Device>(1024,5);
+  Test::impl_test_reproducible_mv<view_type_a_ll, Device>(132231,5);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutRight, Device> view_type_a_lr;
+  Test::impl_test_reproducible_mv<view_type_a_lr, Device>(0,5);
+  Test::impl_test_reproducible_mv<view_type_a_lr, Device>(13,5);
+  Test::impl_test_reproducible_mv<view_type_a_lr, Device>(1024,5);
+  Test::impl_test_reproducible_mv<view_type_a_lr, Device>(132231,5);
+#endif
+  return 1;
+}
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, reproducible_double ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::reproducible_double");
+    test_reproducible<double,TestExecSpace> ();
+  Kokkos::Profiling::popRegion();
+}
+TEST_F( TestCategory, reproducible_mv_double ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::reproducible_mv_double");
+    test_reproducible_mv<double,TestExecSpace> ();
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, reproducible_complex_double ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::reproducible_complex_double");
+    test_reproducible<Kokkos::complex<double>,TestExecSpace> ();
+  Kokkos::Profiling::popRegion();
+}
+TEST_F( TestCategory, reproducible_mv_complex_double ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::reproducible_mv_complex_double");
+    test_reproducible_mv<Kokkos::complex<double>,TestExecSpace> ();
+  Kokkos::Profiling::popRegion();
+}
+#endif
@@ -0,0 +1,229 @@
+#include<gtest/gtest.h>
+#include<Kokkos_Core.hpp>
+#include<Kokkos_Random.hpp>
+#include<KokkosBlas1_rot.hpp>
+#include<KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+  // Check that the rotation computed by rotg maps (a,b) to (r,0).
+  template<class Scalar>
+  void impl_test_rotg(const Scalar a0, const Scalar b0) {
+    typedef Kokkos::Details::ArithTraits<Scalar> AT;
+    typedef typename AT::mag_type mag_type;
+    typedef Kokkos::Details::ArithTraits<mag_type> ATM;
+
+    const mag_type eps = 1e3*ATM::epsilon();
+    const mag_type scale = AT::abs(a0) + AT::abs(b0) + ATM::one();
+
+    Scalar a = a0, b = b0, s;
+    mag_type c;
+    KokkosBlas::rotg(a,b,c,s);
+
+    EXPECT_NEAR_KK( c*c + AT::abs(s)*AT::abs(s), ATM::one(), eps );
+    EXPECT_NEAR_KK( c*a0 + s*b0 - a, AT::zero(), eps*scale );
+    EXPECT_NEAR_KK( -AT::conj(s)*a0 + c*b0, AT::zero(), eps*scale );
+  }
+
+  // EXPECT_NEAR_KK compares magnitudes, so the complex checks below
+  // compare the difference against zero.
+  template<class ViewTypeA, class ViewTypeB, class Device>
+  void impl_test_rot(int N) {
+
+    typedef typename ViewTypeA::value_type ScalarA;
+    typedef typename ViewTypeB::value_type ScalarB;
+    typedef Kokkos::Details::ArithTraits<ScalarA> AT;
+    typedef typename AT::mag_type mag_type;
+
+    typedef Kokkos::View<ScalarA*[2],
+       typename std::conditional<
+                std::is_same<typename ViewTypeA::array_layout,Kokkos::LayoutStride>::value,
+                Kokkos::LayoutRight, Kokkos::LayoutLeft>::type,Device> BaseTypeA;
+    typedef Kokkos::View<ScalarB*[2],
+       typename std::conditional<
+                std::is_same<typename ViewTypeB::array_layout,Kokkos::LayoutStride>::value,
+                Kokkos::LayoutRight, Kokkos::LayoutLeft>::type,Device> BaseTypeB;
+
+    BaseTypeA b_x("X",N);
+    BaseTypeB b_y("Y",N);
+
+    ViewTypeA x = Kokkos::subview(b_x,Kokkos::ALL(),0);
+    ViewTypeB y = Kokkos::subview(b_y,Kokkos::ALL(),0);
+
+    typename BaseTypeA::HostMirror h_b_x = Kokkos::create_mirror(b_x);
+    typename BaseTypeB::HostMirror h_b_y = Kokkos::create_mirror(b_y);
+    typename BaseTypeA::HostMirror h_b_x_org = Kokkos::create_mirror(b_x);
+    typename BaseTypeB::HostMirror h_b_y_org = Kokkos::create_mirror(b_y);
+
+    Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+    Kokkos::fill_random(b_x,rand_pool,ScalarA(10));
+    Kokkos::fill_random(b_y,rand_pool,ScalarB(10));
+    Kokkos::deep_copy(h_b_x_org,b_x);
+    Kokkos::deep_copy(h_b_y_org,b_y);
+
+    // Use the rotation that zeroes the first entry of y
+    ScalarA a = N > 0 ? h_b_x_org(0,0) : ScalarA(3);
+    ScalarA b = N > 0 ? h_b_y_org(0,0) : ScalarA(4);
+    const ScalarA a0 = a, b0 = b;
+    mag_type c;
+    ScalarA s;
+    KokkosBlas::rotg(a,b,c,s);
+    impl_test_rotg(a0,b0);
+
+    const mag_type eps = 100*Kokkos::Details::ArithTraits<mag_type>::epsilon();
+
+    KokkosBlas::rot(x,y,c,s);
+    Kokkos::deep_copy(h_b_x,b_x);
+    Kokkos::deep_copy(h_b_y,b_y);
+    for(int i=0;i<N;i++) {
+      const ScalarA xi = h_b_x_org(i,0), yi = h_b_y_org(i,0);
+      EXPECT_NEAR_KK( h_b_x(i,0) - (c*xi + s*yi), AT::zero(), eps*(AT::abs(xi)+AT::abs(yi)) );
+      EXPECT_NEAR_KK( h_b_y(i,0) - (c*yi - AT::conj(s)*xi), AT::zero(), eps*(AT::abs(xi)+AT::abs(yi)) );
+      EXPECT_EQ( h_b_x(i,1), h_b_x_org(i,1) );
+      EXPECT_EQ( h_b_y(i,1), h_b_y_org(i,1) );
+    }
+    if(N > 0)
+      EXPECT_NEAR_KK( h_b_y(0,0), AT::zero(), eps*(AT::abs(a0)+AT::abs(b0)) );
+  }
+
+  template<class ViewTypeA, class ViewTypeB, class Device>
+  void impl_test_rot_mv(int N, int K) {
+
+    typedef typename ViewTypeA::value_type ScalarA;
+    typedef Kokkos::Details::ArithTraits<ScalarA> AT;
+    typedef typename AT::mag_type mag_type;
+
+    typedef multivector_layout_adapter<ViewTypeA> vfA_type;
+    typedef multivector_layout_adapter<ViewTypeB> vfB_type;
+
+    typename vfA_type::BaseType b_x("A",N,K);
+    typename vfB_type::BaseType b_y("B",N,K);
+
+    ViewTypeA x = vfA_type::view(b_x);
+    ViewTypeB y = vfB_type::view(b_y);
+
+    typedef multivector_layout_adapter<typename ViewTypeA::HostMirror> h_vfA_type;
+    typedef multivector_layout_adapter<typename ViewTypeB::HostMirror> h_vfB_type;
+
+    typename h_vfA_type::BaseType h_b_x = Kokkos::create_mirror(b_x);
+    typename h_vfB_type::BaseType h_b_y = Kokkos::create_mirror(b_y);
+    typename h_vfA_type::BaseType h_b_x_org = Kokkos::create_mirror(b_x);
+    typename h_vfB_type::BaseType h_b_y_org = Kokkos::create_mirror(b_y);
+
+    typename ViewTypeA::HostMirror h_x = h_vfA_type::view(h_b_x);
+    typename ViewTypeB::HostMirror h_y = h_vfB_type::view(h_b_y);
+    typename ViewTypeA::HostMirror h_x_org = h_vfA_type::view(h_b_x_org);
+    typename ViewTypeB::HostMirror h_y_org = h_vfB_type::view(h_b_y_org);
+
+    Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+    Kokkos::fill_random(b_x,rand_pool,ScalarA(10));
+    Kokkos::fill_random(b_y,rand_pool,typename ViewTypeB::value_type(10));
+    Kokkos::deep_copy(h_b_x_org,b_x);
+    Kokkos::deep_copy(h_b_y_org,b_y);
+
+    ScalarA a(3), b(4), s;
+    mag_type c;
+    KokkosBlas::rotg(a,b,c,s);
+
+    const mag_type eps = 100*Kokkos::Details::ArithTraits<mag_type>::epsilon();
+
+    KokkosBlas::rot(x,y,c,s);
+    Kokkos::deep_copy(h_b_x,b_x);
+    Kokkos::deep_copy(h_b_y,b_y);
+    for(int i=0;i<N;i++)
+      for(int j=0;j<K;j++) {
+        const ScalarA xi = h_x_org(i,j), yi = h_y_org(i,j);
+        EXPECT_NEAR_KK( h_x(i,j) - (c*xi + s*yi), AT::zero(), eps*(AT::abs(xi)+AT::abs(yi)) );
+        EXPECT_NEAR_KK( h_y(i,j) - (c*yi - AT::conj(s)*xi), AT::zero(), eps*(AT::abs(xi)+AT::abs(yi)) );
+      }
+  }
+}
+
+template<class ScalarA, class ScalarB, class Device>
+int test_rot() {
+
+  Test::impl_test_rotg<ScalarA>(ScalarA(3),ScalarA(4));
+  Test::impl_test_rotg<ScalarA>(ScalarA(-2),ScalarA(0));
+  Test::impl_test_rotg<ScalarA>(ScalarA(0),ScalarA(5));
+  Test::impl_test_rotg<ScalarA>(ScalarA(0),ScalarA(0));
+  Test::impl_test_rotg<ScalarA>(ScalarA(1e-3),ScalarA(-7e2));
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA*, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  typedef Kokkos::View<ScalarB*, Kokkos::LayoutLeft, Device> view_type_b_ll;
+  Test::impl_test_rot<view_type_a_ll, view_type_b_ll, Device>(0);
+  Test::impl_test_rot<view_type_a_ll, view_type_b_ll, Device>(13);
+  Test::impl_test_rot<view_type_a_ll, view_type_b_ll, Device>(1024);
+  Test::impl_test_rot<view_type_a_ll, view_type_b_ll, Device>(132231);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA*, Kokkos::LayoutRight, Device> view_type_a_lr;
+  typedef Kokkos::View<ScalarB*, Kokkos::LayoutRight, Device> view_type_b_lr;
+  Test::impl_test_rot<view_type_a_lr, view_type_b_lr, Device>(0);
+  Test::impl_test_rot<view_type_a_lr, view_type_b_lr, Device>(13);
+  Test::impl_test_rot<view_type_a_lr, view_type_b_lr, Device>(1024);
+  Test::impl_test_rot<view_type_a_lr, view_type_b_lr, Device>(132231);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTSTRIDE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA*, Kokkos::LayoutStride, Device> view_type_a_ls;
+  typedef Kokkos::View<ScalarB*, Kokkos::LayoutStride, Device> view_type_b_ls;
+  Test::impl_test_rot<view_type_a_ls, view_type_b_ls, Device>(0);
+  Test::impl_test_rot<view_type_a_ls, view_type_b_ls, Device>(13);
+  Test::impl_test_rot<view_type_a_ls, view_type_b_ls, Device>(1024);
+  Test::impl_test_rot<view_type_a_ls, view_type_b_ls, Device>(132231);
+#endif
+
+  return 1;
+}
+
+template<class ScalarA, class ScalarB, class Device>
+int test_rot_mv() {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  typedef Kokkos::View<ScalarB**, Kokkos::LayoutLeft, Device> view_type_b_ll;
+  Test::impl_test_rot_mv<view_type_a_ll, view_type_b_ll, Device>(0,5);
+  Test::impl_test_rot_mv<view_type_a_ll, view_type_b_ll, Device>(13,5);
+  Test::impl_test_rot_mv<view_type_a_ll, view_type_b_ll, Device>(1024,5);
+  Test::impl_test_rot_mv<view_type_a_ll, view_type_b_ll, Device>(132231,5);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutRight, Device> view_type_a_lr;
+  typedef Kokkos::View<ScalarB**, Kokkos::LayoutRight, Device> view_type_b_lr;
+  Test::impl_test_rot_mv<view_type_a_lr, view_type_b_lr, Device>(0,5);
+  Test::impl_test_rot_mv<view_type_a_lr, view_type_b_lr, Device>(13,5);
+  Test::impl_test_rot_mv<view_type_a_lr, view_type_b_lr, Device>(1024,5);
+  Test::impl_test_rot_mv<view_type_a_lr, view_type_b_lr, Device>(132231,5);
+#endif
+
+  return 1;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, rot_float ) {
+    test_rot<float,float,TestExecSpace> ();
+}
+TEST_F( TestCategory, rot_mv_float ) {
+    test_rot_mv<float,float,TestExecSpace> ();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, rot_double ) {
+    test_rot<double,double,TestExecSpace> ();
+}
+TEST_F( TestCategory, rot_mv_double ) {
+    test_rot_mv<double,double,TestExecSpace> ();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, rot_complex_double ) {
+    test_rot<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ();
+}
+TEST_F( TestCategory, rot_mv_complex_double ) {
+    test_rot_mv<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ();
+}
+#endif
@@ -0,0 +1,188 @@
+#include<gtest/gtest.h>
+#include<Kokkos_Core.hpp>
+#include<Kokkos_Random.hpp>
+#include<KokkosBlas1_swap.hpp>
+#include<KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+  template<class ViewTypeA, class ViewTypeB, class Device>
+  void impl_test_swap(int N) {
+
+    typedef typename ViewTypeA::value_type ScalarA;
+    typedef typename ViewTypeB::value_type ScalarB;
+
+    typedef Kokkos::View<ScalarA*[2],
+       typename std::conditional<
+                std::is_same<typename ViewTypeA::array_layout,Kokkos::LayoutStride>::value,
+                Kokkos::LayoutRight, Kokkos::LayoutLeft>::type,Device> BaseTypeA;
+    typedef Kokkos::View<ScalarB*[2],
+       typename std::conditional<
+                std::is_same<typename ViewTypeB::array_layout,Kokkos::LayoutStride>::value,
+                Kokkos::LayoutRight, Kokkos::LayoutLeft>::type,Device> BaseTypeB;
+
+    BaseTypeA b_x("X",N);
+    BaseTypeB b_y("Y",N);
+
+    ViewTypeA x = Kokkos::subview(b_x,Kokkos::ALL(),0);
+    ViewTypeB y = Kokkos::subview(b_y,Kokkos::ALL(),0);
+
+    // create_mirror (not _view): the originals must survive the swap
+    typename BaseTypeA::HostMirror h_b_x = Kokkos::create_mirror(b_x);
+    typename BaseTypeB::HostMirror h_b_y = Kokkos::create_mirror(b_y);
+    typename BaseTypeA::HostMirror h_b_x_org = Kokkos::create_mirror(b_x);
+    typename BaseTypeB::HostMirror h_b_y_org = Kokkos::create_mirror(b_y);
+
+    Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+    Kokkos::fill_random(b_x,rand_pool,ScalarA(10));
+    Kokkos::fill_random(b_y,rand_pool,ScalarB(10));
+    Kokkos::deep_copy(h_b_x_org,b_x);
+    Kokkos::deep_copy(h_b_y_org,b_y);
+
+    KokkosBlas::swap(x,y);
+    Kokkos::deep_copy(h_b_x,b_x);
+    Kokkos::deep_copy(h_b_y,b_y);
+    for(int i=0;i<N;i++) {
+      EXPECT_EQ( h_b_x(i,0), h_b_y_org(i,0) );
+      EXPECT_EQ( h_b_y(i,0), h_b_x_org(i,0) );
+      // the second column must be left alone
+      EXPECT_EQ( h_b_x(i,1), h_b_x_org(i,1) );
+      EXPECT_EQ( h_b_y(i,1), h_b_y_org(i,1) );
+    }
+
+    // Swapping a vector with itself is a no-op
+    KokkosBlas::swap(x,x);
+    Kokkos::deep_copy(h_b_x,b_x);
+    for(int i=0;i<N;i++)
+      EXPECT_EQ( h_b_x(i,0), h_b_y_org(i,0) );
+  }
+
+  template<class ViewTypeA, class ViewTypeB, class Device>
+  void impl_test_swap_mv(int N, int K) {
+
+    typedef multivector_layout_adapter<ViewTypeA> vfA_type;
+    typedef multivector_layout_adapter<ViewTypeB> vfB_type;
+
+    typename vfA_type::BaseType b_x("A",N,K);
+    typename vfB_type::BaseType b_y("B",N,K);
+
+    ViewTypeA x = vfA_type::view(b_x);
+    ViewTypeB y = vfB_type::view(b_y);
+
+    typedef multivector_layout_adapter<typename ViewTypeA::HostMirror> h_vfA_type;
+    typedef multivector_layout_adapter<typename ViewTypeB::HostMirror> h_vfB_type;
+
+    typename h_vfA_type::BaseType h_b_x = Kokkos::create_mirror(b_x);
+    typename h_vfB_type::BaseType h_b_y = Kokkos::create_mirror(b_y);
+    typename h_vfA_type::BaseType h_b_x_org = Kokkos::create_mirror(b_x);
+    typename h_vfB_type::BaseType h_b_y_org = Kokkos::create_mirror(b_y);
+
+    typename ViewTypeA::HostMirror h_x = h_vfA_type::view(h_b_x);
+    typename ViewTypeB::HostMirror h_y = h_vfB_type::view(h_b_y);
+    typename ViewTypeA::HostMirror h_x_org = h_vfA_type::view(h_b_x_org);
+    typename ViewTypeB::HostMirror h_y_org = h_vfB_type::view(h_b_y_org);
+
+    Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+    Kokkos::fill_random(b_x,rand_pool,typename ViewTypeA::value_type(10));
+    Kokkos::fill_random(b_y,rand_pool,typename ViewTypeB::value_type(10));
+    Kokkos::deep_copy(h_b_x_org,b_x);
+    Kokkos::deep_copy(h_b_y_org,b_y);
+
+    KokkosBlas::swap(x,y);
+    Kokkos::deep_copy(h_b_x,b_x);
+    Kokkos::deep_copy(h_b_y,b_y);
+    for(int i=0;i<N;i++)
+      for(int j=0;j<K;j++) {
+        EXPECT_EQ( h_x(i,j), h_y_org(i,j) );
+        EXPECT_EQ( h_y(i,j), h_x_org(i,j) );
+      }
+  }
+}
+
+template<class ScalarA, class ScalarB, class Device>
+int test_swap() {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA*, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  typedef Kokkos::View<ScalarB*, Kokkos::LayoutLeft, Device> view_type_b_ll;
+  Test::impl_test_swap<view_type_a_ll, view_type_b_ll, Device>(0);
+  Test::impl_test_swap<view_type_a_ll, view_type_b_ll, Device>(13);
+  Test::impl_test_swap<view_type_a_ll, view_type_b_ll, Device>(1024);
+  Test::impl_test_swap<view_type_a_ll, view_type_b_ll, Device>(132231);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA*, Kokkos::LayoutRight, Device> view_type_a_lr;
+  typedef Kokkos::View<ScalarB*, Kokkos::LayoutRight, Device> view_type_b_lr;
+  Test::impl_test_swap<view_type_a_lr, view_type_b_lr, Device>(0);
+  Test::impl_test_swap<view_type_a_lr, view_type_b_lr, Device>(13);
+  Test::impl_test_swap<view_type_a_lr, view_type_b_lr, Device>(1024);
+  Test::impl_test_swap<view_type_a_lr, view_type_b_lr, Device>(132231);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTSTRIDE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA*, Kokkos::LayoutStride, Device> view_type_a_ls;
+  typedef Kokkos::View<ScalarB*, Kokkos::LayoutStride, Device> view_type_b_ls;
+  Test::impl_test_swap<view_type_a_ls, view_type_b_ls, Device>(0);
+  Test::impl_test_swap<view_type_a_ls, view_type_b_ls, Device>(13);
+  Test::impl_test_swap<view_type_a_ls, view_type_b_ls, Device>(1024);
+  Test::impl_test_swap<view_type_a_ls, view_type_b_ls, Device>(132231);
+#endif
+
+#if !defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS)
+  Test::impl_test_swap<view_type_a_ls, view_type_b_ll, Device>(1024);
+  Test::impl_test_swap<view_type_a_ll, view_type_b_ls, Device>(1024);
+#endif
+
+  return 1;
+}
+
+template<class ScalarA, class ScalarB, class Device>
+int test_swap_mv() {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  typedef Kokkos::View<ScalarB**, Kokkos::LayoutLeft, Device> view_type_b_ll;
+  Test::impl_test_swap_mv<view_type_a_ll, view_type_b_ll, Device>(0,5);
+  Test::impl_test_swap_mv<view_type_a_ll, view_type_b_ll, Device>(13,5);
+  Test::impl_test_swap_mv<view_type_a_ll, view_type_b_ll, Device>(1024,5);
+  Test::impl_test_swap_mv<view_type_a_ll, view_type_b_ll, Device>(132231,5);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutRight, Device> view_type_a_lr;
+  typedef Kokkos::View<ScalarB**, Kokkos::LayoutRight, Device> view_type_b_lr;
+  Test::impl_test_swap_mv<view_type_a_lr, view_type_b_lr, Device>(0,5);
+  Test::impl_test_swap_mv<view_type_a_lr, view_type_b_lr, Device>(13,5);
+  Test::impl_test_swap_mv<view_type_a_lr, view_type_b_lr, Device>(1024,5);
+  Test::impl_test_swap_mv<view_type_a_lr, view_type_b_lr, Device>(132231,5);
+#endif
+
+  return 1;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, swap_float ) {
+    test_swap<float,float,TestExecSpace> ();
+}
+TEST_F( TestCategory, swap_mv_float ) {
+    test_swap_mv<float,float,TestExecSpace> ();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, swap_double ) {
+    test_swap<double,double,TestExecSpace> ();
+}
+TEST_F( TestCategory, swap_mv_double ) {
+    test_swap_mv<double,double,TestExecSpace> ();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, swap_complex_double ) {
+    test_swap<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ();
+}
+TEST_F( TestCategory, swap_mv_complex_double ) {
+    test_swap_mv<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ();
+}
+#endif
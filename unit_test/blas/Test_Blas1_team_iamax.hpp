@@ -0,0 +1,282 @@
+#include<gtest/gtest.h>
+#include<Kokkos_Core.hpp>
+#include<Kokkos_Random.hpp>
+#include<KokkosBlas1_team_iamax.hpp>
+#include<KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+  // Reference BLAS i?amax on h_x(begin:end): 1-based index of the first
+  // entry with the extreme magnitude |Re(x)| + |Im(x)|, 0 if empty.
+  // Comparisons with NaN are false, so a NaN first entry is kept and
+  // later NaN entries are skipped.
+  template<class ViewType>
+  size_t team_iamax_ref(const ViewType& h_x, int begin, int end, bool find_max) {
+    typedef typename ViewType::non_const_value_type Scalar;
+    typedef Kokkos::Details::ArithTraits<Scalar> AT;
+    typedef Kokkos::Details::ArithTraits<typename AT::mag_type> ATM;
+    if(end <= begin) return 0;
+    size_t idx = 1;
+    auto best = ATM::abs(AT::real(h_x(begin))) + ATM::abs(AT::imag(h_x(begin)));
+    for(int i=begin+1; i<end; i++) {
+      const auto val = ATM::abs(AT::real(h_x(i))) + ATM::abs(AT::imag(h_x(i)));
+      if(find_max ? val > best : val < best) {
+        best = val;
+        idx = i-begin+1;
+      }
+    }
+    return idx;
+  }
+
+  // iamax and iamin of the M chunks of x, one team per chunk
+  template<class ViewTypeA, class Device>
+  void team_iamax_run(const ViewTypeA& x, const int M,
+                      const Kokkos::View<typename ViewTypeA::size_type**,Device>& d_r) {
+    typedef Kokkos::TeamPolicy<Device>        team_policy ;
+    typedef typename team_policy::member_type team_member ;
+    typedef typename ViewTypeA::size_type size_type;
+
+    const int N = x.extent(0);
+    const team_policy policy( M, Kokkos::AUTO );
+    const int team_data_siz = (N%M == 0)?(N/M):(N/M+1);
+    typename ViewTypeA::const_type c_x = x;
+
+    Kokkos::parallel_for( policy, KOKKOS_LAMBDA ( const team_member &teamMember ) {
+       const int teamId = teamMember.league_rank();
+       const size_type imax = KokkosBlas::Experimental::iamax(teamMember, Kokkos::subview(x,Kokkos::make_pair(teamId*team_data_siz,(teamId < M-1)?(teamId+1)*team_data_siz:N)));
+       const size_type imin = KokkosBlas::Experimental::iamin(teamMember, Kokkos::subview(c_x,Kokkos::make_pair(teamId*team_data_siz,(teamId < M-1)?(teamId+1)*team_data_siz:N)));
+       Kokkos::single(Kokkos::PerTeam(teamMember), [&] () {
+         d_r(teamId,0) = imax;
+         d_r(teamId,1) = imin;
+       });
+    } );
+  }
+
+  template<class ViewTypeA, class Device>
+  void impl_test_team_iamax(int N) {
+
+    typedef typename ViewTypeA::value_type ScalarA;
+    typedef typename ViewTypeA::size_type size_type;
+
+    //Launch M teams of the maximum number of threads per team
+    const int M = 4;
+    const int team_data_siz = (N%M == 0)?(N/M):(N/M+1);
+
+    typedef Kokkos::View<ScalarA*[2],
+       typename std::conditional<
+                std::is_same<typename ViewTypeA::array_layout,Kokkos::LayoutStride>::value,
+                Kokkos::LayoutRight, Kokkos::LayoutLeft>::type,Device> BaseTypeA;
+
+    BaseTypeA b_x("X",N);
+    ViewTypeA x = Kokkos::subview(b_x,Kokkos::ALL(),0);
+
+    typename BaseTypeA::HostMirror h_b_x = Kokkos::create_mirror_view(b_x);
+    typename ViewTypeA::HostMirror h_x = Kokkos::subview(h_b_x,Kokkos::ALL(),0);
+
+    Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+    Kokkos::fill_random(b_x,rand_pool,ScalarA(1));
+    Kokkos::deep_copy(h_b_x,b_x);
+
+    // Two entries with the largest and two with the smallest magnitude in
+    // every chunk, so that the "first index" tie rule is exercised
+    for(int k=0; k<M; k++) {
+      const int begin = k*team_data_siz < N ? k*team_data_siz : N;
+      const int end = (k < M-1 && (k+1)*team_data_siz < N) ? (k+1)*team_data_siz : N;
+      const int L = end-begin;
+      if(L < 8) continue;
+      h_x(begin+L/3) = ScalarA(-10);
+      h_x(begin+2*L/3) = ScalarA(10);
+      h_x(begin+L/5) = ScalarA(0);
+      h_x(begin+L/2) = ScalarA(0);
+    }
+    Kokkos::deep_copy(b_x,h_b_x);
+
+    Kokkos::View<size_type**,Device> d_r("TeamIamax::Result",M,2);
+    team_iamax_run<ViewTypeA,Device>(x,M,d_r);
+    typename Kokkos::View<size_type**,Device>::HostMirror h_r = Kokkos::create_mirror_view(d_r);
+    Kokkos::deep_copy(h_r,d_r);
+
+    for(int k=0; k<M; k++) {
+      const int begin = k*team_data_siz < N ? k*team_data_siz : N;
+      const int end = (k < M-1 && (k+1)*team_data_siz < N) ? (k+1)*team_data_siz : N;
+      EXPECT_EQ( h_r(k,0), team_iamax_ref(h_x,begin,end,true) );
+      EXPECT_EQ( h_r(k,1), team_iamax_ref(h_x,begin,end,false) );
+    }
+  }
+
+  // A NaN first entry is returned, later NaN entries are skipped, and a
+  // vector of NaNs gives 1, as in reference BLAS.
+  template<class ViewTypeA, class Device>
+  void impl_test_team_iamax_nan(int N) {
+
+    typedef typename ViewTypeA::value_type ScalarA;
+    typedef typename ViewTypeA::size_type size_type;
+    typedef typename Kokkos::Details::ArithTraits<ScalarA>::mag_type mag_type;
+
+    const ScalarA nan = ScalarA(Kokkos::Details::ArithTraits<mag_type>::nan());
+
+    ViewTypeA x("X",N);
+    typename ViewTypeA::HostMirror h_x = Kokkos::create_mirror_view(x);
+    typename ViewTypeA::HostMirror h_x_org = Kokkos::create_mirror(x);
+
+    Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+    Kokkos::fill_random(x,rand_pool,ScalarA(1));
+    Kokkos::deep_copy(h_x_org,x);
+
+    Kokkos::View<size_type**,Device> d_r("TeamIamax::Result",1,2);
+    typename Kokkos::View<size_type**,Device>::HostMirror h_r = Kokkos::create_mirror_view(d_r);
+
+    for(int test=0; test<3; test++) {
+      Kokkos::deep_copy(h_x,h_x_org);
+      if(test == 0) h_x(0) = nan;
+      if(test == 1) { h_x(N/2) = nan; h_x(N-1) = nan; }
+      if(test == 2) Kokkos::deep_copy(h_x,nan);
+      Kokkos::deep_copy(x,h_x);
+
+      team_iamax_run<ViewTypeA,Device>(x,1,d_r);
+      Kokkos::deep_copy(h_r,d_r);
+
+      EXPECT_EQ( h_r(0,0), team_iamax_ref(h_x,0,N,true) );
+      EXPECT_EQ( h_r(0,1), team_iamax_ref(h_x,0,N,false) );
+      if(test != 1) {
+        EXPECT_EQ( h_r(0,0), size_type(1) );
+        EXPECT_EQ( h_r(0,1), size_type(1) );
+      }
+    }
+  }
+
+  template<class ViewTypeA, class Device>
+  void impl_test_team_iamax_mv(int N, int K) {
+
+    typedef Kokkos::TeamPolicy<Device>        team_policy ;
+    typedef typename team_policy::member_type team_member ;
+
+    //Launch K teams of the maximum number of threads per team
+    const team_policy policy( K, Kokkos::AUTO );
+
+    typedef typename ViewTypeA::size_type size_type;
+    typedef typename ViewTypeA::value_type ScalarA;
+
+    typedef multivector_layout_adapter<ViewTypeA> vfA_type;
+
+    typename vfA_type::BaseType b_x("A",N,K);
+
+    ViewTypeA x = vfA_type::view(b_x);
+
+    typedef multivector_layout_adapter<typename ViewTypeA::HostMirror> h_vfA_type;
+
+    typename h_vfA_type::BaseType h_b_x = Kokkos::create_mirror_view(b_x);
+
+    typename ViewTypeA::HostMirror h_x = h_vfA_type::view(h_b_x);
+
+    Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+    Kokkos::fill_random(b_x,rand_pool,ScalarA(1));
+    Kokkos::deep_copy(h_b_x,b_x);
+    if(N >= 8)
+      for(int j=0; j<K; j++) {
+        h_x((N/3+j)%N,j) = ScalarA(-10);
+        h_x((2*N/3+j)%N,j) = ScalarA(10);
+        h_x((N/5+j)%N,j) = ScalarA(0);
+        h_x((N/2+j)%N,j) = ScalarA(0);
+      }
+    Kokkos::deep_copy(b_x,h_b_x);
+
+    // One team per column; for LayoutRight the columns are strided
+    Kokkos::View<size_type**,Device> d_r("TeamIamax::Result",K,2);
+    Kokkos::parallel_for( policy, KOKKOS_LAMBDA ( const team_member &teamMember ) {
+       const int teamId = teamMember.league_rank();
+       const size_type imax = KokkosBlas::Experimental::iamax(teamMember, Kokkos::subview(x,Kokkos::ALL(),teamId));
+       const size_type imin = KokkosBlas::Experimental::iamin(teamMember, Kokkos::subview(x,Kokkos::ALL(),teamId));
+       Kokkos::single(Kokkos::PerTeam(teamMember), [&] () {
+         d_r(teamId,0) = imax;
+         d_r(teamId,1) = imin;
+       });
+    } );
+    typename Kokkos::View<size_type**,Device>::HostMirror h_r = Kokkos::create_mirror_view(d_r);
+    Kokkos::deep_copy(h_r,d_r);
+    for(int j=0; j<K; j++) {
+      auto h_x_j = Kokkos::subview(h_x,Kokkos::ALL(),j);
+      EXPECT_EQ( h_r(j,0), team_iamax_ref(h_x_j,0,N,true) );
+      EXPECT_EQ( h_r(j,1), team_iamax_ref(h_x_j,0,N,false) );
+    }
+  }
+}
+
+template<class ScalarA, class Device>
+int test_team_iamax() {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA*, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  Test::impl_test_team_iamax<view_type_a_ll, Device>(0);
+  Test::impl_test_team_iamax<view_type_a_ll, Device>(13);
+  Test::impl_test_team_iamax<view_type_a_ll, Device>(1024);
+  Test::impl_test_team_iamax<view_type_a_ll, Device>(132231);
+  Test::impl_test_team_iamax_nan<view_type_a_ll, Device>(1024);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA*, Kokkos::LayoutRight, Device> view_type_a_lr;
+  Test::impl_test_team_iamax<view_type_a_lr, Device>(0);
+  Test::impl_test_team_iamax<view_type_a_lr, Device>(13);
+  Test::impl_test_team_iamax<view_type_a_lr, Device>(1024);
+  Test::impl_test_team_iamax<view_type_a_lr, Device>(132231);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTSTRIDE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA*, Kokkos::LayoutStride, Device> view_type_a_ls;
+  Test::impl_test_team_iamax<view_type_a_ls, Device>(0);
+  Test::impl_test_team_iamax<view_type_a_ls, Device>(13);
+  Test::impl_test_team_iamax<view_type_a_ls, Device>(1024);
+  Test::impl_test_team_iamax<view_type_a_ls, Device>(132231);
+#endif
+
+  return 1;
+}
+
+template<class ScalarA, class Device>
+int test_team_iamax_mv() {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  Test::impl_test_team_iamax_mv<view_type_a_ll, Device>(0,5);
+  Test::impl_test_team_iamax_mv<view_type_a_ll, Device>(13,5);
+  Test::impl_test_team_iamax_mv<view_type_a_ll, Device>(1024,5);
+  Test::impl_test_team_iamax_mv<view_type_a_ll, Device>(132231,5);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutRight, Device> view_type_a_lr;
+  Test::impl_test_team_iamax_mv<view_type_a_lr, Device>(0,5);
+  Test::impl_test_team_iamax_mv<view_type_a_lr, Device>(13,5);
+  Test::impl_test_team_iamax_mv<view_type_a_lr, Device>(1024,5);
+  Test::impl_test_team_iamax_mv<view_type_a_lr, Device>(132231,5);
+#endif
+
+  return 1;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, team_iamax_float ) {
+    test_team_iamax<float,TestExecSpace> ();
+}
+TEST_F( TestCategory, team_iamax_mv_float ) {
+    test_team_iamax_mv<float,TestExecSpace> ();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, team_iamax_double ) {
+    test_team_iamax<double,TestExecSpace> ();
+}
+TEST_F( TestCategory, team_iamax_mv_double ) {
+    test_team_iamax_mv<double,TestExecSpace> ();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, team_iamax_complex_double ) {
+    test_team_iamax<Kokkos::complex<double>,TestExecSpace> ();
+}
+TEST_F( TestCategory, team_iamax_mv_complex_double ) {
+    test_team_iamax_mv<Kokkos::complex<double>,TestExecSpace> ();
+}
+#endif
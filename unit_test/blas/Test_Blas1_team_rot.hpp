@@ -0,0 +1,242 @@
+#include<gtest/gtest.h>
+#include<Kokkos_Core.hpp>
+#include<Kokkos_Random.hpp>
+#include<KokkosBlas1_rot.hpp>
+#include<KokkosBlas1_team_rot.hpp>
+#include<KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+  // The team rotation must agree with KokkosBlas::rot applied to a copy
+  // of the same data.  EXPECT_NEAR_KK compares magnitudes, so the complex
+  // checks compare the difference against zero.
+  template<class ViewTypeA, class ViewTypeB, class Device>
+  void impl_test_team_rot(int N) {
+
+    typedef Kokkos::TeamPolicy<Device>        team_policy ;
+    typedef typename team_policy::member_type team_member ;
+
+    //Launch M teams of the maximum number of threads per team
+    int M = 4;
+    const team_policy policy( M, Kokkos::AUTO );
+    const int team_data_siz = (N%M == 0)?(N/M):(N/M+1);
+
+    typedef typename ViewTypeA::value_type ScalarA;
+    typedef typename ViewTypeB::value_type ScalarB;
+    typedef Kokkos::Details::ArithTraits<ScalarA> AT;
+    typedef typename AT::mag_type mag_type;
+
+    typedef Kokkos::View<ScalarA*[2],
+       typename std::conditional<
+                std::is_same<typename ViewTypeA::array_layout,Kokkos::LayoutStride>::value,
+                Kokkos::LayoutRight, Kokkos::LayoutLeft>::type,Device> BaseTypeA;
+    typedef Kokkos::View<ScalarB*[2],
+       typename std::conditional<
+                std::is_same<typename ViewTypeB::array_layout,Kokkos::LayoutStride>::value,
+                Kokkos::LayoutRight, Kokkos::LayoutLeft>::type,Device> BaseTypeB;
+
+    BaseTypeA b_x("X",N), b_x_ref("X_ref",N);
+    BaseTypeB b_y("Y",N), b_y_ref("Y_ref",N);
+
+    ViewTypeA x = Kokkos::subview(b_x,Kokkos::ALL(),0);
+    ViewTypeB y = Kokkos::subview(b_y,Kokkos::ALL(),0);
+    ViewTypeA x_ref = Kokkos::subview(b_x_ref,Kokkos::ALL(),0);
+    ViewTypeB y_ref = Kokkos::subview(b_y_ref,Kokkos::ALL(),0);
+
+    typename BaseTypeA::HostMirror h_b_x = Kokkos::create_mirror(b_x);
+    typename BaseTypeB::HostMirror h_b_y = Kokkos::create_mirror(b_y);
+    typename BaseTypeA::HostMirror h_b_x_ref = Kokkos::create_mirror(b_x);
+    typename BaseTypeB::HostMirror h_b_y_ref = Kokkos::create_mirror(b_y);
+
+    Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+    Kokkos::fill_random(b_x,rand_pool,ScalarA(10));
+    Kokkos::fill_random(b_y,rand_pool,ScalarB(10));
+    Kokkos::deep_copy(b_x_ref,b_x);
+    Kokkos::deep_copy(b_y_ref,b_y);
+
+    // Use the rotation that zeroes the first entry of y
+    Kokkos::deep_copy(h_b_x,b_x);
+    Kokkos::deep_copy(h_b_y,b_y);
+    ScalarA a = N > 0 ? h_b_x(0,0) : ScalarA(3);
+    ScalarA b = N > 0 ? h_b_y(0,0) : ScalarA(4);
+    mag_type c;
+    ScalarA s;
+    KokkosBlas::rotg(a,b,c,s);
+
+    KokkosBlas::rot(x_ref,y_ref,c,s);
+
+    Kokkos::parallel_for( policy, KOKKOS_LAMBDA ( const team_member &teamMember ) {
+       const int teamId = teamMember.league_rank();
+       KokkosBlas::Experimental::rot(teamMember, Kokkos::subview(x,Kokkos::make_pair(teamId*team_data_siz,(teamId < M-1)?(teamId+1)*team_data_siz:N)), Kokkos::subview(y,Kokkos::make_pair(teamId*team_data_siz,(teamId < M-1)?(teamId+1)*team_data_siz:N)), c, s);
+    } );
+
+    Kokkos::deep_copy(h_b_x,b_x);
+    Kokkos::deep_copy(h_b_y,b_y);
+    Kokkos::deep_copy(h_b_x_ref,b_x_ref);
+    Kokkos::deep_copy(h_b_y_ref,b_y_ref);
+
+    const mag_type eps = 10*Kokkos::Details::ArithTraits<mag_type>::epsilon();
+    for(int i=0;i<N;i++) {
+      const mag_type scale = AT::abs(h_b_x_ref(i,0))+AT::abs(h_b_y_ref(i,0))+1;
+      EXPECT_NEAR_KK( h_b_x(i,0) - h_b_x_ref(i,0), AT::zero(), eps*scale );
+      EXPECT_NEAR_KK( h_b_y(i,0) - h_b_y_ref(i,0), AT::zero(), eps*scale );
+      EXPECT_EQ( h_b_x(i,1), h_b_x_ref(i,1) );
+      EXPECT_EQ( h_b_y(i,1), h_b_y_ref(i,1) );
+    }
+  }
+
+  template<class ViewTypeA, class ViewTypeB, class Device>
+  void impl_test_team_rot_mv(int N, int K) {
+
+    typedef Kokkos::TeamPolicy<Device>        team_policy ;
+    typedef typename team_policy::member_type team_member ;
+
+    //Launch K teams of the maximum number of threads per team
+    const team_policy policy( K, Kokkos::AUTO );
+
+    typedef typename ViewTypeA::value_type ScalarA;
+    typedef Kokkos::Details::ArithTraits<ScalarA> AT;
+    typedef typename AT::mag_type mag_type;
+
+    typedef multivector_layout_adapter<ViewTypeA> vfA_type;
+    typedef multivector_layout_adapter<ViewTypeB> vfB_type;
+
+    typename vfA_type::BaseType b_x("A",N,K), b_x_ref("A_ref",N,K);
+    typename vfB_type::BaseType b_y("B",N,K), b_y_ref("B_ref",N,K);
+
+    ViewTypeA x = vfA_type::view(b_x);
+    ViewTypeB y = vfB_type::view(b_y);
+    ViewTypeA x_ref = vfA_type::view(b_x_ref);
+    ViewTypeB y_ref = vfB_type::view(b_y_ref);
+
+    typedef multivector_layout_adapter<typename ViewTypeA::HostMirror> h_vfA_type;
+    typedef multivector_layout_adapter<typename ViewTypeB::HostMirror> h_vfB_type;
+
+    typename h_vfA_type::BaseType h_b_x = Kokkos::create_mirror(b_x);
+    typename h_vfB_type::BaseType h_b_y = Kokkos::create_mirror(b_y);
+    typename h_vfA_type::BaseType h_b_x_ref = Kokkos::create_mirror(b_x);
+    typename h_vfB_type::BaseType h_b_y_ref = Kokkos::create_mirror(b_y);
+
+    typename ViewTypeA::HostMirror h_x = h_vfA_type::view(h_b_x);
+    typename ViewTypeB::HostMirror h_y = h_vfB_type::view(h_b_y);
+    typename ViewTypeA::HostMirror h_x_ref = h_vfA_type::view(h_b_x_ref);
+    typename ViewTypeB::HostMirror h_y_ref = h_vfB_type::view(h_b_y_ref);
+
+    Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+    Kokkos::fill_random(b_x,rand_pool,ScalarA(10));
+    Kokkos::fill_random(b_y,rand_pool,typename ViewTypeB::value_type(10));
+    Kokkos::deep_copy(b_x_ref,b_x);
+    Kokkos::deep_copy(b_y_ref,b_y);
+
+    ScalarA a(3), b(4), s;
+    mag_type c;
+    KokkosBlas::rotg(a,b,c,s);
+
+    KokkosBlas::rot(x_ref,y_ref,c,s);
+
+    // One team per column; for LayoutRight the columns are strided
+    Kokkos::parallel_for( policy, KOKKOS_LAMBDA ( const team_member &teamMember ) {
+       const int teamId = teamMember.league_rank();
+       KokkosBlas::Experimental::rot(teamMember,
+                                     Kokkos::subview(x,Kokkos::ALL(),teamId),
+                                     Kokkos::subview(y,Kokkos::ALL(),teamId),
+                                     c, s);
+    } );
+
+    Kokkos::deep_copy(h_b_x,b_x);
+    Kokkos::deep_copy(h_b_y,b_y);
+    Kokkos::deep_copy(h_b_x_ref,b_x_ref);
+    Kokkos::deep_copy(h_b_y_ref,b_y_ref);
+
+    const mag_type eps = 10*Kokkos::Details::ArithTraits<mag_type>::epsilon();
+    for(int i=0;i<N;i++)
+      for(int j=0;j<K;j++) {
+        const mag_type scale = AT::abs(h_x_ref(i,j))+AT::abs(h_y_ref(i,j))+1;
+        EXPECT_NEAR_KK( h_x(i,j) - h_x_ref(i,j), AT::zero(), eps*scale );
+        EXPECT_NEAR_KK( h_y(i,j) - h_y_ref(i,j), AT::zero(), eps*scale );
+      }
+  }
+}
+
+template<class ScalarA, class ScalarB, class Device>
+int test_team_rot() {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA*, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  typedef Kokkos::View<ScalarB*, Kokkos::LayoutLeft, Device> view_type_b_ll;
+  Test::impl_test_team_rot<view_type_a_ll, view_type_b_ll, Device>(0);
+  Test::impl_test_team_rot<view_type_a_ll, view_type_b_ll, Device>(13);
+  Test::impl_test_team_rot<view_type_a_ll, view_type_b_ll, Device>(1024);
+  Test::impl_test_team_rot<view_type_a_ll, view_type_b_ll, Device>(132231);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA*, Kokkos::LayoutRight, Device> view_type_a_lr;
+  typedef Kokkos::View<ScalarB*, Kokkos::LayoutRight, Device> view_type_b_lr;
+  Test::impl_test_team_rot<view_type_a_lr, view_type_b_lr, Device>(0);
+  Test::impl_test_team_rot<view_type_a_lr, view_type_b_lr, Device>(13);
+  Test::impl_test_team_rot<view_type_a_lr, view_type_b_lr, Device>(1024);
+  Test::impl_test_team_rot<view_type_a_lr, view_type_b_lr, Device>(132231);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTSTRIDE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA*, Kokkos::LayoutStride, Device> view_type_a_ls;
+  typedef Kokkos::View<ScalarB*, Kokkos::LayoutStride, Device> view_type_b_ls;
+  Test::impl_test_team_rot<view_type_a_ls, view_type_b_ls, Device>(0);
+  Test::impl_test_team_rot<view_type_a_ls, view_type_b_ls, Device>(13);
+  Test::impl_test_team_rot<view_type_a_ls, view_type_b_ls, Device>(1024);
+  Test::impl_test_team_rot<view_type_a_ls, view_type_b_ls, Device>(132231);
+#endif
+
+  return 1;
+}
+
+template<class ScalarA, class ScalarB, class Device>
+int test_team_rot_mv() {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  typedef Kokkos::View<ScalarB**, Kokkos::LayoutLeft, Device> view_type_b_ll;
+  Test::impl_test_team_rot_mv<view_type_a_ll, view_type_b_ll, Device>(0,5);
+  Test::impl_test_team_rot_mv<view_type_a_ll, view_type_b_ll, Device>(13,5);
+  Test::impl_test_team_rot_mv<view_type_a_ll, view_type_b_ll, Device>(1024,5);
+  Test::impl_test_team_rot_mv<view_type_a_ll, view_type_b_ll, Device>(132231,5);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutRight, Device> view_type_a_lr;
+  typedef Kokkos::View<ScalarB**, Kokkos::LayoutRight, Device> view_type_b_lr;
+  Test::impl_test_team_rot_mv<view_type_a_lr, view_type_b_lr, Device>(0,5);
+  Test::impl_test_team_rot_mv<view_type_a_lr, view_type_b_lr, Device>(13,5);
+  Test::impl_test_team_rot_mv<view_type_a_lr, view_type_b_lr, Device>(1024,5);
+  Test::impl_test_team_rot_mv<view_type_a_lr, view_type_b_lr, Device>(132231,5);
+#endif
+
+  return 1;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, team_rot_float ) {
+    test_team_rot<float,float,TestExecSpace> ();
+}
+TEST_F( TestCategory, team_rot_mv_float ) {
+    test_team_rot_mv<float,float,TestExecSpace> ();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, team_rot_double ) {
+    test_team_rot<double,double,TestExecSpace> ();
+}
+TEST_F( TestCategory, team_rot_mv_double ) {
+    test_team_rot_mv<double,double,TestExecSpace> ();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, team_rot_complex_double ) {
+    test_team_rot<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ();
+}
+TEST_F( TestCategory, team_rot_mv_complex_double ) {
+    test_team_rot_mv<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ();
+}
+#endif
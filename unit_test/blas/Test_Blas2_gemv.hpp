@@ -28,10 +28,12 @@ namespace Test {
     ScalarX b = 5;
     double eps = std::is_same<ScalarY,float>::value?2*1e-5:1e-7;
 
+    // op(A) is N x M for mode "N" and M x N otherwise
+    const bool tran = mode[0]!='N';
     typename vfA_type::BaseType b_A("A",N,M);
-    BaseTypeX b_x("X",M);
-    BaseTypeY b_y("Y",N);
-    BaseTypeY b_org_y("Org_Y",N);
+    BaseTypeX b_x("X",tran?N:M);
+    BaseTypeY b_y("Y",tran?M:N);
+    BaseTypeY b_org_y("Org_Y",tran?M:N);
     
 
     ViewTypeA A = vfA_type::view(b_A);
@@ -75,6 +77,16 @@ namespace Test {
         expected_result += (b*h_y(i) + a * y_i) * (b*h_y(i) + a * y_i) ;
       }
     }
+    else {
+      typedef Kokkos::Details::ArithTraits<ScalarA> KAT;
+      for(int j=0;j<M;j++) {
+        ScalarY y_j = ScalarY();
+        for(int i=0; i<N; i++) {
+           y_j += (mode[0]=='C' ? KAT::conj(h_A(i,j)) : h_A(i,j))*h_x(i);
+        }
+        expected_result += (b*h_y(j) + a * y_j) * (b*h_y(j) + a * y_j) ;
+      }
+    }
 
     KokkosBlas::gemv(mode,a,A,x,b,y);
     ScalarY nonconst_nonconst_result = KokkosBlas::dot(y,y);
@@ -105,6 +117,9 @@ int test_gemv(const char* mode) {
   Test::impl_test_gemv<view_type_a_ll, view_type_b_ll, view_type_c_ll, Device>(mode,13,1024);
   Test::impl_test_gemv<view_type_a_ll, view_type_b_ll, view_type_c_ll, Device>(mode,1024,1024);
   Test::impl_test_gemv<view_type_a_ll, view_type_b_ll, view_type_c_ll, Device>(mode,132231,1024);
+  // Tall-skinny and short-wide shapes
+  Test::impl_test_gemv<view_type_a_ll, view_type_b_ll, view_type_c_ll, Device>(mode,100003,30);
+  Test::impl_test_gemv<view_type_a_ll, view_type_b_ll, view_type_c_ll, Device>(mode,30,100003);
 #endif
 
 #if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
@@ -115,6 +130,9 @@ int test_gemv(const char* mode) {
   Test::impl_test_gemv<view_type_a_lr, view_type_b_lr, view_type_c_lr, Device>(mode,13,1024);
   Test::impl_test_gemv<view_type_a_lr, view_type_b_lr, view_type_c_lr, Device>(mode,1024,1024);
   Test::impl_test_gemv<view_type_a_lr, view_type_b_lr, view_type_c_lr, Device>(mode,132231,1024);
+  // Tall-skinny and short-wide shapes
+  Test::impl_test_gemv<view_type_a_lr, view_type_b_lr, view_type_c_lr, Device>(mode,100003,30);
+  Test::impl_test_gemv<view_type_a_lr, view_type_b_lr, view_type_c_lr, Device>(mode,30,100003);
 #endif
 
 #if defined(KOKKOSKERNELS_INST_LAYOUTSTRIDE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
@@ -138,18 +156,22 @@ int test_gemv(const char* mode) {
 #if defined(KOKKOSKERNELS_INST_FLOAT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
 TEST_F( TestCategory, gemv_float ) {
     test_gemv<float,float,float,TestExecSpace> ("N");
+    test_gemv<float,float,float,TestExecSpace> ("T");
 }
 #endif
 
 #if defined(KOKKOSKERNELS_INST_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
 TEST_F( TestCategory, gemv_double ) {
     test_gemv<double,double,double,TestExecSpace> ("N");
+    test_gemv<double,double,double,TestExecSpace> ("T");
 }
 #endif
 
 #if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
 TEST_F( TestCategory, gemv_complex_double ) {
     test_gemv<Kokkos::complex<double>,Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("N");
+    test_gemv<Kokkos::complex<double>,Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("T");
+    test_gemv<Kokkos::complex<double>,Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("C");
 }
 #endif
 
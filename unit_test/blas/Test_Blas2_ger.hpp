@@ -0,0 +1,154 @@
+#include<gtest/gtest.h>
+#include<Kokkos_Core.hpp>
+#include<Kokkos_Random.hpp>
+#include<KokkosBlas2_ger.hpp>
+#include<KokkosBlas2_team_ger.hpp>
+#include<KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+
+  template<class ViewTypeX, class ViewTypeY, class ViewTypeA, class Device>
+  void impl_test_ger(const char* trans, int M, int N,
+      typename ViewTypeA::value_type alpha) {
+
+    bool conj = (trans[0]=='H') || (trans[0]=='h') || (trans[0]=='C') || (trans[0]=='c');
+    typedef typename ViewTypeA::device_type::execution_space execution_space;
+    typedef typename ViewTypeX::value_type ScalarX;
+    typedef typename ViewTypeY::value_type ScalarY;
+    typedef typename ViewTypeA::value_type ScalarA;
+    typedef Kokkos::Details::ArithTraits<ScalarA> APT;
+    typedef typename APT::mag_type mag_type;
+
+    double machine_eps = APT::epsilon();
+
+    ViewTypeX x("X",M);
+    ViewTypeY y("Y",N);
+    ViewTypeA A("A",M,N);
+    ViewTypeA org_A("Org_A",M,N);
+
+    Kokkos::Random_XorShift64_Pool<execution_space> rand_pool(13718);
+
+    Kokkos::fill_random(x,rand_pool,ScalarX(10));
+    Kokkos::fill_random(y,rand_pool,ScalarY(10));
+    Kokkos::fill_random(A,rand_pool,ScalarA(10));
+    Kokkos::deep_copy(org_A,A);
+
+    typename ViewTypeX::HostMirror h_x = Kokkos::create_mirror_view(x);
+    typename ViewTypeY::HostMirror h_y = Kokkos::create_mirror_view(y);
+    typename ViewTypeA::HostMirror h_A = Kokkos::create_mirror_view(A);
+    Kokkos::deep_copy(h_x,x);
+    Kokkos::deep_copy(h_y,y);
+    Kokkos::deep_copy(h_A,A);
+
+    KokkosBlas::ger(trans,alpha,x,y,A);
+    Kokkos::fence();
+
+    typename ViewTypeA::HostMirror h_result = Kokkos::create_mirror_view(A);
+    Kokkos::deep_copy(h_result,A);
+
+    // Every entry is a single multiply-add.
+    double diff_A_expected = 100*75*machine_eps*7;
+
+    mag_type diff_A = 0;
+    for(int i=0; i<M; i++)
+      for(int j=0; j<N; j++) {
+        ScalarA ref = h_A(i,j) + alpha*h_x(i)*(conj ? APT::conj(h_y(j)) : ScalarA(h_y(j)));
+        diff_A += APT::abs(h_result(i,j) - ref);
+      }
+    if( M!=0 && N!=0 )
+      EXPECT_TRUE( (diff_A/(M*N) < 1.05*diff_A_expected) );
+
+    // Team version: each team updates a block of rows of A.
+    typedef Kokkos::TeamPolicy<Device>        team_policy ;
+    typedef typename team_policy::member_type team_member ;
+    int K = 4;
+    const team_policy policy( K, Kokkos::AUTO );
+    const int team_data_siz = (M%K == 0)?(M/K):(M/K+1);
+    const char trans_c = trans[0];
+    typename ViewTypeX::const_type c_x = x;
+
+    Kokkos::deep_copy(A,org_A);
+    Kokkos::parallel_for( policy, KOKKOS_LAMBDA ( const team_member &teamMember ) {
+      const int teamId = teamMember.league_rank();
+      const int begin = teamId*team_data_siz < M ? teamId*team_data_siz : M;
+      const int end = (teamId < K-1) && ((teamId+1)*team_data_siz < M) ? (teamId+1)*team_data_siz : M;
+      KokkosBlas::Experimental::ger(teamMember, trans_c, alpha,
+                                    Kokkos::subview(c_x,Kokkos::make_pair(begin,end)), y,
+                                    Kokkos::subview(A,Kokkos::make_pair(begin,end),Kokkos::ALL()));
+    } );
+    Kokkos::fence();
+    Kokkos::deep_copy(h_result,A);
+
+    diff_A = 0;
+    for(int i=0; i<M; i++)
+      for(int j=0; j<N; j++) {
+        ScalarA ref = h_A(i,j) + alpha*h_x(i)*(conj ? APT::conj(h_y(j)) : ScalarA(h_y(j)));
+        diff_A += APT::abs(h_result(i,j) - ref);
+      }
+    if( M!=0 && N!=0 )
+      EXPECT_TRUE( (diff_A/(M*N) < 1.05*diff_A_expected) );
+  }
+}
+
+
+
+template<class ScalarX, class ScalarY, class ScalarA, class Device>
+int test_ger(const char* trans, ScalarA alpha) {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarX*, Kokkos::LayoutLeft, Device> view_type_x_ll;
+  typedef Kokkos::View<ScalarY*, Kokkos::LayoutLeft, Device> view_type_y_ll;
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  Test::impl_test_ger<view_type_x_ll, view_type_y_ll, view_type_a_ll, Device>(trans,0,1024,alpha);
+  Test::impl_test_ger<view_type_x_ll, view_type_y_ll, view_type_a_ll, Device>(trans,13,15,alpha);
+  Test::impl_test_ger<view_type_x_ll, view_type_y_ll, view_type_a_ll, Device>(trans,179,211,alpha);
+  Test::impl_test_ger<view_type_x_ll, view_type_y_ll, view_type_a_ll, Device>(trans,1024,13,alpha);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarX*, Kokkos::LayoutRight, Device> view_type_x_lr;
+  typedef Kokkos::View<ScalarY*, Kokkos::LayoutRight, Device> view_type_y_lr;
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutRight, Device> view_type_a_lr;
+  Test::impl_test_ger<view_type_x_lr, view_type_y_lr, view_type_a_lr, Device>(trans,0,1024,alpha);
+  Test::impl_test_ger<view_type_x_lr, view_type_y_lr, view_type_a_lr, Device>(trans,13,15,alpha);
+  Test::impl_test_ger<view_type_x_lr, view_type_y_lr, view_type_a_lr, Device>(trans,179,211,alpha);
+  Test::impl_test_ger<view_type_x_lr, view_type_y_lr, view_type_a_lr, Device>(trans,1024,13,alpha);
+#endif
+  return 1;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, ger_float ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::ger_float");
+    test_ger<float,float,float,TestExecSpace> ("T",3.0f);
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, ger_double ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::ger_double");
+    test_ger<double,double,double,TestExecSpace> ("T",3.0);
+    test_ger<double,double,double,TestExecSpace> ("H",-1.5);
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, ger_complex_double ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::ger_complex_double");
+    Kokkos::complex<double> alpha = Kokkos::complex<double>(5.0,1.0);
+    test_ger<Kokkos::complex<double>,Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("T",alpha);
+    test_ger<Kokkos::complex<double>,Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("H",alpha);
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_FLOAT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, ger_complex_float ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::ger_complex_float");
+    Kokkos::complex<float> alpha = Kokkos::complex<float>(5.0f,1.0f);
+    test_ger<Kokkos::complex<float>,Kokkos::complex<float>,Kokkos::complex<float>,TestExecSpace> ("H",alpha);
+  Kokkos::Profiling::popRegion();
+}
+#endif
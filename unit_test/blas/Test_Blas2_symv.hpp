@@ -0,0 +1,179 @@
+#include<gtest/gtest.h>
+#include<Kokkos_Core.hpp>
+#include<Kokkos_Random.hpp>
+#include<KokkosBlas2_symv.hpp>
+#include<KokkosBlas2_team_symv.hpp>
+#include<KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+
+  template<class ViewTypeA, class ViewTypeX, class ViewTypeY, class Device>
+  void impl_test_symv(const char* uplo, const bool hermitian, int N,
+      typename ViewTypeA::value_type alpha,
+      typename ViewTypeY::value_type beta) {
+
+    bool lower = (uplo[0]=='L') || (uplo[0]=='l');
+    typedef typename ViewTypeA::device_type::execution_space execution_space;
+    typedef typename ViewTypeA::value_type ScalarA;
+    typedef typename ViewTypeX::value_type ScalarX;
+    typedef typename ViewTypeY::value_type ScalarY;
+    typedef Kokkos::Details::ArithTraits<ScalarY> APT;
+    typedef typename APT::mag_type mag_type;
+
+    double machine_eps = APT::epsilon();
+
+    ViewTypeA A("A",N,N);
+    ViewTypeX x("X",N);
+    ViewTypeY y("Y",N);
+    ViewTypeY org_y("Org_Y",N);
+
+    Kokkos::Random_XorShift64_Pool<execution_space> rand_pool(13718);
+
+    Kokkos::fill_random(A,rand_pool,ScalarA(10));
+    Kokkos::fill_random(x,rand_pool,ScalarX(10));
+    Kokkos::fill_random(y,rand_pool,ScalarY(10));
+    Kokkos::deep_copy(org_y,y);
+
+    typename ViewTypeA::HostMirror h_A = Kokkos::create_mirror_view(A);
+    typename ViewTypeX::HostMirror h_x = Kokkos::create_mirror_view(x);
+    typename ViewTypeY::HostMirror h_y = Kokkos::create_mirror_view(y);
+    Kokkos::deep_copy(h_A,A);
+    Kokkos::deep_copy(h_x,x);
+    Kokkos::deep_copy(h_y,y);
+
+    // Reference, reading only the uplo triangle of A.
+    std::vector<ScalarY> ref(N);
+    for(int i=0; i<N; i++) {
+      ScalarY Ax_i = 0.0;
+      for(int j=0; j<N; j++) {
+        ScalarA A_ij;
+        if(i==j)
+          A_ij = hermitian ? ScalarA(APT::real(h_A(i,i))) : h_A(i,i);
+        else if((j<i) == lower)
+          A_ij = h_A(i,j);
+        else
+          A_ij = hermitian ? APT::conj(h_A(j,i)) : h_A(j,i);
+        Ax_i += A_ij*h_x(j);
+      }
+      ref[i] = beta*h_y(i) + alpha*Ax_i;
+    }
+
+    // Same bound as for gemm
+    double diff_y_expected = 1.0*sqrt(N)*N*75*machine_eps*7;
+
+    if(hermitian)
+      KokkosBlas::hemv(uplo,alpha,A,x,beta,y);
+    else
+      KokkosBlas::symv(uplo,alpha,A,x,beta,y);
+    Kokkos::fence();
+
+    typename ViewTypeY::HostMirror h_result = Kokkos::create_mirror_view(y);
+    Kokkos::deep_copy(h_result,y);
+
+    mag_type diff_y = 0;
+    for(int i=0; i<N; i++)
+      diff_y += APT::abs(h_result(i) - ref[i]);
+    if( N!=0 )
+      EXPECT_TRUE( (diff_y/N < 1.05*diff_y_expected) );
+
+    // Team version, one team for the whole matrix.
+    typedef Kokkos::TeamPolicy<Device>        team_policy ;
+    typedef typename team_policy::member_type team_member ;
+    const team_policy policy( 1, Kokkos::AUTO );
+    const char uplo_c = uplo[0];
+    typename ViewTypeA::const_type c_A = A;
+
+    Kokkos::deep_copy(y,org_y);
+    Kokkos::parallel_for( policy, KOKKOS_LAMBDA ( const team_member &teamMember ) {
+      if(hermitian)
+        KokkosBlas::Experimental::hemv(teamMember, uplo_c, alpha, c_A, x, beta, y);
+      else
+        KokkosBlas::Experimental::symv(teamMember, uplo_c, alpha, c_A, x, beta, y);
+    } );
+    Kokkos::fence();
+    Kokkos::deep_copy(h_result,y);
+
+    diff_y = 0;
+    for(int i=0; i<N; i++)
+      diff_y += APT::abs(h_result(i) - ref[i]);
+    if( N!=0 )
+      EXPECT_TRUE( (diff_y/N < 1.05*diff_y_expected) );
+  }
+}
+
+
+
+template<class ScalarA, class ScalarX, class ScalarY, class Device>
+int test_symv(const char* uplo, const bool hermitian, ScalarA alpha, ScalarY beta) {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  typedef Kokkos::View<ScalarX*, Kokkos::LayoutLeft, Device> view_type_x_ll;
+  typedef Kokkos::View<ScalarY*, Kokkos::LayoutLeft, Device> view_type_y_ll;
+  Test::impl_test_symv<view_type_a_ll, view_type_x_ll, view_type_y_ll, Device>(uplo,hermitian,0,alpha,beta);
+  Test::impl_test_symv<view_type_a_ll, view_type_x_ll, view_type_y_ll, Device>(uplo,hermitian,13,alpha,beta);
+  Test::impl_test_symv<view_type_a_ll, view_type_x_ll, view_type_y_ll, Device>(uplo,hermitian,179,alpha,beta);
+  Test::impl_test_symv<view_type_a_ll, view_type_x_ll, view_type_y_ll, Device>(uplo,hermitian,1024,alpha,beta);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutRight, Device> view_type_a_lr;
+  typedef Kokkos::View<ScalarX*, Kokkos::LayoutRight, Device> view_type_x_lr;
+  typedef Kokkos::View<ScalarY*, Kokkos::LayoutRight, Device> view_type_y_lr;
+  Test::impl_test_symv<view_type_a_lr, view_type_x_lr, view_type_y_lr, Device>(uplo,hermitian,0,alpha,beta);
+  Test::impl_test_symv<view_type_a_lr, view_type_x_lr, view_type_y_lr, Device>(uplo,hermitian,13,alpha,beta);
+  Test::impl_test_symv<view_type_a_lr, view_type_x_lr, view_type_y_lr, Device>(uplo,hermitian,179,alpha,beta);
+  Test::impl_test_symv<view_type_a_lr, view_type_x_lr, view_type_y_lr, Device>(uplo,hermitian,1024,alpha,beta);
+#endif
+  return 1;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, symv_float ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::symv_float");
+    test_symv<float,float,float,TestExecSpace> ("L",false,3.0f,5.0f);
+    test_symv<float,float,float,TestExecSpace> ("U",false,3.0f,5.0f);
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, symv_double ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::symv_double");
+    test_symv<double,double,double,TestExecSpace> ("L",false,3.0,5.0);
+    test_symv<double,double,double,TestExecSpace> ("U",false,3.0,5.0);
+    test_symv<double,double,double,TestExecSpace> ("L",false,4.5,0.0);
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, symv_complex_double ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::symv_complex_double");
+    Kokkos::complex<double> alpha = Kokkos::complex<double>(5.0,1.0);
+    Kokkos::complex<double> beta = Kokkos::complex<double>(3.0,-2.0);
+    test_symv<Kokkos::complex<double>,Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("L",false,alpha,beta);
+    test_symv<Kokkos::complex<double>,Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("U",false,alpha,beta);
+  Kokkos::Profiling::popRegion();
+}
+
+TEST_F( TestCategory, hemv_complex_double ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::hemv_complex_double");
+    Kokkos::complex<double> alpha = Kokkos::complex<double>(5.0,1.0);
+    Kokkos::complex<double> beta = Kokkos::complex<double>(3.0,-2.0);
+    test_symv<Kokkos::complex<double>,Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("L",true,alpha,beta);
+    test_symv<Kokkos::complex<double>,Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("U",true,alpha,beta);
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_FLOAT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, hemv_complex_float ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::hemv_complex_float");
+    Kokkos::complex<float> alpha = Kokkos::complex<float>(5.0f,1.0f);
+    Kokkos::complex<float> beta = Kokkos::complex<float>(3.0f,-2.0f);
+    test_symv<Kokkos::complex<float>,Kokkos::complex<float>,Kokkos::complex<float>,TestExecSpace> ("L",true,alpha,beta);
+    test_symv<Kokkos::complex<float>,Kokkos::complex<float>,Kokkos::complex<float>,TestExecSpace> ("U",true,alpha,beta);
+  Kokkos::Profiling::popRegion();
+}
+#endif
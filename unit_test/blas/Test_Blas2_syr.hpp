@@ -0,0 +1,179 @@
+#include<gtest/gtest.h>
+#include<Kokkos_Core.hpp>
+#include<Kokkos_Random.hpp>
+#include<KokkosBlas2_syr.hpp>
+#include<KokkosBlas2_team_syr.hpp>
+#include<KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+
+  // mode is trans and uplo, e.g. "TL" or "HU".
+  template<class ViewTypeX, class ViewTypeY, class ViewTypeA, class Device>
+  void impl_test_syr(const char* mode, const bool rank2, int N,
+      typename ViewTypeA::value_type alpha) {
+
+    bool conj = (mode[0]=='H') || (mode[0]=='h') || (mode[0]=='C') || (mode[0]=='c');
+    bool lower = (mode[1]=='L') || (mode[1]=='l');
+    typedef typename ViewTypeA::device_type::execution_space execution_space;
+    typedef typename ViewTypeX::value_type ScalarX;
+    typedef typename ViewTypeY::value_type ScalarY;
+    typedef typename ViewTypeA::value_type ScalarA;
+    typedef Kokkos::Details::ArithTraits<ScalarA> APT;
+    typedef typename APT::mag_type mag_type;
+
+    double machine_eps = APT::epsilon();
+
+    ViewTypeX x("X",N);
+    ViewTypeY y("Y",N);
+    ViewTypeA A("A",N,N);
+    ViewTypeA org_A("Org_A",N,N);
+
+    Kokkos::Random_XorShift64_Pool<execution_space> rand_pool(13718);
+
+    Kokkos::fill_random(x,rand_pool,ScalarX(10));
+    Kokkos::fill_random(y,rand_pool,ScalarY(10));
+    Kokkos::fill_random(A,rand_pool,ScalarA(10));
+    Kokkos::deep_copy(org_A,A);
+
+    typename ViewTypeX::HostMirror h_x = Kokkos::create_mirror_view(x);
+    typename ViewTypeY::HostMirror h_y = Kokkos::create_mirror_view(y);
+    typename ViewTypeA::HostMirror h_A = Kokkos::create_mirror_view(A);
+    Kokkos::deep_copy(h_x,x);
+    Kokkos::deep_copy(h_y,y);
+    Kokkos::deep_copy(h_A,A);
+
+    if(rank2)
+      KokkosBlas::syr2(&mode[0],&mode[1],alpha,x,y,A);
+    else
+      KokkosBlas::syr(&mode[0],&mode[1],alpha,x,A);
+    Kokkos::fence();
+
+    typename ViewTypeA::HostMirror h_result = Kokkos::create_mirror_view(A);
+    Kokkos::deep_copy(h_result,A);
+
+    // Every entry is at most two multiply-adds.
+    double diff_A_expected = 2*100*75*machine_eps*7;
+
+    // The triangle which is not referenced must be left untouched.
+    mag_type diff_A = 0;
+    for(int i=0; i<N; i++)
+      for(int j=0; j<N; j++) {
+        ScalarA ref = h_A(i,j);
+        if(!(lower ? (j>i) : (j<i))) {
+          const ScalarA x_j = conj ? APT::conj(h_x(j)) : ScalarA(h_x(j));
+          if(rank2) {
+            const ScalarA y_j = conj ? APT::conj(h_y(j)) : ScalarA(h_y(j));
+            ref += alpha*h_x(i)*y_j + (conj ? APT::conj(alpha) : alpha)*h_y(i)*x_j;
+          }
+          else
+            ref += alpha*h_x(i)*x_j;
+          if(conj && i==j)
+            ref = APT::real(ref);
+        }
+        diff_A += APT::abs(h_result(i,j) - ref);
+      }
+    if( N!=0 )
+      EXPECT_TRUE( (diff_A/(N*N) < 1.05*diff_A_expected) );
+
+    // Team version, one team for the whole matrix.
+    typedef Kokkos::TeamPolicy<Device>        team_policy ;
+    typedef typename team_policy::member_type team_member ;
+    const team_policy policy( 1, Kokkos::AUTO );
+    const char trans = mode[0], uplo = mode[1];
+
+    Kokkos::deep_copy(A,org_A);
+    Kokkos::parallel_for( policy, KOKKOS_LAMBDA ( const team_member &teamMember ) {
+      if(rank2)
+        KokkosBlas::Experimental::syr2(teamMember, trans, uplo, alpha, x, y, A);
+      else
+        KokkosBlas::Experimental::syr(teamMember, trans, uplo, alpha, x, A);
+    } );
+    Kokkos::fence();
+
+    typename ViewTypeA::HostMirror h_team_result = Kokkos::create_mirror_view(A);
+    Kokkos::deep_copy(h_team_result,A);
+
+    // The team and the device-level kernels do the same arithmetic.
+    diff_A = 0;
+    for(int i=0; i<N; i++)
+      for(int j=0; j<N; j++)
+        diff_A += APT::abs(h_team_result(i,j) - h_result(i,j));
+    if( N!=0 )
+      EXPECT_TRUE( (diff_A/(N*N) < 1.05*diff_A_expected) );
+  }
+}
+
+
+
+template<class ScalarX, class ScalarY, class ScalarA, class Device>
+int test_syr(const char* mode, const bool rank2, ScalarA alpha) {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarX*, Kokkos::LayoutLeft, Device> view_type_x_ll;
+  typedef Kokkos::View<ScalarY*, Kokkos::LayoutLeft, Device> view_type_y_ll;
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  Test::impl_test_syr<view_type_x_ll, view_type_y_ll, view_type_a_ll, Device>(mode,rank2,0,alpha);
+  Test::impl_test_syr<view_type_x_ll, view_type_y_ll, view_type_a_ll, Device>(mode,rank2,13,alpha);
+  Test::impl_test_syr<view_type_x_ll, view_type_y_ll, view_type_a_ll, Device>(mode,rank2,179,alpha);
+  Test::impl_test_syr<view_type_x_ll, view_type_y_ll, view_type_a_ll, Device>(mode,rank2,1024,alpha);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarX*, Kokkos::LayoutRight, Device> view_type_x_lr;
+  typedef Kokkos::View<ScalarY*, Kokkos::LayoutRight, Device> view_type_y_lr;
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutRight, Device> view_type_a_lr;
+  Test::impl_test_syr<view_type_x_lr, view_type_y_lr, view_type_a_lr, Device>(mode,rank2,0,alpha);
+  Test::impl_test_syr<view_type_x_lr, view_type_y_lr, view_type_a_lr, Device>(mode,rank2,13,alpha);
+  Test::impl_test_syr<view_type_x_lr, view_type_y_lr, view_type_a_lr, Device>(mode,rank2,179,alpha);
+  Test::impl_test_syr<view_type_x_lr, view_type_y_lr, view_type_a_lr, Device>(mode,rank2,1024,alpha);
+#endif
+  return 1;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, syr_float ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::syr_float");
+    test_syr<float,float,float,TestExecSpace> ("TL",false,3.0f);
+    test_syr<float,float,float,TestExecSpace> ("TU",true,3.0f);
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, syr_double ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::syr_double");
+    test_syr<double,double,double,TestExecSpace> ("TL",false,3.0);
+    test_syr<double,double,double,TestExecSpace> ("TU",false,3.0);
+    test_syr<double,double,double,TestExecSpace> ("TL",true,-1.5);
+    test_syr<double,double,double,TestExecSpace> ("TU",true,-1.5);
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, syr_complex_double ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::syr_complex_double");
+    Kokkos::complex<double> alpha = Kokkos::complex<double>(5.0,1.0);
+    test_syr<Kokkos::complex<double>,Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("TL",false,alpha);
+    test_syr<Kokkos::complex<double>,Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("TU",true,alpha);
+  Kokkos::Profiling::popRegion();
+}
+
+TEST_F( TestCategory, her_complex_double ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::her_complex_double");
+    test_syr<Kokkos::complex<double>,Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("HL",false,Kokkos::complex<double>(5.0));
+    test_syr<Kokkos::complex<double>,Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("HU",false,Kokkos::complex<double>(5.0));
+    test_syr<Kokkos::complex<double>,Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("HL",true,Kokkos::complex<double>(5.0,1.0));
+    test_syr<Kokkos::complex<double>,Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("HU",true,Kokkos::complex<double>(5.0,1.0));
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_FLOAT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, her_complex_float ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::her_complex_float");
+    test_syr<Kokkos::complex<float>,Kokkos::complex<float>,Kokkos::complex<float>,TestExecSpace> ("HL",false,Kokkos::complex<float>(5.0f));
+    test_syr<Kokkos::complex<float>,Kokkos::complex<float>,Kokkos::complex<float>,TestExecSpace> ("HU",true,Kokkos::complex<float>(5.0f,1.0f));
+  Kokkos::Profiling::popRegion();
+}
+#endif
@@ -0,0 +1,160 @@
+#include<gtest/gtest.h>
+#include<Kokkos_Core.hpp>
+#include<Kokkos_Random.hpp>
+#include<KokkosBlas2_trmv.hpp>
+#include<KokkosBlas2_team_trmv.hpp>
+#include<KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+
+  // mode is uplo, trans and diag, e.g. "LNN" or "UCU".
+  template<class ViewTypeA, class ViewTypeX, class Device>
+  void impl_test_trmv(const char* mode, int N) {
+
+    bool lower = (mode[0]=='L') || (mode[0]=='l');
+    bool A_t = (mode[1]!='N') && (mode[1]!='n');
+    bool A_c = (mode[1]=='C') || (mode[1]=='c');
+    bool unit = (mode[2]=='U') || (mode[2]=='u');
+    typedef typename ViewTypeA::device_type::execution_space execution_space;
+    typedef typename ViewTypeA::value_type ScalarA;
+    typedef typename ViewTypeX::value_type ScalarX;
+    typedef Kokkos::Details::ArithTraits<ScalarX> APT;
+    typedef typename APT::mag_type mag_type;
+
+    double machine_eps = APT::epsilon();
+
+    ViewTypeA A("A",N,N);
+    ViewTypeX x("X",N);
+    ViewTypeX org_x("Org_X",N);
+
+    Kokkos::Random_XorShift64_Pool<execution_space> rand_pool(13718);
+
+    Kokkos::fill_random(A,rand_pool,ScalarA(10));
+    Kokkos::fill_random(x,rand_pool,ScalarX(10));
+    Kokkos::deep_copy(org_x,x);
+
+    typename ViewTypeA::HostMirror h_A = Kokkos::create_mirror_view(A);
+    typename ViewTypeX::HostMirror h_x = Kokkos::create_mirror_view(x);
+    Kokkos::deep_copy(h_A,A);
+    Kokkos::deep_copy(h_x,x);
+
+    // Reference op(A)*x, reading only the uplo triangle of A.
+    std::vector<ScalarX> ref(N);
+    for(int i=0; i<N; i++) {
+      ScalarX Ax_i = 0.0;
+      for(int j=0; j<N; j++) {
+        const int r = A_t ? j : i;
+        const int c = A_t ? i : j;
+        if(lower ? (c>r) : (c<r))
+          continue;
+        ScalarA A_ij = (r==c && unit) ? ScalarA(1) : h_A(r,c);
+        if(A_c)
+          A_ij = APT::conj(A_ij);
+        Ax_i += A_ij*h_x(j);
+      }
+      ref[i] = Ax_i;
+    }
+
+    // Same bound as for gemm
+    double diff_x_expected = 1.0*sqrt(N)*N*75*machine_eps*7;
+
+    KokkosBlas::trmv(&mode[0],&mode[1],&mode[2],A,x);
+    Kokkos::fence();
+
+    typename ViewTypeX::HostMirror h_result = Kokkos::create_mirror_view(x);
+    Kokkos::deep_copy(h_result,x);
+
+    mag_type diff_x = 0;
+    for(int i=0; i<N; i++)
+      diff_x += APT::abs(h_result(i) - ref[i]);
+    if( N!=0 )
+      EXPECT_TRUE( (diff_x/N < 1.05*diff_x_expected) );
+
+    // Team version, one team for the whole matrix.
+    typedef Kokkos::TeamPolicy<Device>        team_policy ;
+    typedef typename team_policy::member_type team_member ;
+    const team_policy policy( 1, Kokkos::AUTO );
+    const char uplo = mode[0], trans = mode[1], diag = mode[2];
+    typename ViewTypeA::const_type c_A = A;
+
+    Kokkos::deep_copy(x,org_x);
+    Kokkos::parallel_for( policy, KOKKOS_LAMBDA ( const team_member &teamMember ) {
+      KokkosBlas::Experimental::trmv(teamMember, uplo, trans, diag, c_A, x);
+    } );
+    Kokkos::fence();
+    Kokkos::deep_copy(h_result,x);
+
+    diff_x = 0;
+    for(int i=0; i<N; i++)
+      diff_x += APT::abs(h_result(i) - ref[i]);
+    if( N!=0 )
+      EXPECT_TRUE( (diff_x/N < 1.05*diff_x_expected) );
+  }
+}
+
+
+
+template<class ScalarA, class ScalarX, class Device>
+int test_trmv(const char* mode) {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  typedef Kokkos::View<ScalarX*, Kokkos::LayoutLeft, Device> view_type_x_ll;
+  Test::impl_test_trmv<view_type_a_ll, view_type_x_ll, Device>(mode,0);
+  Test::impl_test_trmv<view_type_a_ll, view_type_x_ll, Device>(mode,13);
+  Test::impl_test_trmv<view_type_a_ll, view_type_x_ll, Device>(mode,179);
+  Test::impl_test_trmv<view_type_a_ll, view_type_x_ll, Device>(mode,1024);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutRight, Device> view_type_a_lr;
+  typedef Kokkos::View<ScalarX*, Kokkos::LayoutRight, Device> view_type_x_lr;
+  Test::impl_test_trmv<view_type_a_lr, view_type_x_lr, Device>(mode,0);
+  Test::impl_test_trmv<view_type_a_lr, view_type_x_lr, Device>(mode,13);
+  Test::impl_test_trmv<view_type_a_lr, view_type_x_lr, Device>(mode,179);
+  Test::impl_test_trmv<view_type_a_lr, view_type_x_lr, Device>(mode,1024);
+#endif
+  return 1;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, trmv_float ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::trmv_float");
+    test_trmv<float,float,TestExecSpace> ("LNN");
+    test_trmv<float,float,TestExecSpace> ("UTU");
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, trmv_double ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::trmv_double");
+    test_trmv<double,double,TestExecSpace> ("LNN");
+    test_trmv<double,double,TestExecSpace> ("LNU");
+    test_trmv<double,double,TestExecSpace> ("LTN");
+    test_trmv<double,double,TestExecSpace> ("UNN");
+    test_trmv<double,double,TestExecSpace> ("UNU");
+    test_trmv<double,double,TestExecSpace> ("UTN");
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, trmv_complex_double ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::trmv_complex_double");
+    test_trmv<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("LNN");
+    test_trmv<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("LCU");
+    test_trmv<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("UTN");
+    test_trmv<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("UCN");
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_FLOAT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, trmv_complex_float ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::trmv_complex_float");
+    test_trmv<Kokkos::complex<float>,Kokkos::complex<float>,TestExecSpace> ("LCN");
+    test_trmv<Kokkos::complex<float>,Kokkos::complex<float>,TestExecSpace> ("UNU");
+  Kokkos::Profiling::popRegion();
+}
+#endif
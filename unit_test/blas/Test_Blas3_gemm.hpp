@@ -147,6 +147,65 @@ namespace Test {
       EXPECT_TRUE( (diff_C_average < 1.05*diff_C_expected ) );
     }
   }
+
+  template<class ViewTypeA, class ViewTypeB, class ViewTypeC, class Device>
+  void impl_test_gemm_batched(const char* TA, const char* TB, int batch, int M, int N, int K,
+      typename ViewTypeA::value_type alpha,
+      typename ViewTypeC::value_type beta) {
+
+    bool A_t = (TA[0]!='N') && (TA[0]!='n');
+    bool B_t = (TB[0]!='N') && (TB[0]!='n');
+    typedef typename ViewTypeA::device_type::execution_space execution_space;
+    typedef typename ViewTypeA::value_type ScalarA;
+    typedef typename ViewTypeB::value_type ScalarB;
+    typedef typename ViewTypeC::value_type ScalarC;
+    typedef Kokkos::Details::ArithTraits<ScalarC> APT;
+    typedef typename APT::mag_type mag_type;
+
+    double machine_eps = APT::epsilon();
+
+    ViewTypeA A("A",batch,A_t?K:M,A_t?M:K);
+    ViewTypeB B("B",batch,B_t?N:K,B_t?K:N);
+    ViewTypeC C("C",batch,M,N);
+
+    uint64_t seed = Kokkos::Impl::clock_tic();
+    Kokkos::Random_XorShift64_Pool<execution_space> rand_pool(seed);
+
+    Kokkos::fill_random(A,rand_pool,ScalarA(10));
+    Kokkos::fill_random(B,rand_pool,ScalarB(10));
+    Kokkos::fill_random(C,rand_pool,ScalarC(10));
+
+    typename ViewTypeA::HostMirror h_A = Kokkos::create_mirror_view(A);
+    typename ViewTypeB::HostMirror h_B = Kokkos::create_mirror_view(B);
+    typename ViewTypeC::HostMirror h_C = Kokkos::create_mirror_view(C);
+    Kokkos::deep_copy(h_A,A);
+    Kokkos::deep_copy(h_B,B);
+    Kokkos::deep_copy(h_C,C);
+
+    KokkosBlas::gemm(TA,TB,alpha,A,B,beta,C);
+
+    Kokkos::fence();
+
+    typename ViewTypeC::HostMirror h_result = Kokkos::create_mirror_view(C);
+    Kokkos::deep_copy(h_result,C);
+
+    mag_type diff_C = 0;
+    for(int l=0; l<batch; l++)
+      for(int i=0; i<M; i++)
+        for(int j=0; j<N; j++) {
+          ScalarC C_ij = 0.0;
+          for(int k=0; k<K; k++)
+            C_ij += (A_t?h_A(l,k,i):h_A(l,i,k))*(B_t?h_B(l,j,k):h_B(l,k,j));
+          diff_C += APT::abs(h_result(l,i,j) - (beta*h_C(l,i,j) + alpha*C_ij));
+        }
+
+    if( batch!=0 && N!=0 && M!=0 && K!=0 ) {
+      double diff_C_average = diff_C/(batch*N*M);
+      // Same bound as for the rank-2 gemm
+      double diff_C_expected = 1.0*sqrt(K)*K*75*machine_eps*7;
+      EXPECT_TRUE( (diff_C_average < 1.05*diff_C_expected ) );
+    }
+  }
 }
 
 
@@ -162,7 +221,10 @@ int test_gemm(const char* mode, ScalarA alpha, ScalarB beta) {
   Test::impl_test_gemm<view_type_a_ll, view_type_b_ll, view_type_c_ll, Device>(&mode[0],&mode[1],13,15,17,alpha,beta);
   Test::impl_test_gemm<view_type_a_ll, view_type_b_ll, view_type_c_ll, Device>(&mode[0],&mode[1],179,15,211,alpha,beta);
   Test::impl_test_gemm<view_type_a_ll, view_type_b_ll, view_type_c_ll, Device>(&mode[0],&mode[1],12,3071,517,alpha,beta);
+  Test::impl_test_gemm<view_type_a_ll, view_type_b_ll, view_type_c_ll, Device>(&mode[0],&mode[1],517,263,781,alpha,beta);
   Test::impl_test_gemm<view_type_a_ll, view_type_b_ll, view_type_c_ll, Device>(&mode[0],&mode[1],1024,1024,2048,alpha,beta);
+  Test::impl_test_gemm<view_type_a_ll, view_type_b_ll, view_type_c_ll, Device>(&mode[0],&mode[1],8,8,20011,alpha,beta);
+  Test::impl_test_gemm<view_type_a_ll, view_type_b_ll, view_type_c_ll, Device>(&mode[0],&mode[1],31,17,40009,alpha,beta);
 #endif
 
 #if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
@@ -173,7 +235,10 @@ int test_gemm(const char* mode, ScalarA alpha, ScalarB beta) {
   Test::impl_test_gemm<view_type_a_lr, view_type_b_lr, view_type_c_lr, Device>(&mode[0],&mode[1],13,15,17,alpha,beta);
   Test::impl_test_gemm<view_type_a_lr, view_type_b_lr, view_type_c_lr, Device>(&mode[0],&mode[1],179,15,211,alpha,beta);
   Test::impl_test_gemm<view_type_a_lr, view_type_b_lr, view_type_c_lr, Device>(&mode[0],&mode[1],12,3071,517,alpha,beta);
+  Test::impl_test_gemm<view_type_a_lr, view_type_b_lr, view_type_c_lr, Device>(&mode[0],&mode[1],517,263,781,alpha,beta);
   Test::impl_test_gemm<view_type_a_lr, view_type_b_lr, view_type_c_lr, Device>(&mode[0],&mode[1],1024,1024,2048,alpha,beta);
+  Test::impl_test_gemm<view_type_a_lr, view_type_b_lr, view_type_c_lr, Device>(&mode[0],&mode[1],8,8,20011,alpha,beta);
+  Test::impl_test_gemm<view_type_a_lr, view_type_b_lr, view_type_c_lr, Device>(&mode[0],&mode[1],31,17,40009,alpha,beta);
 #endif
 /*
 #if defined(KOKKOSKERNELS_INST_LAYOUTSTRIDE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
@@ -194,6 +259,31 @@ int test_gemm(const char* mode, ScalarA alpha, ScalarB beta) {
   return 1;
 }
 
+template<class ScalarA, class ScalarB, class ScalarC, class Device>
+int test_gemm_batched(const char* mode, ScalarA alpha, ScalarB beta) {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA***, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  typedef Kokkos::View<ScalarB***, Kokkos::LayoutLeft, Device> view_type_b_ll;
+  typedef Kokkos::View<ScalarC***, Kokkos::LayoutLeft, Device> view_type_c_ll;
+  Test::impl_test_gemm_batched<view_type_a_ll, view_type_b_ll, view_type_c_ll, Device>(&mode[0],&mode[1],0,8,8,8,alpha,beta);
+  Test::impl_test_gemm_batched<view_type_a_ll, view_type_b_ll, view_type_c_ll, Device>(&mode[0],&mode[1],1000,8,8,8,alpha,beta);
+  Test::impl_test_gemm_batched<view_type_a_ll, view_type_b_ll, view_type_c_ll, Device>(&mode[0],&mode[1],100,33,17,40,alpha,beta);
+  Test::impl_test_gemm_batched<view_type_a_ll, view_type_b_ll, view_type_c_ll, Device>(&mode[0],&mode[1],3,260,257,263,alpha,beta);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA***, Kokkos::LayoutRight, Device> view_type_a_lr;
+  typedef Kokkos::View<ScalarB***, Kokkos::LayoutRight, Device> view_type_b_lr;
+  typedef Kokkos::View<ScalarC***, Kokkos::LayoutRight, Device> view_type_c_lr;
+  Test::impl_test_gemm_batched<view_type_a_lr, view_type_b_lr, view_type_c_lr, Device>(&mode[0],&mode[1],0,8,8,8,alpha,beta);
+  Test::impl_test_gemm_batched<view_type_a_lr, view_type_b_lr, view_type_c_lr, Device>(&mode[0],&mode[1],1000,8,8,8,alpha,beta);
+  Test::impl_test_gemm_batched<view_type_a_lr, view_type_b_lr, view_type_c_lr, Device>(&mode[0],&mode[1],100,33,17,40,alpha,beta);
+  Test::impl_test_gemm_batched<view_type_a_lr, view_type_b_lr, view_type_c_lr, Device>(&mode[0],&mode[1],3,260,257,263,alpha,beta);
+#endif
+  return 1;
+}
+
 #if defined(KOKKOSKERNELS_INST_FLOAT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
 TEST_F( TestCategory, gemm_float ) {
   Kokkos::Profiling::pushRegion("KokkosBlas::Test::gemm_float");
@@ -274,6 +364,35 @@ TEST_F( TestCategory, gemm_complex_float ) {
 }
 #endif
 
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, gemm_batched_double ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::gemm_batched_double");
+    double alpha = 5.0;
+    double beta = 3.0;
+    test_gemm_batched<double,double,double,TestExecSpace> ("NN",alpha,beta);
+    test_gemm_batched<double,double,double,TestExecSpace> ("TN",alpha,beta);
+    test_gemm_batched<double,double,double,TestExecSpace> ("NT",alpha,beta);
+    test_gemm_batched<double,double,double,TestExecSpace> ("TT",alpha,beta);
+
+    alpha = 4.5;
+    beta = 0.0;
+    test_gemm_batched<double,double,double,TestExecSpace> ("NN",alpha,beta);
+    test_gemm_batched<double,double,double,TestExecSpace> ("TT",alpha,beta);
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, gemm_batched_complex_double ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::gemm_batched_complex_double");
+    Kokkos::complex<double> alpha = 5.0;
+    Kokkos::complex<double> beta = 3.0;
+    test_gemm_batched<Kokkos::complex<double>,Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("NN",alpha,beta);
+    test_gemm_batched<Kokkos::complex<double>,Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("TT",alpha,beta);
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
 /*
 #if defined(KOKKOSKERNELS_INST_INT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
 TEST_F( TestCategory, gemm_int ) {
@@ -0,0 +1,169 @@
+#include<gtest/gtest.h>
+#include<Kokkos_Core.hpp>
+#include<Kokkos_Random.hpp>
+#include<KokkosBlas3_syrk.hpp>
+#include<KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+
+  template<class ViewTypeA, class ViewTypeC, class Device>
+  void impl_test_syrk(const char* uplo, const char* trans, const bool hermitian, int N, int K,
+      typename ViewTypeA::value_type alpha,
+      typename ViewTypeC::value_type beta) {
+
+    bool lower = (uplo[0]=='L') || (uplo[0]=='l');
+    bool A_t = (trans[0]!='N') && (trans[0]!='n');
+    typedef typename ViewTypeA::device_type::execution_space execution_space;
+    typedef typename ViewTypeA::value_type ScalarA;
+    typedef typename ViewTypeC::value_type ScalarC;
+    typedef Kokkos::Details::ArithTraits<ScalarC> APT;
+    typedef typename APT::mag_type mag_type;
+
+    double machine_eps = APT::epsilon();
+
+    ViewTypeA A("A",A_t?K:N,A_t?N:K);
+    ViewTypeC C("C",N,N);
+
+    uint64_t seed = Kokkos::Impl::clock_tic();
+    Kokkos::Random_XorShift64_Pool<execution_space> rand_pool(seed);
+
+    Kokkos::fill_random(A,rand_pool,ScalarA(10));
+    Kokkos::fill_random(C,rand_pool,ScalarC(10));
+
+    typename ViewTypeA::HostMirror h_A = Kokkos::create_mirror_view(A);
+    typename ViewTypeC::HostMirror h_C = Kokkos::create_mirror_view(C);
+    Kokkos::deep_copy(h_A,A);
+    Kokkos::deep_copy(h_C,C);
+
+    if(hermitian)
+      KokkosBlas::herk(uplo,trans,APT::real(alpha),A,APT::real(beta),C);
+    else
+      KokkosBlas::syrk(uplo,trans,alpha,A,beta,C);
+
+    Kokkos::fence();
+
+    typename ViewTypeC::HostMirror h_result = Kokkos::create_mirror_view(C);
+    Kokkos::deep_copy(h_result,C);
+
+    // The triangle which is not referenced must be left untouched.
+    mag_type diff_C = 0;
+    for(int i=0; i<N; i++)
+      for(int j=0; j<N; j++) {
+        if(lower ? (j>i) : (j<i)) {
+          diff_C += APT::abs(h_result(i,j) - h_C(i,j));
+          continue;
+        }
+        ScalarC C_ij = 0.0;
+        for(int k=0; k<K; k++) {
+          ScalarA a_i = A_t?h_A(k,i):h_A(i,k);
+          ScalarA a_j = A_t?h_A(k,j):h_A(j,k);
+          if(hermitian)
+            C_ij += A_t?APT::conj(a_i)*a_j:a_i*APT::conj(a_j);
+          else
+            C_ij += a_i*a_j;
+        }
+        ScalarC ref = beta*h_C(i,j) + alpha*C_ij;
+        if(hermitian && i==j)
+          ref = APT::real(ref);
+        diff_C += APT::abs(h_result(i,j) - ref);
+      }
+
+    if( N!=0 && K!=0 ) {
+      double diff_C_average = diff_C/(N*N);
+      // Same bound as for gemm
+      double diff_C_expected = 1.0*sqrt(K)*K*75*machine_eps*7;
+      EXPECT_TRUE( (diff_C_average < 1.05*diff_C_expected ) );
+    }
+  }
+}
+
+
+
+template<class ScalarA, class ScalarC, class Device>
+int test_syrk(const char* mode, const bool hermitian, ScalarA alpha, ScalarC beta) {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  typedef Kokkos::View<ScalarC**, Kokkos::LayoutLeft, Device> view_type_c_ll;
+  Test::impl_test_syrk<view_type_a_ll, view_type_c_ll, Device>(&mode[0],&mode[1],hermitian,0,0,alpha,beta);
+  Test::impl_test_syrk<view_type_a_ll, view_type_c_ll, Device>(&mode[0],&mode[1],hermitian,13,15,alpha,beta);
+  Test::impl_test_syrk<view_type_a_ll, view_type_c_ll, Device>(&mode[0],&mode[1],hermitian,179,211,alpha,beta);
+  Test::impl_test_syrk<view_type_a_ll, view_type_c_ll, Device>(&mode[0],&mode[1],hermitian,12,3071,alpha,beta);
+  Test::impl_test_syrk<view_type_a_ll, view_type_c_ll, Device>(&mode[0],&mode[1],hermitian,32,4096,alpha,beta);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutRight, Device> view_type_a_lr;
+  typedef Kokkos::View<ScalarC**, Kokkos::LayoutRight, Device> view_type_c_lr;
+  Test::impl_test_syrk<view_type_a_lr, view_type_c_lr, Device>(&mode[0],&mode[1],hermitian,0,0,alpha,beta);
+  Test::impl_test_syrk<view_type_a_lr, view_type_c_lr, Device>(&mode[0],&mode[1],hermitian,13,15,alpha,beta);
+  Test::impl_test_syrk<view_type_a_lr, view_type_c_lr, Device>(&mode[0],&mode[1],hermitian,179,211,alpha,beta);
+  Test::impl_test_syrk<view_type_a_lr, view_type_c_lr, Device>(&mode[0],&mode[1],hermitian,12,3071,alpha,beta);
+  Test::impl_test_syrk<view_type_a_lr, view_type_c_lr, Device>(&mode[0],&mode[1],hermitian,32,4096,alpha,beta);
+#endif
+  return 1;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, syrk_float ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::syrk_float");
+    float alpha = 5.0f;
+    float beta = 3.0f;
+    test_syrk<float,float,TestExecSpace> ("LN",false,alpha,beta);
+    test_syrk<float,float,TestExecSpace> ("LT",false,alpha,beta);
+    test_syrk<float,float,TestExecSpace> ("UN",false,alpha,beta);
+    test_syrk<float,float,TestExecSpace> ("UT",false,alpha,beta);
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, syrk_double ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::syrk_double");
+    double alpha = 5.0;
+    double beta = 3.0;
+    test_syrk<double,double,TestExecSpace> ("LN",false,alpha,beta);
+    test_syrk<double,double,TestExecSpace> ("LT",false,alpha,beta);
+    test_syrk<double,double,TestExecSpace> ("UN",false,alpha,beta);
+    test_syrk<double,double,TestExecSpace> ("UT",false,alpha,beta);
+
+    alpha = 4.5;
+    beta = 0.0;
+    test_syrk<double,double,TestExecSpace> ("LN",false,alpha,beta);
+    test_syrk<double,double,TestExecSpace> ("UT",false,alpha,beta);
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, syrk_complex_double ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::syrk_complex_double");
+    Kokkos::complex<double> alpha = Kokkos::complex<double>(5.0,1.0);
+    Kokkos::complex<double> beta = Kokkos::complex<double>(3.0,-2.0);
+    test_syrk<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("LN",false,alpha,beta);
+    test_syrk<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("UT",false,alpha,beta);
+  Kokkos::Profiling::popRegion();
+}
+
+TEST_F( TestCategory, herk_complex_double ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::herk_complex_double");
+    Kokkos::complex<double> alpha = 5.0;
+    Kokkos::complex<double> beta = 3.0;
+    test_syrk<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("LN",true,alpha,beta);
+    test_syrk<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("LC",true,alpha,beta);
+    test_syrk<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("UN",true,alpha,beta);
+    test_syrk<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("UC",true,alpha,beta);
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_FLOAT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, herk_complex_float ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::herk_complex_float");
+    Kokkos::complex<float> alpha = 5.0f;
+    Kokkos::complex<float> beta = 3.0f;
+    test_syrk<Kokkos::complex<float>,Kokkos::complex<float>,TestExecSpace> ("LN",true,alpha,beta);
+    test_syrk<Kokkos::complex<float>,Kokkos::complex<float>,TestExecSpace> ("UC",true,alpha,beta);
+  Kokkos::Profiling::popRegion();
+}
+#endif
@@ -0,0 +1,153 @@
+#include<gtest/gtest.h>
+#include<Kokkos_Core.hpp>
+#include<Kokkos_Random.hpp>
+#include<KokkosBlas3_trmm.hpp>
+#include<KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+
+  template<class ViewTypeA, class ViewTypeB, class Device>
+  void impl_test_trmm(const char* side, const char* uplo, const char* trans, const char* diag,
+      int M, int N, typename ViewTypeB::value_type alpha) {
+
+    bool left = (side[0]=='L') || (side[0]=='l');
+    bool lower = (uplo[0]=='L') || (uplo[0]=='l');
+    bool A_t = (trans[0]!='N') && (trans[0]!='n');
+    bool A_c = (trans[0]=='C') || (trans[0]=='c');
+    bool unit = (diag[0]=='U') || (diag[0]=='u');
+    typedef typename ViewTypeA::device_type::execution_space execution_space;
+    typedef typename ViewTypeA::value_type ScalarA;
+    typedef typename ViewTypeB::value_type ScalarB;
+    typedef Kokkos::Details::ArithTraits<ScalarB> APT;
+    typedef typename APT::mag_type mag_type;
+
+    double machine_eps = APT::epsilon();
+
+    const int K = left?M:N;
+    ViewTypeA A("A",K,K);
+    ViewTypeB B("B",M,N);
+
+    uint64_t seed = Kokkos::Impl::clock_tic();
+    Kokkos::Random_XorShift64_Pool<execution_space> rand_pool(seed);
+
+    Kokkos::fill_random(A,rand_pool,ScalarA(10));
+    Kokkos::fill_random(B,rand_pool,ScalarB(10));
+
+    // Make A diagonally dominant so that it is well conditioned
+    typename ViewTypeA::HostMirror h_A = Kokkos::create_mirror_view(A);
+    typename ViewTypeB::HostMirror h_B = Kokkos::create_mirror_view(B);
+    Kokkos::deep_copy(h_A,A);
+    for(int i=0; i<K; i++)
+      h_A(i,i) += ScalarA(10*K);
+    Kokkos::deep_copy(A,h_A);
+    Kokkos::deep_copy(h_B,B);
+
+    KokkosBlas::trmm(side,uplo,trans,diag,alpha,A,B);
+
+    Kokkos::fence();
+
+    typename ViewTypeB::HostMirror h_result = Kokkos::create_mirror_view(B);
+    Kokkos::deep_copy(h_result,B);
+
+    auto op_A = [&] (const int i, const int j) -> ScalarA {
+      const int r = A_t?j:i;
+      const int c = A_t?i:j;
+      if(lower ? (c>r) : (c<r)) return ScalarA(0);
+      if(unit && (r==c)) return ScalarA(1);
+      return A_c?APT::conj(h_A(r,c)):h_A(r,c);
+    };
+
+    mag_type diff_B = 0;
+    for(int i=0; i<M; i++)
+      for(int j=0; j<N; j++) {
+        ScalarB R_ij = 0.0;
+          if(left)
+            for(int l=0; l<M; l++) R_ij += op_A(i,l)*h_B(l,j);
+          else
+            for(int l=0; l<N; l++) R_ij += h_B(i,l)*op_A(l,j);
+          diff_B += APT::abs(alpha*R_ij - h_result(i,j));
+      }
+
+    if( N!=0 && M!=0 ) {
+      double diff_B_average = diff_B/(N*M);
+      // Each entry is a dot product of length at most K, as in gemm
+      double diff_B_expected = 1.0*sqrt(K)*K*75*machine_eps*7*10;
+      EXPECT_TRUE( (diff_B_average < 1.05*diff_B_expected ) );
+    }
+  }
+}
+
+
+
+template<class ScalarA, class ScalarB, class Device>
+int test_trmm(const char* mode, ScalarB alpha) {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  typedef Kokkos::View<ScalarB**, Kokkos::LayoutLeft, Device> view_type_b_ll;
+  Test::impl_test_trmm<view_type_a_ll, view_type_b_ll, Device>(&mode[0],&mode[1],&mode[2],&mode[3],0,0,alpha);
+  Test::impl_test_trmm<view_type_a_ll, view_type_b_ll, Device>(&mode[0],&mode[1],&mode[2],&mode[3],13,15,alpha);
+  Test::impl_test_trmm<view_type_a_ll, view_type_b_ll, Device>(&mode[0],&mode[1],&mode[2],&mode[3],179,15,alpha);
+  Test::impl_test_trmm<view_type_a_ll, view_type_b_ll, Device>(&mode[0],&mode[1],&mode[2],&mode[3],1031,17,alpha);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutRight, Device> view_type_a_lr;
+  typedef Kokkos::View<ScalarB**, Kokkos::LayoutRight, Device> view_type_b_lr;
+  Test::impl_test_trmm<view_type_a_lr, view_type_b_lr, Device>(&mode[0],&mode[1],&mode[2],&mode[3],0,0,alpha);
+  Test::impl_test_trmm<view_type_a_lr, view_type_b_lr, Device>(&mode[0],&mode[1],&mode[2],&mode[3],13,15,alpha);
+  Test::impl_test_trmm<view_type_a_lr, view_type_b_lr, Device>(&mode[0],&mode[1],&mode[2],&mode[3],179,15,alpha);
+  Test::impl_test_trmm<view_type_a_lr, view_type_b_lr, Device>(&mode[0],&mode[1],&mode[2],&mode[3],1031,17,alpha);
+#endif
+  return 1;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, trmm_float ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::trmm_float");
+    float alpha = 2.0f;
+    test_trmm<float,float,TestExecSpace> ("LLNN",alpha);
+    test_trmm<float,float,TestExecSpace> ("LUTN",alpha);
+    test_trmm<float,float,TestExecSpace> ("RLTU",alpha);
+    test_trmm<float,float,TestExecSpace> ("RUNU",alpha);
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, trmm_double ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::trmm_double");
+    double alpha = 2.0;
+    test_trmm<double,double,TestExecSpace> ("LLNN",alpha);
+    test_trmm<double,double,TestExecSpace> ("LLTU",alpha);
+    test_trmm<double,double,TestExecSpace> ("LUNU",alpha);
+    test_trmm<double,double,TestExecSpace> ("LUTN",alpha);
+    test_trmm<double,double,TestExecSpace> ("RLNU",alpha);
+    test_trmm<double,double,TestExecSpace> ("RLTN",alpha);
+    test_trmm<double,double,TestExecSpace> ("RUNN",alpha);
+    test_trmm<double,double,TestExecSpace> ("RUTU",alpha);
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, trmm_complex_double ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::trmm_complex_double");
+    Kokkos::complex<double> alpha = Kokkos::complex<double>(2.0,1.0);
+    test_trmm<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("LLNN",alpha);
+    test_trmm<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("LUCN",alpha);
+    test_trmm<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("RLCU",alpha);
+    test_trmm<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("RUTN",alpha);
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_FLOAT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, trmm_complex_float ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::trmm_complex_float");
+    Kokkos::complex<float> alpha = Kokkos::complex<float>(2.0f,1.0f);
+    test_trmm<Kokkos::complex<float>,Kokkos::complex<float>,TestExecSpace> ("LLCN",alpha);
+    test_trmm<Kokkos::complex<float>,Kokkos::complex<float>,TestExecSpace> ("RUCU",alpha);
+  Kokkos::Profiling::popRegion();
+}
+#endif
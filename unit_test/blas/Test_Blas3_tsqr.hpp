@@ -0,0 +1,119 @@
+#include<gtest/gtest.h>
+#include<Kokkos_Core.hpp>
+#include<Kokkos_Random.hpp>
+#include<KokkosBlas.hpp>
+#include<KokkosBlas3_tsqr.hpp>
+#include<KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+
+  template<class ViewTypeA, class Device>
+  void impl_test_tsqr(int M, int K) {
+
+    typedef typename ViewTypeA::device_type::execution_space execution_space;
+    typedef typename ViewTypeA::value_type ScalarA;
+    typedef Kokkos::Details::ArithTraits<ScalarA> APT;
+    typedef typename APT::mag_type mag_type;
+
+    double machine_eps = APT::epsilon();
+
+    ViewTypeA A("A",M,K);
+    ViewTypeA Q("Q",M,K);
+    ViewTypeA R("R",K,K);
+
+    uint64_t seed = Kokkos::Impl::clock_tic();
+    Kokkos::Random_XorShift64_Pool<execution_space> rand_pool(seed);
+
+    Kokkos::fill_random(A,rand_pool,ScalarA(10));
+
+    KokkosBlas::Experimental::tsqr(A,Q,R);
+
+    Kokkos::fence();
+
+    typename ViewTypeA::HostMirror h_A = Kokkos::create_mirror_view(A);
+    typename ViewTypeA::HostMirror h_Q = Kokkos::create_mirror_view(Q);
+    typename ViewTypeA::HostMirror h_R = Kokkos::create_mirror_view(R);
+    Kokkos::deep_copy(h_A,A);
+    Kokkos::deep_copy(h_Q,Q);
+    Kokkos::deep_copy(h_R,R);
+
+    // R is upper triangular with a real non-negative diagonal
+    bool R_is_upper = true;
+    for(int i=0; i<K; i++) {
+      if((APT::real(h_R(i,i)) < 0) || (APT::imag(h_R(i,i)) != 0))
+        R_is_upper = false;
+      for(int j=0; j<i; j++)
+        if(h_R(i,j) != ScalarA(0))
+          R_is_upper = false;
+    }
+    EXPECT_TRUE( R_is_upper );
+
+    // Q^H*Q = I
+    mag_type diff_QQ = 0;
+    for(int i=0; i<K; i++)
+      for(int j=0; j<K; j++) {
+        ScalarA QQ_ij = 0.0;
+        for(int l=0; l<M; l++)
+          QQ_ij += APT::conj(h_Q(l,i))*h_Q(l,j);
+        const mag_type diff = APT::abs(QQ_ij - ScalarA(i==j?1:0));
+        diff_QQ = diff > diff_QQ ? diff : diff_QQ;
+      }
+
+    // Q*R = A
+    mag_type diff_QR = 0;
+    for(int i=0; i<M; i++)
+      for(int j=0; j<K; j++) {
+        ScalarA QR_ij = 0.0;
+        for(int l=0; l<=j; l++)
+          QR_ij += h_Q(i,l)*h_R(l,j);
+        const mag_type diff = APT::abs(QR_ij - h_A(i,j));
+        diff_QR = diff > diff_QR ? diff : diff_QR;
+      }
+
+    // Householder QR is backward stable: errors grow with k and the
+    // number of rows per block, not with the condition number.
+    double diff_expected = 1000.0*K*machine_eps;
+    EXPECT_TRUE( (diff_QQ < diff_expected) );
+    EXPECT_TRUE( (diff_QR < 10*diff_expected) );
+  }
+}
+
+
+
+template<class ScalarA, class Device>
+int test_tsqr() {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  Test::impl_test_tsqr<view_type_a_ll, Device>(0,0);
+  Test::impl_test_tsqr<view_type_a_ll, Device>(13,13);
+  Test::impl_test_tsqr<view_type_a_ll, Device>(1000,8);
+  Test::impl_test_tsqr<view_type_a_ll, Device>(12345,17);
+  Test::impl_test_tsqr<view_type_a_ll, Device>(20011,32);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutRight, Device> view_type_a_lr;
+  Test::impl_test_tsqr<view_type_a_lr, Device>(0,0);
+  Test::impl_test_tsqr<view_type_a_lr, Device>(13,13);
+  Test::impl_test_tsqr<view_type_a_lr, Device>(1000,8);
+  Test::impl_test_tsqr<view_type_a_lr, Device>(12345,17);
+#endif
+  return 1;
+}
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, tsqr_double ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::tsqr_double");
+    test_tsqr<double,TestExecSpace> ();
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, tsqr_complex_double ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::tsqr_complex_double");
+    test_tsqr<Kokkos::complex<double>,TestExecSpace> ();
+  Kokkos::Profiling::popRegion();
+}
+#endif
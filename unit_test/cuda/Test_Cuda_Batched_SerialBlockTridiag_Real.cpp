@@ -0,0 +1,3 @@
+#include "Test_Cuda.hpp"
+#include "Test_Batched_SerialBlockTridiag.hpp"
+#include "Test_Batched_SerialBlockTridiag_Real.hpp"
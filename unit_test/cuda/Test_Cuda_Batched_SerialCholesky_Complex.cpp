@@ -0,0 +1,3 @@
+#include "Test_Cuda.hpp"
+#include "Test_Batched_SerialCholesky.hpp"
+#include "Test_Batched_SerialCholesky_Complex.hpp"
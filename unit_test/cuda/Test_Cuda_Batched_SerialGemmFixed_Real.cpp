@@ -0,0 +1,3 @@
+#include "Test_Cuda.hpp"
+#include "Test_Batched_SerialGemmFixed.hpp"
+#include "Test_Batched_SerialGemmFixed_Real.hpp"
@@ -0,0 +1,3 @@
+#include "Test_Cuda.hpp"
+#include "Test_Batched_SerialLUFixed.hpp"
+#include "Test_Batched_SerialLUFixed_Complex.hpp"
@@ -0,0 +1,3 @@
+#include "Test_Cuda.hpp"
+#include "Test_Batched_TeamBlockTridiag.hpp"
+#include "Test_Batched_TeamBlockTridiag_Real.hpp"
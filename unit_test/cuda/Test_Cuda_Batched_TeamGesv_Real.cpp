@@ -0,0 +1,3 @@
+#include "Test_Cuda.hpp"
+#include "Test_Batched_TeamGesv.hpp"
+#include "Test_Batched_TeamGesv_Real.hpp"
@@ -0,0 +1,3 @@
+#include "Test_Cuda.hpp"
+#include "Test_Batched_TeamQR.hpp"
+#include "Test_Batched_TeamQR_Complex.hpp"
@@ -0,0 +1,3 @@
+#include "Test_Cuda.hpp"
+#include "Test_Batched_VarBatchedGemm.hpp"
+#include "Test_Batched_VarBatchedGemm_Complex.hpp"
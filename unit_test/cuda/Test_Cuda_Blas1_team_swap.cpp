@@ -0,0 +1,4 @@
+#include<Test_Cuda.hpp>
+#ifdef KOKKOS_ENABLE_CUDA_LAMBDA
+#include<Test_Blas1_team_swap.hpp>
+#endif
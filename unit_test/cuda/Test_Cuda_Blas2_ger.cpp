@@ -0,0 +1,2 @@
+#include<Test_Cuda.hpp>
+#include<Test_Blas2_ger.hpp>
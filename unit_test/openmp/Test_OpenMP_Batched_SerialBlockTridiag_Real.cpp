@@ -0,0 +1,3 @@
+#include "Test_OpenMP.hpp"
+#include "Test_Batched_SerialBlockTridiag.hpp"
+#include "Test_Batched_SerialBlockTridiag_Real.hpp"
@@ -0,0 +1,3 @@
+#include "Test_OpenMP.hpp"
+#include "Test_Batched_SerialGesvMixed.hpp"
+#include "Test_Batched_SerialGesvMixed_Real.hpp"
@@ -0,0 +1,3 @@
+#include "Test_OpenMP.hpp"
+#include "Test_Batched_SerialGesv.hpp"
+#include "Test_Batched_SerialGesv_Complex.hpp"
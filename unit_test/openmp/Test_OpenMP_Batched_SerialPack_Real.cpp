@@ -0,0 +1,3 @@
+#include "Test_OpenMP.hpp"
+#include "Test_Batched_SerialPack.hpp"
+#include "Test_Batched_SerialPack_Real.hpp"
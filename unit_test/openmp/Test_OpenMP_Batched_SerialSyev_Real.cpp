@@ -0,0 +1,3 @@
+#include "Test_OpenMP.hpp"
+#include "Test_Batched_SerialSyev.hpp"
+#include "Test_Batched_SerialSyev_Real.hpp"
@@ -0,0 +1,3 @@
+#include "Test_OpenMP.hpp"
+#include "Test_Batched_TeamBlockTridiag.hpp"
+#include "Test_Batched_TeamBlockTridiag_Complex.hpp"
@@ -0,0 +1,3 @@
+#include "Test_OpenMP.hpp"
+#include "Test_Batched_TeamGesv.hpp"
+#include "Test_Batched_TeamGesv_Complex.hpp"
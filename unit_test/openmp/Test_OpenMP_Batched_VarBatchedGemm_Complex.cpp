@@ -0,0 +1,3 @@
+#include "Test_OpenMP.hpp"
+#include "Test_Batched_VarBatchedGemm.hpp"
+#include "Test_Batched_VarBatchedGemm_Complex.hpp"
@@ -0,0 +1,3 @@
+#include "Test_OpenMP.hpp"
+#include "Test_Batched_VarBatchedLU.hpp"
+#include "Test_Batched_VarBatchedLU_Complex.hpp"
@@ -0,0 +1,3 @@
+#include "Test_Serial.hpp"
+#include "Test_Batched_SerialBlockTridiag.hpp"
+#include "Test_Batched_SerialBlockTridiag_Complex.hpp"
@@ -0,0 +1,3 @@
+#include "Test_Serial.hpp"
+#include "Test_Batched_SerialPack.hpp"
+#include "Test_Batched_SerialPack_Complex.hpp"
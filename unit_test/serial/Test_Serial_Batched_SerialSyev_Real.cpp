@@ -0,0 +1,3 @@
+#include "Test_Serial.hpp"
+#include "Test_Batched_SerialSyev.hpp"
+#include "Test_Batched_SerialSyev_Real.hpp"
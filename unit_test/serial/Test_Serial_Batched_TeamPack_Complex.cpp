@@ -0,0 +1,3 @@
+#include "Test_Serial.hpp"
+#include "Test_Batched_TeamPack.hpp"
+#include "Test_Batched_TeamPack_Complex.hpp"
@@ -0,0 +1,3 @@
+#include "Test_Serial.hpp"
+#include "Test_Batched_TeamSyev.hpp"
+#include "Test_Batched_TeamSyev_Real.hpp"
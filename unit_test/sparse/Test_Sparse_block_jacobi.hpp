@@ -0,0 +1,399 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+#include "KokkosKernels_IOUtils.hpp"
+#include <KokkosSparse_spmv.hpp>
+#include <cstdlib>
+#include <iostream>
+#include <complex>
+#include "KokkosSparse_BlockCrsMatrix.hpp"
+#include "KokkosSparse_block_jacobi.hpp"
+
+#ifndef kokkos_complex_double
+#define kokkos_complex_double Kokkos::complex<double>
+#define kokkos_complex_float Kokkos::complex<float>
+#endif
+
+template <typename scalar_t, typename lno_t, typename size_type, typename device>
+void test_block_jacobi(lno_t numRows, size_type nnz, lno_t bandwidth, lno_t row_size_variance, lno_t block_size) {
+
+  srand(245);
+  typedef typename KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type> crsMat_t;
+  typedef typename crsMat_t::values_type::non_const_type scalar_view_t;
+  typedef Kokkos::View<scalar_t ***, device> diag_blocks_t;
+  typedef typename Kokkos::Details::ArithTraits<scalar_t>::mag_type mag_t;
+
+  lno_t numCols = numRows;
+  crsMat_t input_mat = KokkosKernels::Impl::kk_generate_diagonally_dominant_sparse_matrix<crsMat_t>(numRows,numCols,nnz,row_size_variance, bandwidth);
+  lno_t nv = input_mat.numRows();
+  lno_t num_blocks = (nv + block_size - 1) / block_size;
+
+  scalar_view_t y_vector ("y vector", nv);
+  typename scalar_view_t::HostMirror h_y = Kokkos::create_mirror_view (y_vector);
+  for (lno_t i = 0; i < nv; ++i){
+    h_y(i) = static_cast <scalar_t> (rand()) / static_cast <scalar_t> (RAND_MAX / 10.0);
+  }
+  Kokkos::deep_copy (y_vector, h_y);
+
+  auto h_row_map = Kokkos::create_mirror_view (input_mat.graph.row_map);
+  auto h_entries = Kokkos::create_mirror_view (input_mat.graph.entries);
+  auto h_values = Kokkos::create_mirror_view (input_mat.values);
+  Kokkos::deep_copy (h_row_map, input_mat.graph.row_map);
+  Kokkos::deep_copy (h_entries, input_mat.graph.entries);
+  Kokkos::deep_copy (h_values, input_mat.values);
+
+  for (int explicit_inverse = 0; explicit_inverse < 2; ++explicit_inverse){
+    diag_blocks_t D ("D", num_blocks, block_size, block_size);
+    KokkosSparse::getDiagBlocksCopy (D, input_mat);
+    KokkosSparse::Experimental::block_jacobi_numeric (D, explicit_inverse);
+
+    scalar_view_t x_vector ("x vector", nv);
+    KokkosSparse::Experimental::block_jacobi_apply (D, x_vector, y_vector, explicit_inverse);
+
+    //x solves the block diagonal part of A, so the residual restricted
+    //to the diagonal blocks must vanish.
+    typename scalar_view_t::HostMirror h_x = Kokkos::create_mirror_view (x_vector);
+    Kokkos::deep_copy (h_x, x_vector);
+    mag_t residual_norm = 0, y_norm = 0;
+    for (lno_t i = 0; i < nv; ++i){
+      const lno_t block_begin = (i / block_size) * block_size;
+      scalar_t sum = Kokkos::Details::ArithTraits<scalar_t>::zero();
+      for (size_type k = h_row_map(i); k < h_row_map(i + 1); ++k){
+        const lno_t col = h_entries(k);
+        if (col >= block_begin && col < block_begin + block_size && col < nv){
+          sum += h_values(k) * h_x(col);
+        }
+      }
+      const mag_t diff = Kokkos::Details::ArithTraits<scalar_t>::abs (h_y(i) - sum);
+      residual_norm += diff * diff;
+      y_norm += Kokkos::Details::ArithTraits<scalar_t>::abs (h_y(i)) * Kokkos::Details::ArithTraits<scalar_t>::abs (h_y(i));
+    }
+    const mag_t eps = 1000 * Kokkos::Details::ArithTraits<mag_t>::epsilon();
+    EXPECT_TRUE( (residual_norm <= eps * eps * y_norm * nv));
+  }
+}
+
+//Checks D0_i * inv(D0_i) = I for the blocks inverted by block_jacobi_numeric.
+template <typename diag_blocks_t>
+void check_block_inverses(const diag_blocks_t &D0, const diag_blocks_t &Dinv) {
+  typedef typename diag_blocks_t::non_const_value_type scalar_t;
+  typedef typename Kokkos::Details::ArithTraits<scalar_t>::mag_type mag_t;
+  typedef Kokkos::Details::ArithTraits<scalar_t> ats;
+
+  typename diag_blocks_t::HostMirror h_D0 = Kokkos::create_mirror_view (D0);
+  typename diag_blocks_t::HostMirror h_Dinv = Kokkos::create_mirror_view (Dinv);
+  Kokkos::deep_copy (h_D0, D0);
+  Kokkos::deep_copy (h_Dinv, Dinv);
+
+  const mag_t eps = 1000 * Kokkos::Details::ArithTraits<mag_t>::epsilon();
+  const int num_blocks = D0.extent(0), block_size = D0.extent(1);
+  mag_t diff = 0;
+  for (int b = 0; b < num_blocks; ++b){
+    for (int i = 0; i < block_size; ++i){
+      for (int j = 0; j < block_size; ++j){
+        scalar_t sum = (i == j) ? -ats::one() : ats::zero();
+        for (int k = 0; k < block_size; ++k){
+          sum += h_D0(b, i, k) * h_Dinv(b, k, j);
+        }
+        diff += ats::abs (sum);
+      }
+    }
+  }
+  EXPECT_TRUE( (diff <= eps * num_blocks * block_size * block_size));
+}
+
+//Runs the compact SIMD factorization directly, so that it is covered
+//next to the scalar factor functor above.
+template <typename diag_blocks_t,
+          bool is_host = std::is_same<typename diag_blocks_t::memory_space, Kokkos::HostSpace>::value>
+struct test_block_jacobi_compact {
+  static void run(const diag_blocks_t &) {}
+};
+
+template <typename diag_blocks_t>
+struct test_block_jacobi_compact<diag_blocks_t, true> {
+  static void run(const diag_blocks_t &D0) {
+    diag_blocks_t D ("D", D0.extent(0), D0.extent(1), D0.extent(2));
+    Kokkos::deep_copy (D, D0);
+    KokkosSparse::Impl::block_jacobi_numeric_impl (D, true, std::true_type ());
+    Kokkos::fence ();
+    check_block_inverses (D0, D);
+  }
+};
+
+//InverseLU relies on its workspace being zero off the diagonal;
+//the factor functor must not depend on how the workspace was allocated.
+template <typename scalar_t, typename lno_t, typename size_type, typename device>
+void test_block_jacobi_inverse(lno_t numRows, size_type nnz, lno_t bandwidth, lno_t row_size_variance, lno_t block_size) {
+
+  srand(245);
+  typedef typename KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type> crsMat_t;
+  typedef Kokkos::View<scalar_t ***, device> diag_blocks_t;
+  typedef Kokkos::View<scalar_t **, Kokkos::LayoutRight, device> work_t;
+
+  lno_t numCols = numRows;
+  crsMat_t input_mat = KokkosKernels::Impl::kk_generate_diagonally_dominant_sparse_matrix<crsMat_t>(numRows,numCols,nnz,row_size_variance, bandwidth);
+  lno_t nv = input_mat.numRows();
+  lno_t num_blocks = (nv + block_size - 1) / block_size;
+
+  diag_blocks_t D0 ("D0", num_blocks, block_size, block_size);
+  KokkosSparse::getDiagBlocksCopy (D0, input_mat);
+
+  //poisoned workspace
+  {
+    diag_blocks_t D ("D", num_blocks, block_size, block_size);
+    Kokkos::deep_copy (D, D0);
+    work_t W (Kokkos::ViewAllocateWithoutInitializing ("W"), num_blocks, block_size * block_size);
+    Kokkos::deep_copy (W, static_cast<scalar_t> (12345));
+
+    KokkosSparse::Impl::BlockJacobiFactorFunctor<diag_blocks_t, work_t> functor (D, W, true);
+    Kokkos::parallel_for ("KokkosSparse::Test::block_jacobi_factor",
+                          Kokkos::RangePolicy<typename device::execution_space> (0, num_blocks), functor);
+    Kokkos::fence ();
+    check_block_inverses (D0, D);
+  }
+
+  //workspace allocated by block_jacobi_numeric
+  {
+    diag_blocks_t D ("D", num_blocks, block_size, block_size);
+    Kokkos::deep_copy (D, D0);
+    KokkosSparse::Experimental::block_jacobi_numeric (D, true);
+    Kokkos::fence ();
+    check_block_inverses (D0, D);
+  }
+
+  //compact SIMD layout, including a partially filled last pack
+  test_block_jacobi_compact<diag_blocks_t>::run (D0);
+}
+
+//Block tridiagonal BlockCrsMatrix; each block row stores its blocks in
+//the order b+1, b, b-1, so the diagonal block is not the first one.
+template <typename scalar_t, typename lno_t, typename size_type, typename device>
+void test_block_jacobi_block_crs(lno_t numBlockRows, lno_t blockDim) {
+
+  typedef typename KokkosSparse::Experimental::BlockCrsMatrix<scalar_t, lno_t, device, void, size_type> bcrsMat_t;
+  typedef typename bcrsMat_t::staticcrsgraph_type graph_t;
+  typedef typename bcrsMat_t::row_map_type::non_const_type row_map_t;
+  typedef typename bcrsMat_t::index_type::non_const_type entries_t;
+  typedef typename bcrsMat_t::values_type::non_const_type values_t;
+  typedef Kokkos::View<scalar_t ***, device> diag_blocks_t;
+
+  row_map_t row_map ("row_map", numBlockRows + 1);
+  typename row_map_t::HostMirror h_row_map = Kokkos::create_mirror_view (row_map);
+  h_row_map(0) = 0;
+  for (lno_t b = 0; b < numBlockRows; ++b){
+    h_row_map(b + 1) = h_row_map(b) + 1 + (b > 0) + (b + 1 < numBlockRows);
+  }
+  const size_type numBlocks = h_row_map(numBlockRows);
+
+  entries_t entries ("entries", numBlocks);
+  values_t values ("values", numBlocks * blockDim * blockDim);
+  typename entries_t::HostMirror h_entries = Kokkos::create_mirror_view (entries);
+  typename values_t::HostMirror h_values = Kokkos::create_mirror_view (values);
+
+  diag_blocks_t D0 ("D0", numBlockRows, blockDim, blockDim);
+  typename diag_blocks_t::HostMirror h_D0 = Kokkos::create_mirror_view (D0);
+
+  for (lno_t b = 0; b < numBlockRows; ++b){
+    const size_type start = h_row_map(b);
+    const lno_t length = h_row_map(b + 1) - start;
+    lno_t K = 0;
+    for (lno_t col = b + 1; col >= b - 1; --col){
+      if (col < 0 || col >= numBlockRows) continue;
+      h_entries(start + K) = col;
+      //values of block K of a block row are stored row by row across the block row
+      for (lno_t i = 0; i < blockDim; ++i){
+        for (lno_t j = 0; j < blockDim; ++j){
+          scalar_t val = static_cast<scalar_t> ((7 * i + 3 * j + 5 * b + col) % 11) / static_cast<scalar_t> (11);
+          if (col == b){
+            if (i == j) val += static_cast<scalar_t> (2 * blockDim);
+            h_D0(b, i, j) = val;
+          }
+          h_values(start * blockDim * blockDim + K * blockDim + i * length * blockDim + j) = val;
+        }
+      }
+      ++K;
+    }
+  }
+  Kokkos::deep_copy (row_map, h_row_map);
+  Kokkos::deep_copy (entries, h_entries);
+  Kokkos::deep_copy (values, h_values);
+  Kokkos::deep_copy (D0, h_D0);
+
+  graph_t graph (entries, row_map);
+  bcrsMat_t A ("A", numBlockRows, values, graph, blockDim);
+
+  diag_blocks_t D ("D", numBlockRows, blockDim, blockDim);
+  KokkosSparse::getDiagBlocksCopy (D, A);
+
+  typename diag_blocks_t::HostMirror h_D = Kokkos::create_mirror_view (D);
+  Kokkos::deep_copy (h_D, D);
+  typename Kokkos::Details::ArithTraits<scalar_t>::mag_type diff = 0;
+  for (lno_t b = 0; b < numBlockRows; ++b){
+    for (lno_t i = 0; i < blockDim; ++i){
+      for (lno_t j = 0; j < blockDim; ++j){
+        diff += Kokkos::Details::ArithTraits<scalar_t>::abs (h_D(b, i, j) - h_D0(b, i, j));
+      }
+    }
+  }
+  EXPECT_TRUE( (diff == 0));
+
+  KokkosSparse::Experimental::block_jacobi_numeric (D, true);
+  Kokkos::fence ();
+  check_block_inverses (D0, D);
+}
+
+#define EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE) \
+TEST_F( TestCategory, sparse ## _ ## block_jacobi ## _ ## SCALAR ## _ ## ORDINAL ## _ ## OFFSET ## _ ## DEVICE ) { \
+  test_block_jacobi<SCALAR,ORDINAL,OFFSET,DEVICE>(1003, 1003 * 20, 50, 10, 7); \
+  test_block_jacobi<SCALAR,ORDINAL,OFFSET,DEVICE>(1000, 1000 * 20, 50, 10, 4); \
+  test_block_jacobi_inverse<SCALAR,ORDINAL,OFFSET,DEVICE>(1003, 1003 * 20, 50, 10, 7); \
+  test_block_jacobi_block_crs<SCALAR,ORDINAL,OFFSET,DEVICE>(101, 5); \
+  test_block_jacobi_block_crs<SCALAR,ORDINAL,OFFSET,DEVICE>(1, 3); \
+}
+
+
+#if (defined (KOKKOSKERNELS_INST_DOUBLE) \
+ && defined (KOKKOSKERNELS_INST_ORDINAL_INT) \
+ && defined (KOKKOSKERNELS_INST_OFFSET_INT) ) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+ EXECUTE_TEST(double, int, int, TestExecSpace)
+#endif
+
+#if (defined (KOKKOSKERNELS_INST_DOUBLE) \
+ && defined (KOKKOSKERNELS_INST_ORDINAL_INT64_T) \
+ && defined (KOKKOSKERNELS_INST_OFFSET_INT) ) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+ EXECUTE_TEST(double, int64_t, int, TestExecSpace)
+#endif
+
+#if (defined (KOKKOSKERNELS_INST_DOUBLE) \
+ && defined (KOKKOSKERNELS_INST_ORDINAL_INT) \
+ && defined (KOKKOSKERNELS_INST_OFFSET_SIZE_T) ) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+ EXECUTE_TEST(double, int, size_t, TestExecSpace)
+#endif
+
+#if (defined (KOKKOSKERNELS_INST_DOUBLE) \
+ && defined (KOKKOSKERNELS_INST_ORDINAL_INT64_T) \
+ && defined (KOKKOSKERNELS_INST_OFFSET_SIZE_T) ) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+ EXECUTE_TEST(double, int64_t, size_t, TestExecSpace)
+#endif
+
+#if (defined (KOKKOSKERNELS_INST_FLOAT) \
+ && defined (KOKKOSKERNELS_INST_ORDINAL_INT) \
+ && defined (KOKKOSKERNELS_INST_OFFSET_INT) ) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+ EXECUTE_TEST(float, int, int, TestExecSpace)
+#endif
+
+#if (defined (KOKKOSKERNELS_INST_FLOAT) \
+ && defined (KOKKOSKERNELS_INST_ORDINAL_INT64_T) \
+ && defined (KOKKOSKERNELS_INST_OFFSET_INT) ) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+ EXECUTE_TEST(float, int64_t, int, TestExecSpace)
+#endif
+
+#if (defined (KOKKOSKERNELS_INST_FLOAT) \
+ && defined (KOKKOSKERNELS_INST_ORDINAL_INT) \
+ && defined (KOKKOSKERNELS_INST_OFFSET_SIZE_T) ) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+ EXECUTE_TEST(float, int, size_t, TestExecSpace)
+#endif
+
+#if (defined (KOKKOSKERNELS_INST_FLOAT) \
+ && defined (KOKKOSKERNELS_INST_ORDINAL_INT64_T) \
+ && defined (KOKKOSKERNELS_INST_OFFSET_SIZE_T) ) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+ EXECUTE_TEST(float, int64_t, size_t, TestExecSpace)
+#endif
+
+
+#if (defined (KOKKOSKERNELS_INST_KOKKOS_COMPLEX_DOUBLE_) \
+ && defined (KOKKOSKERNELS_INST_ORDINAL_INT) \
+ && defined (KOKKOSKERNELS_INST_OFFSET_INT) ) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+ EXECUTE_TEST(kokkos_complex_double, int, int, TestExecSpace)
+#endif
+
+#if (defined (KOKKOSKERNELS_INST_KOKKOS_COMPLEX_DOUBLE_) \
+ && defined (KOKKOSKERNELS_INST_ORDINAL_INT64_T) \
+ && defined (KOKKOSKERNELS_INST_OFFSET_INT) ) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+ EXECUTE_TEST(kokkos_complex_double, int64_t, int, TestExecSpace)
+#endif
+
+#if (defined (KOKKOSKERNELS_INST_KOKKOS_COMPLEX_DOUBLE_) \
+ && defined (KOKKOSKERNELS_INST_ORDINAL_INT) \
+ && defined (KOKKOSKERNELS_INST_OFFSET_SIZE_T) ) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+ EXECUTE_TEST(kokkos_complex_double, int, size_t, TestExecSpace)
+#endif
+
+#if (defined (KOKKOSKERNELS_INST_KOKKOS_COMPLEX_DOUBLE_) \
+ && defined (KOKKOSKERNELS_INST_ORDINAL_INT64_T) \
+ && defined (KOKKOSKERNELS_INST_OFFSET_SIZE_T) ) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+ EXECUTE_TEST(kokkos_complex_double, int64_t, size_t, TestExecSpace)
+#endif
+
+#if (defined (KOKKOSKERNELS_INST_KOKKOS_COMPLEX_FLOAT_) \
+ && defined (KOKKOSKERNELS_INST_ORDINAL_INT) \
+ && defined (KOKKOSKERNELS_INST_OFFSET_INT) ) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+ EXECUTE_TEST(kokkos_complex_float, int, int, TestExecSpace)
+#endif
+
+#if (defined (KOKKOSKERNELS_INST_KOKKOS_COMPLEX_FLOAT_) \
+ && defined (KOKKOSKERNELS_INST_ORDINAL_INT64_T) \
+ && defined (KOKKOSKERNELS_INST_OFFSET_INT) ) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+ EXECUTE_TEST(kokkos_complex_float, int64_t, int, TestExecSpace)
+#endif
+
+#if (defined (KOKKOSKERNELS_INST_KOKKOS_COMPLEX_FLOAT_) \
+ && defined (KOKKOSKERNELS_INST_ORDINAL_INT) \
+ && defined (KOKKOSKERNELS_INST_OFFSET_SIZE_T) ) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+ EXECUTE_TEST(kokkos_complex_float, int, size_t, TestExecSpace)
+#endif
+
+#if (defined (KOKKOSKERNELS_INST_KOKKOS_COMPLEX_FLOAT_) \
+ && defined (KOKKOSKERNELS_INST_ORDINAL_INT64_T) \
+ && defined (KOKKOSKERNELS_INST_OFFSET_SIZE_T) ) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+ EXECUTE_TEST(kokkos_complex_float, int64_t, size_t, TestExecSpace)
+#endif
+
+
+
+
@@ -197,13 +197,13 @@ void test_gauss_seidel(lno_t numRows, size_type nnz, lno_t bandwidth, lno_t row_
   const scalar_view_t solution_x = create_x_vector<scalar_view_t>(nv);
   scalar_view_t y_vector = create_y_vector(input_mat, solution_x);
 #ifdef gauss_seidel_testmore
-  GSAlgorithm gs_algorithms[] ={GS_DEFAULT, GS_TEAM, GS_PERMUTED};
+  GSAlgorithm gs_algorithms[] ={GS_DEFAULT, GS_TEAM, GS_PERMUTED, GS_TWOSTAGE, GS_CLUSTER};
   int apply_count = 3;
-  for (int ii = 0; ii < 3; ++ii){
+  for (int ii = 0; ii < 5; ++ii){
 #else
   int apply_count = 1;
-  GSAlgorithm gs_algorithms[] ={GS_DEFAULT};
-  for (int ii = 0; ii < 1; ++ii){
+  GSAlgorithm gs_algorithms[] ={GS_DEFAULT, GS_TWOSTAGE, GS_CLUSTER};
+  for (int ii = 0; ii < 3; ++ii){
 #endif
     GSAlgorithm gs_algorithm = gs_algorithms[ii];
     scalar_view_t x_vector ("x vector", nv);
@@ -244,16 +244,94 @@ void test_gauss_seidel(lno_t numRows, size_type nnz, lno_t bandwidth, lno_t row_
         }
       }
     }
+
+    //omega = 0 should not change x, for every sweep direction.
+    for (int apply_type = 0; apply_type < apply_count; ++apply_type){
+      Kokkos::deep_copy (x_vector , 0);
+      run_gauss_seidel_1<crsMat_t, device>(input_mat, gs_algorithm, x_vector, y_vector, true, apply_type, false, false,
+                                           Kokkos::Details::ArithTraits<scalar_t>::zero());
+      scalar_t zero_omega_dot_product = KokkosBlas::dot( x_vector , x_vector );
+      EXPECT_TRUE( (Kokkos::Details::ArithTraits<scalar_t>::abs (zero_omega_dot_product) == 0));
+    }
   }
   //device::execution_space::finalize();
 }
 
 
+template <typename scalar_t, typename lno_t, typename size_type, typename device>
+void test_gauss_seidel_multivector(lno_t numRows, size_type nnz, lno_t bandwidth, lno_t row_size_variance, lno_t num_vectors) {
+
+  using namespace Test;
+  srand(245);
+  typedef typename KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type> crsMat_t;
+  typedef Kokkos::View<scalar_t **, Kokkos::LayoutLeft, device> scalar_view2d_t;
+  typedef KokkosKernelsHandle
+      <size_type,lno_t, scalar_t,
+      typename device::execution_space, typename device::memory_space,typename device::memory_space > KernelHandle;
+  typedef typename Kokkos::Details::ArithTraits<scalar_t>::mag_type mag_t;
+
+  lno_t numCols = numRows;
+  crsMat_t input_mat = KokkosKernels::Impl::kk_generate_diagonally_dominant_sparse_matrix<crsMat_t>(numRows,numCols,nnz,row_size_variance, bandwidth);
+  lno_t nv = input_mat.numRows();
+
+  scalar_view2d_t solution_x ("sol", nv, num_vectors);
+  typename scalar_view2d_t::HostMirror h_solution_x = Kokkos::create_mirror_view (solution_x);
+  for (lno_t i = 0; i < nv; ++i){
+    for (lno_t j = 0; j < num_vectors; ++j){
+      h_solution_x(i, j) = static_cast <scalar_t> (rand()) / static_cast <scalar_t> (RAND_MAX / 10.0);
+    }
+  }
+  Kokkos::deep_copy (solution_x, h_solution_x);
+  scalar_view2d_t y_vector ("y vector", nv, num_vectors);
+  KokkosSparse::spmv("N", 1, input_mat, solution_x, 0, y_vector);
+
+  GSAlgorithm gs_algorithms[] ={GS_DEFAULT, GS_TEAM, GS_PERMUTED};
+  for (int ii = 0; ii < 3; ++ii){
+    scalar_view2d_t x_vector ("x vector", nv, num_vectors);
+
+    KernelHandle kh;
+    kh.create_gs_handle(gs_algorithms[ii]);
+    gauss_seidel_symbolic
+      (&kh, nv, nv, input_mat.graph.row_map, input_mat.graph.entries, true);
+    gauss_seidel_numeric
+      (&kh, nv, nv, input_mat.graph.row_map, input_mat.graph.entries, input_mat.values, true);
+    symmetric_gauss_seidel_apply
+      (&kh, nv, nv, input_mat.graph.row_map, input_mat.graph.entries, input_mat.values, x_vector, y_vector, true, true, 0.9, 10);
+    kh.destroy_gs_handle();
+
+    //every vector should converge towards its own solution.
+    typename scalar_view2d_t::HostMirror h_x = Kokkos::create_mirror_view (x_vector);
+    Kokkos::deep_copy (h_x, x_vector);
+    for (lno_t j = 0; j < num_vectors; ++j){
+      mag_t initial_norm = 0, result_norm = 0;
+      for (lno_t i = 0; i < nv; ++i){
+        initial_norm += Kokkos::Details::ArithTraits<scalar_t>::abs(h_solution_x(i, j)) *
+                        Kokkos::Details::ArithTraits<scalar_t>::abs(h_solution_x(i, j));
+        mag_t diff = Kokkos::Details::ArithTraits<scalar_t>::abs(h_solution_x(i, j) - h_x(i, j));
+        result_norm += diff * diff;
+      }
+      EXPECT_TRUE( (result_norm < initial_norm));
+    }
+  }
+}
+
+
+
+//multiple right hand sides are not explicitly instantiated.
+#if !defined(KOKKOSKERNELS_ETI_ONLY)
+#define EXECUTE_MULTIVECTOR_TEST(SCALAR, ORDINAL, OFFSET, DEVICE) \
+TEST_F( TestCategory, sparse ## _ ## gauss_seidel_multivector ## _ ## SCALAR ## _ ## ORDINAL ## _ ## OFFSET ## _ ## DEVICE ) { \
+  test_gauss_seidel_multivector<SCALAR,ORDINAL,OFFSET,DEVICE>(2000, 2000 * 20, 200, 10, 8); \
+}
+#else
+#define EXECUTE_MULTIVECTOR_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)
+#endif
 
 #define EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE) \
 TEST_F( TestCategory, sparse ## _ ## gauss_seidel ## _ ## SCALAR ## _ ## ORDINAL ## _ ## OFFSET ## _ ## DEVICE ) { \
   test_gauss_seidel<SCALAR,ORDINAL,OFFSET,DEVICE>(10000, 10000 * 30, 200, 10); \
-}
+} \
+EXECUTE_MULTIVECTOR_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)
 
 
 #if (defined (KOKKOSKERNELS_INST_DOUBLE) \